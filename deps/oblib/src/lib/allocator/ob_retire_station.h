@@ -26,6 +26,13 @@ class QClock
 {
 public:
   enum { MAX_QCLOCK_SLOT_NUM = OB_MAX_CPU_NUM * 64 };
+  // Slots of adjacent thread ids are striped across cache lines, so that readers
+  // entering critical section concurrently never write the same cache line.
+  enum
+  {
+    SLOT_NUM_PER_LINE = CACHE_ALIGN_SIZE / sizeof(uint64_t),
+    SLOT_LINE_NUM = MAX_QCLOCK_SLOT_NUM / SLOT_NUM_PER_LINE
+  };
   struct ClockSlot
   {
     ClockSlot(): clock_(UINT64_MAX) {}
@@ -83,7 +90,11 @@ private:
   }
 private:
   uint64_t get_slot_id() { return get_itid(); }
-  ClockSlot* locate(uint64_t id) { return clock_array_ + (id % MAX_QCLOCK_SLOT_NUM); }
+  ClockSlot* locate(uint64_t id)
+  {
+    id = id % MAX_QCLOCK_SLOT_NUM;
+    return clock_array_ + (id % SLOT_LINE_NUM) * SLOT_NUM_PER_LINE + id / SLOT_LINE_NUM;
+  }
   uint64_t inc_clock() { return ATOMIC_AAF(&clock_, 1); }
   uint64_t get_clock() { return ATOMIC_LOAD(&clock_); }
   uint64_t get_qclock() { return ATOMIC_LOAD(&qclock_); }
@@ -93,8 +104,9 @@ private:
   }
   uint64_t calc_quiescent_clock(uint64_t cur_clock) {
     uint64_t qclock = cur_clock;
+    // scan in memory order, the striped layout only matters to enter/leave_critical
     for(int64_t i = 0; i < MAX_QCLOCK_SLOT_NUM; i++){
-      uint64_t tclock = locate(i)->load_clock();
+      uint64_t tclock = clock_array_[i].load_clock();
       if (tclock < qclock) {
         qclock = tclock;
       }
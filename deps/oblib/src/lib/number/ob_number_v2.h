@@ -537,16 +537,26 @@ public:
   // multiplication fast path entrance
   OB_INLINE static bool try_fast_mul(ObNumber &l_num, ObNumber &r_num,
                                      uint32_t *res_digit, Desc &res_desc);
-  // 2 posivtive number sum fast path
-  // formular format: a(1 digit number) + b(1 digit number):
-  //  - a range: [1, 999999999] or 0.[000000001, 999999999]
-  //  - b range: [1, 999999999] or 0.[000000001, 999999999]
+  // fixed-point representation of short numbers:
+  //  - numbers of 1 integer digit, 1 fragment digit, or 1 integer digit and 1 fragment digit,
+  //    i.e. range (-999999999.999999999, 999999999.999999999) with at most 9 decimal digits
+  //  - value is the number in unit of 1 / BASE, which is int64 and never overflows after one
+  //    addition or subtraction
+  OB_INLINE static bool try_get_fixed_point(const Desc &desc, const uint32_t *digits,
+                                            int64_t &value);
+  // value should be in range (-BASE^3, BASE^3) and non zero
+  OB_INLINE static void fixed_point_to_number(const int64_t value,
+                                              uint32_t *res_digit, Desc &res_desc);
+  // sum fast path of 2 numbers both in fixed-point representation
+  // formular format: a(1 or 2 digits number) + b(1 or 2 digits number):
+  //  - a range: [-999999999.999999999, 999999999.999999999]
+  //  - b range: [-999999999.999999999, 999999999.999999999]
   OB_INLINE static bool try_fast_add(ObNumber &l_num, ObNumber &r_num,
                                      uint32_t *res_digit, Desc &res_desc);
-  // 2 posivtive number minus fast path
-  // formular format: a(1 digit integer ) - b(1 digit decimal):
-  //  - a range: [1, 999999999]
-  //  - b range: 0.[000000001, 999999999]
+  // minus fast path of 2 numbers both in fixed-point representation
+  // formular format: a(1 or 2 digits number) - b(1 or 2 digits number):
+  //  - a range: [-999999999.999999999, 999999999.999999999]
+  //  - b range: [-999999999.999999999, 999999999.999999999]
   OB_INLINE static bool try_fast_minus(ObNumber &l_num, ObNumber &r_num,
                                      uint32_t *res_digit, Desc &res_desc);
 
@@ -3438,65 +3448,85 @@ OB_INLINE bool ObNumber::try_fast_mul(ObNumber &l_num, ObNumber &r_num,
   return is_fast_panel;
 }
 
-OB_INLINE bool ObNumber::try_fast_add(ObNumber &l_num, ObNumber &r_num,
-                                      uint32_t *res_digit, Desc &res_desc)
+OB_INLINE bool ObNumber::try_get_fixed_point(const Desc &desc, const uint32_t *digits,
+                                             int64_t &value)
 {
-  bool is_fast_panel = true;
-  uint32_t sum_frag_val = 0;
-  uint32_t sum_int_val = 0;
-
-  if (l_num.d_.is_1d_positive_integer()) {
-    sum_int_val = l_num.get_digits()[0];
-  } else if (l_num.d_.is_1d_positive_fragment()) {
-    sum_frag_val = l_num.get_digits()[0];
-  } else {
-    is_fast_panel = false;
+  bool is_fixed_point = true;
+  switch (desc.desc_) {
+    case NUM_DESC_1DIGIT_POSITIVE_INTEGER: {
+      value = static_cast<int64_t>(digits[0]) * static_cast<int64_t>(BASE);
+      break;
+    }
+    case NUM_DESC_1DIGIT_POSITIVE_FRAGMENT: {
+      value = static_cast<int64_t>(digits[0]);
+      break;
+    }
+    case NUM_DESC_2DIGITS_POSITIVE_DECIMAL: {
+      value = static_cast<int64_t>(digits[0]) * static_cast<int64_t>(BASE) + digits[1];
+      break;
+    }
+    case NUM_DESC_1DIGIT_NEGATIVE_INTEGER: {
+      value = -static_cast<int64_t>(digits[0]) * static_cast<int64_t>(BASE);
+      break;
+    }
+    case NUM_DESC_1DIGIT_NEGATIVE_FRAGMENT: {
+      value = -static_cast<int64_t>(digits[0]);
+      break;
+    }
+    case NUM_DESC_2DIGITS_NEGATIVE_DECIMAL: {
+      value = -(static_cast<int64_t>(digits[0]) * static_cast<int64_t>(BASE) + digits[1]);
+      break;
+    }
+    default: {
+      is_fixed_point = false;
+      break;
+    }
   }
-
-  if (r_num.d_.is_1d_positive_integer()) {
-    sum_int_val += r_num.get_digits()[0];
-  } else if (r_num.d_.is_1d_positive_fragment()) {
-    sum_frag_val += r_num.get_digits()[0];
+  return is_fixed_point;
+}
+
+OB_INLINE void ObNumber::fixed_point_to_number(const int64_t value,
+                                               uint32_t *res_digit, Desc &res_desc)
+{
+  const bool is_neg = (value < 0);
+  const uint64_t abs_val = is_neg ? static_cast<uint64_t>(-value) : static_cast<uint64_t>(value);
+  const uint32_t frag_val = static_cast<uint32_t>(abs_val % BASE);
+  const uint32_t int_val = static_cast<uint32_t>((abs_val / BASE) % BASE);
+  const uint32_t carry = static_cast<uint32_t>(abs_val / BASE / BASE);
+  // exp of the highest digit: 1 for carry, 0 for integer and -1 for fragment
+  int32_t exp = 0;
+  res_desc.desc_ = is_neg ? NUM_DESC_1DIGIT_NEGATIVE_INTEGER : NUM_DESC_1DIGIT_POSITIVE_INTEGER;
+  if (carry > 0) {
+    exp = 1;
+    res_desc.len_ = 3 - (0 == frag_val) - (0 == frag_val && 0 == int_val);
+    // performance critical: set the tailing digits even they are 0, no overflow risk
+    res_digit[0] = carry;
+    res_digit[1] = int_val;
+    res_digit[2] = frag_val;
+  } else if (int_val > 0) {
+    res_desc.len_ = 2 - (0 == frag_val);
+    res_digit[0] = int_val;
+    res_digit[1] = frag_val;
   } else {
-    is_fast_panel = false;
-  }
-
-  if (is_fast_panel) {
-    // generate res_desc
-    res_desc.len_ = 2;
-    res_desc.exp_ = common::max(l_num.d_.exp_, r_num.d_.exp_);
-    auto carry = 0;
-    if (sum_frag_val >= BASE) {
-      carry = 1;
-      sum_frag_val -= BASE;
-    }
-
-    res_desc.len_ -= (sum_frag_val == 0);
-    sum_int_val += carry;
-    if (sum_int_val >= BASE) {
-      sum_int_val -= BASE;
-      res_desc.len_ -= (sum_int_val == 0 && sum_frag_val == 0);
-      res_desc.exp_++;
-      res_desc.len_++;
-      res_digit[0] = 1;
-      res_digit[1] = sum_int_val;
-      res_digit[2] = sum_frag_val; // set by default, no zero check
-    } else {
-      if (sum_int_val) {
-        res_digit[0] = sum_int_val;
-        res_digit[1] = sum_frag_val; // set by default, no zero check
-        if (sum_int_val == carry && carry == 1) {
-          res_desc.exp_++;
-        }
-      } else {
-        res_digit[0] = sum_frag_val;
-        res_desc.len_--;
-      }
-    }
-    res_desc.sign_ = POSITIVE;
-    res_desc.reserved_ = 0; // must assign 0 explicitly here, due to optimization in sql.
+    exp = -1;
+    res_digit[0] = frag_val;
   }
+  // exp of negative number is stored inverted
+  res_desc.exp_ = static_cast<uint8_t>(res_desc.exp_ + (is_neg ? -exp : exp));
+}
 
+OB_INLINE bool ObNumber::try_fast_add(ObNumber &l_num, ObNumber &r_num,
+                                      uint32_t *res_digit, Desc &res_desc)
+{
+  bool is_fast_panel = false;
+  int64_t l_val = 0;
+  int64_t r_val = 0;
+  if (try_get_fixed_point(l_num.d_, l_num.get_digits(), l_val)
+      && try_get_fixed_point(r_num.d_, r_num.get_digits(), r_val)
+      && 0 != l_val + r_val) {
+    fixed_point_to_number(l_val + r_val, res_digit, res_desc);
+    is_fast_panel = true;
+  }
   return is_fast_panel;
 }
 
@@ -3504,31 +3534,13 @@ OB_INLINE bool ObNumber::try_fast_minus(ObNumber &l_num, ObNumber &r_num,
                                       uint32_t *res_digit, Desc &res_desc)
 {
   bool is_fast_panel = false;
-  uint64_t res_frag_val = 0;
-  uint64_t res_int_val = 0;
-  uint64_t carry = BASE;
-
-  // TODO qubin.qb: support more sophisticated cases in further release.
-  // E.G: minus between positive integer(2 - 1) or  postive decimal(e.g: 1.32 - 1.1).
-  // So far only support cases like 2 - 0.3
-  if (l_num.d_.is_1d_positive_integer() && r_num.d_.is_1d_positive_fragment()) {
+  int64_t l_val = 0;
+  int64_t r_val = 0;
+  if (try_get_fixed_point(l_num.d_, l_num.get_digits(), l_val)
+      && try_get_fixed_point(r_num.d_, r_num.get_digits(), r_val)
+      && l_val != r_val) {
+    fixed_point_to_number(l_val - r_val, res_digit, res_desc);
     is_fast_panel = true;
-    res_int_val = l_num.get_digits()[0] - 1;
-    res_frag_val = carry - r_num.get_digits()[0];
-    res_desc.desc_ = NUM_DESC_2DIGITS_POSITIVE_DECIMAL;
-  }
-
-  if (is_fast_panel) {
-    if (res_int_val == 0) {
-      res_desc.exp_--;
-      res_desc.len_--;
-      res_digit[0] = static_cast<uint32_t> (res_frag_val);
-    } else {
-      res_digit[0] = static_cast<uint32_t> (res_int_val);
-      res_digit[1] = static_cast<uint32_t> (res_frag_val);
-    }
-    res_desc.len_ -= (res_frag_val == 0);
-    res_desc.reserved_ = 0;
   }
   return is_fast_panel;
 }
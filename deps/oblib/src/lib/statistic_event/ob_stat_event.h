@@ -273,6 +273,15 @@ STAT_EVENT_ADD_DEF(BLOCKSCAN_BLOCK_CNT, "blockscaned data micro block count", Ob
 STAT_EVENT_ADD_DEF(BLOCKSCAN_ROW_CNT, "blockscaned row count", ObStatClassIds::STORAGE, "blockscaned row count", 60089, false, true)
 STAT_EVENT_ADD_DEF(PUSHDOWN_STORAGE_FILTER_ROW_CNT, "storage filtered row count", ObStatClassIds::STORAGE, "storage filter row count", 60090, false, true)
 
+STAT_EVENT_ADD_DEF(TMP_FILE_WRITE_COUNT, "tmp file write count", ObStatClassIds::STORAGE, "tmp file write count", 60091, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_WRITE_BYTES, "tmp file write bytes", ObStatClassIds::STORAGE, "tmp file write bytes", 60092, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_WRITE_TIME, "tmp file write time", ObStatClassIds::STORAGE, "tmp file write time", 60093, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_READ_COUNT, "tmp file read count", ObStatClassIds::STORAGE, "tmp file read count", 60094, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_READ_BYTES, "tmp file read bytes", ObStatClassIds::STORAGE, "tmp file read bytes", 60095, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_READ_WAIT_TIME, "tmp file read wait time", ObStatClassIds::STORAGE, "tmp file read wait time", 60096, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_FLUSH_COUNT, "tmp file flush block count", ObStatClassIds::STORAGE, "tmp file flush block count", 60097, false, true)
+STAT_EVENT_ADD_DEF(TMP_FILE_FLUSH_BYTES, "tmp file flush block bytes", ObStatClassIds::STORAGE, "tmp file flush block bytes", 60098, false, true)
+
 // backup & restore
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_COUNT, "backup io read count", ObStatClassIds::STORAGE, "backup io read count", 69000, true, true)
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_BYTES, "backup io read bytes", ObStatClassIds::STORAGE, "backup io read bytes", 69001, true, true)
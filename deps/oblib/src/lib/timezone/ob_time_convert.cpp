@@ -2573,6 +2573,63 @@ int ObTimeConverter::datetime_to_ob_time(int64_t value, const ObTimeZoneInfo *tz
   return ret;
 }
 
+int ObDatetimeBatchConverter::add_timezone_offset(int64_t &value)
+{
+  int ret = OB_SUCCESS;
+  if (NULL != tz_info_) {
+    const int64_t utc_sec = USEC_TO_SEC(value);
+    if (utc_sec < lower_time_ || utc_sec >= upper_time_) {
+      if (OB_FAIL(tz_info_->get_timezone_offset_range(utc_sec, offset_sec_,
+                                                      lower_time_, upper_time_))) {
+        lower_time_ = INT64_MAX;
+        upper_time_ = INT64_MIN;
+        LOG_WARN("failed to get offset between utc and local", K(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      value += SEC_TO_USEC(offset_sec_);
+    }
+  }
+  return ret;
+}
+
+int ObDatetimeBatchConverter::datetime_to_ob_time(const int64_t value, ObTime &ob_time)
+{
+  int ret = OB_SUCCESS;
+  int64_t usec = value;
+  if (OB_UNLIKELY(ObTimeConverter::ZERO_DATETIME == usec)) {
+    MEMSET(ob_time.parts_, 0, sizeof(*ob_time.parts_) * TOTAL_PART_CNT);
+    ob_time.parts_[DT_DATE] = ObTimeConverter::ZERO_DATE;
+  } else if (OB_FAIL(add_timezone_offset(usec))) {
+    LOG_WARN("failed to adjust value with time zone offset", K(ret));
+  } else {
+    int32_t days = static_cast<int32_t>(usec / USECS_PER_DAY);
+    usec %= USECS_PER_DAY;
+    if (OB_UNLIKELY(usec < 0)) {
+      --days;
+      usec += USECS_PER_DAY;
+    }
+    if (days == date_ && ObTimeConverter::ZERO_DATE != days) {
+      ob_time.parts_[DT_YEAR] = date_parts_[DT_YEAR];
+      ob_time.parts_[DT_MON] = date_parts_[DT_MON];
+      ob_time.parts_[DT_MDAY] = date_parts_[DT_MDAY];
+      ob_time.parts_[DT_DATE] = date_parts_[DT_DATE];
+      ob_time.parts_[DT_YDAY] = date_parts_[DT_YDAY];
+      ob_time.parts_[DT_WDAY] = date_parts_[DT_WDAY];
+    } else if (OB_FAIL(ObTimeConverter::date_to_ob_time(days, ob_time))) {
+      LOG_WARN("failed to convert date part to obtime", K(ret), K(days));
+    } else {
+      date_ = days;
+      MEMCPY(date_parts_, ob_time.parts_, sizeof(date_parts_));
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(ObTimeConverter::time_to_ob_time(usec, ob_time))) {
+      LOG_WARN("failed to convert time part to obtime", K(ret), K(usec));
+    }
+  }
+  return ret;
+}
+
 int ObTimeConverter::otimestamp_to_ob_time(const ObObjType type, const ObOTimestampData &ot_data,
     const ObTimeZoneInfo *tz_info, ObTime &ob_time, const bool store_utc_time /*true*/)
 {
@@ -685,6 +685,40 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObTimeConverter);
 };
 
+// Converts datetime values of one batch to ObTime. Values of a batch are usually close to each
+// other, so the timezone offset is reused while the value is in the same transition range, and
+// the date parts are reused while the value is in the same local day, which saves the transition
+// lookup and the year/month computation of most values.
+class ObDatetimeBatchConverter
+{
+public:
+  explicit ObDatetimeBatchConverter(const ObTimeZoneInfo *tz_info)
+    : tz_info_(tz_info),
+      offset_sec_(0),
+      lower_time_(INT64_MAX),
+      upper_time_(INT64_MIN),
+      date_(ObTimeConverter::ZERO_DATE)
+  {
+    MEMSET(date_parts_, 0, sizeof(date_parts_));
+  }
+  ~ObDatetimeBatchConverter() {}
+  // same as ObTimeConverter::datetime_to_ob_time(value, tz_info_, ob_time)
+  int datetime_to_ob_time(const int64_t value, ObTime &ob_time);
+  TO_STRING_KV(KP_(tz_info), K_(offset_sec), K_(lower_time), K_(upper_time), K_(date));
+private:
+  int add_timezone_offset(int64_t &value);
+private:
+  const ObTimeZoneInfo *tz_info_;
+  // offset of utc time second range [lower_time_, upper_time_)
+  int32_t offset_sec_;
+  int64_t lower_time_;
+  int64_t upper_time_;
+  // date parts of local day date_, ZERO_DATE means nothing cached
+  int32_t date_;
+  int32_t date_parts_[TOTAL_PART_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObDatetimeBatchConverter);
+};
+
 enum ObNLSFormatEnum {
   NLS_DATE = 0,
   NLS_TIMESTAMP,
@@ -39148,6 +39148,19 @@ int ObTimeZoneInfo::get_timezone_offset(int64_t value, int32_t &offset_sec,
   return ret;
 }
 
+int ObTimeZoneInfo::get_timezone_offset_range(int64_t value, int32_t &offset_sec,
+    int64_t &lower_time, int64_t &upper_time) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(get_timezone_offset(value, offset_sec))) {
+    LOG_WARN("fail to get timezone offset", K(ret), K(value));
+  } else {
+    lower_time = INT64_MIN;
+    upper_time = INT64_MAX;
+  }
+  return ret;
+}
+
 int ObTimeZoneInfo::timezone_to_str(char *buf, const int64_t buf_len, int64_t &pos) const
 {
   int ret = OB_SUCCESS;
@@ -39501,6 +39514,34 @@ int ObTimeZoneInfoPos::get_timezone_offset(int64_t value, int32_t &offset_sec) c
   return get_timezone_offset(value, offset_sec, tz_abbr_str, tran_type_id);
 }
 
+int ObTimeZoneInfoPos::get_timezone_offset_range(int64_t value, int32_t &offset_sec,
+    int64_t &lower_time, int64_t &upper_time) const
+{
+  int ret = OB_SUCCESS;
+  const common::ObSArray<ObTZTransitionTypeInfo> &tz_tran_types = get_tz_tran_types();
+  int64_t type_cnt = tz_tran_types.count();
+  int64_t type_idx = 0;
+  if (OB_UNLIKELY(false == is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tz info is invalid", K(ret));
+  } else if (0 == type_cnt
+      || value < tz_tran_types.at(0).lower_time_) {
+    offset_sec = default_type_.info_.offset_sec_;
+    lower_time = INT64_MIN;
+    upper_time = (0 == type_cnt) ? INT64_MAX : tz_tran_types.at(0).lower_time_;
+  } else if (OB_FAIL(find_time_range(value, tz_tran_types, type_idx))) {
+    LOG_WARN("fail to find time range", K(ret));
+  } else if (OB_UNLIKELY(type_idx < 0 || type_idx >= type_cnt)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected type idx", K(type_idx), K(tz_tran_types), K(ret));
+  } else {
+    offset_sec = tz_tran_types.at(type_idx).info_.offset_sec_;
+    lower_time = tz_tran_types.at(type_idx).lower_time_;
+    upper_time = (type_idx + 1 < type_cnt) ? tz_tran_types.at(type_idx + 1).lower_time_ : INT64_MAX;
+  }
+  return ret;
+}
+
 int ObTimeZoneInfoPos::find_offset_range(const int32_t tran_type_id,
     const common::ObIArray<ObTZTransitionTypeInfo> &tz_tran_types, int64_t &type_idx) const
 {
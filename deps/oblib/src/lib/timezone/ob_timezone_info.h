@@ -268,6 +268,12 @@ public:
                                   int32_t &offset_sec,
                                   common::ObString &tz_abbr_str,
                                   int32_t &tran_type_id) const;
+  // get offset of utc time second value, and the utc time second range [lower_time, upper_time)
+  // in which the offset keeps unchanged, so that the offset can be reused by the values in range.
+  virtual int get_timezone_offset_range(int64_t value,
+                                        int32_t &offset_sec,
+                                        int64_t &lower_time,
+                                        int64_t &upper_time) const;
   virtual int timezone_to_str(char *buf, const int64_t len, int64_t &pos) const;
   void reset()
   {
@@ -509,6 +515,10 @@ public:
                           common::ObString &tz_abbr_str,
                           int32_t &offset_sec) const;
   virtual int get_timezone_offset(int64_t value, int32_t &offset_sec) const;
+  virtual int get_timezone_offset_range(int64_t value,
+                                        int32_t &offset_sec,
+                                        int64_t &lower_time,
+                                        int64_t &upper_time) const;
   // get_timezone_sub_offset is used to get timezone offset at specified local time and position.
   // First parameter is local time second value.
   virtual int get_timezone_sub_offset(int64_t value,
@@ -520,6 +520,7 @@ class EventTable
       EN_BACKUP_DELETE_EXCEPTION_HANDLING = 245,
       EN_SORT_IMPL_FORCE_DO_DUMP = 246,
       EN_ENFORCE_PUSH_DOWN_WF = 247,
+      EN_PARALLEL_SORT_ALLOC_PHASE = 248,
       //
       EN_TRANS_SHARED_LOCK_CONFLICT = 250,
       EN_HASH_JOIN_OPTION = 251,
@@ -548,6 +549,7 @@ class EventTable
       EN_CLOG_SW_OUT_OF_RANGE = 272,
       EN_DFC_FACTOR = 273,
       EN_LOGSERVICE_IO_TIMEOUT = 274,
+      EN_LOGSERVICE_GROUP_SYNC_FAILED = 279,
 
       EN_PARTICIPANTS_SIZE_OVERFLOW = 275,
       EN_UNDO_ACTIONS_SIZE_OVERFLOW = 276,
@@ -16,6 +16,7 @@
 #include "rpc/frame/ob_req_transport.h"
 #include "rpc/ob_request.h"
 #include "rpc/obrpc/ob_poc_rpc_server.h"
+#include "lib/container/ob_iarray.h"
 
 extern "C" {
 #include "rpc/pnio/interface/group.h"
@@ -111,10 +112,7 @@ public:
     int sys_err = 0;
     int ret = common::OB_SUCCESS;
     const int64_t start_ts = common::ObTimeUtility::current_time();
-    int64_t src_tenant_id = ob_get_tenant_id();
-    if (get_proxy_group_id(proxy) == ObPocServerHandleContext::OBCG_ELECTION) {
-      src_tenant_id = OB_SERVER_TENANT_ID;
-    }
+    const int64_t src_tenant_id = get_src_tenant_id(proxy);
     auto &set = obrpc::ObRpcPacketSet::instance();
     const char* pcode_label = set.name_of_idx(set.idx_of_pcode(pcode));
     ObRpcMemPool pool(src_tenant_id, pcode_label);
@@ -169,20 +167,10 @@ public:
   }
   template<typename Input, typename UCB>
   int post(ObRpcProxy& proxy, const common::ObAddr& addr, ObRpcPacketCode pcode, const Input& args, UCB* ucb, const ObRpcOpts& opts) {
-    int sys_err = 0;
     int ret = common::OB_SUCCESS;
     const int64_t start_ts = common::ObTimeUtility::current_time();
     ObRpcMemPool* pool = NULL;
-    uint64_t pnio_group_id = ObPocRpcServer::DEFAULT_PNIO_GROUP;
-    // TODO:@fangwu.lcc map proxy.group_id_ to pnio_group_id
-    if (OB_LS_FETCH_LOG2 == pcode) {
-      pnio_group_id = ObPocRpcServer::RATELIMIT_PNIO_GROUP;
-    }
-    uint8_t thread_id = balance_assign_tidx();
-    int64_t src_tenant_id = ob_get_tenant_id();
-    if (get_proxy_group_id(proxy) == ObPocServerHandleContext::OBCG_ELECTION) {
-      src_tenant_id = OB_SERVER_TENANT_ID;
-    }
+    const int64_t src_tenant_id = get_src_tenant_id(proxy);
 #ifndef PERF_MODE
     const int init_alloc_sz = 0;
 #else
@@ -193,37 +181,12 @@ public:
     if (NULL == (pool = ObRpcMemPool::create(src_tenant_id, pcode_label, init_alloc_sz))) {
       ret = common::OB_ALLOCATE_MEMORY_FAILED;
     } else {
-      ObAsyncRespCallback* cb = NULL;
       char* req = NULL;
       int64_t req_sz = 0;
       if (OB_FAIL(rpc_encode_req(proxy, *pool, pcode, args, opts, req, req_sz, NULL == ucb))) {
         RPC_LOG(WARN, "rpc encode req fail", K(ret));
-      } else if(OB_FAIL(check_blacklist(addr))) {
-        RPC_LOG(WARN, "check_blacklist failed", K(addr));
-      } else if (NULL == (cb = ObAsyncRespCallback::create(*pool, ucb))) {
-        ret = common::OB_ALLOCATE_MEMORY_FAILED;
       } else {
-        auto newcb = reinterpret_cast<UCB*>(cb->get_ucb());
-        if (newcb) {
-          set_ucb_args(newcb, args);
-          init_ucb(proxy, cb->get_ucb(), addr, start_ts, req_sz);
-        }
-      }
-      if (OB_SUCC(ret)) {
-        sockaddr_in sock_addr;
-        if (0 != (sys_err = pn_send(
-            (pnio_group_id<<32) + thread_id,
-            obaddr2sockaddr(&sock_addr, addr),
-            req,
-            req_sz,
-            static_cast<int16_t>(set.idx_of_pcode(pcode)),
-            start_ts + get_proxy_timeout(proxy),
-            ObAsyncRespCallback::client_cb,
-            cb)
-            )) {
-          ret = translate_io_error(sys_err);
-          RPC_LOG(WARN, "pn_send fail", K(sys_err), K(ret));
-        }
+        ret = post_encoded_req(proxy, addr, pcode, args, ucb, *pool, req, req_sz, start_ts);
       }
     }
     if (common::OB_SUCCESS != ret && NULL != pool) {
@@ -231,6 +194,48 @@ public:
     }
     return ret;
   }
+  // Post the same request to every server of %addrs. pn_send copies the request into
+  // the send queue of pnio, so the request is encoded only once and shared by all
+  // servers, only the pool of response callback is created for each server.
+  // return the last error, servers after a failed one are still posted.
+  template<typename Input, typename UCB>
+  int post_to_servers(ObRpcProxy& proxy, const common::ObIArray<common::ObAddr>& addrs, ObRpcPacketCode pcode, const Input& args, UCB* ucb, const ObRpcOpts& opts) {
+    int ret = common::OB_SUCCESS;
+#ifdef PERF_MODE
+    // pnio sends the request buffer in place, it can not be shared
+    for (int64_t i = 0; i < addrs.count(); i++) {
+      int tmp_ret = common::OB_SUCCESS;
+      if (common::OB_SUCCESS != (tmp_ret = post(proxy, addrs.at(i), pcode, args, ucb, opts))) {
+        ret = tmp_ret;
+      }
+    }
+#else
+    const int64_t start_ts = common::ObTimeUtility::current_time();
+    const int64_t src_tenant_id = get_src_tenant_id(proxy);
+    auto &set = obrpc::ObRpcPacketSet::instance();
+    const char* pcode_label = set.name_of_idx(set.idx_of_pcode(pcode));
+    ObRpcMemPool encode_pool(src_tenant_id, pcode_label);
+    char* req = NULL;
+    int64_t req_sz = 0;
+    if (OB_FAIL(rpc_encode_req(proxy, encode_pool, pcode, args, opts, req, req_sz, NULL == ucb))) {
+      RPC_LOG(WARN, "rpc encode req fail", K(ret));
+    } else {
+      for (int64_t i = 0; i < addrs.count(); i++) {
+        int tmp_ret = common::OB_SUCCESS;
+        ObRpcMemPool* pool = NULL;
+        if (NULL == (pool = ObRpcMemPool::create(src_tenant_id, pcode_label, 0))) {
+          tmp_ret = common::OB_ALLOCATE_MEMORY_FAILED;
+        } else if (common::OB_SUCCESS != (tmp_ret = post_encoded_req(proxy, addrs.at(i), pcode, args, ucb, *pool, req, req_sz, start_ts))) {
+          pool->destroy();
+        }
+        if (common::OB_SUCCESS != tmp_ret) {
+          ret = tmp_ret;
+        }
+      }
+    }
+#endif
+    return ret;
+  }
 
   static struct sockaddr_in* obaddr2sockaddr(struct sockaddr_in *sin, const ObAddr& addr)
   {
@@ -242,6 +247,56 @@ public:
     return sin;
   }
   int log_user_error_and_warn(const ObRpcResultCode &rcode) const;
+private:
+  static int64_t get_src_tenant_id(ObRpcProxy& proxy)
+  {
+    int64_t src_tenant_id = ob_get_tenant_id();
+    if (get_proxy_group_id(proxy) == ObPocServerHandleContext::OBCG_ELECTION) {
+      src_tenant_id = OB_SERVER_TENANT_ID;
+    }
+    return src_tenant_id;
+  }
+  // send the encoded %req to %addr, the response callback is created in %pool,
+  // which is released by the callback once pn_send succeeds.
+  template<typename Input, typename UCB>
+  int post_encoded_req(ObRpcProxy& proxy, const common::ObAddr& addr, ObRpcPacketCode pcode, const Input& args, UCB* ucb,
+                       ObRpcMemPool& pool, const char* req, const int64_t req_sz, const int64_t start_ts) {
+    int sys_err = 0;
+    int ret = common::OB_SUCCESS;
+    ObAsyncRespCallback* cb = NULL;
+    uint64_t pnio_group_id = ObPocRpcServer::DEFAULT_PNIO_GROUP;
+    // TODO:@fangwu.lcc map proxy.group_id_ to pnio_group_id
+    if (OB_LS_FETCH_LOG2 == pcode) {
+      pnio_group_id = ObPocRpcServer::RATELIMIT_PNIO_GROUP;
+    }
+    auto &set = obrpc::ObRpcPacketSet::instance();
+    if (OB_FAIL(check_blacklist(addr))) {
+      RPC_LOG(WARN, "check_blacklist failed", K(addr));
+    } else if (NULL == (cb = ObAsyncRespCallback::create(pool, ucb))) {
+      ret = common::OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      auto newcb = reinterpret_cast<UCB*>(cb->get_ucb());
+      if (newcb) {
+        set_ucb_args(newcb, args);
+        init_ucb(proxy, cb->get_ucb(), addr, start_ts, req_sz);
+      }
+      sockaddr_in sock_addr;
+      if (0 != (sys_err = pn_send(
+          (pnio_group_id<<32) + balance_assign_tidx(),
+          obaddr2sockaddr(&sock_addr, addr),
+          req,
+          req_sz,
+          static_cast<int16_t>(set.idx_of_pcode(pcode)),
+          start_ts + get_proxy_timeout(proxy),
+          ObAsyncRespCallback::client_cb,
+          cb)
+          )) {
+        ret = translate_io_error(sys_err);
+        RPC_LOG(WARN, "pn_send fail", K(sys_err), K(ret), K(addr));
+      }
+    }
+    return ret;
+  }
 };
 
 extern ObPocClientStub global_poc_client;
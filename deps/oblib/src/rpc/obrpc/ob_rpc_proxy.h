@@ -19,6 +19,7 @@
 #include "lib/compress/ob_compressor_pool.h"
 #include "lib/utility/ob_unify_serialize.h"
 #include "lib/net/ob_addr.h"
+#include "lib/container/ob_iarray.h"
 #include "lib/runtime.h"
 #include "rpc/frame/ob_req_transport.h"
 #include "rpc/obrpc/ob_rpc_packet.h"
@@ -236,6 +237,12 @@ protected:
   int rpc_post(ObRpcPacketCode pcode,
                rpc::frame::ObReqTransport::AsyncCB *cb,
                const ObRpcOpts &opts);
+  // post the same request to all %dsts, with pkt-nio the request is encoded only once
+  template <class pcodeStruct>
+  int rpc_post_to_servers(const common::ObIArray<common::ObAddr> &dsts,
+                          const typename pcodeStruct::Request &args,
+                          AsyncCB<pcodeStruct> *cb,
+                          const ObRpcOpts &opts);
 
 private:
   int send_request(
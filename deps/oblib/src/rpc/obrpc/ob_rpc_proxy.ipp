@@ -694,6 +694,38 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
   return ret;
 }
 
+template <class pcodeStruct>
+int ObRpcProxy::rpc_post_to_servers(const common::ObIArray<common::ObAddr> &dsts,
+                                    const typename pcodeStruct::Request &args,
+                                    AsyncCB<pcodeStruct> *cb,
+                                    const ObRpcOpts &opts)
+{
+  using namespace oceanbase::common;
+  int ret = OB_SUCCESS;
+  UNIS_VERSION_GUARD(opts.unis_version_);
+
+  if (!init_) {
+    ret = OB_NOT_INIT;
+    RPC_OBRPC_LOG(WARN, "rpc not inited", K(ret));
+  } else if (!active_) {
+    ret = OB_INACTIVE_RPC_PROXY;
+    RPC_OBRPC_LOG(WARN, "rpc is inactive", K(ret));
+  } else if (transport_impl_ == rpc::ObRequest::TRANSPORT_PROTO_POC && global_poc_server.client_use_pkt_nio()) {
+    ret = global_poc_client.post_to_servers(*this, dsts, pcodeStruct::PCODE, args, cb, opts);
+  } else {
+    // the request is encoded for each server by easy
+    for (int64_t i = 0; i < dsts.count(); i++) {
+      int tmp_ret = OB_SUCCESS;
+      set_server(dsts.at(i));
+      if (OB_SUCCESS != (tmp_ret = rpc_post<pcodeStruct>(args, cb, opts))) {
+        RPC_OBRPC_LOG(WARN, "post packet fail", K(tmp_ret), "dst", dsts.at(i));
+        ret = tmp_ret;
+      }
+    }
+  }
+  return ret;
+}
+
 
 
 
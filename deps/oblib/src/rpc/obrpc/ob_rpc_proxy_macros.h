@@ -174,20 +174,33 @@
     return name##_(args, cb, opts);          \
   }
 
+#define OB_RPC_ASYNC_OPTS(newopts, opts, prio)                          \
+  const static ObRpcPriority PR = prio;                                 \
+  ObRpcOpts newopts = opts;                                             \
+  if (newopts.pr_ == ORPR_UNDEF) {                                      \
+    newopts.pr_ = PR;                                                   \
+  }                                                                     \
+  newopts.ssl_invited_nodes_ = GCONF._ob_ssl_invited_nodes.get_value_string(); \
+  newopts.local_addr_ = GCTX.self_addr()
+
+// name##_to_servers_ posts the same request to all %dsts, it is a template
+// so that it is only instantiated by the rpc which uses it.
 #define OB_DEFINE_RPC_ASYNC(name, pcode, prio, Input, Output)             \
   OB_DEFINE_RPC_STRUCT(pcode, Input, Output);                           \
   int name##_(const Input& args, ORACB_(pcode), OROP_)                   \
   {                                                                     \
-    const static ObRpcPriority PR = prio;                               \
     int ret = common::OB_SUCCESS;                                       \
-    ObRpcOpts newopts = opts;                                           \
-    if (newopts.pr_ == ORPR_UNDEF) {                                    \
-      newopts.pr_ = PR;                                                 \
-    }                                                                   \
-    newopts.ssl_invited_nodes_ = GCONF._ob_ssl_invited_nodes.get_value_string(); \
-    newopts.local_addr_ = GCTX.self_addr();                             \
+    OB_RPC_ASYNC_OPTS(newopts, opts, prio);                             \
     ret = rpc_post<ObRpc<pcode>>(args, cb, newopts);                    \
     return ret;                                                         \
+  }                                                                     \
+  template <typename AddrArray>                                         \
+  int name##_to_servers_(const AddrArray& dsts, const Input& args, ORACB_(pcode), OROP_) \
+  {                                                                     \
+    int ret = common::OB_SUCCESS;                                       \
+    OB_RPC_ASYNC_OPTS(newopts, opts, prio);                             \
+    ret = rpc_post_to_servers<ObRpc<pcode>>(dsts, args, cb, newopts);   \
+    return ret;                                                         \
   }
 
 #define OB_DEFINE_RPC_AP2_(name, pcode, prio, Input, Output)     \
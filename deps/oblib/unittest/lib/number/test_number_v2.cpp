@@ -4343,6 +4343,55 @@ TEST(ObNumber, arithmetic_cmp_v2)
 }
 
 
+TEST(ObNumber, fast_add_minus)
+{
+  const char *values[] = {
+    "1", "-1", "0.5", "-0.5", "999999999", "-999999999", "0.000000001", "-0.000000001",
+    "999999999.999999999", "-999999999.999999999", "123456789.987654321", "-123456789.987654321",
+    "1.000000001", "-1.000000001", "500000000.5", "-500000000.5", "0.999999999", "12.34",
+    "1000000000", "0.0000000001", "1234567890.1"
+  };
+  const int64_t value_cnt = sizeof(values) / sizeof(values[0]);
+  char buf_alloc[ObNumber::MAX_CALC_BYTE_LEN * 4];
+  ObDataBuffer allocator(buf_alloc, sizeof(buf_alloc));
+  for (int64_t i = 0; i < value_cnt; ++i) {
+    for (int64_t j = 0; j < value_cnt; ++j) {
+      ObNumber num1;
+      ObNumber num2;
+      ObNumber expected;
+      uint32_t digits[ObNumber::OB_CALC_BUFFER_SIZE];
+      ObNumber::Desc desc;
+      ASSERT_EQ(OB_SUCCESS, num1.from(values[i], allocator));
+      ASSERT_EQ(OB_SUCCESS, num2.from(values[j], allocator));
+      int64_t l_val = 0;
+      int64_t r_val = 0;
+      const bool is_fixed_point = ObNumber::try_get_fixed_point(num1.d_, num1.get_digits(), l_val)
+          && ObNumber::try_get_fixed_point(num2.d_, num2.get_digits(), r_val);
+
+      desc.desc_ = 0;
+      ASSERT_EQ(OB_SUCCESS, num1.add_v3(num2, expected, allocator));
+      if (ObNumber::try_fast_add(num1, num2, digits, desc)) {
+        ASSERT_TRUE(is_fixed_point);
+        ASSERT_EQ(expected.d_.desc_, desc.desc_);
+        ASSERT_EQ(0, MEMCMP(expected.get_digits(), digits, desc.len_ * sizeof(uint32_t)));
+      } else {
+        ASSERT_TRUE(!is_fixed_point || expected.is_zero());
+      }
+
+      desc.desc_ = 0;
+      ASSERT_EQ(OB_SUCCESS, num1.sub_v3(num2, expected, allocator));
+      if (ObNumber::try_fast_minus(num1, num2, digits, desc)) {
+        ASSERT_TRUE(is_fixed_point);
+        ASSERT_EQ(expected.d_.desc_, desc.desc_);
+        ASSERT_EQ(0, MEMCMP(expected.get_digits(), digits, desc.len_ * sizeof(uint32_t)));
+      } else {
+        ASSERT_TRUE(!is_fixed_point || expected.is_zero());
+      }
+      allocator.free();
+    }
+  }
+}
+
 TEST(ObNumber, DISABLED_arithmetic_perf_v2)
 {
   const int64_t MAX_TEST_COUNT  = 10000;
@@ -3093,6 +3093,135 @@ TEST(ObTimeConvertTest, time_to_ob_time)
   // TODO: -123:34:45
 }
 
+TEST(ObTimeConvertTest, datetime_batch_converter)
+{
+  char buf[50] = {0};
+  ObString str;
+  ObTimeZoneInfo tz_info;
+  strcpy(buf, "+8:00");
+  str.assign(buf, static_cast<int32_t>(strlen(buf)));
+  tz_info.set_timezone(str);
+  const int64_t values[] = {
+    0, 1, -1, 1429089727 * USECS_PER_SEC, 1429089727 * USECS_PER_SEC + 1234,
+    1429099727 * USECS_PER_SEC, -30610252800 * USECS_PER_SEC, 1429089727 * USECS_PER_SEC,
+    ObTimeConverter::ZERO_DATETIME, 1429089727 * USECS_PER_SEC, -USECS_PER_DAY - 1
+  };
+  for (int64_t tz_idx = 0; tz_idx < 2; ++tz_idx) {
+    const ObTimeZoneInfo *tz = (0 == tz_idx) ? NULL : &tz_info;
+    ObDatetimeBatchConverter converter(tz);
+    for (int64_t i = 0; i < static_cast<int64_t>(sizeof(values) / sizeof(values[0])); ++i) {
+      ObTime expected;
+      ObTime ob_time;
+      EXPECT_EQ(OB_SUCCESS, ObTimeConverter::datetime_to_ob_time(values[i], tz, expected));
+      EXPECT_EQ(OB_SUCCESS, converter.datetime_to_ob_time(values[i], ob_time));
+      EXPECT_EQ(0, MEMCMP(expected.parts_, ob_time.parts_, sizeof(ob_time.parts_)));
+    }
+  }
+}
+
+// transitions of America/New_York from 2022 to 2024, the offset before the first transition is EST
+static const int64_t NEW_YORK_TRAN_TIMES[] = {
+  1647154800, // 2022-03-13 07:00:00 UTC, EDT
+  1667714400, // 2022-11-06 06:00:00 UTC, EST
+  1678604400, // 2023-03-12 07:00:00 UTC, EDT
+  1699164000, // 2023-11-05 06:00:00 UTC, EST
+  1710054000  // 2024-03-10 07:00:00 UTC, EDT
+};
+
+static void init_new_york_tz_info(ObTimeZoneInfoPos &tz_info)
+{
+  const char *tz_name = "America/New_York";
+  const int32_t EST_OFFSET = -5 * 3600;
+  const int32_t EDT_OFFSET = -4 * 3600;
+  tz_info.set_tz_id(1);
+  ASSERT_EQ(OB_SUCCESS, tz_info.set_tz_name(tz_name, strlen(tz_name)));
+  ObTZTransitionTypeInfo default_type;
+  default_type.info_.offset_sec_ = EST_OFFSET;
+  default_type.info_.tran_type_id_ = 0;
+  default_type.set_tz_abbr(ObString::make_string("EST"));
+  ASSERT_EQ(OB_SUCCESS, tz_info.set_default_tran_type(default_type));
+  for (int64_t i = 0; i < ARRAYSIZEOF(NEW_YORK_TRAN_TIMES); ++i) {
+    const bool is_dst = (0 == i % 2);
+    ObTZTransitionTypeInfo tran_type;
+    tran_type.lower_time_ = NEW_YORK_TRAN_TIMES[i];
+    tran_type.info_.offset_sec_ = is_dst ? EDT_OFFSET : EST_OFFSET;
+    tran_type.info_.tran_type_id_ = is_dst ? 1 : 0;
+    tran_type.info_.is_dst_ = is_dst;
+    tran_type.set_tz_abbr(ObString::make_string(is_dst ? "EDT" : "EST"));
+    ASSERT_EQ(OB_SUCCESS, tz_info.add_tran_type_info(tran_type));
+  }
+}
+
+TEST(ObTimeConvertTest, datetime_batch_converter_dst)
+{
+  ObTimeZoneInfoPos tz_info;
+  init_new_york_tz_info(tz_info);
+  // the offset range starts exactly at the transition and ends right before the next one
+  int32_t offset_sec = 0;
+  int64_t lower_time = 0;
+  int64_t upper_time = 0;
+  EXPECT_EQ(OB_SUCCESS, tz_info.get_timezone_offset_range(NEW_YORK_TRAN_TIMES[0] - 1, offset_sec,
+                                                          lower_time, upper_time));
+  EXPECT_EQ(-5 * 3600, offset_sec);
+  EXPECT_EQ(INT64_MIN, lower_time);
+  EXPECT_EQ(NEW_YORK_TRAN_TIMES[0], upper_time);
+  EXPECT_EQ(OB_SUCCESS, tz_info.get_timezone_offset_range(NEW_YORK_TRAN_TIMES[2], offset_sec,
+                                                          lower_time, upper_time));
+  EXPECT_EQ(-4 * 3600, offset_sec);
+  EXPECT_EQ(NEW_YORK_TRAN_TIMES[2], lower_time);
+  EXPECT_EQ(NEW_YORK_TRAN_TIMES[3], upper_time);
+  EXPECT_EQ(OB_SUCCESS, tz_info.get_timezone_offset_range(NEW_YORK_TRAN_TIMES[4] + 1, offset_sec,
+                                                          lower_time, upper_time));
+  EXPECT_EQ(-4 * 3600, offset_sec);
+  EXPECT_EQ(NEW_YORK_TRAN_TIMES[4], lower_time);
+  EXPECT_EQ(INT64_MAX, upper_time);
+
+  // values on both sides of each transition and exactly at it, forward and backward, so that the
+  // cached range is left through both bounds
+  ObArray<int64_t> values;
+  for (int64_t i = 0; i < ARRAYSIZEOF(NEW_YORK_TRAN_TIMES); ++i) {
+    const int64_t tran_usec = NEW_YORK_TRAN_TIMES[i] * USECS_PER_SEC;
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec - USECS_PER_SEC));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec - 1));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec + 1));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec + 3600 * USECS_PER_SEC));
+  }
+  const int64_t value_cnt = values.count();
+  for (int64_t i = value_cnt - 1; i >= 0; --i) {
+    ASSERT_EQ(OB_SUCCESS, values.push_back(values.at(i)));
+  }
+  ASSERT_EQ(OB_SUCCESS, values.push_back(0));
+  ASSERT_EQ(OB_SUCCESS, values.push_back(NEW_YORK_TRAN_TIMES[2] * USECS_PER_SEC));
+  ASSERT_EQ(OB_SUCCESS, values.push_back(ObTimeConverter::ZERO_DATETIME));
+  ASSERT_EQ(OB_SUCCESS, values.push_back(NEW_YORK_TRAN_TIMES[2] * USECS_PER_SEC - 1));
+  ObDatetimeBatchConverter converter(&tz_info);
+  for (int64_t i = 0; i < values.count(); ++i) {
+    ObTime expected;
+    ObTime ob_time;
+    EXPECT_EQ(OB_SUCCESS, ObTimeConverter::datetime_to_ob_time(values.at(i), &tz_info, expected));
+    EXPECT_EQ(OB_SUCCESS, converter.datetime_to_ob_time(values.at(i), ob_time));
+    EXPECT_EQ(0, MEMCMP(expected.parts_, ob_time.parts_, sizeof(ob_time.parts_)))
+        << "value: " << values.at(i);
+  }
+
+  // local time jumps from 01:59:59 EST to 03:00:00 EDT, and back from 01:59:59 EDT to 01:00:00 EST
+  ObDatetimeBatchConverter dst_converter(&tz_info);
+  ObTime ob_time;
+  EXPECT_EQ(OB_SUCCESS, dst_converter.datetime_to_ob_time(
+      (NEW_YORK_TRAN_TIMES[2] - 1) * USECS_PER_SEC, ob_time));
+  EXPECT_TRUE(ob_time_eq(ob_time, 2023, 3, 12, 1, 59, 59, 0));
+  EXPECT_EQ(OB_SUCCESS, dst_converter.datetime_to_ob_time(
+      NEW_YORK_TRAN_TIMES[2] * USECS_PER_SEC, ob_time));
+  EXPECT_TRUE(ob_time_eq(ob_time, 2023, 3, 12, 3, 0, 0, 0));
+  EXPECT_EQ(OB_SUCCESS, dst_converter.datetime_to_ob_time(
+      (NEW_YORK_TRAN_TIMES[3] - 1) * USECS_PER_SEC, ob_time));
+  EXPECT_TRUE(ob_time_eq(ob_time, 2023, 11, 5, 1, 59, 59, 0));
+  EXPECT_EQ(OB_SUCCESS, dst_converter.datetime_to_ob_time(
+      NEW_YORK_TRAN_TIMES[3] * USECS_PER_SEC, ob_time));
+  EXPECT_TRUE(ob_time_eq(ob_time, 2023, 11, 5, 1, 0, 0, 0));
+}
+
 bool varify_interval_encode_decode(const ObIntervalYMValue ori_value, const ObScale ori_scale)
 {
   static const int64_t buf_len = 256;
@@ -17,8 +17,11 @@
 #include "logservice/palf/log_group_entry.h"
 #include <cstdio>
 #include <gtest/gtest.h>
+#include <fcntl.h>
 #include <signal.h>
 #include <stdexcept>
+#include <unistd.h>
+#include "lib/utility/ob_tracepoint.h"
 #define private public
 #include "env/ob_simple_log_cluster_env.h"
 #include "logservice/palf/log_reader_utils.h"
@@ -735,6 +738,89 @@ TEST_F(TestObSimpleLogClusterLogEngine, io_reducer_basic_func)
   PALF_LOG(INFO, "end io_reducer_basic_func");
 }
 
+TEST_F(TestObSimpleLogClusterLogEngine, io_reducer_group_sync)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "io_reducer_group_sync");
+  OB_LOGGER.set_log_level("TRACE");
+  PALF_LOG(INFO, "begin io_reducer_group_sync");
+  int64_t id_1 = ATOMIC_AAF(&palf_id_, 1);
+  int64_t id_2 = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx_1 = 0;
+  int64_t leader_idx_2 = 0;
+  PalfHandleImplGuard leader_1;
+  PalfHandleImplGuard leader_2;
+  PalfEnv *palf_env = NULL;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id_1, leader_idx_1, leader_1));
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id_2, leader_idx_2, leader_2));
+  EXPECT_EQ(OB_SUCCESS, get_palf_env(leader_idx_1, palf_env));
+  PalfEnvImpl *palf_env_impl = &palf_env->palf_env_impl_;
+  LogIOWorker *log_io_worker = &palf_env_impl->log_io_worker_wrapper_.user_log_io_worker_;
+
+  // enable group sync on the fly, the blocks opened with O_SYNC are still correct, and
+  // each of them is fdatasync'ed by the group sync.
+  LogBlockMgr &block_mgr_1 = leader_1.palf_handle_impl_->log_engine_.log_storage_.block_mgr_;
+  LogBlockMgr &block_mgr_2 = leader_2.palf_handle_impl_->log_engine_.log_storage_.block_mgr_;
+  block_mgr_1.enable_group_sync_ = true;
+  block_mgr_1.curr_writable_handler_.enable_group_sync_ = true;
+  block_mgr_2.enable_group_sync_ = true;
+  block_mgr_2.curr_writable_handler_.enable_group_sync_ = true;
+  log_io_worker->batch_io_task_mgr_.enable_group_sync_ = true;
+
+  // 1. logs of two palf instances are persisted and callbacked by group sync.
+  {
+    const int64_t prev_group_sync_count = log_io_worker->batch_io_task_mgr_.group_sync_count_;
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader_1, 100, id_1, 200));
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader_2, 100, id_2, 200));
+    const LSN max_lsn_1 = leader_1.palf_handle_impl_->get_max_lsn();
+    const LSN max_lsn_2 = leader_2.palf_handle_impl_->get_max_lsn();
+    EXPECT_EQ(OB_SUCCESS, wait_lsn_until_flushed(max_lsn_1, leader_1));
+    EXPECT_EQ(OB_SUCCESS, wait_lsn_until_flushed(max_lsn_2, leader_2));
+    EXPECT_EQ(max_lsn_1, leader_1.palf_handle_impl_->log_engine_.log_storage_.log_tail_);
+    EXPECT_EQ(max_lsn_2, leader_2.palf_handle_impl_->log_engine_.log_storage_.log_tail_);
+    EXPECT_LT(prev_group_sync_count, log_io_worker->batch_io_task_mgr_.group_sync_count_);
+  }
+
+  // 2. the logs written before a failed fdatasync are not callbacked, and are neither
+  // dropped: the fdatasync is retried until success, after that all logs are callbacked in order.
+  {
+    LSN flushed_end_lsn_1;
+    LSN flushed_end_lsn_2;
+    leader_1.palf_handle_impl_->sw_.get_max_flushed_end_lsn(flushed_end_lsn_1);
+    leader_2.palf_handle_impl_->sw_.get_max_flushed_end_lsn(flushed_end_lsn_2);
+    TP_SET_EVENT(EventTable::EN_LOGSERVICE_GROUP_SYNC_FAILED, OB_IO_ERROR, 0, 1);
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader_1, 50, id_1, 200));
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader_2, 50, id_2, 200));
+    sleep(2);
+    LSN curr_flushed_end_lsn_1;
+    LSN curr_flushed_end_lsn_2;
+    leader_1.palf_handle_impl_->sw_.get_max_flushed_end_lsn(curr_flushed_end_lsn_1);
+    leader_2.palf_handle_impl_->sw_.get_max_flushed_end_lsn(curr_flushed_end_lsn_2);
+    EXPECT_EQ(flushed_end_lsn_1, curr_flushed_end_lsn_1);
+    EXPECT_EQ(flushed_end_lsn_2, curr_flushed_end_lsn_2);
+    // the log io worker is stuck in the retried sync, which makes log disk hang detectable.
+    int64_t last_working_time = OB_INVALID_TIMESTAMP;
+    EXPECT_EQ(OB_SUCCESS, palf_env_impl->get_io_start_time(last_working_time));
+    EXPECT_NE(OB_INVALID_TIMESTAMP, last_working_time);
+
+    TP_SET_EVENT(EventTable::EN_LOGSERVICE_GROUP_SYNC_FAILED, OB_IO_ERROR, 0, 0);
+    const LSN max_lsn_1 = leader_1.palf_handle_impl_->get_max_lsn();
+    const LSN max_lsn_2 = leader_2.palf_handle_impl_->get_max_lsn();
+    EXPECT_EQ(OB_SUCCESS, wait_lsn_until_flushed(max_lsn_1, leader_1));
+    EXPECT_EQ(OB_SUCCESS, wait_lsn_until_flushed(max_lsn_2, leader_2));
+    EXPECT_EQ(max_lsn_1, leader_1.palf_handle_impl_->log_engine_.log_storage_.log_tail_);
+    EXPECT_EQ(max_lsn_2, leader_2.palf_handle_impl_->log_engine_.log_storage_.log_tail_);
+    EXPECT_EQ(OB_ITER_END, read_log(leader_1));
+    EXPECT_EQ(OB_ITER_END, read_log(leader_2));
+  }
+
+  log_io_worker->batch_io_task_mgr_.enable_group_sync_ = false;
+  block_mgr_1.enable_group_sync_ = false;
+  block_mgr_1.curr_writable_handler_.enable_group_sync_ = false;
+  block_mgr_2.enable_group_sync_ = false;
+  block_mgr_2.curr_writable_handler_.enable_group_sync_ = false;
+  PALF_LOG(INFO, "end io_reducer_group_sync");
+}
+
 //TEST_F(TestObSimpleLogClusterLogEngine, io_reducer_performance)
 //{
 //  SET_CASE_LOG_FILE(TEST_NAME, "io_reducer_performance");
@@ -219,6 +219,7 @@ TEST_F(TestObMicroBlockCache, test_block_cache)
       multi_io_param,
       context_.query_flag_,
       tablet_handle_.get_obj()->get_full_read_info(),
+      tablet_handle_,
       multi_io_handle));
   ASSERT_EQ(OB_SUCCESS, multi_io_handle.wait(DEFAULT_IO_WAIT_TIME_MS));
   const ObMultiBlockIOResult *io_result
@@ -284,6 +285,102 @@ TEST_F(TestObMicroBlockCache, test_block_cache)
   ASSERT_TRUE(loaded_index_data.get_micro_header()->is_valid());
 }
 
+TEST_F(TestObMicroBlockCache, test_block_cache_admission)
+{
+  ObMacroBlockHandle idx_io_handle;
+  ObIndexBlockRowScanner idx_row_scanner;
+  ObMicroBlockData root_block;
+  ObMicroIndexInfo micro_idx_info;
+  ObArray<int32_t> agg_projector;
+  ObArray<ObColumnSchemaV2> agg_column_schema;
+  sstable_.get_index_tree_root(tablet_handle_.get_obj()->get_index_read_info(), root_block);
+  ASSERT_EQ(OB_SUCCESS, idx_row_scanner.init(
+      agg_projector,
+      agg_column_schema,
+      &tablet_handle_.get_obj()->get_index_read_info(),
+      allocator_,
+      context_.query_flag_,
+      0));
+  ASSERT_EQ(OB_SUCCESS, idx_row_scanner.open(
+      ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID, root_block, ObDatumRowkey::MIN_ROWKEY));
+  ASSERT_EQ(OB_SUCCESS, idx_row_scanner.get_next(micro_idx_info));
+  ASSERT_TRUE(micro_idx_info.is_leaf_block());
+  ASSERT_EQ(OB_SUCCESS, index_block_cache_->prefetch(
+      MTL_ID(),
+      micro_idx_info.get_macro_id(),
+      micro_idx_info,
+      context_.query_flag_,
+      tablet_handle_.get_obj()->get_index_read_info(),
+      tablet_handle_,
+      idx_io_handle));
+  ASSERT_EQ(OB_SUCCESS, idx_io_handle.wait(DEFAULT_IO_WAIT_TIME_MS));
+  ObMicroBlockData idx_prefetch_data =
+      *reinterpret_cast<const ObMicroBlockData*>(idx_io_handle.get_buffer());
+  ObDatumRange full_range;
+  full_range.set_whole_range();
+  idx_row_scanner.reuse();
+  ASSERT_EQ(OB_SUCCESS, idx_row_scanner.open(
+      micro_idx_info.get_macro_id(), idx_prefetch_data, full_range, 0, true, true));
+  ObMicroIndexInfo data_idx_info;
+  ASSERT_EQ(OB_SUCCESS, idx_row_scanner.get_next(data_idx_info));
+  ASSERT_TRUE(data_idx_info.is_data_block());
+
+  // the block may be left in cache by other cases
+  ObMicroBlockCacheKey key(MTL_ID(), data_idx_info.get_macro_id(),
+      data_idx_info.get_block_offset(), data_idx_info.get_block_size());
+  int ret = data_block_cache_->erase(key);
+  ASSERT_TRUE(OB_SUCCESS == ret || OB_ENTRY_NOT_EXIST == ret);
+  ASSERT_EQ(OB_SUCCESS, data_block_cache_->set_admission(true));
+  ObKVCacheInstKey inst_key(data_block_cache_->get_cache_id(), MTL_ID());
+  ObKVCacheInstHandle inst_handle;
+  ASSERT_EQ(OB_SUCCESS, ObKVGlobalCache::get_instance().insts_.get_cache_inst(inst_key, inst_handle));
+  ASSERT_TRUE(NULL != inst_handle.get_inst());
+  const int64_t reject_cnt = inst_handle.get_inst()->status_.admission_reject_cnt_;
+
+  // first touch, the io callback builds the block but it is not admitted into cache
+  ObMacroBlockHandle data_io_handle;
+  ObMicroBlockBufferHandle data_buf_handle;
+  ASSERT_EQ(OB_SUCCESS, data_block_cache_->prefetch(
+      MTL_ID(),
+      data_idx_info.get_macro_id(),
+      data_idx_info,
+      context_.query_flag_,
+      tablet_handle_.get_obj()->get_full_read_info(),
+      tablet_handle_,
+      data_io_handle));
+  ASSERT_EQ(OB_SUCCESS, data_io_handle.wait(DEFAULT_IO_WAIT_TIME_MS));
+  ASSERT_TRUE(NULL != data_io_handle.get_buffer());
+  ASSERT_TRUE(reinterpret_cast<const ObMicroBlockData*>(data_io_handle.get_buffer())->is_valid());
+  ASSERT_EQ(reject_cnt + 1, inst_handle.get_inst()->status_.admission_reject_cnt_);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, data_block_cache_->get_cache_block(
+      MTL_ID(),
+      data_idx_info.get_macro_id(),
+      data_idx_info.get_block_offset(),
+      data_idx_info.get_block_size(),
+      data_buf_handle));
+
+  // touched again, the next prefetch puts it into cache
+  data_io_handle.reset();
+  ASSERT_EQ(OB_SUCCESS, data_block_cache_->prefetch(
+      MTL_ID(),
+      data_idx_info.get_macro_id(),
+      data_idx_info,
+      context_.query_flag_,
+      tablet_handle_.get_obj()->get_full_read_info(),
+      tablet_handle_,
+      data_io_handle));
+  ASSERT_EQ(OB_SUCCESS, data_io_handle.wait(DEFAULT_IO_WAIT_TIME_MS));
+  ASSERT_EQ(reject_cnt + 1, inst_handle.get_inst()->status_.admission_reject_cnt_);
+  ASSERT_EQ(OB_SUCCESS, data_block_cache_->get_cache_block(
+      MTL_ID(),
+      data_idx_info.get_macro_id(),
+      data_idx_info.get_block_offset(),
+      data_idx_info.get_block_size(),
+      data_buf_handle));
+  ASSERT_TRUE(data_buf_handle.is_valid());
+  ASSERT_EQ(OB_SUCCESS, data_block_cache_->set_admission(false));
+}
+
 
 } // blocksstable
 } // oceanbase
@@ -16,6 +16,9 @@
 
 #include "storage/access/ob_index_tree_prefetcher.h"
 #include "storage/access/ob_sstable_row_multi_getter.h"
+#include "storage/access/ob_sstable_row_getter.h"
+#include "share/cache/ob_kv_storecache.h"
+#include "lib/random/ob_random.h"
 #include "ob_index_block_data_prepare.h"
 
 namespace oceanbase
@@ -41,6 +44,7 @@ public:
       const bool is_reverse_scan);
   void test_border(const bool is_reverse_scan);
   void test_normal(const bool is_reverse_scan);
+  void test_coalesced_io(const ObIArray<int64_t> &seeds);
 
 protected:
   static const int64_t TEST_MULTI_GET_CNT = 2000;
@@ -354,6 +358,87 @@ void TestSSTableRowMultiGetter::test_normal(const bool is_reverse_scan)
   destroy_query_param();
 }
 
+// Multi get with all data blocks missed in cache, blocks close to each other are
+// read by one coalesced io, the others by single block io. Rows must be the same
+// as the ones returned by the single row getter, which never coalesces.
+void TestSSTableRowMultiGetter::test_coalesced_io(const ObIArray<int64_t> &seeds)
+{
+  int ret = OB_SUCCESS;
+  ObArray<ObDatumRowkey> rowkeys;
+  const ObDatumRow *prow = NULL;
+  const ObDatumRow *single_prow = NULL;
+  ObSSTableRowMultiGetter getter;
+  ObSSTableRowGetter single_getter;
+  ObDatumRowkey *mget_rowkeys = static_cast<ObDatumRowkey *>(
+      allocator_.alloc(sizeof(ObDatumRowkey) * seeds.count()));
+  ASSERT_TRUE(NULL != mget_rowkeys);
+  for (int64_t i = 0; i < seeds.count(); ++i) {
+    ObDatumRowkey tmp_rowkey;
+    new (mget_rowkeys + i) ObDatumRowkey();
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seeds.at(i), start_row_));
+    tmp_rowkey.assign(start_row_.storage_datums_, TEST_ROWKEY_COLUMN_CNT);
+    ASSERT_EQ(OB_SUCCESS, tmp_rowkey.deep_copy(mget_rowkeys[i], allocator_));
+    ASSERT_EQ(OB_SUCCESS, rowkeys.push_back(mget_rowkeys[i]));
+  }
+
+  // warm up index blocks so that the whole prefetch window is drilled down
+  ASSERT_EQ(OB_SUCCESS, getter.inner_open(iter_param_, context_, &sstable_, &rowkeys));
+  for (int64_t i = 0; i < seeds.count(); ++i) {
+    ASSERT_EQ(OB_SUCCESS, getter.inner_get_next_row(prow));
+  }
+  ASSERT_EQ(OB_ITER_END, getter.inner_get_next_row(prow));
+  getter.reuse();
+
+  ASSERT_EQ(OB_SUCCESS, ObKVGlobalCache::get_instance().erase_cache(MTL_ID(), "user_block_cache"));
+  ASSERT_EQ(OB_SUCCESS, getter.inner_open(iter_param_, context_, &sstable_, &rowkeys));
+
+  // ios of the first prefetch window are submitted in inner_open
+  ObIndexTreeMultiPrefetcher &prefetcher = getter.prefetcher_;
+  int64_t multi_block_io_cnt = 0;
+  int64_t single_block_io_cnt = 0;
+  for (int64_t i = prefetcher.fetch_rowkey_idx_; i < prefetcher.prefetch_rowkey_idx_; ++i) {
+    ObIndexTreeMultiPrefetcher::ObSSTableReadHandleExt &read_handle =
+        prefetcher.ext_read_handles_[i % prefetcher.max_handle_prefetching_cnt_];
+    if (ObSSTableRowState::IN_BLOCK == read_handle.row_state_
+        && NULL != read_handle.micro_handle_
+        && ObSSTableMicroBlockState::IN_BLOCK_IO == read_handle.micro_handle_->block_state_) {
+      if (read_handle.micro_handle_->block_index_ >= 0) {
+        ++multi_block_io_cnt;
+      } else {
+        ++single_block_io_cnt;
+      }
+    }
+  }
+  STORAGE_LOG(INFO, "coalesced io of first prefetch window", K(multi_block_io_cnt), K(single_block_io_cnt),
+      K_(data_macro_block_cnt));
+  ASSERT_TRUE(prefetcher.pending_data_ios_.empty());
+  ASSERT_GT(multi_block_io_cnt, 0);
+  if (data_macro_block_cnt_ > 1) {
+    ASSERT_GT(single_block_io_cnt, 0);
+  }
+
+  for (int64_t i = 0; i < seeds.count(); ++i) {
+    ASSERT_EQ(OB_SUCCESS, single_getter.inner_open(iter_param_, context_, &sstable_, &rowkeys.at(i)));
+    ret = getter.inner_get_next_row(prow);
+    ASSERT_EQ(OB_SUCCESS, ret) << "i=" << i << " seed=" << seeds.at(i);
+    ASSERT_EQ(OB_SUCCESS, single_getter.inner_get_next_row(single_prow));
+    if (seeds.at(i) >= row_cnt_) {
+      ASSERT_TRUE(prow->row_flag_.is_not_exist());
+      ASSERT_TRUE(single_prow->row_flag_.is_not_exist());
+    } else {
+      ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seeds.at(i), check_row_));
+      ASSERT_EQ(OB_SUCCESS, (const_cast<ObDatumRow *>(prow))->prepare_new_row(schema_cols_));
+      ASSERT_EQ(OB_SUCCESS, (const_cast<ObDatumRow *>(single_prow))->prepare_new_row(schema_cols_));
+      ASSERT_TRUE(check_row_ == *prow) << "i=" << i << " seed=" << seeds.at(i);
+      ASSERT_TRUE(*single_prow == *prow) << "i=" << i << " seed=" << seeds.at(i);
+    }
+    ASSERT_EQ(OB_ITER_END, single_getter.inner_get_next_row(single_prow));
+    single_getter.reuse();
+  }
+  ASSERT_EQ(OB_ITER_END, getter.inner_get_next_row(prow));
+  getter.reuse();
+}
+
 TEST_F(TestSSTableRowMultiGetter, test_border)
 {
   bool is_reverse_scan = false;
@@ -370,6 +455,36 @@ TEST_F(TestSSTableRowMultiGetter, test_normal)
   test_normal(is_reverse_scan);
 }
 
+TEST_F(TestSSTableRowMultiGetter, test_coalesced_io)
+{
+  ObArray<int64_t> seeds;
+  prepare_query_param(false, tablet_handle_.get_obj()->get_full_read_info());
+
+  // adjacent rows in the first prefetch window share coalesced ios, the rows of
+  // the last macro block and the not exist rows between them use single block io
+  const int64_t window_cnt = ObIndexTreeMultiPrefetcher::MAX_MULTIGET_MICRO_DATA_HANDLE_CNT;
+  const int64_t step = 32;
+  for (int64_t i = 0; i < window_cnt; ++i) {
+    if (0 == i % 4) {
+      ASSERT_EQ(OB_SUCCESS, seeds.push_back(row_cnt_ - 1 - i));
+    } else if (0 == i % 7) {
+      ASSERT_EQ(OB_SUCCESS, seeds.push_back(row_cnt_ + i));
+    } else {
+      ASSERT_EQ(OB_SUCCESS, seeds.push_back(i * step));
+    }
+  }
+  // same rowkeys again, the blocks are deduped before submitting
+  for (int64_t i = 0; i < window_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, seeds.push_back(seeds.at(window_cnt - 1 - i)));
+  }
+  // random rows across the whole sstable, spanning several prefetch windows
+  for (int64_t i = 0; i < TEST_MULTI_GET_CNT / 4; ++i) {
+    ASSERT_EQ(OB_SUCCESS, seeds.push_back(ObRandom::rand(0, row_cnt_ - 1)));
+  }
+  test_coalesced_io(seeds);
+  destroy_query_param();
+}
+
 }
 }
 
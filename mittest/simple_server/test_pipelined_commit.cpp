@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "env/ob_simple_cluster_test_base.h"
+
+static const char *TEST_FILE_NAME = "test_pipelined_commit";
+const int64_t SESSION_COUNT = 16;
+const int64_t ROW_COUNT_PER_SESSION = 2000;
+
+namespace oceanbase
+{
+namespace unittest
+{
+#define EXE_SQL(sql_str)                                            \
+  ASSERT_EQ(OB_SUCCESS, sql.assign(sql_str));                       \
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write(sql.ptr(), affected_rows));
+
+#define WRITE_SQL_BY_CONN(conn, sql_str)                                \
+  ASSERT_EQ(OB_SUCCESS, sql.assign(sql_str));                           \
+  ASSERT_EQ(OB_SUCCESS, conn->execute_write(OB_SYS_TENANT_ID, sql.ptr(), affected_rows));
+
+#define WRITE_SQL_FMT_BY_CONN(conn, ...)                                \
+  ASSERT_EQ(OB_SUCCESS, sql.assign_fmt(__VA_ARGS__));                   \
+  ASSERT_EQ(OB_SUCCESS, conn->execute_write(OB_SYS_TENANT_ID, sql.ptr(), affected_rows));
+
+class ObPipelinedCommitTest : public ObSimpleClusterTestBase
+{
+public:
+  ObPipelinedCommitTest() : ObSimpleClusterTestBase(TEST_FILE_NAME) {}
+
+  void create_test_tenant(uint64_t &tenant_id)
+  {
+    TRANS_LOG(INFO, "create_tenant start");
+    ASSERT_EQ(OB_SUCCESS, create_tenant());
+    ASSERT_EQ(OB_SUCCESS, get_tenant_id(tenant_id));
+    ASSERT_EQ(OB_SUCCESS, get_curr_simple_server().init_sql_proxy2());
+    TRANS_LOG(INFO, "create_tenant end", K(tenant_id));
+  }
+
+  void set_early_lock_release(const bool enable)
+  {
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    int64_t affected_rows = 0;
+    ObSqlString sql;
+    ASSERT_EQ(OB_SUCCESS, sql.assign_fmt("alter system set enable_early_lock_release = %s;",
+                                         enable ? "True" : "False"));
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.write(sql.ptr(), affected_rows));
+  }
+
+  void query_count(sqlclient::ObISQLConnection *connection,
+                   const char *sql_str,
+                   int64_t &cnt)
+  {
+    cnt = -1;
+    SMART_VAR(ObMySQLProxy::MySQLResult, res) {
+      ASSERT_EQ(OB_SUCCESS, connection->execute_read(OB_SYS_TENANT_ID, sql_str, res));
+      sqlclient::ObMySQLResult *result = res.get_result();
+      ASSERT_NE(nullptr, result);
+      ASSERT_EQ(OB_SUCCESS, result->next());
+      ASSERT_EQ(OB_SUCCESS, result->get_int("cnt", cnt));
+    }
+  }
+
+  // Every row is committed by its own transaction, and the session reads its own commit
+  // immediately after the commit response, which is the guarantee that the commit response
+  // is never sent before the commit log synced and the gts elapsed the commit version.
+  void commit_row_by_row(const int64_t session_idx)
+  {
+    ObSqlString sql;
+    int64_t affected_rows = 0;
+    int64_t cnt = 0;
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    sqlclient::ObISQLConnection *connection = nullptr;
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.acquire(connection));
+    ASSERT_NE(nullptr, connection);
+
+    const int64_t begin_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < ROW_COUNT_PER_SESSION; i++) {
+      const int64_t key = session_idx * ROW_COUNT_PER_SESSION + i;
+      WRITE_SQL_FMT_BY_CONN(connection, "insert into test_pipelined_commit values(%ld, %ld);",
+                            key, session_idx);
+      ASSERT_EQ(1, affected_rows);
+      // hot row updated by all sessions, which relies on elr to release the row lock early
+      WRITE_SQL_BY_CONN(connection, "update test_pipelined_commit_hot set c = c + 1 where a = 1;");
+      ASSERT_EQ(1, affected_rows);
+      if (0 == i % 10) {
+        ASSERT_EQ(OB_SUCCESS, sql.assign_fmt("select count(*) as cnt from test_pipelined_commit "
+                                             "where b = %ld;", session_idx));
+        query_count(connection, sql.ptr(), cnt);
+        ASSERT_EQ(i + 1, cnt);
+      }
+    }
+    const int64_t end_time = ObTimeUtility::current_time();
+    TRANS_LOG(INFO, "commit row by row finish", K(session_idx), "cost", end_time - begin_time);
+  }
+
+  void check_count_monotonic(bool &stop)
+  {
+    int64_t last_cnt = 0;
+    int64_t cnt = 0;
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    sqlclient::ObISQLConnection *connection = nullptr;
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.acquire(connection));
+    ASSERT_NE(nullptr, connection);
+
+    while (!ATOMIC_LOAD(&stop)) {
+      query_count(connection, "select count(*) as cnt from test_pipelined_commit;", cnt);
+      ASSERT_LE(last_cnt, cnt);
+      last_cnt = cnt;
+      usleep(10 * 1000);
+    }
+  }
+};
+
+TEST_F(ObPipelinedCommitTest, commit_row_by_row_stress)
+{
+  ObSqlString sql;
+  int64_t affected_rows = 0;
+  int64_t cnt = 0;
+
+  uint64_t tenant_id = 0;
+  create_test_tenant(tenant_id);
+
+  common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+  EXE_SQL("create table test_pipelined_commit (a bigint primary key, b bigint)");
+  EXE_SQL("create table test_pipelined_commit_hot (a bigint primary key, c bigint)");
+  EXE_SQL("insert into test_pipelined_commit_hot values(1, 0)");
+
+  for (int64_t round = 0; round < 2; round++) {
+    const bool enable_elr = (0 == round);
+    set_early_lock_release(enable_elr);
+    // tenant config of elr is refreshed every 5s
+    sleep(6);
+    EXE_SQL("delete from test_pipelined_commit");
+
+    bool stop = false;
+    std::thread checker(&ObPipelinedCommitTest::check_count_monotonic, this, std::ref(stop));
+    std::vector<std::thread> sessions;
+    for (int64_t i = 0; i < SESSION_COUNT; i++) {
+      sessions.push_back(std::thread(&ObPipelinedCommitTest::commit_row_by_row, this, i));
+    }
+    for (int64_t i = 0; i < SESSION_COUNT; i++) {
+      sessions[i].join();
+    }
+    ATOMIC_STORE(&stop, true);
+    checker.join();
+
+    sqlclient::ObISQLConnection *connection = nullptr;
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.acquire(connection));
+    query_count(connection, "select count(*) as cnt from test_pipelined_commit;", cnt);
+    ASSERT_EQ(SESSION_COUNT * ROW_COUNT_PER_SESSION, cnt);
+    query_count(connection, "select c as cnt from test_pipelined_commit_hot where a = 1;", cnt);
+    ASSERT_EQ((round + 1) * SESSION_COUNT * ROW_COUNT_PER_SESSION, cnt);
+    TRANS_LOG(INFO, "pipelined commit round finish", K(round), K(enable_elr));
+  }
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::unittest::init_log_and_gtest(argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -172,6 +172,11 @@ public:
   DEF_INT(binlog_record_prealloc_count, OB_CLUSTER_PARAMETER, "100000", "[1,]", "binlog record pre-alloc count");
 
   DEF_STR(store_service_path, OB_CLUSTER_PARAMETER, "./storage", "store sevice path");
+  // rocksdb: store data of huge transactions in rocksdb
+  // file: store data of huge transactions in append-only spill files, which has no compaction
+  DEF_STR(store_service_type, OB_CLUSTER_PARAMETER, "rocksdb", "store service type: rocksdb|file");
+  // compressor used by file store service, none means not compress
+  DEF_STR(store_service_compress_func, OB_CLUSTER_PARAMETER, "lz4_1.0", "compress func of file store service");
 
   // Whether to do ob version compatibility check
   // default value '0:not_skip'
@@ -523,6 +528,12 @@ public:
   // No printing by default
   T_DEF_BOOL(enable_formatter_print_log, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // All statements of one redo log entry are formatted by the same Formatter thread.
+  // A log entry with more statements than this value (e.g. a large batch DML) has its
+  // statements spread over all Formatter threads instead, 0 means never spread.
+  T_DEF_INT_INFT(formatter_shard_stmt_count_threshold, OB_CLUSTER_PARAMETER, 1024, 0,
+      "statement count threshold of log entry to be formatted by all formatter threads");
+
   // Switch: Whether to enable SSL authentication: including MySQL and RPC
   // Disabled by default
   T_DEF_BOOL(ssl_client_authentication, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
@@ -0,0 +1,712 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Store service based on append-only spill files
+ */
+
+#define USING_LOG_PREFIX OBLOG_STORAGER
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <linux/falloc.h>                   // FALLOC_FL_PUNCH_HOLE
+#include "ob_log_file_store_service.h"
+#include "ob_log_utils.h"                   // ob_cdc_malloc
+#include "ob_log_config.h"                  // TCONF
+#include "lib/compress/ob_compressor_pool.h" // ObCompressorPool
+#include "lib/file/file_directory_utils.h"  // FileDirectoryUtils
+#include "lib/oblog/ob_log_module.h"        // LOG_*
+#include "lib/ob_errno.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace libobcdc
+{
+/////////////////////////////////////////// ObLogSpillFile ///////////////////////////////////////////
+
+ObLogSpillFile::ObLogSpillFile() :
+    is_inited_(false),
+    fd_(-1),
+    file_path_(),
+    compressor_(NULL),
+    lock_(),
+    index_(),
+    reading_values_(),
+    write_offset_(0),
+    io_cnt_(0)
+{
+}
+
+ObLogSpillFile::~ObLogSpillFile()
+{
+  destroy();
+}
+
+int ObLogSpillFile::init(const std::string &file_path, ObCompressor *compressor)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_ERROR("ObLogSpillFile init twice", KR(ret), KPC(this));
+  } else if (OB_UNLIKELY(file_path.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), "file_path", file_path.c_str());
+  } else if (-1 == (fd_ = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644))) {
+    ret = OB_IO_ERROR;
+    LOG_ERROR("open spill file fail", KR(ret), K(errno), "file_path", file_path.c_str());
+  } else {
+    file_path_ = file_path;
+    compressor_ = compressor;
+    write_offset_ = 0;
+    io_cnt_ = 0;
+    is_inited_ = true;
+    LOG_INFO("ObLogSpillFile init succ", KPC(this), "compressor",
+        NULL == compressor_ ? "none" : compressor_->get_compressor_name());
+  }
+
+  return ret;
+}
+
+void ObLogSpillFile::destroy()
+{
+  if (-1 != fd_) {
+    (void)::close(fd_);
+    fd_ = -1;
+  }
+  index_.clear();
+  reading_values_.clear();
+  compressor_ = NULL;
+  write_offset_ = 0;
+  io_cnt_ = 0;
+  is_inited_ = false;
+}
+
+int ObLogSpillFile::remove()
+{
+  int ret = OB_SUCCESS;
+  const std::string file_path = file_path_;
+
+  destroy();
+  if (! file_path.empty() && 0 != ::unlink(file_path.c_str()) && ENOENT != errno) {
+    ret = OB_IO_ERROR;
+    LOG_ERROR("unlink spill file fail", KR(ret), K(errno), "file_path", file_path.c_str());
+  } else {
+    LOG_INFO("remove spill file succ", "file_path", file_path.c_str());
+  }
+
+  return ret;
+}
+
+int ObLogSpillFile::put(const std::string &key, const ObSlice &value)
+{
+  int ret = OB_SUCCESS;
+  char *compress_buf = NULL;
+  const char *data = NULL;
+  int64_t data_len = 0;
+  ValuePos pos;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("ObLogSpillFile not init", KR(ret));
+  } else if (OB_ISNULL(value.buf_) || OB_UNLIKELY(value.buf_len_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), K(value.buf_len_));
+  } else if (OB_FAIL(compress_(value, compress_buf, data, data_len))) {
+    LOG_ERROR("compress value fail", KR(ret), K(value.buf_len_), KPC(this));
+  } else {
+    {
+      lib::ObMutexGuard guard(lock_);
+      pos.offset_ = write_offset_;
+      pos.data_len_ = data_len;
+      pos.orig_len_ = value.buf_len_;
+      write_offset_ += data_len;
+      ++io_cnt_;
+    }
+
+    if (OB_FAIL(write_(data, data_len, pos.offset_))) {
+      LOG_ERROR("write spill file fail", KR(ret), K(pos), KPC(this));
+    }
+
+    lib::ObMutexGuard guard(lock_);
+    --io_cnt_;
+    if (OB_SUCC(ret)) {
+      ValueIndex::iterator iter = index_.find(key);
+      if (index_.end() != iter) {
+        // overwrite the old value
+        release_or_delay_(iter->second);
+        iter->second = pos;
+      } else {
+        index_.insert(std::make_pair(key, pos));
+      }
+    } else {
+      release_(pos);
+      try_truncate_();
+    }
+  }
+
+  if (NULL != compress_buf) {
+    ob_cdc_free(compress_buf);
+    compress_buf = NULL;
+  }
+
+  return ret;
+}
+
+int ObLogSpillFile::get(const std::string &key, std::string &value)
+{
+  int ret = OB_SUCCESS;
+  ValuePos pos;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("ObLogSpillFile not init", KR(ret));
+  } else {
+    lib::ObMutexGuard guard(lock_);
+    ValueIndex::const_iterator iter = index_.find(key);
+    if (index_.end() == iter) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      pos = iter->second;
+      // the value may be deleted or overwritten while reading it out of lock_
+      inc_reading_ref_(pos);
+      ++io_cnt_;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(read_(pos, value))) {
+      LOG_ERROR("read spill file fail", KR(ret), K(pos), KPC(this));
+    }
+
+    lib::ObMutexGuard guard(lock_);
+    dec_reading_ref_(pos);
+    --io_cnt_;
+    try_truncate_();
+  }
+
+  return ret;
+}
+
+int ObLogSpillFile::del(const std::string &key)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("ObLogSpillFile not init", KR(ret));
+  } else {
+    lib::ObMutexGuard guard(lock_);
+    ValueIndex::iterator iter = index_.find(key);
+    // delete a key not exist is OK
+    if (index_.end() != iter) {
+      release_or_delay_(iter->second);
+      index_.erase(iter);
+      try_truncate_();
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSpillFile::del_range(const std::string &begin_key, const std::string &end_key)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("ObLogSpillFile not init", KR(ret));
+  } else {
+    lib::ObMutexGuard guard(lock_);
+    ValueIndex::iterator iter = index_.lower_bound(begin_key);
+    while (index_.end() != iter && iter->first < end_key) {
+      release_or_delay_(iter->second);
+      iter = index_.erase(iter);
+    }
+    try_truncate_();
+  }
+
+  return ret;
+}
+
+int64_t ObLogSpillFile::get_value_count() const
+{
+  lib::ObMutexGuard guard(lock_);
+  return index_.size();
+}
+
+int64_t ObLogSpillFile::get_file_size() const
+{
+  lib::ObMutexGuard guard(lock_);
+  return write_offset_;
+}
+
+int ObLogSpillFile::compress_(const ObSlice &value,
+    char *&compress_buf,
+    const char *&data,
+    int64_t &data_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t max_overflow_size = 0;
+  int64_t compress_buf_len = 0;
+  int64_t compress_size = 0;
+  compress_buf = NULL;
+  data = value.buf_;
+  data_len = value.buf_len_;
+
+  if (NULL == compressor_) {
+    // not compress
+  } else if (OB_FAIL(compressor_->get_max_overflow_size(value.buf_len_, max_overflow_size))) {
+    LOG_ERROR("get_max_overflow_size fail", KR(ret), K(value.buf_len_));
+  } else if (FALSE_IT(compress_buf_len = value.buf_len_ + max_overflow_size)) {
+  } else if (OB_ISNULL(compress_buf = static_cast<char *>(ob_cdc_malloc(compress_buf_len, "CDCSpillFile")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("alloc compress buf fail", KR(ret), K(compress_buf_len));
+  } else if (OB_FAIL(compressor_->compress(value.buf_, value.buf_len_, compress_buf,
+      compress_buf_len, compress_size))) {
+    LOG_ERROR("compress fail", KR(ret), K(value.buf_len_), K(compress_buf_len));
+  } else if (compress_size < value.buf_len_) {
+    data = compress_buf;
+    data_len = compress_size;
+  } else {
+    // incompressible, write the value as it is
+  }
+
+  return ret;
+}
+
+int ObLogSpillFile::write_(const char *data, const int64_t data_len, const int64_t offset)
+{
+  int ret = OB_SUCCESS;
+  int64_t write_size = 0;
+
+  while (OB_SUCC(ret) && write_size < data_len) {
+    const ssize_t size = ::pwrite(fd_, data + write_size, data_len - write_size, offset + write_size);
+    if (size < 0) {
+      if (EINTR != errno) {
+        ret = OB_IO_ERROR;
+        LOG_ERROR("pwrite fail", KR(ret), K(errno), K(offset), K(data_len), K(write_size));
+      }
+    } else {
+      write_size += size;
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSpillFile::read_(const ValuePos &pos, std::string &value)
+{
+  int ret = OB_SUCCESS;
+  static const int64_t page_size = ::sysconf(_SC_PAGESIZE);
+  // offset of mmap must be aligned to page
+  const int64_t map_offset = pos.offset_ - pos.offset_ % page_size;
+  const int64_t map_len = pos.offset_ + pos.data_len_ - map_offset;
+  void *map_buf = ::mmap(NULL, map_len, PROT_READ, MAP_SHARED, fd_, map_offset);
+
+  if (MAP_FAILED == map_buf) {
+    ret = OB_IO_ERROR;
+    LOG_ERROR("mmap spill file fail", KR(ret), K(errno), K(pos), K(map_offset), K(map_len));
+  } else {
+    (void)::madvise(map_buf, map_len, MADV_SEQUENTIAL);
+    const char *data = static_cast<const char *>(map_buf) + (pos.offset_ - map_offset);
+
+    if (! pos.is_compressed()) {
+      value.assign(data, pos.data_len_);
+    } else if (OB_ISNULL(compressor_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("compressor is NULL for compressed value", KR(ret), K(pos));
+    } else {
+      int64_t decompress_size = 0;
+      value.resize(pos.orig_len_);
+      if (OB_FAIL(compressor_->decompress(data, pos.data_len_, &value[0], pos.orig_len_,
+          decompress_size))) {
+        LOG_ERROR("decompress fail", KR(ret), K(pos));
+      } else if (OB_UNLIKELY(decompress_size != pos.orig_len_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_ERROR("decompress size not match", KR(ret), K(pos), K(decompress_size));
+      }
+    }
+
+    (void)::munmap(map_buf, map_len);
+  }
+
+  return ret;
+}
+
+void ObLogSpillFile::release_(const ValuePos &pos)
+{
+  // only the pages entirely covered are freed by file system, the others are zeroed
+  if (0 != ::fallocate(fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, pos.offset_, pos.data_len_)) {
+    if (REACH_TIME_INTERVAL(PRINT_LOG_INTERVAL)) {
+      LOG_WARN_RET(OB_IO_ERROR, "punch hole in spill file fail, space is released after truncate",
+          K(errno), K(pos), KPC(this));
+    }
+  }
+}
+
+void ObLogSpillFile::release_or_delay_(const ValuePos &pos)
+{
+  ReadingValueMap::iterator iter = reading_values_.find(pos.offset_);
+  if (reading_values_.end() != iter) {
+    // punching hole now makes the readers read zeros, release it by the last reader
+    iter->second.is_released_ = true;
+  } else {
+    release_(pos);
+  }
+}
+
+void ObLogSpillFile::inc_reading_ref_(const ValuePos &pos)
+{
+  ReadingValueMap::iterator iter = reading_values_.find(pos.offset_);
+  if (reading_values_.end() != iter) {
+    ++iter->second.ref_cnt_;
+  } else {
+    ReadingValue reading_value;
+    reading_value.pos_ = pos;
+    reading_value.ref_cnt_ = 1;
+    reading_value.is_released_ = false;
+    reading_values_.insert(std::make_pair(pos.offset_, reading_value));
+  }
+}
+
+void ObLogSpillFile::dec_reading_ref_(const ValuePos &pos)
+{
+  ReadingValueMap::iterator iter = reading_values_.find(pos.offset_);
+  if (OB_UNLIKELY(reading_values_.end() == iter)) {
+    LOG_ERROR_RET(OB_ERR_UNEXPECTED, "reading value not exist", K(pos), KPC(this));
+  } else if (--iter->second.ref_cnt_ > 0) {
+    // still being read by others
+  } else {
+    if (iter->second.is_released_) {
+      release_(iter->second.pos_);
+    }
+    reading_values_.erase(iter);
+  }
+}
+
+void ObLogSpillFile::try_truncate_()
+{
+  if (index_.empty() && 0 == io_cnt_ && write_offset_ > 0) {
+    if (0 != ::ftruncate(fd_, 0)) {
+      LOG_WARN_RET(OB_IO_ERROR, "truncate spill file fail", K(errno), KPC(this));
+    } else {
+      LOG_DEBUG("truncate spill file succ", KPC(this));
+      write_offset_ = 0;
+    }
+  }
+}
+
+/////////////////////////////////////////// ObLogFileStoreService ///////////////////////////////////////////
+
+ObLogFileStoreService::ObLogFileStoreService() :
+    is_inited_(false),
+    is_stopped_(true),
+    path_(),
+    compressor_(NULL),
+    default_file_(NULL)
+{
+}
+
+ObLogFileStoreService::~ObLogFileStoreService()
+{
+  destroy();
+}
+
+int ObLogFileStoreService::init(const std::string &path)
+{
+  int ret = OB_SUCCESS;
+  const char *compress_func = TCONF.store_service_compress_func.str();
+  ObCompressor *compressor = NULL;
+
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_ERROR("ObLogFileStoreService has inited twice", KR(ret));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compress_func, compressor))) {
+    LOG_ERROR("get_compressor fail", KR(ret), K(compress_func));
+  } else if (OB_FAIL(init_dir_(path.c_str()))) {
+    LOG_ERROR("init_dir_ fail", KR(ret), "path", path.c_str());
+  } else {
+    path_ = path;
+    compressor_ = ObCompressorPool::need_common_compress(compressor->get_compressor_type()) ? compressor : NULL;
+
+    if (OB_FAIL(create_spill_file_("default", default_file_))) {
+      LOG_ERROR("create default spill file fail", KR(ret), "path", path.c_str());
+    } else {
+      is_stopped_ = false;
+      is_inited_ = true;
+      _LOG_INFO("ObLogFileStoreService init success, path:%s, compress_func=%s", path_.c_str(), compress_func);
+    }
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::close()
+{
+  int ret = OB_SUCCESS;
+
+  if (NULL != default_file_) {
+    LOG_INFO("closing file store service ...");
+    mark_stop_flag();
+    default_file_->destroy();
+    LOG_INFO("file store service close succ");
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::init_dir_(const char *dir_path)
+{
+  int ret = OB_SUCCESS;
+  bool is_exist = false;
+
+  // the spill files left by last run are useless, remove them all
+  if (OB_FAIL(common::FileDirectoryUtils::is_exists(dir_path, is_exist))) {
+    LOG_ERROR("FileDirectoryUtils is_exists fail", K(ret), K(dir_path));
+  } else if (is_exist && OB_FAIL(common::FileDirectoryUtils::delete_directory_rec(dir_path))) {
+    LOG_ERROR("FileDirectoryUtils delete_directory_rec fail", K(ret), K(dir_path));
+  } else if (OB_FAIL(common::FileDirectoryUtils::create_full_path(dir_path))) {
+    LOG_ERROR("FileDirectoryUtils create_full_path fail", K(ret), K(dir_path));
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::create_spill_file_(const std::string &name, ObLogSpillFile *&spill_file)
+{
+  int ret = OB_SUCCESS;
+  const std::string file_path = path_ + "/" + name + ".spill";
+  ObLogSpillFile *tmp_file = NULL;
+  spill_file = NULL;
+
+  if (OB_ISNULL(tmp_file = new(std::nothrow) ObLogSpillFile())) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("construct ObLogSpillFile fail", KR(ret));
+  } else if (OB_FAIL(tmp_file->init(file_path, compressor_))) {
+    LOG_ERROR("init ObLogSpillFile fail", KR(ret), "file_path", file_path.c_str());
+    delete tmp_file;
+    tmp_file = NULL;
+  } else {
+    spill_file = tmp_file;
+  }
+
+  return ret;
+}
+
+void ObLogFileStoreService::destroy()
+{
+  if (is_inited_) {
+    LOG_INFO("file store service destroy begin");
+    close();
+
+    if (OB_NOT_NULL(default_file_)) {
+      delete default_file_;
+      default_file_ = NULL;
+    }
+    compressor_ = NULL;
+    path_.clear();
+    is_inited_ = false;
+    LOG_INFO("file store service destroy end");
+  }
+}
+
+int ObLogFileStoreService::put(const std::string &key, const ObSlice &value)
+{
+  return put(default_file_, key, value);
+}
+
+int ObLogFileStoreService::put(void *cf_handle, const std::string &key, const ObSlice &value)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handle);
+
+  if (OB_ISNULL(spill_file)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("spill_file is NULL", KR(ret));
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(spill_file->put(key, value))) {
+    LOG_ERROR("ObLogFileStoreService put value into spill file failed", KR(ret), "key", key.c_str());
+    ret = OB_IO_ERROR;
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::batch_write(void *cf_handle,
+    const std::vector<std::string> &keys,
+    const std::vector<ObSlice> &values)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(keys.size() != values.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("keys and values not match", KR(ret), "key_count", keys.size(), "value_count", values.size());
+  }
+
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < keys.size(); ++idx) {
+    if (OB_FAIL(put(cf_handle, keys[idx], values[idx]))) {
+      if (OB_IN_STOP_STATE != ret) {
+        LOG_ERROR("put value fail", KR(ret), K(idx), "key", keys[idx].c_str());
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::get(const std::string &key, std::string &value)
+{
+  return get(default_file_, key, value);
+}
+
+int ObLogFileStoreService::get(void *cf_handle, const std::string &key, std::string &value)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handle);
+
+  if (OB_ISNULL(spill_file)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("spill_file is NULL", KR(ret));
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(spill_file->get(key, value))) {
+    _LOG_ERROR("ObLogFileStoreService get value from spill file failed, ret=%d, key:%s", ret, key.c_str());
+    ret = OB_ERR_UNEXPECTED;
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::del(const std::string &key)
+{
+  return del(default_file_, key);
+}
+
+int ObLogFileStoreService::del(void *cf_handle, const std::string &key)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handle);
+
+  if (OB_ISNULL(spill_file)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("spill_file is NULL", KR(ret));
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(spill_file->del(key))) {
+    LOG_ERROR("delete from spill file failed", KR(ret), "key", key.c_str());
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handle);
+
+  if (OB_ISNULL(spill_file)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("spill_file is NULL", KR(ret));
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(spill_file->del_range(begin_key, end_key))) {
+    LOG_ERROR("delete range from spill file failed", KR(ret), "begin_key", begin_key.c_str(),
+        "end_key", end_key.c_str());
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::create_column_family(const std::string& column_family_name,
+    void *&cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = NULL;
+
+  if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(create_spill_file_(column_family_name, spill_file))) {
+    LOG_ERROR("create spill file fail", KR(ret), "column_family_name", column_family_name.c_str());
+  } else {
+    cf_handle = reinterpret_cast<void *>(spill_file);
+    LOG_INFO("file store service create column family succ", "column_family_name", column_family_name.c_str(),
+        KPC(spill_file));
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::drop_column_family(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handle);
+
+  if (OB_ISNULL(spill_file)) {
+    LOG_ERROR("spill_file is NULL");
+    ret = OB_INVALID_ARGUMENT;
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(spill_file->remove())) {
+    LOG_ERROR("remove spill file fail", KR(ret));
+  } else {
+    LOG_INFO("file store service drop column family succ");
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::destory_column_family(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handle);
+
+  if (OB_ISNULL(spill_file)) {
+    LOG_ERROR("spill_file is NULL");
+    ret = OB_INVALID_ARGUMENT;
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else {
+    delete spill_file;
+    spill_file = NULL;
+    LOG_INFO("file store service destroy column family succ");
+  }
+
+  return ret;
+}
+
+void ObLogFileStoreService::get_mem_usage(const std::vector<uint64_t> ids,
+    const std::vector<void *> cf_handles)
+{
+  int64_t total_value_count = 0;
+  int64_t total_file_size = 0;
+
+  for (int64_t idx = 0; !is_stopped() && idx < cf_handles.size(); ++idx) {
+    ObLogSpillFile *spill_file = static_cast<ObLogSpillFile *>(cf_handles[idx]);
+
+    if (OB_NOT_NULL(spill_file)) {
+      const int64_t value_count = spill_file->get_value_count();
+      const int64_t file_size = spill_file->get_file_size();
+      total_value_count += value_count;
+      total_file_size += file_size;
+
+      LOG_INFO("[SPILL_FILE] [USAGE]", "tenant_id", ids[idx], K(value_count),
+          "file_size", SIZE_TO_STR(file_size));
+    }
+  } // for
+
+  LOG_INFO("[SPILL_FILE] [TOTAL_USAGE]", K(total_value_count), "file_size", SIZE_TO_STR(total_file_size));
+}
+
+}
+}
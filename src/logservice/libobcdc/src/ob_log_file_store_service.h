@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Store service based on append-only spill files
+ */
+
+#ifndef OCEANBASE_LIBOBCDC_OB_LOG_FILE_STORE_SERVICE_H_
+#define OCEANBASE_LIBOBCDC_OB_LOG_FILE_STORE_SERVICE_H_
+
+#include <map>
+#include "ob_log_store_service.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/lock/ob_mutex.h"
+#include "lib/compress/ob_compressor.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+// An append-only spill file, which is a column family of ObLogFileStoreService.
+//
+// 1. Values are compressed and appended to the end of file, they are never rewritten and
+//    the position of each value is indexed in memory.
+// 2. Values are read back by mmap, the redo of one transaction is read in the order it is
+//    written, which is sequential read of the file.
+// 3. Space of deleted value is released by punching hole, and the file is truncated once all
+//    values are deleted, so that there is no compaction at all. The space of a value being
+//    read is released after the last reader of it finishes.
+class ObLogSpillFile
+{
+public:
+  ObLogSpillFile();
+  ~ObLogSpillFile();
+  int init(const std::string &file_path, common::ObCompressor *compressor);
+  void destroy();
+
+public:
+  int put(const std::string &key, const ObSlice &value);
+  int get(const std::string &key, std::string &value);
+  int del(const std::string &key);
+  // delete all keys in [begin_key, end_key)
+  int del_range(const std::string &begin_key, const std::string &end_key);
+  // remove the file from disk, all values are lost
+  int remove();
+  int64_t get_value_count() const;
+  int64_t get_file_size() const;
+
+  TO_STRING_KV("file_path", file_path_.c_str(), K_(fd), K_(write_offset), K_(io_cnt),
+      "value_count", index_.size());
+
+private:
+  struct ValuePos
+  {
+    int64_t offset_;
+    int64_t data_len_;  // length of data in file
+    int64_t orig_len_;  // length of value, equal to data_len_ if not compressed
+
+    bool is_compressed() const { return data_len_ != orig_len_; }
+    TO_STRING_KV(K_(offset), K_(data_len), K_(orig_len));
+  };
+  typedef std::map<std::string, ValuePos> ValueIndex;
+  // value which is being read out of lock_, it is not released until no one reads it
+  struct ReadingValue
+  {
+    ValuePos pos_;
+    int64_t ref_cnt_;
+    bool is_released_;
+  };
+  // offset of value -> ReadingValue, values never overlap in file
+  typedef std::map<int64_t, ReadingValue> ReadingValueMap;
+
+private:
+  int compress_(const ObSlice &value, char *&compress_buf, const char *&data, int64_t &data_len);
+  int write_(const char *data, const int64_t data_len, const int64_t offset);
+  int read_(const ValuePos &pos, std::string &value);
+  // release the space of value, caller should hold lock_
+  void release_(const ValuePos &pos);
+  // release the space of value, or delay it until the readers of value finish, caller should
+  // hold lock_
+  void release_or_delay_(const ValuePos &pos);
+  // caller should hold lock_
+  void inc_reading_ref_(const ValuePos &pos);
+  void dec_reading_ref_(const ValuePos &pos);
+  // truncate file if there is no value and no io on going, caller should hold lock_
+  void try_truncate_();
+
+private:
+  static const int64_t PRINT_LOG_INTERVAL = 10 * 1000 * 1000;
+
+  bool is_inited_;
+  int fd_;
+  std::string file_path_;
+  common::ObCompressor *compressor_;
+  mutable lib::ObMutex lock_;
+  ValueIndex index_;
+  ReadingValueMap reading_values_;
+  int64_t write_offset_;
+  // count of reads and writes out of lock_, which prevents the file from being truncated
+  int64_t io_cnt_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObLogSpillFile);
+};
+
+// Every column family (i.e. tenant) has its own spill file under the store service path,
+// and the default column family is the file named "default".
+class ObLogFileStoreService : public IObStoreService
+{
+public:
+  ObLogFileStoreService();
+  virtual ~ObLogFileStoreService();
+  int init(const std::string &path);
+  void destroy();
+
+public:
+  virtual int put(const std::string &key, const ObSlice &value);
+  virtual int put(void *cf_handle, const std::string &key, const ObSlice &value);
+
+  virtual int batch_write(void *cf_handle, const std::vector<std::string> &keys, const std::vector<ObSlice> &values);
+
+  virtual int get(const std::string &key, std::string &value);
+  virtual int get(void *cf_handle, const std::string &key, std::string &value);
+
+  virtual int del(const std::string &key);
+  virtual int del(void *cf_handle, const std::string &key);
+  virtual int del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key);
+
+  virtual int create_column_family(const std::string& column_family_name,
+      void *&cf_handle);
+  virtual int drop_column_family(void *cf_handle);
+  virtual int destory_column_family(void *cf_handle);
+
+  virtual void mark_stop_flag() override { ATOMIC_SET(&is_stopped_, true); }
+  virtual int close() override;
+  virtual void get_mem_usage(const std::vector<uint64_t> ids,
+      const std::vector<void *> cf_handles);
+  OB_INLINE bool is_stopped() const { return ATOMIC_LOAD(&is_stopped_); }
+
+private:
+  int init_dir_(const char *dir_path);
+  int create_spill_file_(const std::string &name, ObLogSpillFile *&spill_file);
+
+private:
+  bool is_inited_;
+  bool is_stopped_;
+  std::string path_;
+  common::ObCompressor *compressor_;
+  ObLogSpillFile *default_file_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObLogFileStoreService);
+};
+
+}
+}
+
+#endif
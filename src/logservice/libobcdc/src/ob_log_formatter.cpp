@@ -228,8 +228,16 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
-    const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue, except for
+    // the large ObLogEntryTask, whose stmts are pushed to all queues in turn.
+    // The output order is not affected: rows are linked in the order of stmt list
+    // by the thread which formats the last stmt, see finish_format_.
+    const int64_t shard_stmt_count_threshold = TCONF.formatter_shard_stmt_count_threshold;
+    DmlStmtTask *dml_stmt_task = dynamic_cast<DmlStmtTask *>(stmt_task);
+    const bool need_shard = shard_stmt_count_threshold > 0
+        && NULL != dml_stmt_task
+        && dml_stmt_task->get_redo_log_entry_task().get_stmt_num() > shard_stmt_count_threshold;
+    uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
     int64_t stmt_count = 0;
 
     while (OB_SUCC(ret) && NULL != stmt_task) {
@@ -241,6 +249,9 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
       if (OB_SUCC(ret)) {
         stmt_task = next;
         ++stmt_count;
+        if (need_shard) {
+          ++hash_value;
+        }
       } else {
         if (OB_IN_STOP_STATE != ret) {
           LOG_ERROR("push task into formatter fail", KR(ret), K(push_task), K(hash_value), K(stmt_count));
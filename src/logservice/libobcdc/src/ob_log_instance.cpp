@@ -57,6 +57,7 @@
 #include "ob_log_start_schema_matcher.h"  // ObLogStartSchemaMatcher
 #include "ob_log_tenant_mgr.h"            // IObLogTenantMgr
 #include "ob_log_rocksdb_store_service.h" // RocksDbStoreService
+#include "ob_log_file_store_service.h"    // ObLogFileStoreService
 
 #include "ob_log_trace_id.h"
 #include "share/ob_simple_mem_limit_getter.h"
@@ -817,7 +818,17 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
 
   INIT(log_entry_task_pool_, ObLogEntryTaskPool, TCONF.log_entry_task_prealloc_count);
 
-  INIT(store_service_, RocksDbStoreService, store_service_path);
+  if (OB_SUCC(ret)) {
+    const char *store_service_type = TCONF.store_service_type.str();
+    if (0 == strcmp("rocksdb", store_service_type)) {
+      INIT(store_service_, RocksDbStoreService, store_service_path);
+    } else if (0 == strcmp("file", store_service_type)) {
+      INIT(store_service_, ObLogFileStoreService, store_service_path);
+    } else {
+      ret = OB_INVALID_CONFIG;
+      LOG_ERROR("unknown store_service_type, expect rocksdb or file", KR(ret), K(store_service_type));
+    }
+  }
 
   INIT(br_pool_, ObLogBRPool, TCONF.binlog_record_prealloc_count);
 
@@ -1289,7 +1300,11 @@ void ObLogInstance::destroy_components_()
   DESTROY(br_pool_, ObLogBRPool);
   DESTROY(storager_, ObLogStorager);
   DESTROY(reader_, ObLogReader);
-  DESTROY(store_service_, RocksDbStoreService);
+  if (NULL != dynamic_cast<ObLogFileStoreService *>(store_service_)) {
+    DESTROY(store_service_, ObLogFileStoreService);
+  } else {
+    DESTROY(store_service_, RocksDbStoreService);
+  }
   if (is_data_dict_refresh_mode(refresh_mode_)) {
     ObLogMetaDataService::get_instance().destroy();
   }
@@ -150,6 +150,7 @@ LogBlockHandler::LogBlockHandler()
     trace_time_(OB_INVALID_TIMESTAMP),
     dir_fd_(-1),
     io_fd_(-1),
+    enable_group_sync_(false),
     is_inited_(false)
 {
 }
@@ -162,7 +163,8 @@ LogBlockHandler::~LogBlockHandler()
 int LogBlockHandler::init(const int dir_fd,
                           const int64_t log_block_size,
                           const int64_t align_size,
-                          const int64_t align_buf_size)
+                          const int64_t align_buf_size,
+                          const bool enable_group_sync)
 {
   int ret = OB_SUCCESS;
   if (IS_INIT) {
@@ -177,8 +179,10 @@ int LogBlockHandler::init(const int dir_fd,
   } else {
     dir_fd_ = dir_fd;
     log_block_size_ = log_block_size;
+    enable_group_sync_ = enable_group_sync;
     is_inited_ = true;
-    PALF_LOG(INFO, "LogBlockHandler init success", K(ret), K(log_block_size_), K(align_size), K(align_buf_size));
+    PALF_LOG(INFO, "LogBlockHandler init success", K(ret), K(log_block_size_), K(align_size), K(align_buf_size),
+             K(enable_group_sync));
   }
   return ret;
 }
@@ -193,6 +197,7 @@ void LogBlockHandler::destroy()
       io_fd_ = -1;
     }
     log_block_size_ = 0;
+    enable_group_sync_ = false;
     dio_aligned_buf_.destroy();
     PALF_LOG(INFO, "LogFileHandler destroy success");
   }
@@ -203,6 +208,10 @@ int LogBlockHandler::switch_next_block(const char *block_path)
   int ret = OB_SUCCESS;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
+  // NB: the logs written into current block may be acked by the next group sync, which
+  // only syncs the next block, so sync current block before closing it.
+  } else if (OB_FAIL(sync())) {
+    PALF_LOG(ERROR, "sync current block failed", K(ret), K(block_path));
   } else if (OB_FAIL(inner_close_())) {
     PALF_LOG(ERROR, "inner_close_", K(ret), K(block_path));
   } else if (OB_FAIL(open(block_path))) {
@@ -283,6 +292,43 @@ int LogBlockHandler::writev(const offset_t offset,
   return ret;
 }
 
+// NB: O_DIRECT only bypasses the page cache, a finished write may still stay in the volatile
+// cache of the device, and writing into the preallocated extents of a block changes the
+// metadata of the file, so the block must be fdatasync'ed before the logs are acked.
+// Like pwrite, retry fdatasync until it succeeds, otherwise there would be a hole in the
+// sliding window. While retrying, the LogIOWorker is stuck in one io task, so the log disk
+// will be detected as hung by the io start time of PalfEnvImpl.
+int LogBlockHandler::sync()
+{
+  int ret = OB_SUCCESS;
+  int64_t time_interval = OB_INVALID_TIMESTAMP;
+  const int64_t start_ts = ObTimeUtility::fast_current_time();
+  if (false == enable_group_sync_) {
+    // each write has been persisted with O_SYNC
+  } else if (-1 == io_fd_) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(ERROR, "block has not been opened", K(ret), KPC(this));
+  } else {
+    do {
+      ret = OB_E(EventTable::EN_LOGSERVICE_GROUP_SYNC_FAILED) OB_SUCCESS;
+      if (OB_SUCC(ret) && -1 == ::fdatasync(io_fd_)) {
+        ret = convert_sys_errno();
+      }
+      if (OB_FAIL(ret)) {
+        if (palf_reach_time_interval(1000 * 1000, time_interval)) {
+          PALF_LOG(ERROR, "::fdatasync failed, retry until success", K(ret), K(errno), KPC(this));
+        }
+        ob_usleep(RETRY_INTERVAL);
+      }
+    } while (OB_FAIL(ret));
+    const int64_t cost_ts = ObTimeUtility::fast_current_time() - start_ts;
+    if (cost_ts >= 10 * 1000) {
+      PALF_LOG_RET(WARN, OB_ERR_TOO_MUCH_TIME, "sync block cost too much time", K(cost_ts), KPC(this));
+    }
+  }
+  return ret;
+}
+
 int LogBlockHandler::inner_close_()
 {
   int ret = OB_SUCCESS;
@@ -306,7 +352,8 @@ int LogBlockHandler::inner_open_(const char *block_path)
 {
   int ret = OB_SUCCESS;
   do {
-    if (-1 == (io_fd_ = ::openat(dir_fd_, block_path, LOG_WRITE_FLAG, FILE_OPEN_MODE))) {
+    const int open_flag = enable_group_sync_ ? LOG_WRITE_FLAG_GROUP_SYNC : LOG_WRITE_FLAG;
+    if (-1 == (io_fd_ = ::openat(dir_fd_, block_path, open_flag, FILE_OPEN_MODE))) {
       ret = convert_sys_errno();
       PALF_LOG(ERROR, "open block failed", K(ret), K(errno), K(block_path), K(dir_fd_));
       ob_usleep(RETRY_INTERVAL);
@@ -90,7 +90,8 @@ public:
   int init(const int dir_fd,
            const int64_t log_block_size,
            const int64_t align_size,
-           const int64_t align_buf_size);
+           const int64_t align_buf_size,
+           const bool enable_group_sync);
 
   void destroy();
 
@@ -128,7 +129,11 @@ public:
   int writev(const offset_t offset,
              const LogWriteBuf &write_buf);
 
-  TO_STRING_KV(K_(dio_aligned_buf), K_(log_block_size), K_(dir_fd), K_(io_fd));
+  // @brief persist the data written into current block, only need when group sync is
+  // enabled, the block is opened without O_SYNC. It retries until success.
+  int sync();
+
+  TO_STRING_KV(K_(dio_aligned_buf), K_(log_block_size), K_(dir_fd), K_(io_fd), K_(enable_group_sync));
 private:
   // if timeout, retry until open block return an explicit error code
   // @brief block_path, the block path to be opened
@@ -161,6 +166,7 @@ private:
   int64_t trace_time_;
   int dir_fd_;
   int io_fd_;
+  bool enable_group_sync_;
   bool is_inited_;
 };
 } // end of logservice
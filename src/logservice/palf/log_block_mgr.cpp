@@ -39,6 +39,7 @@ LogBlockMgr::LogBlockMgr() : curr_writable_handler_(),
                              dir_fd_(-1),
                              align_size_(-1),
                              align_buf_size_(-1),
+                             enable_group_sync_(false),
                              is_inited_(false)
 {
 }
@@ -53,7 +54,8 @@ int LogBlockMgr::init(const char *log_dir,
                       const int64_t align_size,
                       const int64_t align_buf_size,
                       int64_t log_block_size,
-                      ILogBlockPool *log_block_pool)
+                      ILogBlockPool *log_block_pool,
+                      const bool enable_group_sync)
 {
   int ret = OB_SUCCESS;
   if (IS_INIT) {
@@ -63,7 +65,8 @@ int LogBlockMgr::init(const char *log_dir,
   } else if (-1 == (dir_fd_ = ::open(log_dir, O_DIRECTORY | O_RDONLY))) {
     ret = convert_sys_errno();
     PALF_LOG(ERROR, "::open failed", K(ret), K(log_dir));
-  } else if (OB_FAIL(curr_writable_handler_.init(dir_fd_, log_block_size, align_size, align_buf_size))) {
+  } else if (OB_FAIL(curr_writable_handler_.init(dir_fd_, log_block_size, align_size, align_buf_size,
+                                                 enable_group_sync))) {
     PALF_LOG(ERROR, "init curr_writable_handler_ failed", K(ret), K(log_dir));
   } else if (OB_FAIL(do_scan_dir_(log_dir, initial_block_id, log_block_pool))) {
     PALF_LOG(ERROR, "do_scan_dir_ failed", K(ret), K(log_dir));
@@ -75,8 +78,9 @@ int LogBlockMgr::init(const char *log_dir,
     log_block_pool_ = log_block_pool;
     align_size_ = align_size;
     align_buf_size_ = align_buf_size;
+    enable_group_sync_ = enable_group_sync;
     is_inited_ = true;
-    PALF_LOG(INFO, "LogBlockMgr init success", K(ret), K(log_dir_), K(log_block_size));
+    PALF_LOG(INFO, "LogBlockMgr init success", K(ret), K(log_dir_), K(log_block_size), K(enable_group_sync));
   }
   if (OB_FAIL(ret) && OB_INIT_TWICE != ret) {
     destroy();
@@ -101,6 +105,7 @@ void LogBlockMgr::destroy()
   is_inited_ = false;
   align_size_ = -1;
   align_buf_size_ = -1;
+  enable_group_sync_ = false;
   if (-1 != dir_fd_) {
     close_with_ret(dir_fd_);
     dir_fd_ = -1;
@@ -184,6 +189,19 @@ int LogBlockMgr::writev(const block_id_t block_id,
   return ret;
 }
 
+int LogBlockMgr::sync_curr_block()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(curr_writable_handler_.sync())) {
+    PALF_LOG(ERROR, "LogBlockHandler sync failed", K(ret), KPC(this));
+  } else {
+    PALF_LOG(TRACE, "LogBlockMgr sync_curr_block success", K(ret), K_(curr_writable_block_id));
+  }
+  return ret;
+}
+
 int LogBlockMgr::truncate(const block_id_t block_id, const offset_t offset)
 {
   int ret = OB_SUCCESS;
@@ -279,7 +297,8 @@ int LogBlockMgr::create_tmp_block_handler(const block_id_t block_id)
 	} else if (OB_FAIL(curr_writable_handler_.close())) {
     PALF_LOG(ERROR, "curr_writable_handler_ close success");
   } else if (FALSE_IT(curr_writable_handler_.destroy())) {
-  } else if (OB_FAIL(curr_writable_handler_.init(dir_fd_, log_block_size_, align_size_, align_buf_size_))) {
+  } else if (OB_FAIL(curr_writable_handler_.init(dir_fd_, log_block_size_, align_size_, align_buf_size_,
+                                                 enable_group_sync_))) {
     PALF_LOG(ERROR, "curr_writable_handler_ init failed", K(ret), KPC(this));
   } else if (OB_FAIL(log_block_pool_->create_block_at(dir_fd_, tmp_block_path, log_block_size_))) {
   } else if (OB_FAIL(curr_writable_handler_.open(tmp_block_path))) {
@@ -303,6 +322,7 @@ int LogBlockMgr::rename_tmp_block_handler_to_normal(const block_id_t block_id)
 	// 2. delete "block_id", make sure each block has returned into BlockPool
 	// 3. rename "block_id.flashback" to "block_id"
 	// NB: for restart, the block which named 'block_id.flashback' must be renamed to 'block_id'
+	// NB: when group sync is enabled, the data of tmp block must be persisted before renaming.
 	char tmp_block_path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
 	char block_path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
 	char flashback_block_path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
@@ -316,6 +336,8 @@ int LogBlockMgr::rename_tmp_block_handler_to_normal(const block_id_t block_id)
 		PALF_LOG(ERROR, "block_id_to_tmp_string failed", K(ret), K(block_id));
   } else if (OB_FAIL(block_id_to_flashback_string(block_id, flashback_block_path, OB_MAX_FILE_NAME_LENGTH))) {
 		PALF_LOG(ERROR, "block_id_to_flashback_string failed", K(ret), K(block_id));
+  } else if (OB_FAIL(curr_writable_handler_.sync())) {
+    PALF_LOG(ERROR, "sync tmp block failed", K(ret), KPC(this));
 	} else if (OB_FAIL(do_rename_and_fsync_(tmp_block_path, flashback_block_path))) {
     PALF_LOG(ERROR, "do_rename_and_fsync_ failed", K(ret), KPC(this));
 	} else if(OB_FAIL(do_delete_block_(block_id))) {
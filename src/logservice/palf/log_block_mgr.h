@@ -38,7 +38,8 @@ public:
   int init(const char *log_dir, const block_id_t block_id,
            const int64_t align_size,
            const int64_t align_buf_size,
-           int64_t log_block_size, ILogBlockPool *log_block_pool);
+           int64_t log_block_size, ILogBlockPool *log_block_pool,
+           const bool enable_group_sync);
   void reset(const block_id_t init_block_id);
 
   void destroy();
@@ -58,6 +59,10 @@ public:
              const offset_t offset,
              const LogWriteBuf &write_buf);
 
+  // @brief persist the data written into current writable block, the blocks before it
+  // have been persisted when switching block.
+  int sync_curr_block();
+
   int truncate(const block_id_t block_id,
                const offset_t offset);
   // @brief used to get min block id and max block id
@@ -77,7 +82,8 @@ public:
   int delete_block_from_back_to_front_until(const block_id_t block_id);
   int rename_tmp_block_handler_to_normal(const block_id_t block_id);
   // =======================================================
-  TO_STRING_KV(K_(log_dir), K_(dir_fd), K_(min_block_id), K_(max_block_id), K_(curr_writable_block_id));
+  TO_STRING_KV(K_(log_dir), K_(dir_fd), K_(min_block_id), K_(max_block_id), K_(curr_writable_block_id),
+               K_(enable_group_sync));
 private:
   // @brief this function used to rebuild 'blocks_'
   // Firstly, scan the directory, get the name of all blocks;
@@ -125,6 +131,7 @@ private:
   int dir_fd_;
   int64_t align_size_;
   int64_t align_buf_size_;
+  bool enable_group_sync_;
   bool is_inited_;
 };
 } // end of logservice
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX PALF
 #include "log_cache.h"
 #include "palf_handle_impl.h"
+#include "share/rc/ob_tenant_base.h"
 
 namespace oceanbase
 {
@@ -97,5 +98,302 @@ int LogHotCache::read(const LSN &read_begin_lsn,
   return ret;
 }
 
+LogKVCacheKey::LogKVCacheKey()
+  : tenant_id_(OB_INVALID_TENANT_ID),
+    palf_id_(INVALID_PALF_ID),
+    version_(0),
+    line_lsn_()
+{}
+
+LogKVCacheKey::LogKVCacheKey(const uint64_t tenant_id,
+                             const int64_t palf_id,
+                             const int64_t version,
+                             const LSN &line_lsn)
+  : tenant_id_(tenant_id),
+    palf_id_(palf_id),
+    version_(version),
+    line_lsn_(line_lsn)
+{}
+
+LogKVCacheKey::~LogKVCacheKey()
+{}
+
+bool LogKVCacheKey::operator ==(const ObIKVCacheKey &other) const
+{
+  const LogKVCacheKey &other_key = reinterpret_cast<const LogKVCacheKey &>(other);
+  return tenant_id_ == other_key.tenant_id_
+      && palf_id_ == other_key.palf_id_
+      && version_ == other_key.version_
+      && line_lsn_ == other_key.line_lsn_;
+}
+
+uint64_t LogKVCacheKey::get_tenant_id() const
+{
+  return tenant_id_;
+}
+
+uint64_t LogKVCacheKey::hash() const
+{
+  uint64_t hash_val = murmurhash(&tenant_id_, sizeof(tenant_id_), 0);
+  hash_val = murmurhash(&palf_id_, sizeof(palf_id_), hash_val);
+  hash_val = murmurhash(&version_, sizeof(version_), hash_val);
+  hash_val = murmurhash(&line_lsn_.val_, sizeof(line_lsn_.val_), hash_val);
+  return hash_val;
+}
+
+int64_t LogKVCacheKey::size() const
+{
+  return sizeof(*this);
+}
+
+int LogKVCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(WARN, "invalid log kv cache key", K(ret), KPC(this));
+  } else {
+    key = new (buf) LogKVCacheKey(tenant_id_, palf_id_, version_, line_lsn_);
+  }
+  return ret;
+}
+
+bool LogKVCacheKey::is_valid() const
+{
+  return is_valid_tenant_id(tenant_id_) && is_valid_palf_id(palf_id_) && line_lsn_.is_valid();
+}
+
+LogKVCacheValue::LogKVCacheValue()
+  : buf_(NULL),
+    buf_size_(0)
+{}
+
+LogKVCacheValue::LogKVCacheValue(const char *buf, const int64_t buf_size)
+  : buf_(buf),
+    buf_size_(buf_size)
+{}
+
+LogKVCacheValue::~LogKVCacheValue()
+{}
+
+int64_t LogKVCacheValue::size() const
+{
+  return sizeof(*this) + buf_size_;
+}
+
+int LogKVCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len), "request_size", size());
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(WARN, "invalid log kv cache value", K(ret), KPC(this));
+  } else {
+    MEMCPY(buf + sizeof(*this), buf_, buf_size_);
+    value = new (buf) LogKVCacheValue(buf + sizeof(*this), buf_size_);
+  }
+  return ret;
+}
+
+LogKVCache &LogKVCache::get_instance()
+{
+  static LogKVCache instance;
+  return instance;
+}
+
+LogColdCache::LogColdCache()
+  : palf_id_(INVALID_PALF_ID),
+    tenant_id_(OB_INVALID_TENANT_ID),
+    logical_block_size_(0),
+    version_(0),
+    last_read_end_lsn_(),
+    hit_line_cnt_(0),
+    miss_line_cnt_(0),
+    cache_read_size_(0),
+    disk_read_size_(0),
+    last_print_time_(0),
+    is_inited_(false)
+{}
+
+LogColdCache::~LogColdCache()
+{
+  destroy();
+}
+
+int LogColdCache::init(const int64_t palf_id, const int64_t logical_block_size)
+{
+  int ret = OB_SUCCESS;
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+  } else if (false == is_valid_palf_id(palf_id) || logical_block_size <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), K(palf_id), K(logical_block_size));
+  } else if (!OB_LOG_KV_CACHE.is_inited() || !is_valid_tenant_id(MTL_ID())) {
+    // no kv cache in this process (e.g. tools), read from disk directly
+    PALF_LOG(INFO, "log kv cache is not available, skip init cold cache", K(palf_id), K(MTL_ID()));
+  } else {
+    palf_id_ = palf_id;
+    tenant_id_ = MTL_ID();
+    logical_block_size_ = logical_block_size;
+    invalidate();
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void LogColdCache::destroy()
+{
+  is_inited_ = false;
+  palf_id_ = INVALID_PALF_ID;
+  tenant_id_ = OB_INVALID_TENANT_ID;
+  logical_block_size_ = 0;
+  last_read_end_lsn_.reset();
+}
+
+void LogColdCache::invalidate()
+{
+  // the version is allocated globally, lines cached by a removed replica with the
+  // same palf_id are never hit by the replica created later.
+  static int64_t GLOBAL_VERSION = 0;
+  ATOMIC_STORE(&version_, ATOMIC_AAF(&GLOBAL_VERSION, 1));
+}
+
+LSN LogColdCache::get_line_begin_(const LSN &lsn) const
+{
+  const offset_t block_begin = lsn.val_ - lsn_2_offset(lsn, logical_block_size_);
+  return LSN(block_begin + lower_align(lsn_2_offset(lsn, logical_block_size_), LINE_SIZE));
+}
+
+LSN LogColdCache::get_line_end_(const LSN &line_begin_lsn) const
+{
+  const LSN block_end_lsn((lsn_2_block(line_begin_lsn, logical_block_size_) + 1) * logical_block_size_);
+  return MIN(line_begin_lsn + LINE_SIZE, block_end_lsn);
+}
+
+int LogColdCache::read(const int64_t version,
+                       const LSN &read_begin_lsn,
+                       const int64_t in_read_size,
+                       char *buf,
+                       int64_t &out_read_size)
+{
+  int ret = OB_SUCCESS;
+  out_read_size = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!read_begin_lsn.is_valid() || in_read_size <= 0 || OB_ISNULL(buf)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), KPC(this), K(read_begin_lsn), K(in_read_size), KP(buf));
+  } else {
+    const LSN read_end_lsn = read_begin_lsn + in_read_size;
+    LSN curr_lsn = read_begin_lsn;
+    bool is_missed = false;
+    int64_t hit_line_cnt = 0;
+    while (OB_SUCC(ret) && !is_missed && curr_lsn < read_end_lsn) {
+      const LSN line_begin_lsn = get_line_begin_(curr_lsn);
+      const LogKVCacheKey key(tenant_id_, palf_id_, version, line_begin_lsn);
+      const LogKVCacheValue *value = NULL;
+      common::ObKVCacheHandle handle;
+      if (OB_FAIL(OB_LOG_KV_CACHE.get(key, value, handle))) {
+        if (OB_ENTRY_NOT_EXIST == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          PALF_LOG(WARN, "get from log kv cache failed", K(ret), K(key));
+        }
+        is_missed = true;
+      } else if (OB_ISNULL(value)
+          || OB_UNLIKELY(line_begin_lsn + value->get_buf_size() != get_line_end_(line_begin_lsn))) {
+        ret = OB_ERR_UNEXPECTED;
+        PALF_LOG(ERROR, "unexpected cache line", K(ret), K(key), KPC(value));
+      } else {
+        const int64_t line_offset = curr_lsn - line_begin_lsn;
+        const int64_t copy_size = MIN(static_cast<int64_t>(read_end_lsn - curr_lsn),
+                                           value->get_buf_size() - line_offset);
+        MEMCPY(buf + out_read_size, value->get_buf() + line_offset, copy_size);
+        out_read_size += copy_size;
+        curr_lsn = curr_lsn + copy_size;
+        hit_line_cnt++;
+      }
+    }
+    (void)ATOMIC_AAF(&hit_line_cnt_, hit_line_cnt);
+    (void)ATOMIC_AAF(&cache_read_size_, out_read_size);
+    if (is_missed) {
+      (void)ATOMIC_AAF(&miss_line_cnt_, 1);
+    } else {
+      ATOMIC_STORE(&last_read_end_lsn_.val_, read_end_lsn.val_);
+    }
+    try_print_stat_();
+  }
+  return ret;
+}
+
+void LogColdCache::get_fill_range(const LSN &read_begin_lsn,
+                                  const LSN &read_end_lsn,
+                                  const LSN &readable_end_lsn,
+                                  LSN &fill_begin_lsn,
+                                  LSN &fill_end_lsn) const
+{
+  const bool is_sequential = read_begin_lsn.val_ == ATOMIC_LOAD(&last_read_end_lsn_.val_);
+  fill_begin_lsn = get_line_begin_(read_begin_lsn);
+  fill_end_lsn = get_line_end_(get_line_begin_(read_end_lsn - 1));
+  for (int64_t i = 0; is_sequential && i < READAHEAD_LINE_CNT && fill_end_lsn < readable_end_lsn; ++i) {
+    fill_end_lsn = get_line_end_(fill_end_lsn);
+  }
+  fill_end_lsn = MIN(fill_end_lsn, readable_end_lsn);
+}
+
+int LogColdCache::fill(const int64_t version,
+                       const LSN &begin_lsn,
+                       const char *buf,
+                       const int64_t buf_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!begin_lsn.is_valid() || OB_ISNULL(buf) || buf_size <= 0
+      || OB_UNLIKELY(get_line_begin_(begin_lsn) != begin_lsn)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), KPC(this), K(begin_lsn), KP(buf), K(buf_size));
+  } else {
+    const LSN end_lsn = begin_lsn + buf_size;
+    LSN line_begin_lsn = begin_lsn;
+    LSN line_end_lsn = get_line_end_(line_begin_lsn);
+    // the last incomplete line is not cached
+    while (OB_SUCC(ret) && line_end_lsn <= end_lsn) {
+      const LogKVCacheKey key(tenant_id_, palf_id_, version, line_begin_lsn);
+      const LogKVCacheValue value(buf + (line_begin_lsn - begin_lsn), line_end_lsn - line_begin_lsn);
+      if (OB_FAIL(OB_LOG_KV_CACHE.put(key, value, false /*overwrite*/))) {
+        if (OB_ENTRY_EXIST == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          PALF_LOG(WARN, "put into log kv cache failed", K(ret), K(key));
+        }
+      }
+      line_begin_lsn = line_end_lsn;
+      line_end_lsn = get_line_end_(line_begin_lsn);
+    }
+    (void)ATOMIC_AAF(&disk_read_size_, buf_size);
+    ATOMIC_STORE(&last_read_end_lsn_.val_, end_lsn.val_);
+  }
+  return ret;
+}
+
+void LogColdCache::try_print_stat_()
+{
+  if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, last_print_time_)) {
+    const int64_t hit_cnt = ATOMIC_TAS(&hit_line_cnt_, 0);
+    const int64_t miss_cnt = ATOMIC_TAS(&miss_line_cnt_, 0);
+    const int64_t cache_read_size = ATOMIC_TAS(&cache_read_size_, 0);
+    const int64_t disk_read_size = ATOMIC_TAS(&disk_read_size_, 0);
+    const int64_t total_cnt = (0 == hit_cnt + miss_cnt) ? 1 : hit_cnt + miss_cnt;
+    PALF_LOG(INFO, "[PALF STAT COLD CACHE HIT RATE]", K_(palf_id), K(hit_cnt), K(miss_cnt),
+        K(cache_read_size), K(disk_read_size), "hit rate", hit_cnt * 1.0 / total_cnt);
+  }
+}
+
 } // end namespace palf
 } // end namespace oceanbase
@@ -14,12 +14,13 @@
 #define OCEANBASE_PALF_LOG_CACHE_
 
 #include <cstdint>                                       // int64_t
+#include "share/cache/ob_kv_storecache.h"               // ObKVCache
+#include "lsn.h"                                        // LSN
 
 namespace oceanbase
 {
 namespace palf
 {
-class LSN;
 class IPalfHandleImpl;
 
 class LogHotCache
@@ -44,6 +45,125 @@ private:
   bool is_inited_;
 };
 
+// Key of one cache line of LogColdCache.
+// 'version_' is unique for all replicas of the server and changes when the logs of the
+// replica are truncated or flashbacked, so the stale lines are never hit again.
+class LogKVCacheKey : public common::ObIKVCacheKey
+{
+public:
+  LogKVCacheKey();
+  LogKVCacheKey(const uint64_t tenant_id, const int64_t palf_id, const int64_t version,
+                const LSN &line_lsn);
+  ~LogKVCacheKey();
+  bool operator ==(const ObIKVCacheKey &other) const override;
+  uint64_t get_tenant_id() const override;
+  uint64_t hash() const override;
+  int64_t size() const override;
+  int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const override;
+  bool is_valid() const;
+  TO_STRING_KV(K_(tenant_id), K_(palf_id), K_(version), K_(line_lsn));
+private:
+  uint64_t tenant_id_;
+  int64_t palf_id_;
+  int64_t version_;
+  LSN line_lsn_;
+};
+
+class LogKVCacheValue : public common::ObIKVCacheValue
+{
+public:
+  LogKVCacheValue();
+  LogKVCacheValue(const char *buf, const int64_t buf_size);
+  ~LogKVCacheValue();
+  int64_t size() const override;
+  int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const override;
+  bool is_valid() const { return NULL != buf_ && buf_size_ > 0; }
+  const char *get_buf() const { return buf_; }
+  int64_t get_buf_size() const { return buf_size_; }
+  TO_STRING_KV(KP_(buf), K_(buf_size));
+private:
+  const char *buf_;
+  int64_t buf_size_;
+};
+
+class LogKVCache : public common::ObKVCache<LogKVCacheKey, LogKVCacheValue>
+{
+public:
+  static LogKVCache &get_instance();
+  bool is_inited() const { return get_cache_id() >= 0; }
+private:
+  LogKVCache() {}
+  ~LogKVCache() {}
+  DISALLOW_COPY_AND_ASSIGN(LogKVCache);
+};
+
+#define OB_LOG_KV_CACHE (::oceanbase::palf::LogKVCache::get_instance())
+
+// Cache of logs on disk for one palf replica, the logs read beyond LogHotCache by lagging
+// followers, CDC and archive fetchers and rebuild are cached in OB_LOG_KV_CACHE by
+// LINE_SIZE lines, which are aligned to the start of each block.
+//
+// Only complete lines before the readable log tail are cached, and the lines are
+// invalidated by changing 'version_' when the logs are rewritten (truncate and flashback).
+// The caller should check the lower bound of the read range, because lines of
+// recycled blocks may still be in cache.
+class LogColdCache
+{
+public:
+  LogColdCache();
+  ~LogColdCache();
+  int init(const int64_t palf_id, const int64_t logical_block_size);
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  // make all cached lines unreachable, must be called after the logs are rewritten.
+  void invalidate();
+  // copy the longest cached prefix of [read_begin_lsn, read_begin_lsn + in_read_size) into 'buf'.
+  //
+  // @param[in]  version, from get_version() before reading the readable log tail.
+  // @param[out] out_read_size, 0 means the first line is missed.
+  int read(const int64_t version,
+           const LSN &read_begin_lsn,
+           const int64_t in_read_size,
+           char *buf,
+           int64_t &out_read_size);
+  // get the range to read from disk for the missed range [read_begin_lsn, read_end_lsn),
+  // the range is extended to complete lines and to the readahead lines for sequential
+  // reads, and it never exceeds 'readable_end_lsn'.
+  void get_fill_range(const LSN &read_begin_lsn,
+                      const LSN &read_end_lsn,
+                      const LSN &readable_end_lsn,
+                      LSN &fill_begin_lsn,
+                      LSN &fill_end_lsn) const;
+  // put the complete lines of [begin_lsn, begin_lsn + buf_size) read from disk into cache.
+  int fill(const int64_t version,
+           const LSN &begin_lsn,
+           const char *buf,
+           const int64_t buf_size);
+  int64_t get_version() const { return ATOMIC_LOAD(&version_); }
+  TO_STRING_KV(K_(palf_id), K_(tenant_id), K_(version), K_(last_read_end_lsn), K_(is_inited));
+public:
+  static const int64_t LINE_SIZE = 64 * 1024;
+  static const int64_t READAHEAD_LINE_CNT = 16;
+private:
+  LSN get_line_begin_(const LSN &lsn) const;
+  LSN get_line_end_(const LSN &line_begin_lsn) const;
+  void try_print_stat_();
+private:
+  int64_t palf_id_;
+  uint64_t tenant_id_;
+  int64_t logical_block_size_;
+  int64_t version_;
+  // end of the last read, used to detect sequential reads
+  LSN last_read_end_lsn_;
+  int64_t hit_line_cnt_;
+  int64_t miss_line_cnt_;
+  int64_t cache_read_size_;
+  int64_t disk_read_size_;
+  int64_t last_print_time_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(LogColdCache);
+};
+
 } // end namespace palf
 } // end namespace oceanbase
 
@@ -145,6 +145,8 @@ const uint64_t PALF_INITIAL_LSN_VAL = 0;
 // =========== Disk io start ==================
 constexpr int LOG_READ_FLAG = O_RDONLY | O_DIRECT | O_SYNC;
 constexpr int LOG_WRITE_FLAG = O_RDWR | O_DIRECT | O_SYNC;
+// used when group sync is enabled, the written blocks are persisted by LogIOWorker with fdatasync
+constexpr int LOG_WRITE_FLAG_GROUP_SYNC = O_RDWR | O_DIRECT;
 constexpr mode_t FILE_OPEN_MODE = S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH;
 // =========== Disk io end ====================
 
@@ -125,7 +125,8 @@ int LogEngine::init(const int64_t palf_id,
                                             LOG_DIO_ALIGNED_BUF_SIZE_META,
                                             log_meta_storage_update_manifest_cb,
                                             log_block_pool,
-                                            NULL /*set hot_cache to NULL for meta storage*/))) {
+                                            NULL /*set hot_cache to NULL for meta storage*/,
+                                            false /*meta is always written with O_SYNC*/))) {
     PALF_LOG(ERROR, "LogMetaStorage init failed", K(ret), K(palf_id), K(base_dir));
   } else if(0 != log_storage_block_size
       && OB_FAIL(log_storage_.init(base_dir,
@@ -137,7 +138,8 @@ int LogEngine::init(const int64_t palf_id,
                                    LOG_DIO_ALIGNED_BUF_SIZE_REDO,
                                    log_storage_update_manifest_cb,
                                    log_block_pool,
-                                   hot_cache))) {
+                                   hot_cache,
+                                   log_io_worker->is_group_sync_enabled()))) {
     PALF_LOG(ERROR, "LogStorage init failed!!!", K(ret), K(palf_id), K(base_dir), K(log_meta));
   } else if (OB_FAIL(log_net_service_.init(palf_id, log_rpc))) {
     PALF_LOG(ERROR, "LogNetService init failed", K(ret), K(palf_id));
@@ -233,6 +235,7 @@ int LogEngine::load(const int64_t palf_id,
                                             log_meta_storage_update_manifest_cb,
                                             log_block_pool,
                                             NULL, /*set hot_cache to NULL for meta storage*/
+                                            false, /*meta is always written with O_SYNC*/
                                             unused_meta_entry_header,
                                             last_meta_entry_start_lsn))) {
     PALF_LOG(ERROR, "LogMetaStorage load failed", K(ret), K(palf_id));
@@ -245,7 +248,8 @@ int LogEngine::load(const int64_t palf_id,
                                           log_storage_block_size, LOG_DIO_ALIGN_SIZE,
                                           LOG_DIO_ALIGNED_BUF_SIZE_REDO,
                                           log_storage_update_manifest_cb, log_block_pool,
-                                          hot_cache, entry_header, last_group_entry_header_lsn)))) {
+                                          hot_cache, log_io_worker->is_group_sync_enabled(),
+                                          entry_header, last_group_entry_header_lsn)))) {
     PALF_LOG(ERROR, "LogStorage load failed", K(ret), K(palf_id), K(base_dir));
   } else if (FALSE_IT(guard.click("load log_storage"))
              || (0 != log_storage_block_size
@@ -547,6 +551,20 @@ int LogEngine::append_log(const LSN &lsn, const LogWriteBuf &write_buf, const SC
   return ret;
 }
 
+int LogEngine::sync_log()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "LogEngine not inited!!!", K(ret), K_(palf_id), K_(is_inited));
+  } else if (OB_FAIL(log_storage_.sync())) {
+    PALF_LOG(ERROR, "LogStorage sync failed", K(ret), K_(palf_id), K_(is_inited));
+  } else {
+    PALF_LOG(TRACE, "LogEngine sync_log success", K(ret), K_(palf_id), K_(is_inited));
+  }
+  return ret;
+}
+
 int LogEngine::append_log(const LSNArray &lsn_array, const LogWriteBufArray &write_buf_array,
                           const SCNArray &scn_array)
 {
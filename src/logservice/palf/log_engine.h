@@ -146,6 +146,7 @@ public:
   // ====================== LogStorage start =====================
   int append_log(const LSN &lsn, const LogWriteBuf &write_buf, const share::SCN &scn);
   int append_log(const LSNArray &lsn, const LogWriteBufArray &write_buf, const SCNArray &scn_array);
+  int sync_log();
   int read_log(const LSN &lsn,
                const int64_t in_read_size,
                ReadBuf &read_buf,
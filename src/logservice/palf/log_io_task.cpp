@@ -189,6 +189,10 @@ int LogIOFlushLogTask::do_task_(int tg_id, IPalfEnvImpl *palf_env_impl)
     // Advance reuse lsn for group_buffer firstly, then callback asynchronous.
   } else if (OB_FAIL(guard.get_palf_handle_impl()->advance_reuse_lsn(flush_log_end_lsn))) {
     PALF_LOG(ERROR, "advance_reuse_lsn failed", K(ret), K(flush_log_end_lsn), K_(flush_log_cb_ctx));
+    // NB: the log is not batched when writing throttling is on, persist it by itself if
+    // group sync is enabled.
+  } else if (OB_FAIL(guard.get_palf_handle_impl()->inner_sync_log())) {
+    PALF_LOG(ERROR, "inner_sync_log failed", K(ret), K_(flush_log_cb_ctx));
   } else if (OB_FAIL(push_task_into_cb_thread_pool_(tg_id, this))) {
     PALF_LOG(WARN, "push_task_into_cb_thread_pool failed", K(ret), K(tg_id), KP(this));
   } else {
@@ -610,6 +614,59 @@ int BatchLogIOFlushLogTask::do_task(int tg_id, IPalfEnvImpl *palf_env_impl)
   return ret;
 }
 
+int BatchLogIOFlushLogTask::write_log(IPalfEnvImpl *palf_env_impl, bool &has_valid_data)
+{
+  int ret = OB_SUCCESS;
+  has_valid_data = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "BatchLogIOFlushLogTask not inited!!!", K(ret), KPC(this));
+  } else if (INVALID_PALF_ID == palf_id_ && true == io_task_array_.empty()) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(ERROR, "BatchLogIOFlushLogTask is empty", K(ret), KPC(this));
+  } else if (OB_FAIL(write_log_(palf_env_impl, has_valid_data))) {
+    PALF_LOG(WARN, "write_log_ failed", K(ret));
+    clear_memory_(palf_env_impl);
+  } else {
+  }
+  return ret;
+}
+
+int BatchLogIOFlushLogTask::sync_log(IPalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  IPalfHandleImplGuard guard;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "BatchLogIOFlushLogTask not inited!!!", K(ret), KPC(this));
+  } else if (OB_FAIL(palf_env_impl->get_palf_handle_impl(palf_id_, guard))) {
+    PALF_LOG(WARN, "IPalfEnvImpl get_palf_handle_impl failed", K(ret), K(palf_id_));
+  } else if (OB_FAIL(guard.get_palf_handle_impl()->inner_sync_log())) {
+    PALF_LOG(ERROR, "inner_sync_log failed", K(ret), KPC(this));
+  } else {
+  }
+  return ret;
+}
+
+int BatchLogIOFlushLogTask::push_flush_cb(int tg_id, IPalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "BatchLogIOFlushLogTask not inited!!!", K(ret), KPC(this));
+  } else if (OB_FAIL(push_flush_cb_to_thread_pool_(tg_id, palf_env_impl))) {
+    PALF_LOG(ERROR, "push_flush_cb_to_thread_pool_ failed", K(ret), KPC(this));
+    clear_memory_(palf_env_impl);
+  } else {
+  }
+  return ret;
+}
+
+void BatchLogIOFlushLogTask::discard(IPalfEnvImpl *palf_env_impl)
+{
+  clear_memory_(palf_env_impl);
+}
+
 int BatchLogIOFlushLogTask::push_flush_cb_to_thread_pool_(int tg_id, IPalfEnvImpl *palf_env_impl)
 {
   int ret = OB_SUCCESS;
@@ -641,18 +698,32 @@ int BatchLogIOFlushLogTask::push_flush_cb_to_thread_pool_(int tg_id, IPalfEnvImp
 // Any LogIOFlusLoghTask has been push into cb queue, the slot of io_task_array_ will reset to NULL,
 // any LogIOFlusLoghTask in io_task_array_ which is not NULL, will be released after do_task_.
 int BatchLogIOFlushLogTask::do_task_(int tg_id, IPalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  bool has_valid_data = false;
+  if (OB_FAIL(write_log_(palf_env_impl, has_valid_data))) {
+    PALF_LOG(WARN, "write_log_ failed", K(ret), KPC(this));
+  } else if (true == has_valid_data
+             && OB_FAIL(push_flush_cb_to_thread_pool_(tg_id, palf_env_impl))) {
+    PALF_LOG(ERROR, "push_flush_cb_to_thread_pool_ failed", K(ret), KPC(this));
+  } else {
+  }
+  return ret;
+}
+
+int BatchLogIOFlushLogTask::write_log_(IPalfEnvImpl *palf_env_impl, bool &has_valid_data)
 {
   int ret = OB_SUCCESS;
   int64_t palf_epoch = -1;
   IPalfHandleImplGuard guard;
   LSN flushed_log_end_lsn;
+  has_valid_data = false;
   if (OB_FAIL(palf_env_impl->get_palf_handle_impl(palf_id_, guard))) {
     PALF_LOG(WARN, "IPalfEnvImpl get_palf_handle_impl failed", K(ret), K(palf_id_));
   } else if (OB_FAIL(guard.get_palf_handle_impl()->get_palf_epoch(palf_epoch))) {
     PALF_LOG(WARN, "IPalfEnvImpl get_palf_epoch failed", K(ret), K(palf_id_));
   } else {
     const int64_t count = io_task_array_.count();
-    bool has_valid_data = false;
     for (int64_t i = 0; i < count && OB_SUCC(ret); i++) {
       LogIOFlushLogTask *io_task = io_task_array_[i];
       if (OB_ISNULL(io_task)) {
@@ -681,8 +752,6 @@ int BatchLogIOFlushLogTask::do_task_(int tg_id, IPalfEnvImpl *palf_env_impl)
         PALF_LOG(ERROR, "inner_append_log failed", K(ret), KPC(this));
       } else if (OB_FAIL(guard.get_palf_handle_impl()->advance_reuse_lsn(flushed_log_end_lsn))) {
         PALF_LOG(ERROR, "advance_reuse_lsn failed", K(ret), K(flushed_log_end_lsn));
-      } else if (OB_FAIL(push_flush_cb_to_thread_pool_(tg_id, palf_env_impl))) {
-        PALF_LOG(ERROR, "push_flush_cb_to_thread_pool_ failed", K(ret), KPC(this));
       } else {
       }
     }
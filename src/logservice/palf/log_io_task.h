@@ -192,12 +192,20 @@ public:
   void destroy();
   int push_back(LogIOFlushLogTask *task);
   int do_task(int tg_id, IPalfEnvImpl *palf_env_impl);
+  // 'do_task' is split into 'write_log', 'sync_log' and 'push_flush_cb' for group sync, the
+  // flush callbacks can only be pushed after the logs written by 'write_log' have been
+  // persisted by 'sync_log'. Each LogIOFlushLogTask will be freed when any of them failed.
+  int write_log(IPalfEnvImpl *palf_env_impl, bool &has_valid_data);
+  int sync_log(IPalfEnvImpl *palf_env_impl);
+  int push_flush_cb(int tg_id, IPalfEnvImpl *palf_env_impl);
+  void discard(IPalfEnvImpl *palf_env_impl);
   int64_t get_palf_id() const { return palf_id_; }
   int64_t get_count() const { return io_task_array_.count(); }
   TO_STRING_KV(K_(palf_id), "count", io_task_array_.count(), K_(lsn_array));
 private:
   int push_flush_cb_to_thread_pool_(int tg_id, IPalfEnvImpl *palf_env_impl);
   int do_task_(int tg_id, IPalfEnvImpl *palf_env_impl);
+  int write_log_(IPalfEnvImpl *palf_env_impl, bool &has_valid_data);
   void clear_memory_(IPalfEnvImpl *palf_env_impl);
 private:
   BatchIOTaskArray io_task_array_;
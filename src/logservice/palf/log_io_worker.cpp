@@ -223,6 +223,7 @@ LogIOWorker::LogIOWorker()
       print_log_interval_(OB_INVALID_TIMESTAMP),
       last_working_time_(OB_INVALID_TIMESTAMP),
       log_io_worker_queue_size_stat_("[PALF STAT LOG IO WORKER QUEUE SIZE]", PALF_STAT_PRINT_INTERVAL_US),
+      enable_group_sync_(false),
       is_inited_(false)
 {
 }
@@ -251,14 +252,16 @@ int LogIOWorker::init(const LogIOWorkerConfig &config,
     PALF_LOG(ERROR, "io task queue init failed", K(ret), K(config));
   } else if (OB_FAIL(batch_io_task_mgr_.init(config.batch_width_,
                                              config.batch_depth_,
-                                             allocator))) {
+                                             allocator,
+                                             config.enable_group_sync_))) {
     PALF_LOG(ERROR, "BatchLogIOFlushLogTaskMgr init failed", K(ret), K(config));
   } else {
     share::ObThreadPool::set_run_wrapper(MTL_CTX());
     log_io_worker_num_ = config.io_worker_num_;
     cb_thread_pool_tg_id_ = cb_thread_pool_tg_id;
     palf_env_impl_ = palf_env_impl;
-    PALF_REPORT_INFO_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id));
+    enable_group_sync_ = config.enable_group_sync_;
+    PALF_REPORT_INFO_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id), K_(enable_group_sync));
     log_io_worker_queue_size_stat_.set_extra_info(EXTRA_INFOS);
     is_inited_ = true;
     PALF_LOG(INFO, "LogIOWorker init success", K(ret), K(config), K(cb_thread_pool_tg_id),
@@ -279,6 +282,7 @@ void LogIOWorker::destroy()
   cb_thread_pool_tg_id_ = -1;
   palf_env_impl_ = NULL;
   log_io_worker_num_ = -1;
+  enable_group_sync_ = false;
   queue_.destroy();
   batch_io_task_mgr_.destroy();
 }
@@ -479,7 +483,8 @@ int LogIOWorker::update_throttling_options_()
 }
 
 LogIOWorker::BatchLogIOFlushLogTaskMgr::BatchLogIOFlushLogTaskMgr()
-  : handle_count_(0), has_batched_size_(0), usable_count_(0), batch_width_(0)
+  : handle_count_(0), has_batched_size_(0), usable_count_(0), batch_width_(0),
+    group_sync_count_(0), enable_group_sync_(false)
 {}
 
 LogIOWorker::BatchLogIOFlushLogTaskMgr::~BatchLogIOFlushLogTaskMgr()
@@ -489,7 +494,8 @@ LogIOWorker::BatchLogIOFlushLogTaskMgr::~BatchLogIOFlushLogTaskMgr()
 
 int LogIOWorker::BatchLogIOFlushLogTaskMgr::init(int64_t batch_width,
                                                  int64_t batch_depth,
-                                                 ObIAllocator *allocator)
+                                                 ObIAllocator *allocator,
+                                                 const bool enable_group_sync)
 {
   int ret = OB_SUCCESS;
   batch_io_task_array_.set_allocator(allocator);
@@ -513,6 +519,7 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::init(int64_t batch_width,
       }
     }
     batch_width_ = usable_count_ = batch_width;
+    enable_group_sync_ = enable_group_sync;
   }
   if (OB_FAIL(ret)) {
     destroy();
@@ -522,7 +529,8 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::init(int64_t batch_width,
 
 void LogIOWorker::BatchLogIOFlushLogTaskMgr::destroy()
 {
-  handle_count_ = has_batched_size_ = batch_width_ = usable_count_ = 0;
+  handle_count_ = has_batched_size_ = batch_width_ = usable_count_ = group_sync_count_ = 0;
+  enable_group_sync_ = false;
   for (int i = 0; i < batch_io_task_array_.count(); i++) {
     BatchLogIOFlushLogTask *&io_task = batch_io_task_array_[i];
     if (NULL != io_task) {
@@ -552,31 +560,100 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle(const int64_t tg_id, IPalfEnv
 {
   int ret = OB_SUCCESS;
   const int64_t count = batch_io_task_array_.count() - usable_count_;
-  // Each BatchLogIOFlushLogTask is a set LogIOFlushLogTask of one palf instance,
-  // even if execute 'do_task_' for one of LogIOFlushLogTask failed, we need
-  // execute 'do_task_' for next LogIOFlushLogTask.
+  if (true == enable_group_sync_) {
+    ret = handle_with_group_sync_(tg_id, palf_env_impl);
+  } else {
+    // Each BatchLogIOFlushLogTask is a set LogIOFlushLogTask of one palf instance,
+    // even if execute 'do_task_' for one of LogIOFlushLogTask failed, we need
+    // execute 'do_task_' for next LogIOFlushLogTask.
+    for (int64_t i = 0; i < count; i++) {
+      BatchLogIOFlushLogTask *io_task = batch_io_task_array_[i];
+      if (OB_ISNULL(io_task)) {
+        ret = OB_ERR_UNEXPECTED;
+        PALF_LOG(ERROR, "BatchLogIOFlushLogTask in batch_io_task_array_ is nullptr, unexpected error!!!",
+                 K(ret), KP(io_task), K(i));
+      } else if (OB_FAIL(io_task->do_task(tg_id, palf_env_impl))) {
+        PALF_LOG(WARN, "do_task failed", K(ret), KP(io_task));
+      } else {
+        PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle success", K(ret), K(has_batched_size_), KP(io_task));
+      }
+      if (OB_NOT_NULL(io_task)) {
+        reuse_batch_io_task_(io_task);
+      }
+    }
+  }
+  return ret;
+}
+
+// Each palf instance still appends logs into its own blocks in order of LSN, the group
+// sync defers the flush callbacks of all palf instances in this io cycle until their logs
+// have been written, then persists the logs of each palf instance with one fdatasync of
+// its current block, so the io cost of O_SYNC is paid once per palf instance and cycle
+// rather than once per write. The blocks switched in this cycle have been synced when
+// switching.
+int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle_with_group_sync_(const int64_t tg_id,
+                                                                   IPalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  int sync_ret = OB_SUCCESS;
+  bool has_synced = false;
+  const int64_t count = batch_io_task_array_.count() - usable_count_;
+  // 1. write logs of each palf instance, the BatchLogIOFlushLogTask which has nothing
+  // to callback is reused directly.
   for (int64_t i = 0; i < count; i++) {
     BatchLogIOFlushLogTask *io_task = batch_io_task_array_[i];
+    bool has_valid_data = false;
     if (OB_ISNULL(io_task)) {
       ret = OB_ERR_UNEXPECTED;
       PALF_LOG(ERROR, "BatchLogIOFlushLogTask in batch_io_task_array_ is nullptr, unexpected error!!!",
                K(ret), KP(io_task), K(i));
-    } else if (OB_FAIL(io_task->do_task(tg_id, palf_env_impl))) {
-      PALF_LOG(WARN, "do_task failed", K(ret), KP(io_task));
+    } else if (OB_SUCCESS != (tmp_ret = io_task->write_log(palf_env_impl, has_valid_data))) {
+      ret = tmp_ret;
+      PALF_LOG(WARN, "write_log failed", K(ret), KP(io_task));
+      reuse_batch_io_task_(io_task);
+    } else if (false == has_valid_data) {
+      reuse_batch_io_task_(io_task);
     } else {
-      PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle success", K(ret), K(has_batched_size_), KP(io_task));
     }
-    if (OB_NOT_NULL(io_task)) {
-      // 'handle_count_' and 'has_batched_size_' are used for statistics
-      handle_count_ += io_task->get_count() <= 1 ? 0 : 1;
-      has_batched_size_ += io_task->get_count() == 1 ? 0 : io_task->get_count();
-      io_task->reuse();
-      usable_count_++;
+  }
+  // 2. persist and callback logs of each palf instance, 'sync_log' retries until success
+  // and only fails when the palf instance has gone, the logs which have not been persisted
+  // will never be callbacked.
+  for (int64_t i = 0; i < count; i++) {
+    BatchLogIOFlushLogTask *io_task = batch_io_task_array_[i];
+    if (OB_ISNULL(io_task) || INVALID_PALF_ID == io_task->get_palf_id()) {
+      // has been reused in step 1
+    } else {
+      if (OB_SUCCESS != (sync_ret = io_task->sync_log(palf_env_impl))) {
+        ret = sync_ret;
+        PALF_LOG(WARN, "sync_log failed", K(ret), KP(io_task));
+        io_task->discard(palf_env_impl);
+      } else if (FALSE_IT(has_synced = true)) {
+      } else if (OB_FAIL(io_task->push_flush_cb(tg_id, palf_env_impl))) {
+        PALF_LOG(WARN, "push_flush_cb failed", K(ret), KP(io_task));
+      } else {
+        PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle_with_group_sync_ success", K(ret),
+                 K(group_sync_count_), KP(io_task));
+      }
+      reuse_batch_io_task_(io_task);
     }
   }
+  if (true == has_synced) {
+    group_sync_count_++;
+  }
   return ret;
 }
 
+void LogIOWorker::BatchLogIOFlushLogTaskMgr::reuse_batch_io_task_(BatchLogIOFlushLogTask *io_task)
+{
+  // 'handle_count_' and 'has_batched_size_' are used for statistics
+  handle_count_ += io_task->get_count() <= 1 ? 0 : 1;
+  has_batched_size_ += io_task->get_count() == 1 ? 0 : io_task->get_count();
+  io_task->reuse();
+  usable_count_++;
+}
+
 bool LogIOWorker::BatchLogIOFlushLogTaskMgr::empty()
 {
   return usable_count_ == batch_width_;
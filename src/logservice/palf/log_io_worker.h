@@ -57,12 +57,17 @@ struct LogIOWorkerConfig
     io_queue_capcity_ = 0;
     batch_width_ = 0;
     batch_depth_ = 0;
+    enable_group_sync_ = false;
   }
   int64_t io_worker_num_;
   int64_t io_queue_capcity_;
   int64_t batch_width_;
   int64_t batch_depth_;
-  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth));
+  // if true, log blocks are opened without O_SYNC, the logs of all palf instances
+  // written in one io cycle are persisted by one filesystem sync before callback.
+  bool enable_group_sync_;
+  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth),
+               K_(enable_group_sync));
 };
 class LogThrottlingStat
 {
@@ -219,10 +224,11 @@ public:
   void run1() override final;
   int submit_io_task(LogIOTask *io_task);
   int64_t get_last_working_time() const { return ATOMIC_LOAD(&last_working_time_); }
+  bool is_group_sync_enabled() const { return enable_group_sync_; }
 
  int notify_need_writing_throttling(const bool &need_throtting);
   static constexpr int64_t MAX_THREAD_NUM = 1;
-  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id));
+  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id), K_(enable_group_sync));
 private:
   bool need_reduce_(LogIOTask *task);
   int reduce_io_task_(void *task);
@@ -240,14 +246,20 @@ private:
   public:
     BatchLogIOFlushLogTaskMgr();
     ~BatchLogIOFlushLogTaskMgr();
-    int init(int64_t batch_width, int64_t batch_depth, ObIAllocator *allocator);
+    int init(int64_t batch_width, int64_t batch_depth, ObIAllocator *allocator,
+             const bool enable_group_sync);
     void destroy();
     int insert(LogIOFlushLogTask *io_task);
     int handle(const int64_t tg_id, IPalfEnvImpl *palf_env_impl);
     bool empty();
-    TO_STRING_KV(K_(batch_io_task_array), K_(usable_count), K_(batch_width));
+    TO_STRING_KV(K_(batch_io_task_array), K_(usable_count), K_(batch_width), K_(enable_group_sync),
+                 K_(group_sync_count));
   private:
     int find_usable_batch_io_task_(const int64_t palf_id, BatchLogIOFlushLogTask *&batch_io_task);
+    // write the logs of all BatchLogIOFlushLogTask, then persist them with one
+    // filesystem sync, and callback at last.
+    int handle_with_group_sync_(const int64_t tg_id, IPalfEnvImpl *palf_env_impl);
+    void reuse_batch_io_task_(BatchLogIOFlushLogTask *io_task);
   private:
     typedef ObFixedArray<BatchLogIOFlushLogTask *, common::ObIAllocator> BatchLogIOFlushLogTaskArray;
     BatchLogIOFlushLogTaskArray batch_io_task_array_;
@@ -255,6 +267,9 @@ private:
     int64_t has_batched_size_;
     int64_t usable_count_;
     int64_t batch_width_;
+    // the count of syncs issued by 'handle_with_group_sync_', used for statistics
+    int64_t group_sync_count_;
+    bool enable_group_sync_;
   };
 
   // TODO: io_task_queue used to store all LogIOTask objects, and the LogIOWorker
@@ -274,6 +289,7 @@ private:
   LogWritingThrottle throttle_;
   SpinLock throttling_lock_;
   ObMiniStat::ObStatItem log_io_worker_queue_size_stat_;
+  bool enable_group_sync_;
   bool is_inited_;
 };
 } // end namespace palf
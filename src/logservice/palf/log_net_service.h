@@ -68,7 +68,23 @@ public:
                               prev_lsn,
                               curr_lsn,
                               write_buf);
-      ret = post_request_to_member_list_(member_list, push_log_req);
+      // the same push log req is sent to every member, serialize it only once
+      common::ObSEArray<common::ObAddr, common::OB_MAX_MEMBER_NUMBER> servers;
+      common::ObAddr server;
+      const int64_t member_number = member_list.get_member_number();
+      if (!push_log_req.is_valid() || !member_list.is_valid()) {
+        ret = OB_INVALID_ARGUMENT;
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < member_number; i++) {
+        if (OB_FAIL(member_list.get_server_by_index(i, server))) {
+          PALF_LOG(WARN, "get_server_by_index failed", K(ret), K_(palf_id), K(i));
+        } else if (OB_FAIL(servers.push_back(server))) {
+          PALF_LOG(WARN, "push_back failed", K(ret), K_(palf_id), K(server));
+        }
+      }
+      if (OB_SUCC(ret) && 0 < servers.count()) {
+        (void) log_rpc_->post_request_to_servers(servers, palf_id_, push_log_req);
+      }
     }
     return ret;
   }
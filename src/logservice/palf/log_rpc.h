@@ -96,6 +96,28 @@ public:
     return ret;
   }
 
+  // post %req to all %servers, the packet is serialized only once if pkt-nio is used,
+  // ReqType must be defined by DEFINE_RPC_PROXY_POST_TO_SERVERS_FUNCTION.
+  template<class ReqType>
+  int post_request_to_servers(const common::ObIArray<common::ObAddr> &servers,
+                              const int64_t palf_id,
+                              const ReqType &req)
+  {
+    int ret = common::OB_SUCCESS;
+    if (IS_NOT_INIT) {
+      ret = OB_NOT_INIT;
+    } else if (0 == servers.count()
+               || false == is_valid_palf_id(palf_id)
+               || false == req.is_valid()) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      LogRpcPacketImpl<ReqType> packet(self_, palf_id, req);
+      ret = rpc_proxy_.post_packet_to_servers(servers, packet, tenant_id_, options_);
+      PALF_LOG(TRACE, "post_packet_to_servers finished", K(ret), K(servers), K(tenant_id_));
+    }
+    return ret;
+  }
+
   template<class ReqType, class RespType>
   int post_sync_request(const common::ObAddr &server,
                         const int64_t palf_id,
@@ -99,6 +99,43 @@
     }                                                                                                         \
     return ret;                                                                                               \
   }
+// post the same packet to all %dsts, with pkt-nio the packet is serialized only once.
+// REQTYPE must be declared by DECLARE_RPC_PROXY_POST_FUNCTION too.
+#define DECLARE_RPC_PROXY_POST_TO_SERVERS_FUNCTION(REQTYPE)                                                   \
+  int post_packet_to_servers(const common::ObIArray<common::ObAddr> &dsts,                                    \
+                             const palf::LogRpcPacketImpl<palf::REQTYPE> &pkt, const int64_t tenant_id,       \
+                             const palf::PalfTransportCompressOptions &options)
+
+#define DEFINE_RPC_PROXY_POST_TO_SERVERS_FUNCTION(REQTYPE, PCODE)                                             \
+  int LogRpcProxyV2::post_packet_to_servers(const common::ObIArray<common::ObAddr> &dsts,                     \
+                                            const palf::LogRpcPacketImpl<palf::REQTYPE> &pkt,                 \
+                                            const int64_t tenant_id,                                          \
+                                            const palf::PalfTransportCompressOptions &options)                \
+  {                                                                                                           \
+    int ret = common::OB_SUCCESS;                                                                             \
+    static obrpc::LogRpcCB<obrpc::PCODE> cb;                                                                  \
+    if (options.enable_transport_compress_) {                                                                 \
+      ret = this->to()                                                                                        \
+                .timeout(3000 * 1000)                                                                         \
+                .trace_time(true)                                                                             \
+                .max_process_handler_time(100 * 1000)                                                         \
+                .by(tenant_id)                                                                                \
+                .group_id(share::OBCG_CLOG)                                                                   \
+                .compressed(options.transport_compress_func_)                                                 \
+                .dst_cluster_id(src_cluster_id_)                                                              \
+                .post_packet_to_servers_(dsts, pkt, &cb);                                                     \
+    } else {                                                                                                  \
+      ret = this->to()                                                                                        \
+                .timeout(3000 * 1000)                                                                         \
+                .trace_time(true)                                                                             \
+                .max_process_handler_time(100 * 1000)                                                         \
+                .by(tenant_id)                                                                                \
+                .group_id(share::OBCG_CLOG)                                                                   \
+                .dst_cluster_id(src_cluster_id_)                                                              \
+                .post_packet_to_servers_(dsts, pkt, &cb);                                                     \
+    }                                                                                                         \
+    return ret;                                                                                               \
+  }
 // ELECTION use unique message queue
 // no need transport compress
 #define DEFINE_RPC_PROXY_ELECTION_POST_FUNCTION(REQTYPE, PCODE)                                               \
@@ -70,6 +70,8 @@ void LogRpcProxyV2::set_group_id(int32_t group_id) {
 
 DEFINE_RPC_PROXY_POST_FUNCTION(LogPushReq,
                                OB_LOG_PUSH_REQ);
+DEFINE_RPC_PROXY_POST_TO_SERVERS_FUNCTION(LogPushReq,
+                                          OB_LOG_PUSH_REQ);
 DEFINE_RPC_PROXY_POST_FUNCTION(LogPushResp,
                                OB_LOG_PUSH_RESP);
 DEFINE_RPC_PROXY_POST_FUNCTION(LogFetchReq,
@@ -34,6 +34,7 @@ public:
   DECLARE_RPC_PROXY_POST_FUNCTION(PR3,
                                   LogPushReq,
                                   OB_LOG_PUSH_REQ);
+  DECLARE_RPC_PROXY_POST_TO_SERVERS_FUNCTION(LogPushReq);
   DECLARE_RPC_PROXY_POST_FUNCTION(PR3,
                                   LogPushResp,
                                   OB_LOG_PUSH_RESP);
@@ -37,6 +37,7 @@ LogStorage::LogStorage() :
     delete_block_lock_(common::ObLatchIds::PALF_LOG_ENGINE_LOCK),
     update_manifest_cb_(),
     hot_cache_(NULL),
+    cold_cache_(),
     is_inited_(false)
 {}
 
@@ -50,7 +51,8 @@ int LogStorage::init(const char *base_dir, const char *sub_dir, const LSN &base_
                      const int64_t align_size, const int64_t align_buf_size,
                      const UpdateManifestCallback &update_manifest_cb,
                      ILogBlockPool *log_block_pool,
-                     LogHotCache *hot_cache)
+                     LogHotCache *hot_cache,
+                     const bool enable_group_sync)
 {
   int ret = OB_SUCCESS;
   if (IS_INIT) {
@@ -64,7 +66,8 @@ int LogStorage::init(const char *base_dir, const char *sub_dir, const LSN &base_
                               align_buf_size,
                               update_manifest_cb,
                               log_block_pool,
-                              hot_cache))) {
+                              hot_cache,
+                              enable_group_sync))) {
     PALF_LOG(WARN, "LogStorage do_init_ failed", K(ret), K(base_dir), K(sub_dir), K(palf_id));
   } else {
     PALF_LOG(INFO, "LogStorage init success", K(ret), K(base_dir), K(sub_dir),
@@ -110,6 +113,7 @@ void LogStorage::destroy()
   log_tail_.reset();
   log_reader_.destroy();
   block_mgr_.destroy();
+  cold_cache_.destroy();
   PALF_LOG(INFO, "LogStorage destroy success");
 }
 
@@ -153,6 +157,19 @@ int LogStorage::writev(const LSN &lsn, const LogWriteBuf &write_buf, const SCN &
   return ret;
 }
 
+int LogStorage::sync()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "LogStorage not inited!!!", K(ret));
+  } else if (OB_FAIL(block_mgr_.sync_curr_block())) {
+    PALF_LOG(ERROR, "LogBlockMgr sync_curr_block failed", K(ret), KPC(this));
+  } else {
+  }
+  return ret;
+}
+
 int LogStorage::writev(const LSNArray &lsn_array,
                        const LogWriteBufArray &write_buf_array,
                        const SCNArray &scn_array)
@@ -270,6 +287,10 @@ int LogStorage::pread(const LSN &read_lsn, const int64_t in_read_size, ReadBuf &
       && OB_SUCCESS == (hot_cache_->read(read_lsn, in_read_size, read_buf.buf_, out_read_size))
       && out_read_size > 0) {
     // read data from hot_cache successfully
+  } else if (cold_cache_.is_inited()
+      && OB_SUCCESS == cold_cache_pread_(read_lsn, in_read_size, read_buf, out_read_size)) {
+    // read data from cold_cache and disk successfully, otherwise read from disk again to
+    // return the exact error code.
   } else if (OB_FAIL(inner_pread_(read_lsn, in_read_size, need_read_with_block_header, read_buf, out_read_size))) {
     PALF_LOG(WARN, "inner_pread_ failed", K(ret), K(read_lsn), K(in_read_size), KPC(this));
   } else {
@@ -337,6 +358,8 @@ int LogStorage::inner_truncate_(const LSN &lsn)
     reset_log_tail_for_last_block_(lsn, true);
     PALF_LOG(INFO, "inner_truncate_ success", K(ret), K(lsn), KPC(this));
   }
+  // the logs after 'lsn' will be rewritten, even if truncate failed halfway.
+  cold_cache_.invalidate();
   return ret;
 }
 
@@ -389,6 +412,7 @@ int LogStorage::truncate_prefix_blocks(const LSN &lsn)
              KPC(this));
 		reset_log_tail_for_last_block_(lsn, false);
     block_mgr_.reset(lsn_2_block(lsn, logical_block_size_));
+    cold_cache_.invalidate();
   }
   PALF_EVENT("LogStorage truncate_prefix_blocks finihsed", palf_id_, K(ret), KPC(this),
              K(lsn), K(block_id), K(min_block_id), K(max_block_id),
@@ -416,6 +440,7 @@ int LogStorage::begin_flashback(const LSN &start_lsn_of_block)
     ObSpinLockGuard guard(tail_info_lock_);
     // In process of flashback, each block after start_lsn_of_block is still readable.
     readable_log_tail_ = origin_log_tail;
+    cold_cache_.invalidate();
     PALF_EVENT("[BEGIN STORAGE FLASHBACK]", palf_id_, KPC(this), K(start_lsn_of_block));
   }
   return ret;
@@ -447,6 +472,7 @@ int LogStorage::end_flashback(const LSN &start_lsn_of_block)
   } else {
 		ObSpinLockGuard guard(tail_info_lock_);
     readable_log_tail_ = log_tail_;
+    cold_cache_.invalidate();
     PALF_EVENT("[END STORAGE FLASHBACK]", palf_id_, KPC(this), K(start_lsn_of_block));
   }
   return ret;
@@ -593,7 +619,8 @@ int LogStorage::do_init_(const char *base_dir,
                          const int64_t align_buf_size,
                          const UpdateManifestCallback &update_manifest_cb,
                          ILogBlockPool *log_block_pool,
-                         LogHotCache *hot_cache)
+                         LogHotCache *hot_cache,
+                         const bool enable_group_sync)
 {
   int ret = OB_SUCCESS;
   int tmp_ret = 0;
@@ -608,10 +635,14 @@ int LogStorage::do_init_(const char *base_dir,
                                      align_size,
                                      align_buf_size,
                                      logical_block_size + MAX_INFO_BLOCK_SIZE,
-                                     log_block_pool))) {
+                                     log_block_pool,
+                                     enable_group_sync))) {
     PALF_LOG(ERROR, "LogBlockMgr init failed", K(ret), K(log_dir));
   } else if (OB_FAIL(log_reader_.init(log_dir, logical_block_size + MAX_INFO_BLOCK_SIZE))) {
     PALF_LOG(ERROR, "LogReader init failed", K(ret), K(log_dir));
+  // only cache logs of log storage, which has hot cache, the meta storage is tiny
+  } else if (OB_NOT_NULL(hot_cache) && OB_FAIL(cold_cache_.init(palf_id, logical_block_size))) {
+    PALF_LOG(ERROR, "LogColdCache init failed", K(ret), K(palf_id));
   } else {
     log_tail_ = readable_log_tail_ = base_lsn;
     log_block_header_.reset();
@@ -868,6 +899,67 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   return ret;
 }
 
+int LogStorage::cold_cache_pread_(const LSN &read_lsn,
+                                  const int64_t in_read_size,
+                                  ReadBuf &read_buf,
+                                  int64_t &out_read_size)
+{
+  int ret = OB_SUCCESS;
+  // NB: get version before log tail, the lines of version are valid before log tail.
+  const int64_t version = cold_cache_.get_version();
+  const LSN log_tail = get_readable_log_tail_guarded_by_lock_();
+  const block_id_t read_block_id = lsn_2_block(read_lsn, logical_block_size_);
+  const LSN readable_end_lsn = MIN(log_tail, LSN((read_block_id + 1) * logical_block_size_));
+  block_id_t min_block_id = LOG_INVALID_BLOCK_ID;
+  block_id_t max_block_id = LOG_INVALID_BLOCK_ID;
+  int64_t cached_size = 0;
+  out_read_size = 0;
+  if (read_lsn >= readable_end_lsn) {
+    ret = OB_ERR_OUT_OF_UPPER_BOUND;
+  } else if (OB_FAIL(get_block_id_range(min_block_id, max_block_id))) {
+    PALF_LOG(WARN, "get_block_id_range failed", K(ret), K(read_lsn));
+  } else if (read_block_id < min_block_id) {
+    // lines of recycled blocks may be still in cache
+    ret = OB_ERR_OUT_OF_LOWER_BOUND;
+  } else {
+    const LSN read_end_lsn = MIN(readable_end_lsn, read_lsn + in_read_size);
+    if (OB_FAIL(cold_cache_.read(version, read_lsn, read_end_lsn - read_lsn, read_buf.buf_,
+                                 cached_size))) {
+      PALF_LOG(WARN, "LogColdCache read failed", K(ret), K(read_lsn), K(read_end_lsn), KPC(this));
+    } else if (read_lsn + cached_size < read_end_lsn) {
+      const LSN miss_lsn = read_lsn + cached_size;
+      LSN fill_begin_lsn;
+      LSN fill_end_lsn;
+      ReadBuf fill_buf;
+      int64_t fill_size = 0;
+      cold_cache_.get_fill_range(miss_lsn, read_end_lsn, readable_end_lsn, fill_begin_lsn, fill_end_lsn);
+      if (OB_FAIL(alloc_read_buf("LogColdCache", fill_end_lsn - fill_begin_lsn, fill_buf))) {
+        PALF_LOG(WARN, "alloc_read_buf failed", K(ret), K(fill_begin_lsn), K(fill_end_lsn));
+      } else if (OB_FAIL(inner_pread_(fill_begin_lsn, fill_end_lsn - fill_begin_lsn, false,
+                                      fill_buf, fill_size))) {
+        PALF_LOG(WARN, "inner_pread_ failed", K(ret), K(fill_begin_lsn), K(fill_end_lsn), KPC(this));
+      } else if (fill_begin_lsn + fill_size <= miss_lsn) {
+        ret = OB_ERR_UNEXPECTED;
+        PALF_LOG(WARN, "read nothing from disk", K(ret), K(miss_lsn), K(fill_begin_lsn), K(fill_size));
+      } else {
+        const int64_t copy_size = MIN(static_cast<int64_t>(read_end_lsn - miss_lsn),
+                                      static_cast<int64_t>(fill_begin_lsn + fill_size - miss_lsn));
+        MEMCPY(read_buf.buf_ + cached_size, fill_buf.buf_ + (miss_lsn - fill_begin_lsn), copy_size);
+        cached_size += copy_size;
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = cold_cache_.fill(version, fill_begin_lsn, fill_buf.buf_, fill_size))) {
+          PALF_LOG(WARN, "LogColdCache fill failed", K(tmp_ret), K(fill_begin_lsn), K(fill_size));
+        }
+      }
+      free_read_buf(fill_buf);
+    }
+  }
+  if (OB_SUCC(ret)) {
+    out_read_size = cached_size;
+  }
+  return ret;
+}
+
 void LogStorage::reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_exist)
 {
   ObSpinLockGuard guard(tail_info_lock_);
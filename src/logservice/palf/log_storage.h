@@ -17,6 +17,7 @@
 #include "share/ob_errno.h"        // errno
 #include "log_block_header.h"      // LogBlockHeader
 #include "log_block_mgr.h"         // LogBlockMgr
+#include "log_cache.h"             // LogColdCache
 #include "log_reader.h"            // LogReader
 #include "log_storage_interface.h" // ILogStorage
 #include "log_writer_utils.h"      // LogWriteBuf
@@ -52,7 +53,8 @@ public:
            const int64_t align_buf_size,
            const UpdateManifestCallback &update_manifest_cb,
            ILogBlockPool *log_block_pool,
-           LogHotCache *hot_cache);
+           LogHotCache *hot_cache,
+           const bool enable_group_sync);
 
   template <class EntryHeaderType>
   int load(const char *log_dir,
@@ -65,6 +67,7 @@ public:
            const UpdateManifestCallback &update_manifest_cb,
            ILogBlockPool *log_block_pool,
            LogHotCache *hot_cache,
+           const bool enable_group_sync,
            EntryHeaderType &entry_header,
            LSN &lsn);
 
@@ -73,6 +76,8 @@ public:
 
   int writev(const LSNArray &lsn_array, const LogWriteBufArray &write_buf_array, const SCNArray &scn_array);
   int writev(const LSN &lsn, const LogWriteBuf &write_buf, const share::SCN &scn);
+  // persist the logs written by 'writev' when group sync is enabled, otherwise do nothing.
+  int sync();
 
   int append_meta(const char *buf, const int64_t buf_len);
 
@@ -130,7 +135,8 @@ private:
                const int64_t align_buf_size,
                const UpdateManifestCallback &update_manifest_cb,
                ILogBlockPool *log_block_pool,
-               LogHotCache *hot_cache);
+               LogHotCache *hot_cache,
+               const bool enable_group_sync);
   // @ret val:
   //   OB_SUCCESS
   //   OB_ERR_OUT_OF_LOWER_BOUND
@@ -170,6 +176,11 @@ private:
                    const bool need_read_block_header,
                    ReadBuf &read_buf,
                    int64_t &out_read_size);
+  // read from cold cache first, and fill the cold cache with the missed part read from disk.
+  int cold_cache_pread_(const LSN &read_lsn,
+                        const int64_t in_read_size,
+                        ReadBuf &read_buf,
+                        int64_t &out_read_size);
   void reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_exist);
   int update_manifest_(const block_id_t expected_next_block_id, const bool in_restart = false);
 private:
@@ -192,6 +203,7 @@ private:
   UpdateManifestCallback update_manifest_cb_;
   char block_header_serialize_buf_[MAX_INFO_BLOCK_SIZE];
   LogHotCache *hot_cache_;
+  LogColdCache cold_cache_;
   bool is_inited_;
 };
 
@@ -212,6 +224,7 @@ int LogStorage::load(const char *base_dir,
                      const UpdateManifestCallback &update_manifest_cb,
                      ILogBlockPool *log_block_pool,
                      LogHotCache *hot_cache,
+                     const bool enable_group_sync,
                      EntryHeaderType &entry_header,
                      LSN &lsn)
 {
@@ -231,7 +244,8 @@ int LogStorage::load(const char *base_dir,
                               align_buf_size,
                               update_manifest_cb,
                               log_block_pool,
-                              hot_cache))) {
+                              hot_cache,
+                              enable_group_sync))) {
     PALF_LOG(WARN, "LogStorage do_init_ failed", K(ret), K(base_dir), K(sub_dir), K(palf_id));
     // NB: if there is no valid data on disk, no need to load last block
   } else if (OB_FAIL(block_mgr_.get_block_id_range(min_block_id, max_block_id))
@@ -202,6 +202,7 @@ int PalfEnvImpl::init(
   log_io_worker_config_.io_queue_capcity_ = 100 * 1024;
   log_io_worker_config_.batch_width_ = 8;
   log_io_worker_config_.batch_depth_ = PALF_SLIDING_WINDOW_SIZE;
+  log_io_worker_config_.enable_group_sync_ = GCONF._enable_log_group_sync;
   const int64_t io_cb_num = PALF_SLIDING_WINDOW_SIZE * 128;
   if (is_inited_) {
     ret = OB_INIT_TWICE;
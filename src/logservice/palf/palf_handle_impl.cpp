@@ -1740,6 +1740,19 @@ int PalfHandleImpl::inner_append_log(const LSNArray &lsn_array,
   return ret;
 }
 
+int PalfHandleImpl::inner_sync_log()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "PalfHandleImpl not inited", K(ret), KPC(this));
+  } else if (OB_FAIL(log_engine_.sync_log())) {
+    PALF_LOG(ERROR, "LogEngine sync_log failed", K(ret), KPC(this));
+  } else {
+  }
+  return ret;
+}
+
 int PalfHandleImpl::inner_append_meta(const char *buf,
                                       const int64_t buf_len)
 {
@@ -514,6 +514,9 @@ public:
   virtual int inner_append_log(const LSNArray &lsn_array,
                                const LogWriteBufArray &write_buf_array,
                                const SCNArray &scn_array) = 0;
+  // persist the logs appended by 'inner_append_log' when group sync is enabled, otherwise
+  // do nothing. it retries until success.
+  virtual int inner_sync_log() = 0;
   virtual int inner_append_meta(const char *buf,
                                 const int64_t buf_len) = 0;
   virtual int inner_truncate_log(const LSN &lsn) = 0;
@@ -851,6 +854,7 @@ public:
   int inner_append_log(const LSNArray &lsn_array,
                        const LogWriteBufArray &write_buf_array,
                        const SCNArray &scn_array);
+  int inner_sync_log() override final;
   int inner_append_meta(const char *buf,
                         const int64_t buf_len) override final;
   int inner_truncate_log(const LSN &lsn) override final;
@@ -840,6 +840,7 @@ int ObLogReplayService::do_replay_task_(ObLogReplayTask *replay_task,
                K(replay_queue_idx), K(ret));
       replay_task->log_buf_ = replay_log_buff;
       free_replay_task_log_buf(replay_task);
+      replay_status->dec_queue_pending_task(*replay_task);
       replay_status->dec_pending_task(replay_task->log_size_);
     }
   } else if (OB_FAIL(ls_adapter_->replay(replay_task))) {
@@ -1162,46 +1163,65 @@ int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queu
   } else {
     int64_t start_ts = ObTimeUtility::fast_current_time();
     do {
-      int64_t replay_task_used = 0;
-      int64_t destroy_task_used = 0;
       ObLink *link = NULL;
       ObLink *link_to_destroy = NULL;
       ObLogReplayTask *replay_task = NULL;
       ObLogReplayTask *replay_task_to_destroy = NULL;
       if (replay_status->try_rdlock()) {
-        if (!replay_status->is_enabled_without_lock()) {
-          is_queue_empty = true;
-        } else if (NULL == (link = task_queue->top())) {
-          //queue is empty
-          ret = OB_SUCCESS;
-          is_queue_empty = true;
-          task_queue->clear_err_info();
-        } else if (OB_ISNULL(replay_task = static_cast<ObLogReplayTask *>(link))) {
-          ret = OB_ERR_UNEXPECTED;
-          CLOG_LOG(ERROR, "replay_task is NULL", KPC(replay_status), K(ret));
-        } else if (OB_FAIL(do_replay_task_(replay_task, replay_status, task_queue->idx()))) {
-          (void)process_replay_ret_code_(ret, *replay_status, *task_queue, *replay_task);
-        } else if (OB_ISNULL(link_to_destroy = task_queue->pop())) {
-          CLOG_LOG(ERROR, "failed to pop task after replay", KPC(replay_task), K(ret));
-          //It's impossible to get to this branch. Use on_replay_error to defend it.
-          on_replay_error_(*replay_task, ret);
-        } else if (OB_ISNULL(replay_task_to_destroy = static_cast<ObLogReplayTask *>(link_to_destroy))) {
-          ret = OB_ERR_UNEXPECTED;
-          CLOG_LOG(ERROR, "replay_task_to_destroy is NULL when pop after replay", KPC(replay_task), K(ret));
-          //It's impossible to get to this branch. Use on_replay_error to defend it.
-          on_replay_error_(*replay_task, ret);
-        } else {
-          task_queue->clear_err_info();
-          if (!replay_task->is_pre_barrier_) {
-            //前向barrier日志执行回放的线程会提前释放内存
-            replay_status->dec_pending_task(replay_task->log_size_);
-          }
-          free_replay_task(replay_task_to_destroy);
-          //To avoid a single task occupies too long thread time, the upper limit of
-          //single occupancy time is set to 10ms
-          int64_t used_time = ObTimeUtility::fast_current_time() - start_ts;
-          if (used_time > MAX_REPLAY_TIME_PER_ROUND) {
-            is_timeslice_run_out = true;
+        // consecutive logs with the same replay hint (usually redo of one transaction)
+        // are replayed in one batch without releasing the lock
+        int64_t batch_replay_hint = -1;
+        int64_t batch_count = 0;
+        bool need_replay_next = true;
+        while (need_replay_next) {
+          need_replay_next = false;
+          if (!replay_status->is_enabled_without_lock()) {
+            is_queue_empty = true;
+          } else if (NULL == (link = task_queue->top())) {
+            //queue is empty
+            ret = OB_SUCCESS;
+            is_queue_empty = true;
+            task_queue->clear_err_info();
+          } else if (OB_ISNULL(replay_task = static_cast<ObLogReplayTask *>(link))) {
+            ret = OB_ERR_UNEXPECTED;
+            CLOG_LOG(ERROR, "replay_task is NULL", KPC(replay_status), K(ret));
+          } else if (0 != batch_count
+                     && (batch_replay_hint != replay_task->replay_hint_ || replay_task->is_pre_barrier_)) {
+            // end of batch, replay it in next round
+          } else {
+            const int64_t replay_start_ts = ObTimeUtility::fast_current_time();
+            if (OB_FAIL(do_replay_task_(replay_task, replay_status, task_queue->idx()))) {
+              (void)process_replay_ret_code_(ret, *replay_status, *task_queue, *replay_task);
+            } else if (OB_ISNULL(link_to_destroy = task_queue->pop())) {
+              CLOG_LOG(ERROR, "failed to pop task after replay", KPC(replay_task), K(ret));
+              //It's impossible to get to this branch. Use on_replay_error to defend it.
+              on_replay_error_(*replay_task, ret);
+            } else if (OB_ISNULL(replay_task_to_destroy = static_cast<ObLogReplayTask *>(link_to_destroy))) {
+              ret = OB_ERR_UNEXPECTED;
+              CLOG_LOG(ERROR, "replay_task_to_destroy is NULL when pop after replay", KPC(replay_task), K(ret));
+              //It's impossible to get to this branch. Use on_replay_error to defend it.
+              on_replay_error_(*replay_task, ret);
+            } else {
+              const int64_t cur_ts = ObTimeUtility::fast_current_time();
+              task_queue->clear_err_info();
+              task_queue->add_replayed_stat(replay_task->log_size_, cur_ts - replay_start_ts);
+              batch_replay_hint = replay_task->replay_hint_;
+              batch_count++;
+              if (!replay_task->is_pre_barrier_) {
+                //前向barrier日志执行回放的线程会提前释放内存
+                replay_status->dec_queue_pending_task(*replay_task);
+                replay_status->dec_pending_task(replay_task->log_size_);
+              }
+              free_replay_task(replay_task_to_destroy);
+              //To avoid a single task occupies too long thread time, the upper limit of
+              //single occupancy time is set to 10ms
+              int64_t used_time = cur_ts - start_ts;
+              if (used_time > MAX_REPLAY_TIME_PER_ROUND) {
+                is_timeslice_run_out = true;
+              } else {
+                need_replay_next = (batch_count < MAX_REPLAY_BATCH_COUNT);
+              }
+            }
           }
         }
         replay_status->unlock();
@@ -1362,6 +1382,27 @@ int ObLogReplayService::diagnose(const share::ObLSID &id,
   return ret;
 }
 
+int ObLogReplayService::get_task_queue_stat(const share::ObLSID &id,
+                                            common::ObIArray<ObReplayQueueStat> &queue_stats,
+                                            int64_t &rebalance_count)
+{
+  int ret = OB_SUCCESS;
+  ObReplayStatus *replay_status = NULL;
+  ObReplayStatusGuard guard;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    CLOG_LOG(WARN, "replay service not init", K(ret));
+  } else if (OB_FAIL(get_replay_status_(id, guard))) {
+    CLOG_LOG(WARN, "guard get replay status failed", K(ret), K(id));
+  } else if (NULL == (replay_status = guard.get_replay_status())) {
+    ret = OB_ERR_UNEXPECTED;
+    CLOG_LOG(WARN, "replay status is not exist", K(ret), K(id));
+  } else if (OB_FAIL(replay_status->get_task_queue_stat(queue_stats, rebalance_count))) {
+    CLOG_LOG(WARN, "replay status get task queue stat failed", K(ret), K(id));
+  }
+  return ret;
+}
+
 bool ObLogReplayService::GetReplayStatusFunctor::operator()(const share::ObLSID &id,
                                                             ObReplayStatus *replay_status)
 {
@@ -1412,6 +1453,7 @@ bool ObLogReplayService::StatReplayProcessFunctor::operator()(const share::ObLSI
     replayed_log_size_ += replayed_log_size;
     unreplayed_log_size_ += unreplayed_log_size;
     CLOG_LOG(INFO, "get_replay_process success", K(id), K(replayed_log_size), K(unreplayed_log_size));
+    replay_status->print_task_queue_stat();
   }
   ret_code_ = ret;
   return true;
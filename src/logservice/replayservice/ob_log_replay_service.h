@@ -155,6 +155,9 @@ public:
   int stat_for_each(const common::ObFunction<int (const ObReplayStatus &)> &func);
   int stat_all_ls_replay_process(int64_t &replayed_log_size, int64_t &unreplayed_log_size);
   int diagnose(const share::ObLSID &id, ReplayDiagnoseInfo &diagnose_info);
+  int get_task_queue_stat(const share::ObLSID &id,
+                          common::ObIArray<ObReplayQueueStat> &queue_stats,
+                          int64_t &rebalance_count);
   void inc_pending_task_size(const int64_t log_size);
   void dec_pending_task_size(const int64_t log_size);
   int64_t get_pending_task_size() const;
@@ -210,6 +213,8 @@ private:
   int remove_all_ls_();
 private:
   const int64_t MAX_REPLAY_TIME_PER_ROUND = 10 * 1000; //10ms
+  //同一个task queue中连续相同replay hint的日志一次持锁最多回放的条数
+  const int64_t MAX_REPLAY_BATCH_COUNT = 16;
   const int64_t MAX_SUBMIT_TIME_PER_ROUND = 100 * 1000; //100ms
   const int64_t TASK_QUEUE_WAIT_IN_GLOBAL_QUEUE_TIME_THRESHOLD = 5 * 1000 * 1000; //5s
   const int64_t PENDING_TASK_MEMORY_LIMIT = 128 * (1LL << 20); //128MB
@@ -352,15 +352,24 @@ void ObReplayServiceReplayTask::reset()
           CLOG_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "replay_buf is NULL when reset", KPC(replay_task));
         } else if (0 == replay_buf->dec_replay_ref()) {
           replay_status_->free_replay_task_log_buf(replay_task);
+          replay_status_->dec_queue_pending_task(*replay_task);
           replay_status_->dec_pending_task(replay_task->log_size_);
         }
       } else {
+        replay_status_->dec_queue_pending_task(*replay_task);
         replay_status_->dec_pending_task(replay_task->log_size_);
       }
       replay_status_->free_replay_task(replay_task);
     };
   }
   idx_ = -1;
+  pending_cnt_ = 0;
+  replayed_cnt_ = 0;
+  replayed_size_ = 0;
+  replay_cost_ = 0;
+  fetched_replayed_cnt_ = 0;
+  fetched_replayed_size_ = 0;
+  fetched_replay_cost_ = 0;
   ObReplayServiceTask::reset();
 }
 
@@ -415,6 +424,38 @@ void ObReplayServiceReplayTask::push(Link *p)
   queue_.push(p);
 }
 
+void ObReplayServiceReplayTask::add_replayed_stat(const int64_t log_size, const int64_t replay_cost)
+{
+  ATOMIC_INC(&replayed_cnt_);
+  ATOMIC_AAF(&replayed_size_, log_size);
+  ATOMIC_AAF(&replay_cost_, replay_cost);
+}
+
+void ObReplayServiceReplayTask::get_replayed_stat(int64_t &replayed_cnt,
+                                                  int64_t &replayed_size,
+                                                  int64_t &replay_cost) const
+{
+  replayed_cnt = ATOMIC_LOAD(&replayed_cnt_);
+  replayed_size = ATOMIC_LOAD(&replayed_size_);
+  replay_cost = ATOMIC_LOAD(&replay_cost_);
+}
+
+void ObReplayServiceReplayTask::fetch_replayed_stat(int64_t &replayed_cnt,
+                                                    int64_t &replayed_size,
+                                                    int64_t &replay_cost)
+{
+  int64_t total_replayed_cnt = 0;
+  int64_t total_replayed_size = 0;
+  int64_t total_replay_cost = 0;
+  get_replayed_stat(total_replayed_cnt, total_replayed_size, total_replay_cost);
+  replayed_cnt = total_replayed_cnt - fetched_replayed_cnt_;
+  replayed_size = total_replayed_size - fetched_replayed_size_;
+  replay_cost = total_replay_cost - fetched_replay_cost_;
+  fetched_replayed_cnt_ = total_replayed_cnt;
+  fetched_replayed_size_ = total_replayed_size;
+  fetched_replay_cost_ = total_replay_cost;
+}
+
 bool ObReplayServiceReplayTask::need_batch_push()
 {
   return need_batch_push_;
@@ -528,6 +569,7 @@ ObReplayStatus::ObReplayStatus():
     rwlock_(common::ObLatchIds::REPLAY_STATUS_LOCK),
     rolelock_(common::ObLatchIds::REPLAY_STATUS_LOCK),
     rp_sv_(NULL),
+    rebalance_count_(0),
     submit_log_task_(),
     palf_env_(NULL),
     palf_handle_(),
@@ -564,6 +606,7 @@ int ObReplayStatus::init(const share::ObLSID &id,
     get_log_info_debug_time_ = OB_INVALID_TIMESTAMP;
     try_wrlock_debug_time_ = OB_INVALID_TIMESTAMP;
     check_enable_debug_time_ = OB_INVALID_TIMESTAMP;
+    reset_hint_slots_();
     palf_env_ = palf_env;
     rp_sv_ = rp_sv;
     IGNORE_RETURN new (&fs_cb_) ObReplayFsCb(this);
@@ -650,6 +693,7 @@ int ObReplayStatus::enable_(const LSN &base_lsn, const SCN &base_scn)
   } else if (OB_FAIL(submit_log_task_.init(base_lsn, base_scn, &palf_handle_, this))) {
     CLOG_LOG(WARN, "failed to init submit_log_task", K(ret), K(&palf_handle_));
   } else {
+    reset_hint_slots_();
     for (int64_t i = 0; OB_SUCC(ret) && i < REPLAY_TASK_QUEUE_SIZE; ++i) {
       if (OB_FAIL(task_queues_[i].init(this, i))) {
         CLOG_LOG(WARN, "failed to init task_queue", K(ret));
@@ -1036,6 +1080,8 @@ int ObReplayStatus::push_log_replay_task(ObLogReplayTask &task)
     }
     if (OB_SUCC(ret)) {
       int index = 0;
+      // the pre barrier log is replayed by the queue of its hint, which can not move until then
+      const int64_t queue_idx = route_replay_hint_(task.replay_hint_);
       ObLogBaseType log_type = task.log_type_;
       share::ObLSID ls_id = task.ls_id_;
       palf::LSN lsn = task.lsn_;
@@ -1060,20 +1106,150 @@ int ObReplayStatus::push_log_replay_task(ObLogReplayTask &task)
         task_queues_[index].set_batch_push_finish();
       }
       CLOG_LOG(INFO, "submit pre barrier log success", K(log_type), K(ls_id), K(lsn), K(scn),
-               K(is_pre_barrier), K(is_post_barrier), K(log_size));
+               K(is_pre_barrier), K(is_post_barrier), K(log_size), K(queue_idx));
     } else {
       for (int64_t i = 1; i < broadcast_task_array.count(); ++i) {
         free_replay_task(broadcast_task_array[i]);
       }
     }
   } else {
-    const uint64_t queue_idx = calc_replay_queue_idx(task.replay_hint_);
+    const int64_t queue_idx = route_replay_hint_(task.replay_hint_);
     ObReplayServiceReplayTask &task_queue = task_queues_[queue_idx];
     task_queue.push(&task);
   }
   return ret;
 }
 
+void ObReplayStatus::reset_hint_slots_()
+{
+  for (int64_t i = 0; i < REPLAY_HINT_SLOT_CNT; ++i) {
+    hint_slots_[i].pending_cnt_ = 0;
+    hint_slots_[i].queue_idx_ = static_cast<int32_t>(calc_replay_queue_idx(i));
+  }
+  rebalance_count_ = 0;
+}
+
+int64_t ObReplayStatus::route_replay_hint_(const int64_t replay_hint)
+{
+  ReplayHintSlot &slot = hint_slots_[replay_hint & (REPLAY_HINT_SLOT_CNT - 1)];
+  int64_t queue_idx = slot.queue_idx_;
+  // pending_cnt_ of slot is decreased after the task has been replayed and popped, so
+  // no task of this slot is in flight when it is 0, and the slot can be moved safely
+  if (0 == ATOMIC_LOAD(&slot.pending_cnt_)) {
+    const int64_t pending_cnt = task_queues_[queue_idx].get_pending_cnt();
+    if (pending_cnt > REBALANCE_PENDING_THRESHOLD) {
+      int64_t min_queue_idx = queue_idx;
+      int64_t min_pending_cnt = pending_cnt;
+      for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+        const int64_t cnt = task_queues_[i].get_pending_cnt();
+        if (cnt < min_pending_cnt) {
+          min_queue_idx = i;
+          min_pending_cnt = cnt;
+        }
+      }
+      if (min_pending_cnt * 2 < pending_cnt) {
+        CLOG_LOG(TRACE, "move replay hint slot to another queue", K(replay_hint), K(queue_idx),
+                 K(pending_cnt), K(min_queue_idx), K(min_pending_cnt), K(ls_id_));
+        queue_idx = min_queue_idx;
+        ATOMIC_STORE(&slot.queue_idx_, static_cast<int32_t>(min_queue_idx));
+        ++rebalance_count_;
+      }
+    }
+  }
+  ATOMIC_INC(&slot.pending_cnt_);
+  task_queues_[queue_idx].inc_pending_cnt();
+  return queue_idx;
+}
+
+void ObReplayStatus::dec_queue_pending_task(const ObLogReplayTask &task)
+{
+  ReplayHintSlot &slot = hint_slots_[task.replay_hint_ & (REPLAY_HINT_SLOT_CNT - 1)];
+  task_queues_[get_hint_queue_idx_(task.replay_hint_)].dec_pending_cnt();
+  ATOMIC_DEC(&slot.pending_cnt_);
+}
+
+void ObReplayStatus::print_task_queue_stat()
+{
+  RLockGuard rlock_guard(rwlock_);
+  if (is_inited_ && is_enabled_) {
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    int64_t total_replayed_cnt = 0;
+    int64_t total_replayed_size = 0;
+    int64_t max_lag = 0;
+    common::ObSEArray<ObReplayQueueStat, REPLAY_TASK_QUEUE_SIZE> queue_stats;
+    for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+      ObReplayQueueStat queue_stat;
+      bool is_queue_empty = true;
+      get_task_queue_stat_(i, cur_ts, true /*fetch_delta*/, queue_stat, is_queue_empty);
+      max_lag = std::max(max_lag, queue_stat.lag_);
+      total_replayed_cnt += queue_stat.replayed_cnt_;
+      total_replayed_size += queue_stat.replayed_size_;
+      if (0 != queue_stat.replayed_cnt_ || !is_queue_empty) {
+        (void)queue_stats.push_back(queue_stat);
+      }
+    }
+    if (!queue_stats.empty()) {
+      CLOG_LOG(INFO, "[REPLAY STAT TASK QUEUE]", K(ls_id_), K(total_replayed_cnt), K(total_replayed_size),
+               K(max_lag), K(pending_task_count_), K(rebalance_count_), K(queue_stats));
+    }
+  }
+}
+
+int ObReplayStatus::get_task_queue_stat(common::ObIArray<ObReplayQueueStat> &queue_stats,
+                                        int64_t &rebalance_count)
+{
+  int ret = OB_SUCCESS;
+  RLockGuard rlock_guard(rwlock_);
+  queue_stats.reset();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else {
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    rebalance_count = ATOMIC_LOAD(&rebalance_count_);
+    for (int64_t i = 0; OB_SUCC(ret) && i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+      ObReplayQueueStat queue_stat;
+      bool is_queue_empty = true;
+      get_task_queue_stat_(i, cur_ts, false /*fetch_delta*/, queue_stat, is_queue_empty);
+      if (OB_FAIL(queue_stats.push_back(queue_stat))) {
+        CLOG_LOG(WARN, "push back queue stat failed", K(ret), K(queue_stat), K(ls_id_));
+      }
+    }
+  }
+  return ret;
+}
+
+void ObReplayStatus::get_task_queue_stat_(const int64_t queue_idx,
+                                          const int64_t cur_ts,
+                                          const bool fetch_delta,
+                                          ObReplayQueueStat &queue_stat,
+                                          bool &is_queue_empty)
+{
+  int64_t replay_cost = 0;
+  LSN lsn;
+  SCN scn;
+  int64_t replay_hint = 0;
+  ObLogBaseType log_type = ObLogBaseType::INVALID_LOG_BASE_TYPE;
+  int64_t first_handle_ts = OB_INVALID_TIMESTAMP;
+  int64_t task_replay_cost = 0;
+  int64_t retry_cost = 0;
+  ObReplayServiceReplayTask &task_queue = task_queues_[queue_idx];
+  queue_stat.queue_idx_ = queue_idx;
+  queue_stat.pending_cnt_ = task_queue.get_pending_cnt();
+  if (fetch_delta) {
+    task_queue.fetch_replayed_stat(queue_stat.replayed_cnt_, queue_stat.replayed_size_, replay_cost);
+  } else {
+    task_queue.get_replayed_stat(queue_stat.replayed_cnt_, queue_stat.replayed_size_, replay_cost);
+  }
+  queue_stat.avg_replay_cost_ = replay_cost / (queue_stat.replayed_cnt_ + 1);
+  is_queue_empty = true;
+  (void)task_queue.get_min_unreplayed_log_info(lsn, scn, replay_hint, log_type, first_handle_ts,
+                                               task_replay_cost, retry_cost, is_queue_empty);
+  if (!is_queue_empty && scn.is_valid()) {
+    // lag of the oldest unreplayed log of this queue
+    queue_stat.lag_ = std::max(0L, cur_ts - scn.convert_to_ts());
+  }
+}
+
 //此接口不会失败
 int ObReplayStatus::batch_push_all_task_queue()
 {
@@ -1187,14 +1363,14 @@ int ObReplayStatus::check_replay_barrier(ObLogReplayTask *replay_task,
     } else if (NULL == replay_log_buf->log_buf_) {
       ret = OB_ERR_UNEXPECTED;
       CLOG_LOG(ERROR, "pre barrier log real log buff is NULL", K(ret), KPC(replay_task));
-    } else if (replay_queue_idx == calc_replay_queue_idx(replay_hint)
+    } else if (replay_queue_idx == get_hint_queue_idx_(replay_hint)
                && 1 != replay_log_buf->get_replay_ref()) {
       ret = OB_EAGAIN;
       //某个事务内的前向barrier日志只能在此队列回放
       CLOG_LOG(TRACE, "skip dec pre barrier log ref", K(ret), K(replay_task), KPC(replay_task),
                K(nv), KPC(this));
     } else if ((0 == (nv = replay_log_buf->dec_replay_ref()))) {
-      if (replay_queue_idx != calc_replay_queue_idx(replay_hint)) {
+      if (replay_queue_idx != get_hint_queue_idx_(replay_hint)) {
         ret = OB_ERR_UNEXPECTED;
         CLOG_LOG(ERROR, "pre barrier log need replay but replay_queue_idx not match", K(ret), K(replay_task),
                  KPC(replay_task), K(replay_queue_idx), KPC(this));
@@ -1340,6 +1516,26 @@ int ObReplayStatus::diagnose(ReplayDiagnoseInfo &diagnose_info)
                                                        replay_cost, retry_cost, first_handle_time))) {
       CLOG_LOG(WARN, "append diagnose str failed", K(ret), K(replay_ret), K(min_unreplayed_lsn), K(min_unreplayed_scn),
                K(replay_hint), K(is_submit_err), K(replay_cost), K(retry_cost), K(first_handle_time));
+    } else if (is_enabled_) {
+      // the most backed up task queue, to tell whether replay is skewed on a few hot replay hints
+      int64_t max_pending_queue_idx = 0;
+      int64_t max_queue_pending_cnt = 0;
+      for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+        const int64_t queue_pending_cnt = task_queues_[i].get_pending_cnt();
+        if (queue_pending_cnt > max_queue_pending_cnt) {
+          max_pending_queue_idx = i;
+          max_queue_pending_cnt = queue_pending_cnt;
+        }
+      }
+      if (OB_FAIL(diagnose_info.diagnose_str_.append_fmt(" rebalance_count:%ld; "
+                                                         "max_pending_queue:%ld; "
+                                                         "max_queue_pending_cnt:%ld;",
+                                                         ATOMIC_LOAD(&rebalance_count_),
+                                                         max_pending_queue_idx,
+                                                         max_queue_pending_cnt))) {
+        CLOG_LOG(WARN, "append diagnose str failed", K(ret), K(max_pending_queue_idx),
+                 K(max_queue_pending_cnt));
+      }
     }
   }
   return ret;
@@ -76,6 +76,26 @@ struct LSReplayStat
                K(pending_cnt_));
 };
 
+//单个回放队列的回放统计, get_task_queue_stat()返回累计值, 日志中打印的是与上次打印之间的增量
+struct ObReplayQueueStat
+{
+  ObReplayQueueStat()
+    : queue_idx_(-1), pending_cnt_(0), replayed_cnt_(0),
+      replayed_size_(0), avg_replay_cost_(0), lag_(0) {}
+  int64_t queue_idx_;
+  int64_t pending_cnt_;
+  int64_t replayed_cnt_;
+  int64_t replayed_size_;
+  int64_t avg_replay_cost_;
+  int64_t lag_; //队列中最早未回放日志的scn与当前时间的差值
+  TO_STRING_KV(K(queue_idx_),
+               K(pending_cnt_),
+               K(replayed_cnt_),
+               K(replayed_size_),
+               K(avg_replay_cost_),
+               K(lag_));
+};
+
 struct ReplayDiagnoseInfo
 {
   ReplayDiagnoseInfo() { reset(); }
@@ -346,6 +366,13 @@ public:
     type_ = ObReplayServiceTaskType::REPLAY_LOG_TASK;
     idx_ = -1;
     need_batch_push_ = false;
+    pending_cnt_ = 0;
+    replayed_cnt_ = 0;
+    replayed_size_ = 0;
+    replay_cost_ = 0;
+    fetched_replayed_cnt_ = 0;
+    fetched_replayed_size_ = 0;
+    fetched_replay_cost_ = 0;
   }
   ~ObReplayServiceReplayTask() { destroy(); }
   // use base_scn init min_unreplayed_scn
@@ -371,8 +398,18 @@ public:
                                   bool &is_queue_empty);
   bool need_batch_push();
   void set_batch_push_finish();
+  // pending_cnt_ counts the tasks routed to this queue by replay hint and not yet replayed,
+  // a pre barrier log broadcast to all queues is counted once by the queue replaying it
+  void inc_pending_cnt() { ATOMIC_INC(&pending_cnt_); }
+  void dec_pending_cnt() { ATOMIC_DEC(&pending_cnt_); }
+  int64_t get_pending_cnt() const { return ATOMIC_LOAD(&pending_cnt_); }
+  void add_replayed_stat(const int64_t log_size, const int64_t replay_cost);
+  // statistics accumulated since this queue was inited
+  void get_replayed_stat(int64_t &replayed_cnt, int64_t &replayed_size, int64_t &replay_cost) const;
+  // statistics since last call, only called by the replay process timer
+  void fetch_replayed_stat(int64_t &replayed_cnt, int64_t &replayed_size, int64_t &replay_cost);
   INHERIT_TO_STRING_KV("ObReplayServiceReplayTask", ObReplayServiceTask,
-                       K(idx_));
+                       K(idx_), K(pending_cnt_));
 private:
   Link *pop_()
   {
@@ -382,6 +419,13 @@ private:
   common::ObSpScLinkQueue queue_; //place ObLogReplayTask
   int64_t idx_; //热点行优化
   bool need_batch_push_; //batch push判断标志, 只有拉日志线程可以修改此值
+  int64_t pending_cnt_;
+  int64_t replayed_cnt_;
+  int64_t replayed_size_;
+  int64_t replay_cost_;
+  int64_t fetched_replayed_cnt_;
+  int64_t fetched_replayed_size_;
+  int64_t fetched_replay_cost_;
 };
 
 class ObReplayFsCb : public palf::PalfFSCb
@@ -499,6 +543,14 @@ public:
   int batch_push_all_task_queue();
   void inc_pending_task(const int64_t log_size);
   void dec_pending_task(const int64_t log_size);
+  // must be called after a task has been replayed, for pre barrier log only once,
+  // its replay hint is free to move to another queue once all of its tasks have been replayed
+  void dec_queue_pending_task(const ObLogReplayTask &task);
+  // print lag and throughput of each task queue since last call
+  void print_task_queue_stat();
+  // lag and accumulated throughput of all task queues, does not affect print_task_queue_stat()
+  int get_task_queue_stat(common::ObIArray<ObReplayQueueStat> &queue_stats,
+                          int64_t &rebalance_count);
   //通用的replay task释放内存接口, 前向barrier的任务不会单独释放log buf内存
   //前向barrier完整释放申请的内存需要同时调用
   //free_replay_task_log_buf()和free_replay_task()
@@ -571,6 +623,7 @@ public:
                K(ref_cnt_),
                K(post_barrier_lsn_),
                K(pending_task_count_),
+               K(rebalance_count_),
                K(submit_log_task_));
 private:
   void set_next_to_submit_log_info_(const palf::LSN &lsn, const share::SCN &scn);
@@ -582,7 +635,31 @@ private:
   // 注销回调并清空任务
   int disable_();
   bool is_replay_enabled_() const;
+  void reset_hint_slots_();
+  void get_task_queue_stat_(const int64_t queue_idx,
+                            const int64_t cur_ts,
+                            const bool fetch_delta,
+                            ObReplayQueueStat &queue_stat,
+                            bool &is_queue_empty);
+  // choose task queue for a task by its replay hint, only called by the thread holding submit_log_task_
+  int64_t route_replay_hint_(const int64_t replay_hint);
+  int64_t get_hint_queue_idx_(const int64_t replay_hint) const
+  {
+    return ATOMIC_LOAD(&hint_slots_[replay_hint & (REPLAY_HINT_SLOT_CNT - 1)].queue_idx_);
+  }
 private:
+  // Replay hints are hashed into hint slots, and each slot is bound to a task queue.
+  // Logs with the same hint must be replayed in order, so a slot only moves to
+  // another queue when all of its pushed tasks have been replayed.
+  struct ReplayHintSlot
+  {
+    int32_t pending_cnt_;
+    int32_t queue_idx_;
+  };
+  static const int64_t REPLAY_HINT_SLOT_CNT = 256;
+  // an idle slot moves away when its queue has more pending tasks than this
+  // and the least loaded queue has less than half of it
+  static const int64_t REBALANCE_PENDING_THRESHOLD = 64;
   static const int64_t PENDING_COUNT_THRESHOLD = 100;
   static const int64_t EAGAIN_COUNT_THRESHOLD = 50000;
   static const int64_t EAGAIN_INTERVAL_THRESHOLD = 10 * 60 * 1000 * 1000LL;
@@ -617,6 +694,8 @@ private:
   ObLogReplayService *rp_sv_;
   // be sure to clear these queues when the partition is offline to prevent old replay task is replayed in situation of migrating out and then migrating in
   ObReplayServiceReplayTask task_queues_[common::REPLAY_TASK_QUEUE_SIZE];
+  ReplayHintSlot hint_slots_[REPLAY_HINT_SLOT_CNT];
+  int64_t rebalance_count_;
   ObReplayServiceSubmitTask submit_log_task_;
 
   palf::PalfEnv *palf_env_;
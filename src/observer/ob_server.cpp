@@ -76,6 +76,7 @@
 #include "storage/tablelock/ob_table_lock_service.h"
 #include "storage/tx/ob_ts_mgr.h"
 #include "storage/tx_table/ob_tx_data_cache.h"
+#include "logservice/palf/log_cache.h"
 #include "storage/ob_file_system_router.h"
 #include "common/log/ob_log_constants.h"
 #include "share/stat/ob_opt_stat_monitor_manager.h"
@@ -340,6 +341,8 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
       LOG_ERROR("init storage failed", KR(ret));
     } else if (OB_FAIL(init_tx_data_cache())) {
       LOG_ERROR("init tx data cache failed", KR(ret));
+    } else if (OB_FAIL(init_log_kv_cache())) {
+      LOG_ERROR("init log kv cache failed", KR(ret));
     } else if (OB_FAIL(locality_manager_.init(self_addr_,
                                               &sql_proxy_))) {
       LOG_ERROR("init locality manager failed", KR(ret));
@@ -563,6 +566,10 @@ void ObServer::destroy()
     OB_TX_DATA_KV_CACHE.destroy();
     FLOG_INFO("tx data kv cache destroyed");
 
+    FLOG_INFO("begin to destroy log kv cache");
+    OB_LOG_KV_CACHE.destroy();
+    FLOG_INFO("log kv cache destroyed");
+
     FLOG_INFO("begin to destroy ObDagWarningHistoryManager");
     ObDagWarningHistoryManager::get_instance().destroy();
     FLOG_INFO("ObDagWarningHistoryManager destroyed");
@@ -2343,6 +2350,15 @@ int ObServer::init_tx_data_cache()
   return ret;
 }
 
+int ObServer::init_log_kv_cache()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(OB_LOG_KV_CACHE.init("log_kv_cache", 1 /* cache priority */))) {
+    LOG_WARN("init OB_LOG_KV_CACHE failed", KR(ret));
+  }
+  return ret;
+}
+
 int ObServer::get_network_speed_from_sysfs(int64_t &network_speed)
 {
   int ret = OB_SUCCESS;
@@ -298,6 +298,18 @@ int ObInfoSchemaKvCacheTable::process_row(const ObKVCacheInst *inst)
         cells_[cell_idx].set_int(inst->status_.hold_size_);
         break;
       }
+      case LRU_HIT_CNT: {
+        cells_[cell_idx].set_int(inst->status_.lru_hit_cnt_.value());
+        break;
+      }
+      case LFU_HIT_CNT: {
+        cells_[cell_idx].set_int(inst->status_.lfu_hit_cnt_.value());
+        break;
+      }
+      case ADMISSION_REJECT_CNT: {
+        cells_[cell_idx].set_int(inst->status_.admission_reject_cnt_);
+        break;
+      }
       default: {
         ret = OB_ERR_UNEXPECTED;
         SERVER_LOG(WARN, "Invalid column id", K(ret), K(cell_idx), K(output_column_ids_), K(col_id));
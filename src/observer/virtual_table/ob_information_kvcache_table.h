@@ -62,7 +62,10 @@ private:
     TOTAL_PUT_CNT,
     TOTAL_HIT_CNT,
     TOTAL_MISS_CNT,
-    HOLD_SIZE
+    HOLD_SIZE,
+    LRU_HIT_CNT,
+    LFU_HIT_CNT,
+    ADMISSION_REJECT_CNT
   };
   common::ObAddr *addr_;
   common::ObString ipstr_;
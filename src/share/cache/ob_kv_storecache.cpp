@@ -269,6 +269,7 @@ void ObKVGlobalCache::destroy()
     insts_.destroy();
     for (int64_t i = 0; i < MAX_CACHE_NUM; ++i) {
       configs_[i].reset();
+      sketches_[i].destroy();
     }
     cache_num_ = 0;
     mem_limit_getter_ = nullptr;
@@ -284,9 +285,10 @@ int ObKVGlobalCache::put(
   const ObIKVCacheValue &value,
   const ObIKVCacheValue *&pvalue,
   ObKVMemBlockHandle *&mb_handle,
-  bool overwrite)
+  bool overwrite,
+  const bool check_admission)
 {
-  return put(store_, cache_id, key, value, pvalue, mb_handle, overwrite);
+  return put(store_, cache_id, key, value, pvalue, mb_handle, overwrite, check_admission);
 }
 
 int ObKVGlobalCache::put(
@@ -321,7 +323,8 @@ int ObKVGlobalCache::put(
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite)
+    bool overwrite,
+    const bool check_admission)
 {
   int ret = OB_SUCCESS;
   ObKVCacheInstKey inst_key(cache_id, key.get_tenant_id());
@@ -341,6 +344,8 @@ int ObKVGlobalCache::put(
   } else if (NULL == inst_handle.get_inst()) {
     ret = OB_ERR_UNEXPECTED;
     COMMON_LOG(WARN, "The inst is NULL, ", K(ret));
+  } else if (check_admission && !is_admitted(*inst_handle.get_inst(), key)) {
+    // rejected by admission control, the item is simply not cached
   } else if (!overwrite && (OB_SUCC(map_.get(cache_id, key, pvalue, mb_handle)))) {
     ret = OB_ENTRY_EXIST;
   } else if (OB_FAIL(store.store(*inst_handle.get_inst(), key, value, kvpair, mb_wrapper))) {
@@ -443,6 +448,7 @@ int ObKVGlobalCache::get(
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
   } else if (FALSE_IT(revert(mb_handle))) {
+  } else if (FALSE_IT(record_access(cache_id, key))) {
   } else if (OB_FAIL(map_.get(cache_id, key, pvalue, mb_handle))) {
     if (OB_ENTRY_NOT_EXIST != ret) {
       COMMON_LOG(WARN, "fail to get value from map, ", K(ret));
@@ -700,6 +706,57 @@ int ObKVGlobalCache::set_priority(const int64_t cache_id, const int64_t priority
   return ret;
 }
 
+int ObKVGlobalCache::set_admission(const int64_t cache_id, const bool enable_admission)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(cache_id < 0) || OB_UNLIKELY(cache_id >= MAX_CACHE_NUM)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(cache_id), K(ret));
+  } else {
+    lib::ObMutexGuard guard(mutex_);
+    if (configs_[cache_id].enable_admission_ == enable_admission) {
+      // same admission, do nothing
+    } else if (enable_admission && !sketches_[cache_id].is_inited()
+        && OB_FAIL(sketches_[cache_id].init())) {
+      COMMON_LOG(WARN, "Fail to init frequency sketch, ", K(cache_id), K(ret));
+    } else {
+      // the sketch is kept after admission is disabled, concurrent getters may still use it
+      ATOMIC_STORE(&configs_[cache_id].enable_admission_, enable_admission);
+      COMMON_LOG(INFO, "Succ to set cache admission", K(cache_id),
+                 "cache_name", configs_[cache_id].cache_name_, K(enable_admission));
+    }
+  }
+  return ret;
+}
+
+bool ObKVGlobalCache::is_admitted(ObKVCacheInst &inst, const ObIKVCacheKey &key)
+{
+  bool admitted = true;
+  uint64_t hash_code = 0;
+  const int64_t cache_id = inst.cache_id_;
+  if (OB_LIKELY(cache_id >= 0 && cache_id < MAX_CACHE_NUM)
+      && ATOMIC_LOAD(&configs_[cache_id].enable_admission_)
+      && OB_SUCCESS == key.hash(hash_code)
+      && sketches_[cache_id].estimate(hash_code) < ADMISSION_FREQ_THRESHOLD) {
+    admitted = false;
+    (void) ATOMIC_AAF(&inst.status_.admission_reject_cnt_, 1);
+  }
+  return admitted;
+}
+
+void ObKVGlobalCache::record_access(const int64_t cache_id, const ObIKVCacheKey &key)
+{
+  uint64_t hash_code = 0;
+  if (OB_LIKELY(cache_id >= 0 && cache_id < MAX_CACHE_NUM)
+      && ATOMIC_LOAD(&configs_[cache_id].enable_admission_)
+      && OB_SUCCESS == key.hash(hash_code)) {
+    sketches_[cache_id].record(hash_code);
+  }
+}
+
 void ObKVGlobalCache::wash()
 {
   if (OB_LIKELY(inited_ && !start_destory_)) {
@@ -774,6 +831,28 @@ void ObKVGlobalCache::reload_priority()
   }
 }
 
+void ObKVGlobalCache::reload_admission()
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; i < MAX_CACHE_NUM; ++i) {
+    if (configs_[i].is_valid_) {
+      ObString cache_list(common::ObServerConfig::get_instance()._cache_admission_list.str());
+      bool enable_admission = false;
+      while (!enable_admission && !cache_list.empty()) {
+        ObString cache_name = cache_list.split_on(',');
+        if (NULL == cache_name.ptr()) {
+          cache_name = cache_list;
+          cache_list.reset();
+        }
+        enable_admission = 0 == cache_name.trim().case_compare(configs_[i].cache_name_);
+      }
+      if (OB_FAIL(set_admission(i, enable_admission))) {
+        COMMON_LOG(WARN, "Fail to set admission, ", K(i), K(enable_admission), K(ret));
+      }
+    }
+  }
+}
+
 int ObKVGlobalCache::reload_wash_interval()
 {
   int ret = OB_SUCCESS;
@@ -61,6 +61,8 @@ public:
   int init(const char *cache_name, const int64_t priority = 1);
   void destroy();
   int set_priority(const int64_t priority);
+  // admission control applies to put and put_kvpair, put_and_fetch always stores the item
+  int set_admission(const bool enable_admission);
   virtual int put(const Key &key, const Value &value, bool overwrite = true);
   virtual int put_and_fetch(
     const Key &key,
@@ -136,6 +138,7 @@ public:
            const int64_t cache_wash_interval = 0);
   void destroy();
   void reload_priority();
+  void reload_admission();
   int reload_wash_interval();
   int64_t get_suitable_bucket_num();
   int get_cache_inst_info(const uint64_t tenant_id, ObIArray<ObKVCacheInstHandle> &inst_handles);
@@ -172,13 +175,20 @@ private:
   int create_working_set(const ObKVCacheInstKey &inst_key, ObWorkingSet *&working_set);
   int delete_working_set(ObWorkingSet *working_set);
   int set_priority(const int64_t cache_id, const int64_t priority);
+  int set_admission(const int64_t cache_id, const bool enable_admission);
+  // TinyLFU style admission: an item is admitted only if its key has been requested at least
+  // ADMISSION_FREQ_THRESHOLD times recently, so one-touch items of large scans never get in.
+  // Rejections are counted on inst.
+  bool is_admitted(ObKVCacheInst &inst, const ObIKVCacheKey &key);
+  void record_access(const int64_t cache_id, const ObIKVCacheKey &key);
   int put(
     const int64_t cache_id,
     const ObIKVCacheKey &key,
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite = true);
+    bool overwrite = true,
+    const bool check_admission = false);
   int put(
     ObWorkingSet *working_set,
     const ObIKVCacheKey &key,
@@ -194,7 +204,8 @@ private:
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite = true);
+    bool overwrite = true,
+    const bool check_admission = false);
   int alloc(
       const int64_t cache_id,
       const uint64_t tenant_id,
@@ -247,6 +258,7 @@ private:
   static const int64_t PRINT_INTERVAL = 30 * 1000L * 1000L;
   static const int64_t MAP_WASH_CLEAN_INTERNAL = 10;
   static const int64_t MAP_REPLACE_ONCE_SKIP_COUNT = 10;
+  static const uint8_t ADMISSION_FREQ_THRESHOLD = 2;
 private:
   class KVStoreWashTask: public ObTimerTask
   {
@@ -293,6 +305,8 @@ private:
   ObWorkingSetMgr ws_mgr_;
   // cache configs
   ObKVCacheConfig configs_[MAX_CACHE_NUM];
+  // access frequency of each cache with admission control
+  ObKVCacheFreqSketch sketches_[MAX_CACHE_NUM];
   int64_t cache_num_;
   lib::ObMutex mutex_;
   // timer and task
@@ -382,6 +396,8 @@ int ObIKVCache<Key, Value>::put_kvpair(ObKVCacheInstHandle &inst_handle, ObKVCac
     if (OB_ISNULL(inst_handle.get_inst())) {
       ret = OB_ERR_UNEXPECTED;
       COMMON_LOG(WARN, "The inst is NULL, ", K(ret));
+    } else if (!ObKVGlobalCache::get_instance().is_admitted(*inst_handle.get_inst(), *kvpair->key_)) {
+      // rejected by admission control, the kvpair is only visible through handle
     } else if (OB_FAIL(ObKVGlobalCache::get_instance().map_.put(*inst_handle.get_inst(),
         *kvpair->key_, kvpair, handle.mb_handle_, overwrite))) {
       if (OB_ENTRY_EXIST != ret) {
@@ -453,6 +469,19 @@ int ObKVCache<Key, Value>::set_priority(const int64_t priority)
   return ret;
 }
 
+template <class Key, class Value>
+int ObKVCache<Key, Value>::set_admission(const bool enable_admission)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(ObKVGlobalCache::get_instance().set_admission(cache_id_, enable_admission))) {
+    COMMON_LOG(WARN, "Fail to set admission, ", K_(cache_id), K(enable_admission), K(ret));
+  }
+  return ret;
+}
+
 template <class Key, class Value>
 int64_t ObKVCache<Key, Value>::size(const uint64_t tenant_id) const
 {
@@ -552,7 +581,7 @@ int ObKVCache<Key, Value>::put(const Key &key, const Value &value, bool overwrit
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
   } else if (OB_FAIL(ObKVGlobalCache::get_instance().put(cache_id_, key, value, pvalue,
-      handle.mb_handle_, overwrite))) {
+      handle.mb_handle_, overwrite, true /* check_admission */))) {
     if (OB_ENTRY_EXIST != ret) {
       COMMON_LOG(WARN, "Fail to put kv to ObKVGlobalCache, ", K_(cache_id), K(ret));
     }
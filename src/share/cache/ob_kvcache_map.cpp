@@ -287,6 +287,11 @@ int ObKVCacheMap::get(
               iter_get_cnt = ++ iter->get_cnt_;
               iter->inst_->status_.total_hit_cnt_.inc();
               mb_policy = out_handle->policy_;
+              if (LRU == mb_policy) {
+                iter->inst_->status_.lru_hit_cnt_.inc();
+              } else {
+                iter->inst_->status_.lfu_hit_cnt_.inc();
+              }
 
               break;
             }
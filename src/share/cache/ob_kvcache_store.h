@@ -305,7 +305,7 @@ int ObIKVCacheStore<MBWrapper>::alloc_kvpair(
           COMMON_LOG(WARN, "alloc failed", K(ret));
         } else {
           //success to alloc kv
-          mb_wrapper->set_full(inst.status_.base_mb_score_);
+          mb_wrapper->set_full(inst.status_.get_base_mb_score(policy));
         }
       } else {
         ret = OB_ERR_UNEXPECTED;
@@ -339,7 +339,7 @@ int ObIKVCacheStore<MBWrapper>::alloc_kvpair(
           COMMON_LOG(WARN, "alloc failed", K(ret), K(block_size));
         } else if (ATOMIC_BCAS((uint64_t*)(&get_curr_mb(inst, policy)), (uint64_t)mb_wrapper, (uint64_t)new_mb_wrapper)) {
           if (NULL != mb_wrapper) {
-            mb_wrapper->set_full(inst.status_.base_mb_score_);
+            mb_wrapper->set_full(inst.status_.get_base_mb_score(policy));
           }
         } else if (OB_FAIL(free(new_mb_wrapper))) {
           COMMON_LOG(ERROR, "free failed", K(ret));
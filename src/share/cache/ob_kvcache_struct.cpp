@@ -11,6 +11,7 @@
  */
 
 #include "ob_kvcache_struct.h"
+#include "lib/allocator/ob_malloc.h"
 
 namespace oceanbase
 {
@@ -21,7 +22,8 @@ namespace common
  */
 ObKVCacheConfig::ObKVCacheConfig()
   : is_valid_(false),
-    priority_(0)
+    priority_(0),
+    enable_admission_(false)
 {
   MEMSET(cache_name_, 0, MAX_CACHE_NAME_LENGTH);
 }
@@ -30,9 +32,94 @@ void ObKVCacheConfig::reset()
 {
   is_valid_ = false;
   priority_ = 0;
+  enable_admission_ = false;
   MEMSET(cache_name_, 0, MAX_CACHE_NAME_LENGTH);
 }
 
+/**
+ * ------------------------------------------------------------ObKVCacheFreqSketch-----------------------------------------------------
+ */
+const uint64_t ObKVCacheFreqSketch::HASH_SEEDS[ObKVCacheFreqSketch::ROW_NUM] = {
+  0xc3a5c85c97cb3127UL, 0xb492b66fbe98f273UL, 0x9ae16a3b2f90404fUL, 0xcbf29ce484222325UL
+};
+
+ObKVCacheFreqSketch::ObKVCacheFreqSketch()
+  : counters_(NULL),
+    sample_cnt_(0),
+    is_inited_(false)
+{
+}
+
+ObKVCacheFreqSketch::~ObKVCacheFreqSketch()
+{
+  destroy();
+}
+
+int ObKVCacheFreqSketch::init()
+{
+  int ret = OB_SUCCESS;
+  const int64_t size = ROW_NUM * ROW_WIDTH * sizeof(uint8_t);
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    COMMON_LOG(WARN, "The ObKVCacheFreqSketch has been inited, ", K(ret));
+  } else if (OB_ISNULL(counters_ = static_cast<uint8_t *>(
+      ob_malloc(size, ObMemAttr(OB_SERVER_TENANT_ID, "KvcacheSketch"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "Fail to allocate memory for frequency sketch, ", K(size), K(ret));
+  } else {
+    MEMSET(counters_, 0, size);
+    sample_cnt_ = 0;
+    ATOMIC_STORE(&is_inited_, true);
+  }
+  return ret;
+}
+
+void ObKVCacheFreqSketch::destroy()
+{
+  ATOMIC_STORE(&is_inited_, false);
+  if (NULL != counters_) {
+    ob_free(counters_);
+    counters_ = NULL;
+  }
+  sample_cnt_ = 0;
+}
+
+void ObKVCacheFreqSketch::record(const uint64_t hash)
+{
+  if (OB_LIKELY(is_inited())) {
+    for (int64_t i = 0; i < ROW_NUM; ++i) {
+      uint8_t &counter = counters_[get_index(hash, i)];
+      if (counter < MAX_FREQ) {
+        ++counter;
+      }
+    }
+    // exactly one thread sees the threshold and ages the counters
+    if (RESET_SAMPLE_CNT == ATOMIC_AAF(&sample_cnt_, 1)) {
+      age();
+      (void) ATOMIC_SAF(&sample_cnt_, RESET_SAMPLE_CNT / 2);
+    }
+  }
+}
+
+uint8_t ObKVCacheFreqSketch::estimate(const uint64_t hash) const
+{
+  uint8_t freq = 0;
+  if (OB_LIKELY(is_inited())) {
+    freq = MAX_FREQ;
+    for (int64_t i = 0; i < ROW_NUM; ++i) {
+      freq = MIN(freq, counters_[get_index(hash, i)]);
+    }
+  }
+  return freq;
+}
+
+void ObKVCacheFreqSketch::age()
+{
+  for (int64_t i = 0; i < ROW_NUM * ROW_WIDTH; ++i) {
+    counters_[i] = static_cast<uint8_t>(counters_[i] >> 1);
+  }
+}
+
 /**
  * ------------------------------------------------------------ObKVCacheStatus----------------------------------------------------------
  */
@@ -62,6 +149,9 @@ void ObKVCacheStatus::reset()
   lfu_mb_cnt_ = 0;
   total_put_cnt_.reset();
   total_hit_cnt_.reset();
+  lru_hit_cnt_.reset();
+  lfu_hit_cnt_.reset();
+  admission_reject_cnt_ = 0;
   total_miss_cnt_ = 0;
   last_hit_cnt_ = 0;
   base_mb_score_ = 0;
@@ -176,9 +176,46 @@ public:
   void reset();
   bool is_valid_;
   int64_t priority_;
+  // only admit items which have been requested before, see ObKVCacheFreqSketch
+  bool enable_admission_;
   char cache_name_[MAX_CACHE_NAME_LENGTH];
 };
 
+// Approximate recent access frequency of cache keys for TinyLFU style admission control.
+// It is a count-min sketch of ROW_NUM rows of saturating 8-bit counters, all counters are
+// halved after every RESET_SAMPLE_CNT records so that old history fades out. Counters are
+// updated without atomic instructions on purpose, a lost update only lowers the estimate.
+class ObKVCacheFreqSketch
+{
+public:
+  static const int64_t ROW_NUM = 4;
+  static const int64_t ROW_WIDTH_BITS = 16;
+  static const int64_t ROW_WIDTH = 1L << ROW_WIDTH_BITS;
+  static const int64_t RESET_SAMPLE_CNT = ROW_WIDTH * 8;
+  static const uint8_t MAX_FREQ = UINT8_MAX;
+public:
+  ObKVCacheFreqSketch();
+  ~ObKVCacheFreqSketch();
+  int init();
+  void destroy();
+  inline bool is_inited() const { return ATOMIC_LOAD(&is_inited_); }
+  void record(const uint64_t hash);
+  uint8_t estimate(const uint64_t hash) const;
+  TO_STRING_KV(K_(is_inited), KP_(counters), K_(sample_cnt));
+private:
+  void age();
+  static inline int64_t get_index(const uint64_t hash, const int64_t row)
+  {
+    return row * ROW_WIDTH + static_cast<int64_t>((hash * HASH_SEEDS[row]) >> (64 - ROW_WIDTH_BITS));
+  }
+private:
+  static const uint64_t HASH_SEEDS[ROW_NUM];
+  uint8_t *counters_;
+  int64_t sample_cnt_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObKVCacheFreqSketch);
+};
+
 struct ObKVCacheStatus
 {
 public:
@@ -187,13 +224,25 @@ public:
   double get_hit_ratio() const;
   inline void set_hold_size(const int64_t hold_size) { ATOMIC_STORE(&hold_size_, hold_size); }
   inline int64_t get_hold_size() const { return ATOMIC_LOAD(&hold_size_); }
+  // LRU memblocks hold the items which have not been hit since put and act as the probation
+  // segment. With admission control they start without base score so that one-touch items
+  // of a large scan are washed before the items promoted to LFU memblocks.
+  inline double get_base_mb_score(const enum ObKVCachePolicy policy) const
+  {
+    return (LRU == policy && NULL != config_ && config_->enable_admission_) ? 0 : base_mb_score_;
+  }
   void reset();
   TO_STRING_KV(KP_(config), K_(kv_cnt), K_(store_size), K_(map_size), K_(lru_mb_cnt),
-      K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size));
+      K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size), "lru_hit_cnt", lru_hit_cnt_.value(),
+      "lfu_hit_cnt", lfu_hit_cnt_.value(), K_(admission_reject_cnt));
 
   const ObKVCacheConfig *config_;
   ObPCNonAtomicCounter total_put_cnt_;
   ObPCNonAtomicCounter total_hit_cnt_;
+  // hits split by the policy of the memblock the item lives in
+  ObPCNonAtomicCounter lru_hit_cnt_;
+  ObPCNonAtomicCounter lfu_hit_cnt_;
+  int64_t admission_reject_cnt_;
   int64_t kv_cnt_;
   int64_t store_size_;
   int64_t lru_mb_cnt_;
@@ -39,6 +39,7 @@ int ObReloadConfig::reload_ob_logger_set()
       OB_LOGGER.set_log_warn(conf_->enable_syslog_wf);
       OB_LOGGER.set_enable_async_log(conf_->enable_async_syslog);
       ObKVGlobalCache::get_instance().reload_priority();
+      ObKVGlobalCache::get_instance().reload_admission();
     }
   }
   return ret;
@@ -6192,6 +6192,9 @@ def_table_schema(
   ('total_hit_cnt', 'int', 'false'),
   ('total_miss_cnt', 'int', 'false'),
   ('hold_size', 'int', 'false'),
+  ('lru_hit_cnt', 'int', 'false'),
+  ('lfu_hit_cnt', 'int', 'false'),
+  ('admission_reject_cnt', 'int', 'false'),
   ],
   vtable_route_policy = 'distributed',
   partition_columns = ['svr_ip', 'svr_port'],
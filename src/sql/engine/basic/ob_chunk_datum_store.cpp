@@ -19,6 +19,7 @@
 #include "lib/container/ob_se_array_iterator.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "share/config/ob_server_config.h"
+#include "lib/compress/ob_compressor_pool.h"
 
 namespace oceanbase
 {
@@ -291,6 +292,40 @@ int ObChunkDatumStore::BlockBufferWrap::append_row(
   return ret;
 }
 
+int ObChunkDatumStore::BlockBufferWrap::append_row(
+  const common::ObIArray<ObDatumVector> &datum_vecs, const int64_t batch_idx,
+  int64_t row_extend_size)
+{
+  int ret = OB_SUCCESS;
+  OB_ASSERT(is_inited());
+  int64_t max_size = remain();
+  int64_t pos = sizeof(ObDatum) * datum_vecs.count() + row_extend_size + sizeof(StoredRow);
+  if (pos > max_size) {
+    ret = OB_BUF_NOT_ENOUGH;
+  } else {
+    StoredRow *sr = (StoredRow*)head();
+    sr->cnt_ = static_cast<uint32_t>(datum_vecs.count());
+    for (int64_t i = 0; OB_SUCC(ret) && i < sr->cnt_; ++i) {
+      const ObDatum &in_datum = *datum_vecs.at(i).at(batch_idx);
+      ObDatum *datum = new (&sr->cells()[i])ObDatum();
+      // Attension : can't print dst datum after deep_copy_unswizzling
+      if (OB_FAIL(deep_copy_unswizzling(in_datum, datum, head(), max_size, pos))) {
+        if (OB_BUF_NOT_ENOUGH != ret) {
+          LOG_WARN("failed to copy datum", K(ret), K(i), K(pos),
+            K(max_size), K(in_datum));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      sr->row_size_ = static_cast<int32_t>(pos);
+      fast_advance(pos);
+      rows_++;
+    }
+  }
+
+  return ret;
+}
+
 int ObChunkDatumStore::Block::append_row(
   const common::ObIArray<ObExpr*> &exprs, ObEvalCtx *ctx,
   BlockBuffer *buf, int64_t row_extend_size, StoredRow **stored_row, const bool unswizzling)
@@ -488,7 +523,8 @@ ObChunkDatumStore::ObChunkDatumStore(common::ObIAllocator *alloc /* = NULL */)
     mem_hold_(0), mem_used_(0), max_hold_mem_(0),
     allocator_(NULL == alloc ? &inner_allocator_ : alloc),
     row_extend_size_(0), callback_(nullptr), batch_ctx_(NULL),
-    tmp_dump_blk_(nullptr)
+    tmp_dump_blk_(nullptr), compressor_(NULL), dump_page_(NULL), dump_page_mem_size_(0),
+    dump_page_pos_(0), dump_page_frame_cnt_(0)
 {
   io_.fd_ = -1;
   io_.dir_id_ = -1;
@@ -553,6 +589,7 @@ void ObChunkDatumStore::reset()
   cur_blk_buffer_ = nullptr;
   free_block(tmp_dump_blk_);
   tmp_dump_blk_ = nullptr;
+  free_dump_page();
   while (!free_list_.is_empty()) {
     Block *item = free_list_.remove_first();
     mem_hold_ -= item->get_buffer()->mem_size();
@@ -673,7 +710,11 @@ bool ObChunkDatumStore::shrink_block(int64_t size)
       free_block(item);
       item = blocks_.remove_first();
     }
+    if (OB_SUCC(ret) && OB_FAIL(flush_dump_page())) {
+      LOG_WARN("flush dump page failed when shrink blk", K(ret));
+    }
     free_tmp_dump_blk();
+    free_dump_page();
   }
   LOG_DEBUG("RowStore shrink_block", K(ret), K(freed_size), K(size));
   if (freed_size >= size) {
@@ -751,6 +792,10 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
   item->block->magic_ = Block::MAGIC;
   if (OB_FAIL(item->get_block()->unswizzling())) {
     LOG_WARN("convert block to copyable failed", K(ret));
+  } else if (NULL != compressor_) {
+    if (OB_FAIL(compress_one_block(item))) {
+      LOG_WARN("compress block failed", K(ret));
+    }
   } else if (item->capacity() < min_block_size) {
     if (OB_ISNULL(tmp_dump_blk_)) {
       if (OB_FAIL(alloc_block_buffer(tmp_dump_blk_, default_block_size_, false))) {
@@ -784,6 +829,111 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
   return ret;
 }
 
+int ObChunkDatumStore::set_dump_compressor(const ObCompressorType type)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (is_file_open()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("can not change compressor after dumped", K(ret), K(type));
+  } else if (NONE_COMPRESSOR == type) {
+    compressor_ = NULL;
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor_))) {
+    LOG_WARN("get compressor failed", K(ret), K(type));
+  } else if (OB_ISNULL(compressor_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null compressor", K(ret), K(type));
+  }
+  return ret;
+}
+
+// Append the payload of block to the dump page, the page is written to file when full.
+int ObChunkDatumStore::compress_one_block(BlockBuffer *item)
+{
+  int ret = OB_SUCCESS;
+  Block *blk = item->get_block();
+  const int64_t payload_size = item->data_size() - BlockBuffer::HEAD_SIZE;
+  int64_t max_overflow_size = 0;
+  if (OB_FAIL(compressor_->get_max_overflow_size(payload_size, max_overflow_size))) {
+    LOG_WARN("get max overflow size failed", K(ret), K(payload_size));
+  } else {
+    const int64_t max_frame_size = sizeof(FrameHead) + payload_size + max_overflow_size;
+    if (NULL != dump_page_ && dump_page_pos_ + max_frame_size > dump_page_mem_size_
+        && OB_FAIL(flush_dump_page())) {
+      LOG_WARN("flush dump page failed", K(ret));
+    } else if (NULL != dump_page_
+               && static_cast<int64_t>(sizeof(PageHead)) + max_frame_size > dump_page_mem_size_) {
+      // block larger than page, use a larger page
+      free_dump_page();
+    }
+    if (OB_SUCC(ret) && NULL == dump_page_) {
+      const int64_t size = std::max(static_cast<int64_t>(DUMP_PAGE_SIZE),
+          next_pow2(static_cast<int64_t>(sizeof(PageHead)) + max_frame_size));
+      if (OB_ISNULL(dump_page_ = static_cast<char *>(alloc_blk_mem(size, false)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc dump page failed", K(ret), K(size));
+      } else {
+        dump_page_mem_size_ = size;
+        dump_page_pos_ = sizeof(PageHead);
+        dump_page_frame_cnt_ = 0;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    FrameHead *frame = reinterpret_cast<FrameHead *>(dump_page_ + dump_page_pos_);
+    char *dst = dump_page_ + dump_page_pos_ + sizeof(FrameHead);
+    const int64_t dst_size = dump_page_mem_size_ - dump_page_pos_ - sizeof(FrameHead);
+    int64_t frame_size = 0;
+    if (OB_FAIL(compressor_->compress(blk->payload_, payload_size, dst, dst_size, frame_size))) {
+      LOG_WARN("compress block failed", K(ret), K(payload_size), K(dst_size));
+    } else {
+      if (frame_size >= payload_size) {
+        // not shrunk, store as is
+        MEMCPY(dst, blk->payload_, payload_size);
+        frame_size = payload_size;
+      }
+      frame->frame_size_ = static_cast<uint32>(frame_size);
+      frame->payload_size_ = static_cast<uint32>(payload_size);
+      frame->blk_size_ = blk->blk_size_;
+      frame->rows_ = blk->rows_;
+      dump_page_pos_ += sizeof(FrameHead) + frame_size;
+      dump_page_frame_cnt_ += 1;
+    }
+  }
+  return ret;
+}
+
+int ObChunkDatumStore::flush_dump_page()
+{
+  int ret = OB_SUCCESS;
+  if (NULL != dump_page_ && dump_page_frame_cnt_ > 0) {
+    PageHead *head = new (dump_page_) PageHead();
+    head->page_size_ = static_cast<uint32>(dump_page_pos_);
+    head->frame_cnt_ = static_cast<uint32>(dump_page_frame_cnt_);
+    if (OB_FAIL(write_file(dump_page_, dump_page_pos_))) {
+      LOG_WARN("write dump page to file failed", K(ret), KPC(head));
+    } else {
+      LOG_DEBUG("RowStore dumped page", KPC(head));
+      dump_page_pos_ = sizeof(PageHead);
+      dump_page_frame_cnt_ = 0;
+    }
+  }
+  return ret;
+}
+
+void ObChunkDatumStore::free_dump_page()
+{
+  if (NULL != dump_page_) {
+    free_blk_mem(dump_page_, dump_page_mem_size_);
+    dump_page_ = NULL;
+    dump_page_mem_size_ = 0;
+    dump_page_pos_ = 0;
+    dump_page_frame_cnt_ = 0;
+  }
+}
+
 // only clean memory data
 int ObChunkDatumStore::clean_memory_data(bool reuse)
 {
@@ -865,7 +1015,11 @@ int ObChunkDatumStore::dump(bool reuse, bool all_dump, int64_t dumped_size)
         tmp_dumped_size += tmp_size;
       }
     }
+    if (OB_SUCC(ret) && OB_FAIL(flush_dump_page())) {
+      LOG_WARN("failed to flush dump page", K(ret));
+    }
     free_tmp_dump_blk();
+    free_dump_page();
     if (all_dump && (mem_used_ != 0 || (!reuse && mem_hold_ != 0) || blocks_.get_size() != 0)) {
       LOG_WARN("hold mem after dump", K_(mem_used), K(reuse), K_(mem_hold),
           K(blocks_.get_size()), K(free_list_.get_size()));
@@ -2361,6 +2515,11 @@ void ObChunkDatumStore::Iterator::reset_cursor(const int64_t file_size)
   aio_blk_buf_ = NULL;
   read_blk_ = NULL;
   read_blk_buf_ = NULL;
+  free_page(aio_page_, aio_page_mem_size_);
+  free_page(page_, page_mem_size_);
+  page_pos_ = 0;
+  page_frame_left_ = 0;
+  aio_page_offset_ = 0;
 
   while (NULL != cached_.get_first()) {
     free_block(cached_.remove_first(), default_block_size_, force_free);
@@ -2396,7 +2555,14 @@ int ObChunkDatumStore::Iterator::load_next_block(RowIterator& it)
     } else if (store_->is_file_open() && !read_file_iter_end()) {
       uint64_t begin_io_read_time = rdtsc();
       // return at least one block when read file not end (!read_file_iter_end())
-      if (OB_FAIL(read_next_blk())) {
+      if (store_->is_dump_compressed()) {
+        if (OB_FAIL(read_next_compressed_blk())) {
+          LOG_WARN("read next compressed blk failed", K(ret));
+        } else if (page_frame_left_ <= 0 && NULL == aio_page_) {
+          // no page left, the next page is prefetched when current page loaded
+          set_read_file_iter_end();
+        }
+      } else if (OB_FAIL(read_next_blk())) {
         LOG_WARN("read next blk failed", K(ret));
       } else {
         if (cur_iter_pos_ >= file_size_) {
@@ -2508,6 +2674,150 @@ int ObChunkDatumStore::Iterator::read_next_blk()
   return ret;
 }
 
+int ObChunkDatumStore::Iterator::read_next_compressed_blk()
+{
+  int ret = OB_SUCCESS;
+  const FrameHead *frame = NULL;
+  Block *blk = NULL;
+  if (page_frame_left_ <= 0 && OB_FAIL(load_next_page())) {
+    LOG_WARN("load next page failed", K(ret));
+  } else if (OB_UNLIKELY(page_pos_ + static_cast<int64_t>(sizeof(FrameHead))
+                         > reinterpret_cast<PageHead *>(page_)->page_size_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("read corrupt page", K(ret), K_(page_pos), KPC(reinterpret_cast<PageHead *>(page_)));
+  } else if (FALSE_IT(frame = reinterpret_cast<const FrameHead *>(page_ + page_pos_))) {
+  } else if (OB_UNLIKELY(page_pos_ + sizeof(FrameHead) + frame->frame_size_
+                         > reinterpret_cast<PageHead *>(page_)->page_size_
+                         || frame->payload_size_ + BlockBuffer::HEAD_SIZE > frame->blk_size_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("read corrupt frame", K(ret), K_(page_pos), KPC(frame));
+  } else if (OB_FAIL(alloc_block(blk, frame->blk_size_ + sizeof(BlockBuffer)))) {
+    LOG_WARN("alloc block failed", K(ret), KPC(frame));
+  } else {
+    BlockBuffer *blk_buf = blk->get_buffer();
+    const char *src = page_ + page_pos_ + sizeof(FrameHead);
+    int64_t payload_size = frame->payload_size_;
+    if (!frame->is_compressed()) {
+      MEMCPY(blk->payload_, src, frame->payload_size_);
+    } else if (OB_FAIL(store_->compressor_->decompress(src, frame->frame_size_, blk->payload_,
+        blk_buf->capacity() - BlockBuffer::HEAD_SIZE, payload_size))) {
+      LOG_WARN("decompress block failed", K(ret), KPC(frame));
+    } else if (payload_size != frame->payload_size_) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("decompressed size mismatch", K(ret), K(payload_size), KPC(frame));
+    }
+    if (OB_SUCC(ret)) {
+      blk->rows_ = frame->rows_;
+      page_pos_ += sizeof(FrameHead) + frame->frame_size_;
+      page_frame_left_ -= 1;
+      if (NULL != read_blk_) {
+        free_block(read_blk_, read_blk_buf_->mem_size());
+      }
+      read_blk_ = blk;
+      read_blk_buf_ = blk_buf;
+      blk = NULL;
+      if (OB_FAIL(read_blk_->swizzling(NULL))) {
+        LOG_WARN("swizzling failed", K(ret));
+      } else {
+        cur_chunk_n_blocks_ = 1;
+        cur_nth_blk_ += 1;
+        read_blk_->next_ = NULL;
+        cur_iter_blk_ = read_blk_;
+        chunk_n_rows_ = cur_iter_blk_->rows_;
+      }
+    }
+    if (NULL != blk) {
+      free_block(blk, blk_buf->mem_size());
+    }
+  }
+  return ret;
+}
+
+int ObChunkDatumStore::Iterator::load_next_page()
+{
+  int ret = OB_SUCCESS;
+  if (NULL == aio_page_ && OB_FAIL(prefetch_next_page())) {
+    LOG_WARN("prefetch next page failed", K(ret));
+  } else if (OB_FAIL(aio_wait())) {
+    LOG_WARN("aio wait failed", K(ret));
+  } else {
+    // the prefetched size may exceed the page, or less than the page if the page is large
+    const int64_t loaded_len = std::min(aio_page_mem_size_, file_size_ - aio_page_offset_);
+    PageHead *head = reinterpret_cast<PageHead *>(aio_page_);
+    if (loaded_len < static_cast<int64_t>(sizeof(PageHead)) || !head->magic_check()
+        || head->page_size_ < sizeof(PageHead)
+        || aio_page_offset_ + head->page_size_ > file_size_) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("read corrupt page", K(ret), K(loaded_len), KPC(head), K_(aio_page_offset),
+               K_(file_size));
+    } else if (head->page_size_ > loaded_len) {
+      char *page = NULL;
+      const int64_t size = next_pow2(head->page_size_);
+      if (OB_ISNULL(page = static_cast<char *>(store_->alloc_blk_mem(size, true)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc page failed", K(ret), K(size));
+      } else {
+        MEMCPY(page, aio_page_, loaded_len);
+        free_page(aio_page_, aio_page_mem_size_);
+        aio_page_ = page;
+        aio_page_mem_size_ = size;
+        cur_iter_pos_ = aio_page_offset_ + loaded_len;
+        if (OB_FAIL(aio_read(aio_page_ + loaded_len,
+                             reinterpret_cast<PageHead *>(aio_page_)->page_size_ - loaded_len))) {
+          LOG_WARN("aio read failed", K(ret));
+        } else if (OB_FAIL(aio_wait())) {
+          LOG_WARN("aio wait failed", K(ret));
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // move aio page to current page
+    free_page(page_, page_mem_size_);
+    page_ = aio_page_;
+    page_mem_size_ = aio_page_mem_size_;
+    aio_page_ = NULL;
+    aio_page_mem_size_ = 0;
+    const PageHead *head = reinterpret_cast<PageHead *>(page_);
+    page_pos_ = sizeof(PageHead);
+    page_frame_left_ = head->frame_cnt_;
+    cur_iter_pos_ = aio_page_offset_ + head->page_size_;
+    if (cur_iter_pos_ < file_size_ && OB_FAIL(prefetch_next_page())) {
+      LOG_WARN("prefetch next page failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObChunkDatumStore::Iterator::prefetch_next_page()
+{
+  int ret = OB_SUCCESS;
+  CK(NULL == aio_page_);
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(aio_page_ = static_cast<char *>(
+                       store_->alloc_blk_mem(DUMP_PAGE_SIZE, true)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc page failed", K(ret));
+  } else {
+    aio_page_mem_size_ = DUMP_PAGE_SIZE;
+    aio_page_offset_ = cur_iter_pos_;
+    if (OB_FAIL(aio_read(aio_page_, aio_page_mem_size_))) {
+      LOG_WARN("aio read failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+void ObChunkDatumStore::Iterator::free_page(char *&page, int64_t &mem_size)
+{
+  if (NULL != page) {
+    store_->allocator_->free(page);
+    store_->callback_free(mem_size);
+    page = NULL;
+    mem_size = 0;
+  }
+}
+
 int ObChunkDatumStore::Iterator::prefetch_next_blk()
 {
   int ret = OB_SUCCESS;
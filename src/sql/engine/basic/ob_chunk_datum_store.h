@@ -23,6 +23,7 @@
 #include "share/datum/ob_datum.h"
 #include "sql/engine/expr/ob_expr.h"
 #include "storage/blocksstable/ob_tmp_file.h"
+#include "lib/compress/ob_compressor.h"
 #include "sql/engine/basic/ob_sql_mem_callback.h"
 #include "sql/engine/basic/ob_batch_result_holder.h"
 
@@ -482,6 +483,33 @@ public:
     char payload_[0];
   } __attribute__((packed));
 
+  // Blocks are packed into pages when dumped with compressor (see set_dump_compressor()):
+  //
+  //   | PageHead | FrameHead | payload of block | FrameHead | payload of block | ...
+  //
+  // The payload of each block is compressed, or stored as is if it can not be shrunk.
+  // A page is written by one IO and read back by one sequential prefetch.
+  struct PageHead
+  {
+    static const int64_t MAGIC = 0x6e3b17a4d8536316;
+    PageHead() : magic_(MAGIC), page_size_(0), frame_cnt_(0) {}
+    inline bool magic_check() const { return MAGIC == magic_; }
+    TO_STRING_KV(K_(magic), K_(page_size), K_(frame_cnt));
+    int64_t magic_;
+    uint32 page_size_;  // PageHead included
+    uint32 frame_cnt_;
+  } __attribute__((packed));
+
+  struct FrameHead
+  {
+    inline bool is_compressed() const { return frame_size_ < payload_size_; }
+    TO_STRING_KV(K_(frame_size), K_(payload_size), K_(blk_size), K_(rows));
+    uint32 frame_size_;    // stored payload size, FrameHead excluded
+    uint32 payload_size_;  // payload size of the block before compress
+    uint32 blk_size_;
+    uint32 rows_;
+  } __attribute__((packed));
+
   struct BlockList
   {
   public:
@@ -598,6 +626,9 @@ public:
 
     int append_row(const common::ObIArray<ObExpr*> &exprs,
                    ObEvalCtx *ctx, int64_t row_extend_size);
+    // append row %batch_idx of a batch, the datums of exprs are located once per batch
+    int append_row(const common::ObIArray<ObDatumVector> &datum_vecs,
+                   const int64_t batch_idx, int64_t row_extend_size);
     void reset() { rows_ = 0; BlockBuffer::reset(); }
 
   public:
@@ -704,6 +735,13 @@ public:
                  read_blk_buf_(NULL),
                  aio_blk_(NULL),
                  aio_blk_buf_(NULL),
+                 page_(NULL),
+                 page_mem_size_(0),
+                 page_pos_(0),
+                 page_frame_left_(0),
+                 aio_page_(NULL),
+                 aio_page_mem_size_(0),
+                 aio_page_offset_(0),
                  age_(NULL) {}
     virtual ~Iterator() { reset_cursor(0); }
     int init(ObChunkDatumStore *row_store, const IterationAge *age = NULL);
@@ -757,6 +795,11 @@ public:
     inline void set_read_mem_iter_end() { iter_end_flag_ |= MEM_ITER_END; }
     int prefetch_next_blk();
     int read_next_blk();
+    // read blocks of compressed dump, see PageHead
+    int read_next_compressed_blk();
+    int load_next_page();
+    int prefetch_next_page();
+    void free_page(char *&page, int64_t &mem_size);
     int aio_read(char *buf, const int64_t size);
     int aio_wait();
     int alloc_block(Block *&blk, const int64_t size);
@@ -766,7 +809,8 @@ public:
     TO_STRING_KV(KP_(store), KP_(cur_iter_blk),
          K_(cur_chunk_n_blocks), K_(cur_iter_pos), K_(file_size),
          KP_(chunk_mem), KP_(read_blk), KP_(read_blk_buf), KP_(aio_blk),
-         KP_(aio_blk_buf), K_(default_block_size));
+         KP_(aio_blk_buf), K_(default_block_size), KP_(page), K_(page_pos),
+         K_(page_frame_left), KP_(aio_page), K_(aio_page_offset));
   private:
      explicit Iterator(ObChunkDatumStore *row_store);
   protected:
@@ -791,6 +835,15 @@ public:
      Block *aio_blk_; // not null means aio is reading.
      BlockBuffer *aio_blk_buf_;
 
+     // page of compressed dump which blocks are decompressed from
+     char *page_;
+     int64_t page_mem_size_;
+     int64_t page_pos_;
+     int64_t page_frame_left_;
+     char *aio_page_; // not null means aio is reading.
+     int64_t aio_page_mem_size_;
+     int64_t aio_page_offset_;
+
      BlockList free_list_;
      // cached blocks for batch iterate
      BlockList cached_;
@@ -830,6 +883,7 @@ public:
 public:
   const static int64_t BLOCK_SIZE = (64L << 10);
   const static int64_t MIN_BLOCK_SIZE = (4L << 10);
+  const static int64_t DUMP_PAGE_SIZE = (256L << 10);
   static const int32_t DATUM_SIZE = sizeof(common::ObDatum);
 
   explicit ObChunkDatumStore(common::ObIAllocator *alloc = NULL);
@@ -939,8 +993,11 @@ public:
   // 目前dir id 的策略是上层逻辑（一般是算子）统一申请，然后再set过来
   void set_dir_id(int64_t dir_id) { io_.dir_id_ = dir_id; }
   int alloc_dir_id();
+  // Compress the dumped blocks with %type, must be set before the first dump.
+  int set_dump_compressor(const common::ObCompressorType type);
+  inline bool is_dump_compressed() const { return NULL != compressor_; }
   TO_STRING_KV(K_(tenant_id), K_(label), K_(ctx_id),  K_(mem_limit),
-      K_(row_cnt), K_(file_size), K_(enable_dump));
+      K_(row_cnt), K_(file_size), K_(enable_dump), K(is_dump_compressed()));
 
   int append_datum_store(const ObChunkDatumStore &other_store);
   int assign(const ObChunkDatumStore &other_store);
@@ -995,6 +1052,9 @@ private:
       mem_used_ += used;
     }
   inline int dump_one_block(BlockBuffer *item);
+  int compress_one_block(BlockBuffer *item);
+  int flush_dump_page();
+  void free_dump_page();
 
   int write_file(void *buf, int64_t size);
   int read_file(
@@ -1089,6 +1149,13 @@ private:
   BatchCtx *batch_ctx_;
   Block *tmp_dump_blk_;
 
+  common::ObCompressor *compressor_;
+  // page being filled by compressed blocks, see PageHead
+  char *dump_page_;
+  int64_t dump_page_mem_size_;
+  int64_t dump_page_pos_;
+  int64_t dump_page_frame_cnt_;
+
   DISALLOW_COPY_AND_ASSIGN(ObChunkDatumStore);
 };
 
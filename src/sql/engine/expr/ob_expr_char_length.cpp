@@ -14,6 +14,7 @@
 
 #include "sql/engine/expr/ob_expr_char_length.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "storage/ob_storage_util.h"
 
 namespace oceanbase
 {
@@ -59,6 +60,14 @@ int ObExprCharLength::calc_result_type1(ObExprResType &type,
   return ret;
 }
 
+// Char length of ASCII string equals to the byte length, which skips the charset decoding.
+static OB_INLINE int64_t calc_char_length(const ObCollationType cs_type, const char *ptr,
+                                          const int64_t len)
+{
+  return (storage::can_do_ascii_optimize(cs_type) && storage::is_ascii_str(ptr, len))
+         ? len : static_cast<int64_t>(ObCharset::strlen_char(cs_type, ptr, len));
+}
+
 int ObExprCharLength::eval_char_length(const ObExpr &expr, ObEvalCtx &ctx, 
                                        ObDatum &res)
 {
@@ -72,10 +81,7 @@ int ObExprCharLength::eval_char_length(const ObExpr &expr, ObEvalCtx &ctx,
   } else if (arg->is_null()) {
     res.set_null();
   } else if (in_tc != ObTextTC) {
-    const ObString &arg_str = arg->get_string();
-    size_t length = ObCharset::strlen_char(expr.args_[0]->datum_meta_.cs_type_,
-                                           arg_str.ptr(), arg_str.length());
-    res.set_int(length);
+    res.set_int(calc_char_length(expr.args_[0]->datum_meta_.cs_type_, arg->ptr_, arg->len_));
   } else {
     int64_t char_len = 0;
     if (OB_FAIL(ObTextStringHelper::get_char_len(ctx, *arg,
@@ -88,6 +94,32 @@ int ObExprCharLength::eval_char_length(const ObExpr &expr, ObEvalCtx &ctx,
   return ret;
 }
 
+int ObExprCharLength::eval_char_length_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                             const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval arg batch failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    const ObCollationType cs_type = expr.args_[0]->datum_meta_.cs_type_;
+    for (int64_t i = 0; i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      const ObDatum &arg = expr.args_[0]->locate_expr_datum(ctx, i);
+      if (arg.is_null()) {
+        res[i].set_null();
+      } else {
+        res[i].set_int(calc_char_length(cs_type, arg.ptr_, arg.len_));
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
 int ObExprCharLength::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                               ObExpr &rt_expr) const
 {
@@ -95,6 +127,10 @@ int ObExprCharLength::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_exp
   UNUSED(expr_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = eval_char_length;
+  const ObObjTypeClass in_tc = ob_obj_type_class(rt_expr.args_[0]->datum_meta_.type_);
+  if (ob_is_castable_type_class(in_tc) && ObTextTC != in_tc) {
+    rt_expr.eval_batch_func_ = eval_char_length_batch;
+  }
   return ret;
 }
 } // namespace sql
@@ -66,21 +66,86 @@ int def_relational_eval_func(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_d
   return ret;
 };
 
-template <typename DatumFunc, typename... Args>
-int def_relational_eval_batch_func(BATCH_EVAL_FUNC_ARG_DECL, Args &...args)
+template <typename CmpOp, typename... Args>
+int def_relational_eval_batch_op(BATCH_EVAL_FUNC_ARG_DECL, Args &...args)
 {
   int ret = OB_SUCCESS;
   const static bool short_circuit = true;
   if (OB_FAIL(binary_operand_batch_eval(expr, ctx, skip, size, short_circuit))) {
     LOG_WARN("binary operand batch evaluate failed", K(ret), K(expr));
   } else {
-    ret = call_functor_with_arg_iter<
-        ObWrapArithOpNullCheck<DatumFunc>,
-        ObDoArithBatchEval>(BATCH_EVAL_FUNC_ARG_LIST, args...);
+    ret = call_functor_with_arg_iter<CmpOp, ObDoArithBatchEval>(BATCH_EVAL_FUNC_ARG_LIST, args...);
   }
   return ret;
 }
 
+template <typename DatumFunc, typename... Args>
+int def_relational_eval_batch_func(BATCH_EVAL_FUNC_ARG_DECL, Args &...args)
+{
+  return def_relational_eval_batch_op<ObWrapArithOpNullCheck<DatumFunc>, Args...>(
+      BATCH_EVAL_FUNC_ARG_LIST, args...);
+}
+
+// Fixed length payload of type class (or type) which is compared by value directly
+// (ObTCPayloadCmp), the payload of batch result is stored contiguously in the reserved buffer
+// of frame with the width of RawType.
+template <ObObjTypeClass L_TC, ObObjTypeClass R_TC>
+struct ObFixedLenTCPayload { constexpr static bool defined_ = false; typedef char RawType; };
+
+template <ObObjType L_T, ObObjType R_T>
+struct ObFixedLenTypePayload { constexpr static bool defined_ = false; typedef char RawType; };
+
+#define DEF_FIXED_LEN_TC_PAYLOAD(tc, raw_type)                    \
+  template <> struct ObFixedLenTCPayload<tc, tc>                  \
+  { constexpr static bool defined_ = true; typedef raw_type RawType; };
+
+#define DEF_FIXED_LEN_TYPE_PAYLOAD(type, raw_type)                \
+  template <> struct ObFixedLenTypePayload<type, type>            \
+  { constexpr static bool defined_ = true; typedef raw_type RawType; };
+
+DEF_FIXED_LEN_TC_PAYLOAD(ObIntTC, int64_t)
+DEF_FIXED_LEN_TC_PAYLOAD(ObUIntTC, uint64_t)
+DEF_FIXED_LEN_TC_PAYLOAD(ObDateTC, int32_t)
+DEF_FIXED_LEN_TC_PAYLOAD(ObTimeTC, int64_t)
+DEF_FIXED_LEN_TC_PAYLOAD(ObYearTC, uint8_t)
+DEF_FIXED_LEN_TYPE_PAYLOAD(ObDateTimeType, int64_t)
+DEF_FIXED_LEN_TYPE_PAYLOAD(ObTimestampType, int64_t)
+
+#undef DEF_FIXED_LEN_TC_PAYLOAD
+#undef DEF_FIXED_LEN_TYPE_PAYLOAD
+
+// Compare fixed length payload with raw operate when both operands are batch results (or
+// scalar) located in frame and not null (see ObDoArithBatchEval), which walks the contiguous
+// payload arrays without touching datums and can be vectorized by compiler.
+// Fallback to datum compare of DatumFunc otherwise.
+template <typename DatumFunc, typename RawType, ObCmpOp CMP_OP>
+struct ObFixedLenRawCmpOp : public ObArithOpRawType<int64_t, RawType, RawType>
+{
+  constexpr static bool is_raw_op_supported() { return true; }
+
+  static void raw_op(int64_t &res, const RawType &l, const RawType &r)
+  {
+    res = get_cmp_ret<CMP_OP>(static_cast<int>(l > r) - static_cast<int>(l < r));
+  }
+
+  static int raw_check(const int64_t &, const RawType &, const RawType &)
+  {
+    return OB_SUCCESS;
+  }
+
+  template <typename... Args>
+  static int datum_op(ObDatum &res, const ObDatum &l, const ObDatum &r, Args &...args)
+  {
+    return ObWrapArithOpNullCheck<DatumFunc>::datum_op(res, l, r, args...);
+  }
+};
+
+template <typename DatumFunc, typename Payload, ObCmpOp CMP_OP>
+using ObRelationalBatchCmpOp = typename std::conditional<
+    Payload::defined_,
+    ObFixedLenRawCmpOp<DatumFunc, typename Payload::RawType, CMP_OP>,
+    ObWrapArithOpNullCheck<DatumFunc>>::type;
+
 template <typename DatumFunc, ObCmpOp CMP_OP>
 int def_oper_cmp_func(ObDatum &res, const ObDatum &l, const ObDatum &r)
 {
@@ -129,7 +194,9 @@ struct ObRelationalTypeFunc<true, L_T, R_T, CMP_OP>
 
   inline static int eval_batch(BATCH_EVAL_FUNC_ARG_DECL)
   {
-    return def_relational_eval_batch_func<DatumCmp>(BATCH_EVAL_FUNC_ARG_LIST);
+    return def_relational_eval_batch_op<
+        ObRelationalBatchCmpOp<DatumCmp, ObFixedLenTypePayload<L_T, R_T>, CMP_OP>>(
+            BATCH_EVAL_FUNC_ARG_LIST);
   }
 };
 
@@ -158,7 +225,9 @@ struct ObRelationalTCFunc<true, L_TC, R_TC, CMP_OP>
 
   inline static int eval_batch(BATCH_EVAL_FUNC_ARG_DECL)
   {
-    return def_relational_eval_batch_func<DatumCmp>(BATCH_EVAL_FUNC_ARG_LIST);
+    return def_relational_eval_batch_op<
+        ObRelationalBatchCmpOp<DatumCmp, ObFixedLenTCPayload<L_TC, R_TC>, CMP_OP>>(
+            BATCH_EVAL_FUNC_ARG_LIST);
   }
 };
 
@@ -349,6 +349,13 @@ int ObExprConcat::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &expr) const
   }
   if (OB_SUCC(ret)) {
     expr.eval_func_ = &eval_concat;
+    bool has_text_param = ob_is_text_tc(expr.datum_meta_.type_);
+    for (int64_t i = 0; !has_text_param && i < expr.arg_cnt_; i++) {
+      has_text_param = ob_is_text_tc(expr.args_[i]->datum_meta_.type_);
+    }
+    if (!lib::is_oracle_mode() && !has_text_param) {
+      expr.eval_batch_func_ = &eval_concat_batch;
+    }
   }
   return ret;
 }
@@ -400,89 +407,126 @@ static int eval_concat_text(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_da
   return ret;
 }
 
-int ObExprConcat::eval_concat(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+// concat the evaluated params of the current row
+static int eval_concat_row(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
 {
   int ret = OB_SUCCESS;
-  if (OB_FAIL(expr.eval_param_value(ctx))) {
-    LOG_WARN("evaluate parameters values failed", K(ret));
-  } else {
-    ObDatum *first_not_null = NULL;
-    int64_t null_cnt = 0;
-    int64_t res_len = 0;
-    int64_t lob_data_byte_len = 0;
-    ObObjType res_type = expr.datum_meta_.type_;
-    // get result length
-    for (int64_t i = 0; OB_SUCC(ret) && i < expr.arg_cnt_; i++) {
-      ObDatum &v = expr.locate_param_datum(ctx, i);
-      if (v.is_null()) {
-        null_cnt += 1;
+  ObDatum *first_not_null = NULL;
+  int64_t null_cnt = 0;
+  int64_t res_len = 0;
+  int64_t lob_data_byte_len = 0;
+  ObObjType res_type = expr.datum_meta_.type_;
+  // get result length
+  for (int64_t i = 0; OB_SUCC(ret) && i < expr.arg_cnt_; i++) {
+    ObDatum &v = expr.locate_param_datum(ctx, i);
+    if (v.is_null()) {
+      null_cnt += 1;
+    } else {
+      if (!ob_is_text_tc(expr.args_[i]->datum_meta_.type_)) {
+        res_len += v.len_;
       } else {
-        if (!ob_is_text_tc(expr.args_[i]->datum_meta_.type_)) {
-          res_len += v.len_;
+        ObLobLocatorV2 locator(v.get_string(), expr.args_[i]->obj_meta_.has_lob_header());
+        if (OB_FAIL(locator.get_lob_data_byte_len(lob_data_byte_len))) {
+          LOG_WARN("get lob data byte length failed", K(ret), K(locator));
         } else {
-          ObLobLocatorV2 locator(v.get_string(), expr.args_[i]->obj_meta_.has_lob_header());
-          if (OB_FAIL(locator.get_lob_data_byte_len(lob_data_byte_len))) {
-            LOG_WARN("get lob data byte length failed", K(ret), K(locator));
-          } else {
-            res_len += lob_data_byte_len;
-          }
-        }
-        if (OB_SUCC(ret) && NULL == first_not_null) {
-          first_not_null = &v;
+          res_len += lob_data_byte_len;
         }
       }
+      if (OB_SUCC(ret) && NULL == first_not_null) {
+        first_not_null = &v;
+      }
     }
-    int64_t max_len = 0;
-    if (is_mysql_mode()) {
-      max_len = OB_MAX_VARCHAR_LENGTH;
-    } else if (expr.is_called_in_sql_) { // SQL in oracle mode
-      max_len = OB_MAX_ORACLE_VARCHAR_LENGTH;
-    } else { // PL in oracle mode
-      const int64_t concat_res_max_len_in_pl = 65535;
-      max_len = concat_res_max_len_in_pl;
+  }
+  int64_t max_len = 0;
+  if (is_mysql_mode()) {
+    max_len = OB_MAX_VARCHAR_LENGTH;
+  } else if (expr.is_called_in_sql_) { // SQL in oracle mode
+    max_len = OB_MAX_ORACLE_VARCHAR_LENGTH;
+  } else { // PL in oracle mode
+    const int64_t concat_res_max_len_in_pl = 65535;
+    max_len = concat_res_max_len_in_pl;
+  }
+  if (ob_is_text_tc(res_type)) {
+    // FIXME bin.lb: mysql mode can not reach here, since result type is always varchar.
+    // Seem to be a bug:
+    max_len = OB_MAX_PACKET_LENGTH;
+  }
+  // mysql mode: all param calc types are varchar;
+  // oracle mode: if result type is longtext, param calc types must be longtext
+  if (OB_FAIL(ret)) {
+  } else if (res_len > max_len) {
+    expr_datum.set_null();
+    // BUGFIX: issue id 49051626
+    if (lib::is_oracle_mode()) ret = OB_ERR_TOO_LONG_STRING_IN_CONCAT;
+    else ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("size overflow", K(ret), K(res_len), K(max_len));
+  } else if (expr.arg_cnt_ == null_cnt
+             || (!lib::is_oracle_mode() && null_cnt > 0)) {
+    // input are all null or has null in mysql mode
+    expr_datum.set_null();
+  } else if ((expr.arg_cnt_ - null_cnt == 1) && !ob_is_text_tc(res_type)) {
+    // only one valid input, shadow copy
+    expr_datum.set_datum(*first_not_null);
+  } else if (!ob_is_text_tc(res_type)) {
+    char *buf = expr.get_str_res_mem(ctx, res_len);
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret), K(res_len));
+    } else {
+      int64_t off = 0;
+      for (int64_t i = 0; i < expr.arg_cnt_; i++) {
+        ObDatum &v = expr.locate_param_datum(ctx, i);
+        if (!v.is_null()) {
+          MEMCPY(buf + off, v.ptr_, v.len_);
+          off += v.len_;
+        }
+      }
+      OB_ASSERT(off == res_len);
     }
-    if (ob_is_text_tc(res_type)) {
-      // FIXME bin.lb: mysql mode can not reach here, since result type is always varchar.
-      // Seem to be a bug:
-      max_len = OB_MAX_PACKET_LENGTH;
+    expr_datum.set_string(buf, res_len);
+  } else { // text tc
+    ret = eval_concat_text(expr, ctx, expr_datum, res_len);
+  }
+  return ret;
+}
+
+int ObExprConcat::eval_concat(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.eval_param_value(ctx))) {
+    LOG_WARN("evaluate parameters values failed", K(ret));
+  } else if (OB_FAIL(eval_concat_row(expr, ctx, expr_datum))) {
+    LOG_WARN("eval concat failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprConcat::eval_concat_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                    const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < expr.arg_cnt_; i++) {
+    if (OB_FAIL(expr.args_[i]->eval_batch(ctx, skip, batch_size))) {
+      LOG_WARN("eval param batch failed", K(ret), K(i));
     }
-    // mysql mode: all param calc types are varchar;
-    // oracle mode: if result type is longtext, param calc types must be longtext
-    if (OB_FAIL(ret)) {
-    } else if (res_len > max_len) {
-      expr_datum.set_null();
-      // BUGFIX: issue id 49051626
-      if (lib::is_oracle_mode()) ret = OB_ERR_TOO_LONG_STRING_IN_CONCAT;
-      else ret = OB_SIZE_OVERFLOW;
-      LOG_WARN("size overflow", K(ret), K(res_len), K(max_len));
-    } else if (expr.arg_cnt_ == null_cnt
-               || (!lib::is_oracle_mode() && null_cnt > 0)) {
-      // input are all null or has null in mysql mode
-      expr_datum.set_null();
-    } else if ((expr.arg_cnt_ - null_cnt == 1) && !ob_is_text_tc(res_type)) {
-      // only one valid input, shadow copy
-      expr_datum.set_datum(*first_not_null);
-    } else if (!ob_is_text_tc(res_type)) {
-      char *buf = expr.get_str_res_mem(ctx, res_len);
-      if (OB_ISNULL(buf)) {
-        ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_WARN("allocate memory failed", K(ret), K(res_len));
+  }
+  if (OB_SUCC(ret)) {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    // params and result memory are located by batch idx
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t j = 0; OB_SUCC(ret) && j < batch_size; ++j) {
+      if (skip.at(j) || eval_flags.at(j)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(j);
+      if (OB_FAIL(eval_concat_row(expr, ctx, res[j]))) {
+        LOG_WARN("eval concat failed", K(ret), K(j));
       } else {
-        int64_t off = 0;
-        for (int64_t i = 0; i < expr.arg_cnt_; i++) {
-          ObDatum &v = expr.locate_param_datum(ctx, i);
-          if (!v.is_null()) {
-            MEMCPY(buf + off, v.ptr_, v.len_);
-            off += v.len_;
-          }
-        }
-        OB_ASSERT(off == res_len);
+        eval_flags.set(j);
       }
-      expr_datum.set_string(buf, res_len);
-    } else { // text tc
-      ret = eval_concat_text(expr, ctx, expr_datum, res_len);
     }
-
   }
   return ret;
 }
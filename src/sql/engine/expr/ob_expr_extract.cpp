@@ -517,6 +517,9 @@ int ObExprExtract::calc_extract_mysql_batch(
       ObDatum *datum_array = expr.args_[1]->locate_batch_datums(ctx);
       const ObTimeZoneInfo *tz_info = get_timezone_info(session);
       const int64_t cur_ts_value = get_cur_time(ctx.exec_ctx_.get_physical_plan_ctx());
+      const ObObjType date_type = expr.args_[1]->datum_meta_.type_;
+      const bool is_datetime = (ObDateTimeTC == ob_obj_type_class(date_type));
+      ObDatetimeBatchConverter converter((ObTimestampType == date_type) ? tz_info : NULL);
       class ObTime ob_time;
       switch (unit_val) {
         case DATE_UNIT_DAY:
@@ -544,7 +547,9 @@ int ObExprExtract::calc_extract_mysql_batch(
           ObDateSqlMode date_sql_mode;
           date_sql_mode.init(session->get_sql_mode());
           memset(&ob_time, 0, sizeof(ob_time));
-          if (is_with_date) {
+          if (is_datetime) {
+            cast_ret = converter.datetime_to_ob_time(datum_array[j].get_datetime(), ob_time);
+          } else if (is_with_date) {
             cast_ret = obj_to_time<ObDatum, true>(
                 datum_array[j], expr.args_[1]->datum_meta_.type_, tz_info, ob_time, cur_ts_value,
                 date_sql_mode, expr.args_[1]->obj_meta_.has_lob_header());
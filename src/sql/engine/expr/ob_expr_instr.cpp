@@ -52,12 +52,49 @@ int ObExprInstr::calc_mysql_instr_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDat
   return ret;
 }
 
+// The params are evaluated by batch, then each row is calculated by
+// ObLocationExprOperator::calc_ as the scalar evaluation does.
+int ObExprInstr::calc_mysql_instr_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                             const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval haystack batch failed", K(ret));
+  } else if (OB_FAIL(expr.args_[1]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval needle batch failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(i);
+      if (OB_FAIL(ObLocationExprOperator::calc_(expr, *expr.args_[1], *expr.args_[0],
+                                                ctx, res[i]))) {
+        LOG_WARN("ObLocationExprOperator::calc_ failed", K(ret));
+      } else {
+        eval_flags.set(i);
+      }
+    }
+  }
+  return ret;
+}
+
 int ObExprInstr::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr,
                                     ObExpr &rt_expr) const
 {
   UNUSED(op_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = calc_mysql_instr_expr;
+  if (2 == rt_expr.arg_cnt_ && OB_NOT_NULL(rt_expr.args_)
+      && OB_NOT_NULL(rt_expr.args_[0]) && OB_NOT_NULL(rt_expr.args_[1])
+      && !ob_is_text_tc(rt_expr.args_[0]->datum_meta_.type_)
+      && !ob_is_text_tc(rt_expr.args_[1]->datum_meta_.type_)) {
+    rt_expr.eval_batch_func_ = calc_mysql_instr_expr_batch;
+  }
   return OB_SUCCESS;
 }
 
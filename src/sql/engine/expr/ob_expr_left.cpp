@@ -16,6 +16,7 @@
 #include "lib/charset/ob_charset.h"
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/engine/ob_exec_context.h"
+#include "storage/ob_storage_util.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::sql;
@@ -136,6 +137,36 @@ int calc_left(ObString &res_str, const ObString &text, const ObCollationType typ
 	return ret;
 }
 
+// left(s, n) of the evaluated params, shared by the scalar and the batch evaluation
+static int calc_left_datum(const ObExpr &expr, const ObDatum &s_datum, const ObDatum &n_datum,
+                           ObDatum &res_datum)
+{
+  int ret = OB_SUCCESS;
+  if (s_datum.is_null() || n_datum.is_null()) {
+    res_datum.set_null();
+  } else {
+    // res_str会指向s_datum的内存空间，所以下面不能改变res_str指向的字符串
+    ObString res_str;
+    const ObCollationType arg_cs_type = expr.args_[0]->datum_meta_.cs_type_;
+    if (storage::can_do_ascii_optimize(arg_cs_type)
+        && storage::is_ascii_str(s_datum.ptr_, s_datum.len_)) {
+      // one byte per char, the result is the prefix of bytes
+      const int64_t n = n_datum.get_int();
+      res_str.assign_ptr(s_datum.ptr_, static_cast<int32_t>(
+          n <= 0 ? 0 : min(n, static_cast<int64_t>(s_datum.len_))));
+    } else if (OB_FAIL(calc_left(res_str, s_datum.get_string(), arg_cs_type, n_datum.get_int()))) {
+      LOG_WARN("failed to calculate left expression", K(ret));
+    }
+    if (OB_FAIL(ret)) {
+    } else if (res_str.empty() && is_oracle_mode()) {
+      res_datum.set_null();
+    } else {
+      res_datum.set_string(res_str);
+    }
+  }
+  return ret;
+}
+
 int calc_left_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum)
 {
   int ret = OB_SUCCESS;
@@ -145,26 +176,38 @@ int calc_left_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum)
   if (OB_FAIL(expr.args_[0]->eval(ctx, s_datum)) ||
       OB_FAIL(expr.args_[1]->eval(ctx, n_datum))) {
     LOG_WARN("eval arg failed", K(ret), KP(s_datum), KP(n_datum));
-  } else if (s_datum->is_null() || n_datum->is_null()) {
-    res_datum.set_null();
+  } else if (OB_FAIL(calc_left_datum(expr, *s_datum, *n_datum, res_datum))) {
+    LOG_WARN("calc left failed", K(ret));
+  }
+  return ret;
+}
+
+int calc_left_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                         const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval text batch failed", K(ret));
+  } else if (OB_FAIL(expr.args_[1]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval length batch failed", K(ret));
   } else {
-    // res_str会指向s_datum的内存空间，所以下面不能改变res_str指向的字符串
-    ObString res_str;
-    const ObCollationType arg_cs_type = expr.args_[0]->datum_meta_.cs_type_;
-		if(OB_FAIL(calc_left(res_str, s_datum->get_string(), arg_cs_type, n_datum->get_int()))) {
-			LOG_WARN("failed to calculate left expression", K(ret));
-		} else {
-      if (res_str.empty() && is_oracle_mode()) {
-        res_datum.set_null();
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      if (OB_FAIL(calc_left_datum(expr, expr.args_[0]->locate_expr_datum(ctx, i),
+                                  expr.args_[1]->locate_expr_datum(ctx, i), res[i]))) {
+        LOG_WARN("calc left failed", K(ret), K(i));
       } else {
-        res_datum.set_string(res_str);
+        eval_flags.set(i);
       }
     }
   }
   return ret;
 }
 
-
 int ObExprLeft::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                             ObExpr &rt_expr) const
 {
@@ -172,6 +215,7 @@ int ObExprLeft::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
   UNUSED(expr_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = calc_left_expr;
+  rt_expr.eval_batch_func_ = calc_left_expr_batch;
   return ret;
 }
 
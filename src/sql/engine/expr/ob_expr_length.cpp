@@ -97,6 +97,9 @@ int ObExprLength::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr, ObE
         CK(ObVarcharType == text_type);
       }
       rt_expr.eval_func_ = ObExprLength::calc_mysql_mode;
+      if (!is_lob_storage(text_type)) {
+        rt_expr.eval_batch_func_ = ObExprLength::calc_mysql_mode_batch;
+      }
     }
   }
   return ret;
@@ -161,5 +164,31 @@ int ObExprLength::calc_mysql_mode(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &e
   return ret;
 }
 
+// byte length of non-lob string is the length of datum
+int ObExprLength::calc_mysql_mode_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval text batch failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    for (int64_t i = 0; i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      const ObDatum &text = expr.args_[0]->locate_expr_datum(ctx, i);
+      if (text.is_null()) {
+        res[i].set_null();
+      } else {
+        res[i].set_int(static_cast<int64_t>(text.len_));
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
 }
 }
@@ -20,6 +20,7 @@
 //#include "sql/engine/expr/ob_expr_promotion_util.h"
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "storage/ob_storage_util.h"
 
 namespace oceanbase {
 using namespace common;
@@ -321,6 +322,9 @@ int ObExprLower::cg_expr(ObExprCGCtx &op_cg_ctx,
     LOG_WARN("lower expr cg expr failed", K(ret));
   } else {
     rt_expr.eval_func_ = ObExprLower::calc_lower;
+    if (!ob_is_text_tc(rt_expr.args_[0]->datum_meta_.type_)) {
+      rt_expr.eval_batch_func_ = ObExprLower::calc_lower_batch;
+    }
   }
   return ret;
 }
@@ -334,6 +338,9 @@ int ObExprUpper::cg_expr(ObExprCGCtx &op_cg_ctx,
     LOG_WARN("upper expr cg expr failed", K(ret));
   } else {
     rt_expr.eval_func_ = ObExprUpper::calc_upper;
+    if (!ob_is_text_tc(rt_expr.args_[0]->datum_meta_.type_)) {
+      rt_expr.eval_batch_func_ = ObExprUpper::calc_upper_batch;
+    }
   }
   return ret;
 }
@@ -353,6 +360,46 @@ static inline int32_t calc_common_inner(char *buf,
           );
 }
 
+// case conversion of non-text string, the result is allocated by the expr for the current row
+static int calc_common_str(const ObExpr &expr, ObEvalCtx &ctx, const ObString &m_text,
+                           const ObCollationType cs_type, const bool lower, ObString &str_result)
+{
+  int ret = OB_SUCCESS;
+  if (m_text.empty()) {
+    str_result.reset();
+  } else if (OB_UNLIKELY(!ObCharset::is_valid_collation(cs_type))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("charset is null", K(ret), K(cs_type));
+  } else if (storage::can_do_ascii_optimize(cs_type)
+             && storage::is_ascii_str(m_text.ptr(), m_text.length())) {
+    // case conversion of ASCII string never changes the length, skip the charset handling
+    char *buf = expr.get_str_res_mem(ctx, m_text.length());
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("alloc memory failed", "size", m_text.length());
+    } else {
+      const char *src = m_text.ptr();
+      for (int32_t i = 0; i < m_text.length(); ++i) {
+        buf[i] = static_cast<char>(lower ? tolower(src[i]) : toupper(src[i]));
+      }
+      str_result.assign(buf, m_text.length());
+    }
+  } else {
+    const uchar multiply = lower ? ObCharset::get_charset(cs_type)->casedn_multiply
+                                 : ObCharset::get_charset(cs_type)->caseup_multiply;
+    int32_t buf_len = m_text.length() * multiply;
+    char *buf = expr.get_str_res_mem(ctx, buf_len);
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("alloc memory failed", "size", buf_len);
+    } else {
+      int32_t out_len = calc_common_inner(buf, buf_len, m_text, cs_type, lower);
+      str_result.assign(buf, static_cast<int32_t>(out_len));
+    }
+  }
+  return ret;
+}
+
 int ObExprLowerUpper::calc_common(const ObExpr &expr, ObEvalCtx &ctx,
                                   ObDatum &expr_datum, bool lower, ObCollationType cs_type)
 {
@@ -371,23 +418,15 @@ int ObExprLowerUpper::calc_common(const ObExpr &expr, ObEvalCtx &ctx,
     bool has_lob_header = expr.args_[0]->obj_meta_.has_lob_header();
     ObDatumMeta text_meta = expr.args_[0]->datum_meta_;
     uchar multiply = 0;
-    if (m_text.empty() && !ob_is_text_tc(text_meta.type_)) {
-      str_result.reset();
+    if (!ob_is_text_tc(text_meta.type_)) {
+      if (OB_FAIL(calc_common_str(expr, ctx, m_text, cs_type, lower, str_result))) {
+        LOG_WARN("calc common str failed", K(ret));
+      }
     } else if (OB_UNLIKELY(!ObCharset::is_valid_collation(cs_type))) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("charset is null", K(ret), K(cs_type));
     } else if (FALSE_IT(multiply = (lower ? ObCharset::get_charset(cs_type)->casedn_multiply
                                           : ObCharset::get_charset(cs_type)->caseup_multiply))) {
-    } else if (!ob_is_text_tc(text_meta.type_)) {
-      int32_t buf_len = m_text.length() * multiply;
-      char *buf = expr.get_str_res_mem(ctx, buf_len);
-      if (OB_ISNULL(buf)) {
-        ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_ERROR("alloc memory failed", "size", buf_len);
-      } else {
-        int32_t out_len = calc_common_inner(buf, buf_len, m_text, cs_type, lower);
-        str_result.assign(buf, static_cast<int32_t>(out_len));
-      }
     } else { // text tc only
       ObEvalCtx::TempAllocGuard alloc_guard(ctx);
       ObIAllocator &calc_alloc = alloc_guard.get_allocator();
@@ -516,16 +555,68 @@ int ObExprLowerUpper::calc_nls_common(const ObExpr &expr, ObEvalCtx &ctx,
   return ret;
 }
 
+int ObExprLowerUpper::calc_common_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size,
+                                        const bool lower)
+{
+  int ret = OB_SUCCESS;
+  const ObCollationType cs_type = expr.datum_meta_.cs_type_;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval text batch failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    // the result memory is allocated for the datum located by batch idx
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(i);
+      const ObDatum &text = expr.args_[0]->locate_expr_datum(ctx, i);
+      ObString str_result;
+      if (text.is_null()) {
+        res[i].set_null();
+      } else if (OB_FAIL(calc_common_str(expr, ctx, text.get_string(), cs_type, lower,
+                                         str_result))) {
+        LOG_WARN("calc common str failed", K(ret));
+      } else if (OB_UNLIKELY(is_oracle_mode() && str_result.length() == 0
+                             && ob_is_string_tc(expr.datum_meta_.type_))) {
+        res[i].set_null();
+      } else {
+        res[i].set_string(str_result);
+      }
+      if (OB_SUCC(ret)) {
+        eval_flags.set(i);
+      }
+    }
+  }
+  return ret;
+}
+
 int ObExprLower::calc_lower(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
 {
   return calc_common(expr, ctx, expr_datum, true, CS_TYPE_INVALID);
 }
 
+int ObExprLower::calc_lower_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                  const ObBitVector &skip, const int64_t batch_size)
+{
+  return calc_common_batch(expr, ctx, skip, batch_size, true);
+}
+
 int ObExprUpper::calc_upper(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
 {
   return calc_common(expr, ctx, expr_datum, false, CS_TYPE_INVALID);
 }
 
+int ObExprUpper::calc_upper_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                  const ObBitVector &skip, const int64_t batch_size)
+{
+  return calc_common_batch(expr, ctx, skip, batch_size, false);
+}
+
 int ObExprNlsLower::calc(const ObCollationType cs_type, char *src, int32_t src_len,
                          char *dst, int32_t dst_len, int32_t &out_len) const
 {
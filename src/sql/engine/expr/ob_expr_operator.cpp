@@ -33,6 +33,7 @@
 #include "lib/timezone/ob_oracle_format_models.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
 #include "sql/resolver/dml/ob_select_stmt.h"
+#include "storage/ob_storage_util.h"
 
 namespace oceanbase
 {
@@ -5412,6 +5413,12 @@ int ObLocationExprOperator::calc_(const ObExpr &expr, const ObExpr &sub_arg,
     if (OB_FAIL(get_calc_cs_type(expr, calc_cs_type))) {
       LOG_WARN("get_calc_cs_type failed", K(ret));
     } else if (!ob_is_text_tc(sub_arg.datum_meta_.type_) && !ob_is_text_tc(ori_arg.datum_meta_.type_)) {
+      // char position of ASCII string equals to the byte position, which is located by binary
+      // compare without charset decoding if the collation is binary sorted
+      if (storage::can_do_ascii_optimize(calc_cs_type) && ObCharset::is_bin_sort(calc_cs_type)
+          && storage::is_ascii_str(ori_str.ptr(), ori_str.length())) {
+        calc_cs_type = CS_TYPE_BINARY;
+      }
       uint32_t idx = ObCharset::locate(calc_cs_type, ori_str.ptr(), ori_str.length(),
                                        sub_str.ptr(), sub_str.length(), pos_int);
       res_datum.set_int(static_cast<int64_t>(idx));
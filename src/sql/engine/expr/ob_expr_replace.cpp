@@ -217,34 +217,34 @@ int ObExprReplace::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &rt_expr) co
   int ret = OB_SUCCESS;
   CK(2 == rt_expr.arg_cnt_ || 3 == rt_expr.arg_cnt_);
   rt_expr.eval_func_ = &eval_replace;
+  if (OB_SUCC(ret) && !ob_is_text_tc(rt_expr.datum_meta_.type_)) {
+    rt_expr.eval_batch_func_ = &eval_replace_batch;
+  }
   return ret;
 }
 
-int ObExprReplace::eval_replace(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+// replace of the evaluated params of the current row, %to is NULL if there are only two params
+static int eval_replace_row(const ObExpr &expr, ObEvalCtx &ctx, const ObDatum *text,
+                            const ObDatum *from, const ObDatum *to, ObDatum &expr_datum)
 {
   int ret = OB_SUCCESS;
   ObString res;
   const bool is_mysql = lib::is_mysql_mode();
   ObExprStrResAlloc alloc(expr, ctx);
-  ObDatum *text = NULL;
-  ObDatum *from = NULL;
-  ObDatum *to = NULL;
   bool is_clob = expr.args_[0]->datum_meta_.is_clob();
   bool is_lob_res = ob_is_text_tc(expr.datum_meta_.type_);
-  if (OB_FAIL(expr.eval_param_value(ctx, text, from, to))) {
-    LOG_WARN("evaluate parameters failed", K(ret));
-  } else if (text->is_null()
+  if (text->is_null()
              || (is_mysql && from->is_null())
              || (is_mysql && NULL != to && to->is_null())) {
     expr_datum.set_null();
   } else if (is_clob && (0 == text->len_)) {
     expr_datum.set_datum(*text);
   } else if (!is_lob_res) { // non text tc inputs
-    if (OB_FAIL(replace(res,
-                        text->get_string(),
-                        !from->is_null() ? from->get_string() : ObString(),
-                        (NULL != to && !to->is_null()) ? to->get_string() : ObString(),
-                        alloc))) {
+    if (OB_FAIL(ObExprReplace::replace(res,
+                                       text->get_string(),
+                                       !from->is_null() ? from->get_string() : ObString(),
+                                       (NULL != to && !to->is_null()) ? to->get_string() : ObString(),
+                                       alloc))) {
       LOG_WARN("do replace failed", K(ret));
     } else {
       if (res.empty() && !is_mysql && !expr.args_[0]->datum_meta_.is_clob()) {
@@ -275,7 +275,7 @@ int ObExprReplace::eval_replace(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &exp
       LOG_WARN("failed to get string data", K(ret), K(expr.args_[2]->datum_meta_));
     }
     if (OB_SUCC(ret)) {
-      if (OB_FAIL(replace(res, text_data, from_data, to_data, temp_allocator))) {
+      if (OB_FAIL(ObExprReplace::replace(res, text_data, from_data, to_data, temp_allocator))) {
         LOG_WARN("do replace for lob resutl failed", K(ret), K(expr.datum_meta_.type_));
       } else if (OB_FAIL(ObTextStringHelper::string_to_templob_result(expr, ctx, expr_datum, res))) {
         LOG_WARN("set lob result failed", K(ret));
@@ -285,5 +285,52 @@ int ObExprReplace::eval_replace(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &exp
   return ret;
 }
 
+int ObExprReplace::eval_replace(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *text = NULL;
+  ObDatum *from = NULL;
+  ObDatum *to = NULL;
+  if (OB_FAIL(expr.eval_param_value(ctx, text, from, to))) {
+    LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (OB_FAIL(eval_replace_row(expr, ctx, text, from, to, expr_datum))) {
+    LOG_WARN("eval replace failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprReplace::eval_replace_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                      const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < expr.arg_cnt_; i++) {
+    if (OB_FAIL(expr.args_[i]->eval_batch(ctx, skip, batch_size))) {
+      LOG_WARN("eval param batch failed", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    // ObExprStrResAlloc allocates result memory of the datum located by batch idx
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t j = 0; OB_SUCC(ret) && j < batch_size; ++j) {
+      if (skip.at(j) || eval_flags.at(j)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(j);
+      const ObDatum &text = expr.args_[0]->locate_expr_datum(ctx, j);
+      const ObDatum &from = expr.args_[1]->locate_expr_datum(ctx, j);
+      const ObDatum *to = 3 == expr.arg_cnt_ ? &expr.args_[2]->locate_expr_datum(ctx, j) : NULL;
+      if (OB_FAIL(eval_replace_row(expr, ctx, &text, &from, to, res[j]))) {
+        LOG_WARN("eval replace failed", K(ret), K(j));
+      } else {
+        eval_flags.set(j);
+      }
+    }
+  }
+  return ret;
+}
+
 } // namespace sql
 } // namespace oceanbase
@@ -36,6 +36,9 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int eval_replace(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  // batch evaluate for non-text result
+  static int eval_replace_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                const ObBitVector &skip, const int64_t batch_size);
 
   // helper func
   static int replace(common::ObString &result,
@@ -17,6 +17,7 @@
 #include "share/object/ob_obj_cast.h"
 #include "objit/common/ob_item_type.h"
 #include "sql/session/ob_sql_session_info.h"
+#include "storage/ob_storage_util.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::sql;
@@ -72,6 +73,35 @@ int do_right(const ObString &input_value, const ObCollationType &cs_type,
   return ret;
 }
 
+// right(s, n) of the evaluated params, shared by the scalar and the batch evaluation
+static int calc_right_datum(const ObExpr &expr, const ObDatum &s_datum, const ObDatum &n_datum,
+                            ObDatum &res_datum)
+{
+  int ret = OB_SUCCESS;
+  if (s_datum.is_null() || n_datum.is_null()) {
+    res_datum.set_null();
+  } else {
+    ObString res_str;
+    const ObCollationType arg_cs_type = expr.args_[0]->datum_meta_.cs_type_;
+    if (storage::can_do_ascii_optimize(arg_cs_type)
+        && storage::is_ascii_str(s_datum.ptr_, s_datum.len_)) {
+      // one byte per char, the result is the suffix of bytes
+      const int64_t n = n_datum.get_int();
+      const int64_t res_len = n <= 0 ? 0 : min(n, static_cast<int64_t>(s_datum.len_));
+      res_str.assign_ptr(s_datum.ptr_ + s_datum.len_ - res_len, static_cast<int32_t>(res_len));
+    } else if (OB_FAIL(do_right(s_datum.get_string(), arg_cs_type, n_datum.get_int(), res_str))) {
+      LOG_WARN("failed to calculate right expression", K(ret));
+    }
+    if (OB_FAIL(ret)) {
+    } else if (res_str.empty() && is_oracle_mode()) {
+      res_datum.set_null();
+    } else {
+      res_datum.set_string(res_str);
+    }
+  }
+  return ret;
+}
+
 int calc_right_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum)
 {
   int ret = OB_SUCCESS;
@@ -81,18 +111,32 @@ int calc_right_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum)
   if (OB_FAIL(expr.args_[0]->eval(ctx, s_datum)) ||
       OB_FAIL(expr.args_[1]->eval(ctx, n_datum))) {
     LOG_WARN("eval arg failed", K(ret), KP(s_datum), KP(n_datum));
-  } else if (s_datum->is_null() || n_datum->is_null()) {
-    res_datum.set_null();
+  } else if (OB_FAIL(calc_right_datum(expr, *s_datum, *n_datum, res_datum))) {
+    LOG_WARN("calc right failed", K(ret));
+  }
+  return ret;
+}
+
+int calc_right_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                          const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval text batch failed", K(ret));
+  } else if (OB_FAIL(expr.args_[1]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval length batch failed", K(ret));
   } else {
-    ObString res_str;
-    const ObCollationType arg_cs_type = expr.args_[0]->datum_meta_.cs_type_;
-		if(OB_FAIL(do_right(s_datum->get_string(), arg_cs_type, n_datum->get_int(), res_str))) {
-			LOG_WARN("failed to calculate right expression", K(ret));
-    } else {
-      if (res_str.empty() && is_oracle_mode()) {
-        res_datum.set_null();
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      if (OB_FAIL(calc_right_datum(expr, expr.args_[0]->locate_expr_datum(ctx, i),
+                                   expr.args_[1]->locate_expr_datum(ctx, i), res[i]))) {
+        LOG_WARN("calc right failed", K(ret), K(i));
       } else {
-        res_datum.set_string(res_str);
+        eval_flags.set(i);
       }
     }
   }
@@ -106,6 +150,7 @@ int ObExprRight::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
   UNUSED(expr_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = calc_right_expr;
+  rt_expr.eval_batch_func_ = calc_right_expr_batch;
   return ret;
 }
 
@@ -396,11 +396,21 @@ int ObExprTrim::fill_default_pattern(char *buf, const int64_t in_len,
   return ret;
 }
 
+// trim(str), ltrim(str), rtrim(str) or trim(trim_type, str)
+bool ObExprTrim::is_default_pattern_trim(const ObExpr &expr)
+{
+  return (1 == expr.arg_cnt_ || (2 == expr.arg_cnt_ && T_FUN_SYS_TRIM == expr.type_))
+         && !ob_is_text_tc(expr.args_[expr.arg_cnt_ - 1]->datum_meta_.type_);
+}
+
 int ObExprTrim::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &rt_expr) const
 {
   int ret = OB_SUCCESS;
   CK(1 <= rt_expr.arg_cnt_ && rt_expr.arg_cnt_ <= 3);
   rt_expr.eval_func_ = eval_trim;
+  if (OB_SUCC(ret) && is_default_pattern_trim(rt_expr)) {
+    rt_expr.eval_batch_func_ = eval_trim_batch;
+  }
   return ret;
 }
 
@@ -866,6 +876,65 @@ int ObExprTrim::eval_trim(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datu
   return ret;
 }
 
+// The default pattern is filled only once for the batch, then each row is trimmed by
+// eval_trim_inner() as the scalar evaluation does.
+int ObExprTrim::eval_trim_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  char default_pattern_buffer[8];
+  int64_t out_len = 0;
+  ObString pattern;
+  for (int64_t i = 0; OB_SUCC(ret) && i < expr.arg_cnt_; i++) {
+    if (OB_FAIL(expr.args_[i]->eval_batch(ctx, skip, batch_size))) {
+      LOG_WARN("eval param batch failed", K(ret), K(i));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(fill_default_pattern(default_pattern_buffer,
+                                          sizeof(default_pattern_buffer),
+                                          expr.datum_meta_.cs_type_,
+                                          out_len))) {
+    LOG_WARN("fill default pattern failed", K(ret));
+  } else if (out_len <= 0) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected out length", K(ret), K(out_len));
+  } else {
+    pattern.assign_ptr(default_pattern_buffer, static_cast<int32_t>(out_len));
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    const ObExpr &str_expr = *expr.args_[expr.arg_cnt_ - 1];
+    const bool str_has_lob_header = str_expr.obj_meta_.has_lob_header();
+    bool res_is_clob = false;
+    int64_t trim_type = TYPE_LRTRIM;
+    if (T_FUN_SYS_LTRIM == expr.type_) {
+      trim_type = TYPE_LTRIM;
+    } else if (T_FUN_SYS_RTRIM == expr.type_) {
+      trim_type = TYPE_RTRIM;
+    }
+    for (int64_t j = 0; OB_SUCC(ret) && j < batch_size; ++j) {
+      if (skip.at(j) || eval_flags.at(j)) {
+        continue;
+      }
+      const ObDatum &str_datum = str_expr.locate_expr_datum(ctx, j);
+      const ObDatum *type_datum = 2 == expr.arg_cnt_
+                                  ? &expr.args_[0]->locate_expr_datum(ctx, j) : NULL;
+      if (str_datum.is_null() || (NULL != type_datum && type_datum->is_null())) {
+        res[j].set_null();
+      } else if (OB_FAIL(eval_trim_inner(expr, ctx, res[j],
+                                         NULL != type_datum ? type_datum->get_int() : trim_type,
+                                         pattern, res_is_clob, str_expr.datum_meta_,
+                                         str_has_lob_header, str_datum))) {
+        LOG_WARN("failed to eval trim", K(ret));
+      }
+      if (OB_SUCC(ret)) {
+        eval_flags.set(j);
+      }
+    }
+  }
+  return ret;
+}
+
 // Ltrim start
 ObExprLtrim::ObExprLtrim(ObIAllocator &alloc)
     : ObExprTrim(alloc, T_FUN_SYS_LTRIM, N_LTRIM, (lib::is_oracle_mode()) ? ONE_OR_TWO : 1)
@@ -977,6 +1046,9 @@ int ObExprLtrim::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &rt_expr) cons
   CK(1 == rt_expr.arg_cnt_ || 2 == rt_expr.arg_cnt_);
   // trim type is detected by expr type in ObExprTrim::eval_trim
   rt_expr.eval_func_ = &ObExprTrim::eval_trim;
+  if (OB_SUCC(ret) && ObExprTrim::is_default_pattern_trim(rt_expr)) {
+    rt_expr.eval_batch_func_ = &ObExprTrim::eval_trim_batch;
+  }
   return ret;
 }
 
@@ -68,6 +68,10 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int eval_trim(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  // batch evaluate trim of non-text string with default pattern
+  static int eval_trim_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                             const ObBitVector &skip, const int64_t batch_size);
+  static bool is_default_pattern_trim(const ObExpr &expr);
 
   // fill ' ' to %buf with specified charset.
   static int fill_default_pattern(char *buf, const int64_t in_len,
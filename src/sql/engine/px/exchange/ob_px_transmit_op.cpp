@@ -637,6 +637,7 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
   int64_t row_count = 0;
   ObObj tablet_id;
   ObSliceIdxCalc::SliceIdxArray slice_idx_array;
+  ObSEArray<ObDatumVector, 16> output_vecs;
   ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
   while (OB_SUCC(ret)) {
     if (OB_FAIL(next_row())) {
@@ -701,14 +702,39 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
                                1); // low temporal locality
           }
         }
+        // Output datums are located once per batch, and rows are appended to the registered
+        // block buffer of their channels directly. Only the rows of channels without registered
+        // buffer, or whose buffer is full, go through send_row() to flush the buffer.
+        output_vecs.reuse();
+        for (int64_t i = 0; OB_SUCC(ret) && i < spec_.output_.count(); i++) {
+          ObDatumVector vec = spec_.output_.at(i)->locate_expr_datumvector(eval_ctx_);
+          if (OB_FAIL(output_vecs.push_back(vec))) {
+            LOG_WARN("push back datum vector failed", K(ret));
+          }
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(try_wait_channel())) {
+          LOG_WARN("failed to wait channel init", K(ret));
+        }
         for (int64_t i = 0; OB_SUCC(ret) && i < brs_.size_; i++) {
           if (brs_.skip_->at(i)) {
             continue;
           }
-          batch_info_guard.set_batch_idx(i);
           row_count += 1;
           metric_.count();
-          if (OB_FAIL(send_row(indexes[i], send_row_time_recorder, tablet_id.get_int()))) {
+          bool appended = false;
+          if (indexes[i] >= 0 && blk_bufs_.at(indexes[i]).is_inited()) {
+            if (OB_SUCC(blk_bufs_.at(indexes[i]).append_row(output_vecs, i, 0))) {
+              appended = true;
+            } else if (OB_BUF_NOT_ENOUGH == ret) {
+              ret = OB_SUCCESS;
+            } else {
+              LOG_WARN("failed to add row", K(ret));
+            }
+          }
+          if (OB_FAIL(ret) || appended) {
+          } else if (FALSE_IT(batch_info_guard.set_batch_idx(i))) {
+          } else if (OB_FAIL(send_row(indexes[i], send_row_time_recorder, tablet_id.get_int()))) {
             LOG_WARN("fail emit row to interm result", K(ret), K(slice_idx_array));
           }
         }
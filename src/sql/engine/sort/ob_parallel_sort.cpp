@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "ob_parallel_sort.h"
+#include "lib/utility/ob_tracepoint.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/sort/ob_sort_op_impl.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+/************************************* ObParallelSortPhase *********************************/
+ObParallelSortPhase::ObParallelSortPhase()
+  : type_(SORT_RUNS), src_(NULL), dst_(NULL), run_cnt_(0), task_cnt_(0),
+    sort_collations_(NULL), sort_cmp_funs_(NULL), exec_ctx_(NULL),
+    enable_encode_sortkey_(false), tenant_id_(OB_INVALID_TENANT_ID), next_task_idx_(0), finished_task_cnt_(0),
+    ret_(OB_SUCCESS), ref_cnt_(1)
+{
+  MEMSET(run_bounds_, 0, sizeof(run_bounds_));
+}
+
+int ObParallelSortPhase::alloc(ObParallelSortPhase *&phase)
+{
+  int ret = OB_SUCCESS;
+  void *buf = NULL;
+  phase = NULL;
+  if (OB_FAIL(OB_E(EventTable::EN_PARALLEL_SORT_ALLOC_PHASE) OB_SUCCESS)) {
+    LOG_WARN("errsim allocate parallel sort phase failed", K(ret));
+  } else if (OB_ISNULL(buf = ob_malloc(sizeof(ObParallelSortPhase),
+                                       ObMemAttr(OB_SERVER_TENANT_ID, "SqlParallelSort")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret));
+  } else {
+    phase = new (buf) ObParallelSortPhase();
+  }
+  return ret;
+}
+
+void ObParallelSortPhase::dec_ref()
+{
+  if (0 == ATOMIC_AAF(&ref_cnt_, -1)) {
+    this->~ObParallelSortPhase();
+    ob_free(this);
+  }
+}
+
+void ObParallelSortPhase::run_tasks()
+{
+  int64_t task_idx = 0;
+  while ((task_idx = ATOMIC_FAA(&next_task_idx_, 1)) < task_cnt_) {
+    int ret = OB_SUCCESS;
+    if (OB_SUCCESS != ATOMIC_LOAD(&ret_)) {
+      // already fail, skip left tasks
+    } else if (OB_FAIL(run_task(task_idx))) {
+      LOG_WARN("run parallel sort task failed", K(ret), K(task_idx), KPC(this));
+      ATOMIC_BCAS(&ret_, OB_SUCCESS, ret);
+    }
+    // rows and compare functions belong to the sort operator, which goes on
+    // right after the last task finished, they can not be accessed after this
+    ATOMIC_INC(&finished_task_cnt_);
+  }
+}
+
+int ObParallelSortPhase::run_task(const int64_t task_idx)
+{
+  int ret = OB_SUCCESS;
+  ObSortOpImpl::Compare comp;
+  if (OB_FAIL(comp.init(sort_collations_, sort_cmp_funs_, exec_ctx_, enable_encode_sortkey_))) {
+    LOG_WARN("failed to init compare", K(ret));
+  } else {
+    // status of the query is checked by the sort operator thread between phases
+    comp.exec_ctx_ = NULL;
+    ObSortOpImpl::CopyableComparer less(comp);
+    if (SORT_RUNS == type_) {
+      std::sort(src_ + run_bounds_[task_idx], src_ + run_bounds_[task_idx + 1], less);
+    } else {
+      const int64_t left = 2 * task_idx;
+      const int64_t begin = run_bounds_[left];
+      const int64_t mid = run_bounds_[min(left + 1, run_cnt_)];
+      const int64_t end = run_bounds_[min(left + 2, run_cnt_)];
+      std::merge(src_ + begin, src_ + mid, src_ + mid, src_ + end, dst_ + begin, less);
+    }
+    if (OB_SUCCESS != comp.ret_) {
+      ret = comp.ret_;
+      LOG_WARN("compare failed", K(ret), K(task_idx));
+    }
+  }
+  return ret;
+}
+
+/************************************* ObSortWorkerPool *********************************/
+ObSortWorkerPool &ObSortWorkerPool::get_instance()
+{
+  static ObSortWorkerPool instance;
+  return instance;
+}
+
+int ObSortWorkerPool::try_start()
+{
+  int ret = OB_SUCCESS;
+  if (!ATOMIC_LOAD(&is_started_)) {
+    lib::ObMutexGuard guard(lock_);
+    if (is_started_) {
+    } else if (OB_FAIL(init(MAX_WORKER_CNT, MAX_QUEUED_TASK_CNT, "SqlSortWorker"))) {
+      LOG_WARN("failed to init sort worker pool", K(ret));
+    } else {
+      ATOMIC_STORE(&is_started_, true);
+    }
+  }
+  return ret;
+}
+
+int ObSortWorkerPool::run_phase(ObParallelSortPhase &phase, const int64_t helper_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (helper_cnt > 0 && OB_FAIL(try_start())) {
+    // sort by this thread only
+    LOG_WARN("failed to start sort worker pool", K(ret));
+    ret = OB_SUCCESS;
+  } else {
+    for (int64_t i = 0; i < min(helper_cnt, MAX_WORKER_CNT); ++i) {
+      int tmp_ret = OB_SUCCESS;
+      phase.inc_ref();
+      if (OB_SUCCESS != (tmp_ret = push(&phase))) {
+        // pool is busy, the left tasks are done by this thread
+        phase.dec_ref();
+        LOG_TRACE("push sort task failed", K(tmp_ret), K(phase));
+        break;
+      }
+    }
+  }
+  phase.run_tasks();
+  while (!phase.is_finished()) {
+    ob_usleep(WAIT_TASK_INTERVAL_US);
+  }
+  ret = phase.get_ret();
+  return ret;
+}
+
+void ObSortWorkerPool::handle(void *task)
+{
+  int ret = OB_SUCCESS;
+  ObParallelSortPhase *phase = static_cast<ObParallelSortPhase *>(task);
+  if (OB_NOT_NULL(phase)) {
+    if (MTL_ID() == phase->tenant_id_) {
+      phase->run_tasks();
+    } else {
+      MTL_SWITCH(phase->tenant_id_) {
+        phase->run_tasks();
+      }
+      if (OB_FAIL(ret)) {
+        // the left tasks are done by the sort operator thread
+        LOG_WARN("failed to switch tenant", K(ret), KPC(phase));
+      }
+    }
+    phase->dec_ref();
+  }
+}
+
+/************************************* ObParallelSorter *********************************/
+int ObParallelSorter::init_phase(
+    const ObParallelSortPhase::PhaseType type,
+    ObChunkDatumStore::StoredRow **src,
+    ObChunkDatumStore::StoredRow **dst,
+    const int64_t *run_bounds,
+    const int64_t run_cnt,
+    const ObIArray<ObSortFieldCollation> &sort_collations,
+    const ObIArray<ObSortCmpFunc> &sort_cmp_funs,
+    ObExecContext &exec_ctx,
+    const bool enable_encode_sortkey,
+    ObParallelSortPhase *&phase)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObParallelSortPhase::alloc(phase))) {
+    LOG_WARN("failed to alloc parallel sort phase", K(ret));
+  } else {
+    phase->type_ = type;
+    phase->src_ = src;
+    phase->dst_ = dst;
+    MEMCPY(phase->run_bounds_, run_bounds, sizeof(int64_t) * (run_cnt + 1));
+    phase->run_cnt_ = run_cnt;
+    phase->task_cnt_ = ObParallelSortPhase::SORT_RUNS == type ? run_cnt : (run_cnt + 1) / 2;
+    phase->sort_collations_ = &sort_collations;
+    phase->sort_cmp_funs_ = &sort_cmp_funs;
+    phase->exec_ctx_ = &exec_ctx;
+    phase->enable_encode_sortkey_ = enable_encode_sortkey;
+    phase->tenant_id_ = MTL_ID();
+  }
+  return ret;
+}
+
+int ObParallelSorter::sort(
+    ObChunkDatumStore::StoredRow **rows,
+    const int64_t begin,
+    const int64_t end,
+    const int64_t degree,
+    const ObIArray<ObSortFieldCollation> &sort_collations,
+    const ObIArray<ObSortCmpFunc> &sort_cmp_funs,
+    ObExecContext &exec_ctx,
+    const bool enable_encode_sortkey,
+    ObChunkDatumStore::StoredRow **tmp_buf)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = end - begin;
+  const int64_t run_cnt = min(degree, ObParallelSortPhase::MAX_RUN_CNT);
+  int64_t run_bounds[ObParallelSortPhase::MAX_RUN_CNT + 1];
+  if (OB_ISNULL(rows) || OB_ISNULL(tmp_buf) || OB_UNLIKELY(begin < 0 || row_cnt < degree || degree <= 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(rows), KP(tmp_buf), K(begin), K(end), K(degree));
+  } else {
+    // positions are relative to rows + begin, tmp_buf is indexed the same way
+    ObChunkDatumStore::StoredRow **src = rows + begin;
+    ObChunkDatumStore::StoredRow **dst = tmp_buf;
+    for (int64_t i = 0; i <= run_cnt; ++i) {
+      run_bounds[i] = row_cnt * i / run_cnt;
+    }
+    ObSortWorkerPool &pool = ObSortWorkerPool::get_instance();
+    ObParallelSortPhase *phase = NULL;
+    int64_t cur_run_cnt = run_cnt;
+    if (OB_FAIL(init_phase(ObParallelSortPhase::SORT_RUNS, src, dst, run_bounds, cur_run_cnt,
+        sort_collations, sort_cmp_funs, exec_ctx, enable_encode_sortkey, phase))) {
+      LOG_WARN("failed to init sort phase", K(ret));
+    } else {
+      ret = pool.run_phase(*phase, phase->task_cnt_ - 1);
+      phase->dec_ref();
+      phase = NULL;
+    }
+    while (OB_SUCC(ret) && cur_run_cnt > 1) {
+      if (OB_FAIL(exec_ctx.check_status())) {
+        LOG_WARN("check status failed", K(ret));
+      } else if (OB_FAIL(init_phase(ObParallelSortPhase::MERGE_RUNS, src, dst, run_bounds,
+          cur_run_cnt, sort_collations, sort_cmp_funs, exec_ctx, enable_encode_sortkey, phase))) {
+        LOG_WARN("failed to init merge phase", K(ret));
+      } else {
+        ret = pool.run_phase(*phase, phase->task_cnt_ - 1);
+        phase->dec_ref();
+        phase = NULL;
+        if (OB_SUCC(ret)) {
+          const int64_t next_run_cnt = (cur_run_cnt + 1) / 2;
+          for (int64_t i = 0; i <= next_run_cnt; ++i) {
+            run_bounds[i] = run_bounds[min(2 * i, cur_run_cnt)];
+          }
+          cur_run_cnt = next_run_cnt;
+          std::swap(src, dst);
+        }
+      }
+    }
+    if (OB_SUCC(ret) && src != rows + begin) {
+      MEMCPY(rows + begin, src, sizeof(ObChunkDatumStore::StoredRow *) * row_cnt);
+    }
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_SORT_PARALLEL_SORT_H_
+#define OCEANBASE_SQL_ENGINE_SORT_PARALLEL_SORT_H_
+
+#include "lib/lock/ob_mutex.h"
+#include "lib/thread/ob_simple_thread_pool.h"
+#include "sql/engine/basic/ob_chunk_datum_store.h"
+#include "sql/engine/sort/ob_sort_basic_info.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+class ObExecContext;
+
+/*
+ * One phase of a parallel in-memory sort, split into independent tasks:
+ *   SORT_RUNS:  sort each run of %src_ in place.
+ *   MERGE_RUNS: merge each pair of adjacent runs of %src_ into %dst_.
+ * Tasks are claimed by the sort operator thread and the helper threads of
+ * ObSortWorkerPool. The phase is referenced by every helper it is dispatched to,
+ * so it is allocated on heap and freed by the last reference.
+ */
+class ObParallelSortPhase
+{
+public:
+  enum PhaseType
+  {
+    SORT_RUNS = 0,
+    MERGE_RUNS = 1
+  };
+  ObParallelSortPhase();
+  ~ObParallelSortPhase() = default;
+  static int alloc(ObParallelSortPhase *&phase);
+  void inc_ref() { ATOMIC_INC(&ref_cnt_); }
+  void dec_ref();
+  // claim and run tasks until no task left
+  void run_tasks();
+  bool is_finished() const { return ATOMIC_LOAD(&finished_task_cnt_) >= task_cnt_; }
+  int get_ret() const { return ATOMIC_LOAD(&ret_); }
+  TO_STRING_KV(K_(type), K_(task_cnt), K_(run_cnt), K_(next_task_idx), K_(finished_task_cnt),
+               K_(ret), K_(ref_cnt), K_(enable_encode_sortkey), K_(tenant_id));
+private:
+  int run_task(const int64_t task_idx);
+public:
+  static const int64_t MAX_RUN_CNT = 64;
+  PhaseType type_;
+  ObChunkDatumStore::StoredRow **src_;
+  ObChunkDatumStore::StoredRow **dst_;
+  // run i is [run_bounds_[i], run_bounds_[i + 1])
+  int64_t run_bounds_[MAX_RUN_CNT + 1];
+  int64_t run_cnt_;
+  int64_t task_cnt_;
+  const common::ObIArray<ObSortFieldCollation> *sort_collations_;
+  const common::ObIArray<ObSortCmpFunc> *sort_cmp_funs_;
+  ObExecContext *exec_ctx_;
+  bool enable_encode_sortkey_;
+  // tenant of the sort operator, compare functions of lob, json and gis may
+  // allocate memory of the tenant or read out row lob
+  uint64_t tenant_id_;
+private:
+  int64_t next_task_idx_;
+  int64_t finished_task_cnt_;
+  int ret_;
+  int64_t ref_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObParallelSortPhase);
+};
+
+// Helper threads shared by all sort operators of the server, they only sort and merge
+// row pointers of one phase, in the tenant context of the sort operator.
+class ObSortWorkerPool : public common::ObSimpleThreadPool
+{
+public:
+  static const int64_t MAX_WORKER_CNT = 15;
+  static const int64_t MAX_QUEUED_TASK_CNT = 1024;
+  static ObSortWorkerPool &get_instance();
+  // run all tasks of %phase by this thread and at most %helper_cnt helpers,
+  // return after all tasks finished.
+  int run_phase(ObParallelSortPhase &phase, const int64_t helper_cnt);
+private:
+  ObSortWorkerPool() : lock_(), is_started_(false) {}
+  virtual ~ObSortWorkerPool() { destroy(); }
+  int try_start();
+  virtual void handle(void *task) override;
+private:
+  static const int64_t WAIT_TASK_INTERVAL_US = 20;
+  lib::ObMutex lock_;
+  bool is_started_;
+  DISALLOW_COPY_AND_ASSIGN(ObSortWorkerPool);
+};
+
+/*
+ * Sort [begin, end) of %rows with %degree threads: the range is split into
+ * %degree runs sorted in parallel, then adjacent runs are merged pairwise in
+ * parallel, log2(degree) rounds, with %tmp_buf (capacity end - begin) as the
+ * ping-pong buffer. The result is always left in %rows.
+ */
+class ObParallelSorter
+{
+public:
+  static int sort(
+      ObChunkDatumStore::StoredRow **rows,
+      const int64_t begin,
+      const int64_t end,
+      const int64_t degree,
+      const common::ObIArray<ObSortFieldCollation> &sort_collations,
+      const common::ObIArray<ObSortCmpFunc> &sort_cmp_funs,
+      ObExecContext &exec_ctx,
+      const bool enable_encode_sortkey,
+      ObChunkDatumStore::StoredRow **tmp_buf);
+private:
+  static int init_phase(
+      const ObParallelSortPhase::PhaseType type,
+      ObChunkDatumStore::StoredRow **src,
+      ObChunkDatumStore::StoredRow **dst,
+      const int64_t *run_bounds,
+      const int64_t run_cnt,
+      const common::ObIArray<ObSortFieldCollation> &sort_collations,
+      const common::ObIArray<ObSortCmpFunc> &sort_cmp_funs,
+      ObExecContext &exec_ctx,
+      const bool enable_encode_sortkey,
+      ObParallelSortPhase *&phase);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SQL_ENGINE_SORT_PARALLEL_SORT_H_
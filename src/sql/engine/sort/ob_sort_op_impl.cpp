@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX SQL_ENG
 
 #include "ob_sort_op_impl.h"
+#include "ob_parallel_sort.h"
 #include "sql/engine/ob_operator.h"
 #include "sql/engine/ob_tenant_sql_memory_manager.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
@@ -387,7 +388,8 @@ int ObSortOpImpl::Compare::init(
 int ObSortOpImpl::Compare::fast_check_status()
 {
   int ret = OB_SUCCESS;
-  if (OB_UNLIKELY((cmp_count_++ & 8191) == 8191)) {
+  // exec_ctx_ is null for compare used by the sort worker threads
+  if (OB_UNLIKELY((cmp_count_++ & 8191) == 8191) && OB_NOT_NULL(exec_ctx_)) {
     ret = exec_ctx_->check_status();
   }
   return ret;
@@ -842,6 +844,10 @@ int ObSortOpImpl::build_chunk(const int64_t level, Input &input, int64_t extra_s
     chunk->datum_store_.set_allocator(mem_context_->get_malloc_allocator());
     chunk->datum_store_.set_callback(&sql_mem_processor_);
     chunk->datum_store_.set_io_event_observer(io_event_observer_);
+    if (GCONF._enable_sort_spill_compression
+        && OB_FAIL(chunk->datum_store_.set_dump_compressor(LZ4_COMPRESSOR))) {
+      LOG_WARN("set dump compressor failed", K(ret));
+    }
     while (OB_SUCC(ret)) {
       if (!is_fetch_with_ties_ && stored_row_cnt >= topn_cnt_) {
         break;
@@ -1526,11 +1532,15 @@ int ObSortOpImpl::build_ems_heap(int64_t &merge_ways)
       ems_heap_->reset();
     }
     if (OB_SUCC(ret)) {
-      merge_ways = get_memory_limit() / ObChunkDatumStore::BLOCK_SIZE;
+      // iterator of compressed chunk prefetches a whole page besides the block being read
+      const int64_t way_mem_size = first->datum_store_.is_dump_compressed()
+          ? ObChunkDatumStore::BLOCK_SIZE + ObChunkDatumStore::DUMP_PAGE_SIZE
+          : ObChunkDatumStore::BLOCK_SIZE;
+      merge_ways = get_memory_limit() / way_mem_size;
       merge_ways = std::max(2L, merge_ways);
       if (merge_ways < max_ways) {
         bool dumped = false;
-        int64_t need_size = max_ways * ObChunkDatumStore::BLOCK_SIZE;
+        int64_t need_size = max_ways * way_mem_size;
         if (OB_FAIL(sql_mem_processor_.extend_max_memory_size(
             &mem_context_->get_malloc_allocator(),
             [&](int64_t max_memory_size) {
@@ -1539,7 +1549,7 @@ int ObSortOpImpl::build_ems_heap(int64_t &merge_ways)
             dumped, mem_context_->used()))) {
           LOG_WARN("failed to extend memory size", K(ret));
         }
-        merge_ways = std::max(merge_ways, get_memory_limit() / ObChunkDatumStore::BLOCK_SIZE);
+        merge_ways = std::max(merge_ways, get_memory_limit() / way_mem_size);
       }
       merge_ways = std::min(merge_ways, max_ways);
       LOG_TRACE("do merge sort ", K(first->level_), K(merge_ways), K(sort_chunks_.get_size()), K(get_memory_limit()), K(sql_mem_processor_.get_profile()));
@@ -1667,8 +1677,13 @@ int ObSortOpImpl::sort_inmem_data()
           }
         }
       }
+      bool sorted_in_parallel = false;
       if (part_cnt_ > 0) {
         do_partition_sort(*rows_, begin, rows_->count());
+      } else if (OB_FAIL(parallel_sort_inmem_data(begin, rows_->count(), sorted_in_parallel))) {
+        LOG_WARN("parallel sort in-memory data failed", K(ret));
+      } else if (sorted_in_parallel) {
+        // sorted by sort worker pool
       } else if (enable_encode_sortkey_) {
         bool can_encode = true;
         ObAdaptiveQS aqs(*rows_, mem_context_->get_malloc_allocator());
@@ -1736,6 +1751,53 @@ int ObSortOpImpl::sort_inmem_data()
   return ret;
 }
 
+int ObSortOpImpl::parallel_sort_inmem_data(const int64_t begin, const int64_t end, bool &sorted)
+{
+  int ret = OB_SUCCESS;
+  sorted = false;
+  const int64_t row_cnt = end - begin;
+  const int64_t degree = min(static_cast<int64_t>(GCONF._sort_parallel_degree),
+                             row_cnt / MIN_PARALLEL_SORT_RUN_ROW_CNT);
+  const int64_t buf_size = row_cnt * sizeof(ObChunkDatumStore::StoredRow *);
+  ObChunkDatumStore::StoredRow **tmp_buf = NULL;
+  if (degree <= 1 || OB_ISNULL(exec_ctx_) || OB_ISNULL(sort_collations_) || OB_ISNULL(sort_cmp_funs_)) {
+    // sort by this thread
+  } else if (sql_mem_processor_.get_data_size() + buf_size > get_memory_limit()
+             || mem_context_->used() + buf_size >= profile_.get_max_bound()) {
+    // the merge buffer exceeds the memory bound, sort by this thread
+    LOG_TRACE("no memory for parallel sort", K(buf_size), K(get_memory_limit()),
+              K(sql_mem_processor_.get_data_size()), K(mem_context_->used()));
+  } else if (OB_ISNULL(tmp_buf = static_cast<ObChunkDatumStore::StoredRow **>(
+                       mem_context_->get_malloc_allocator().alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(buf_size));
+  } else {
+    sql_mem_processor_.alloc(buf_size);
+    check_encode_sortkey(begin, end);
+    if (OB_FAIL(ObParallelSorter::sort(&rows_->at(0), begin, end, degree, *sort_collations_,
+                                       *sort_cmp_funs_, *exec_ctx_, enable_encode_sortkey_, tmp_buf))) {
+      LOG_WARN("parallel sort failed", K(ret), K(begin), K(end), K(degree));
+    } else {
+      sorted = true;
+      LOG_TRACE("parallel in-memory sort", K(row_cnt), K(degree));
+    }
+    sql_mem_processor_.alloc(-1 * buf_size);
+    mem_context_->get_malloc_allocator().free(tmp_buf);
+    tmp_buf = NULL;
+  }
+  return ret;
+}
+
+void ObSortOpImpl::check_encode_sortkey(const int64_t begin, const int64_t end)
+{
+  for (int64_t i = begin; enable_encode_sortkey_ && i < end; i++) {
+    if (rows_->at(i)->cells()[0].is_null()) {
+      enable_encode_sortkey_ = false;
+      comp_.enable_encode_sortkey_ = false;
+    }
+  }
+}
+
 int ObSortOpImpl::sort()
 {
   int ret = OB_SUCCESS;
@@ -72,6 +72,8 @@ public:
   static const int64_t EXTEND_MULTIPLE = 2;
   static const int64_t MAX_MERGE_WAYS = 256;
   static const int64_t INMEMORY_MERGE_SORT_WARN_WAYS = 10000;
+  // minimum rows sorted by one thread of parallel in-memory sort
+  static const int64_t MIN_PARALLEL_SORT_RUN_ROW_CNT = 32 * 1024;
 
   explicit ObSortOpImpl(ObMonitorNode &op_monitor_info);
   virtual ~ObSortOpImpl();
@@ -462,6 +464,12 @@ protected:
     return !use_heap_sort_ && rows_->count() > datum_store_.get_row_cnt();
   }
   int sort_inmem_data();
+  // sort [begin, end) of rows_ by the sort worker pool if _sort_parallel_degree
+  // allows and the merge buffer fits in the memory bound, %sorted is false otherwise.
+  int parallel_sort_inmem_data(const int64_t begin, const int64_t end, bool &sorted);
+  // the encoded sort key is null if encoding failed (e.g. invalid unicode), fall back to
+  // compare by datum if any row of [begin, end) has, same as ObAdaptiveQS::init.
+  void check_encode_sortkey(const int64_t begin, const int64_t end);
   int do_dump();
 
   template <typename Input>
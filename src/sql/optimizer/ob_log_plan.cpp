@@ -6950,7 +6950,8 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
       LOG_WARN("get unexpected null", K(ret));
     } else if (T_FUN_COUNT != cur_aggr->get_expr_type()
                && T_FUN_MIN != cur_aggr->get_expr_type()
-               && T_FUN_MAX != cur_aggr->get_expr_type()) {
+               && T_FUN_MAX != cur_aggr->get_expr_type()
+               && T_FUN_SUM != cur_aggr->get_expr_type()) {
       can_push = false;
     } else if (cur_aggr->is_param_distinct() || 1 < cur_aggr->get_real_param_count()) {
       /* mysql mode, support count(distinct c1, c2). if this distinct can be eliminated,
@@ -6964,6 +6965,17 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
     } else if (!first_param->is_column_ref_expr() ||
                table_item->table_id_ != static_cast<ObColumnRefRawExpr*>(first_param)->get_table_id()) {
       can_push = false;
+    } else if (T_FUN_SUM == cur_aggr->get_expr_type()) {
+      // storage sums integer/number columns into number, float/double columns into float/double
+      const ObObjTypeClass param_tc = first_param->get_result_type().get_type_class();
+      const ObObjTypeClass res_tc = cur_aggr->get_result_type().get_type_class();
+      if (ObIntTC == param_tc || ObUIntTC == param_tc || ObNumberTC == param_tc) {
+        can_push = ObNumberTC == res_tc;
+      } else if (ObFloatTC == param_tc || ObDoubleTC == param_tc) {
+        can_push = ObFloatTC == res_tc || ObDoubleTC == res_tc;
+      } else {
+        can_push = false;
+      }
     }
   }
   return ret;
@@ -18,6 +18,7 @@
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 #include "storage/access/ob_table_access_param.h"
 #include "storage/access/ob_table_access_context.h"
 namespace oceanbase
@@ -30,7 +31,8 @@ ObAggCell::ObAggCell(
     const share::schema::ObColumnParam *col_param,
     sql::ObExpr *expr,
     common::ObIAllocator &allocator)
-    : col_idx_(col_idx), is_lob_col_(false), datum_(), col_param_(col_param), expr_(expr), allocator_(allocator)
+    : col_idx_(col_idx), skip_index_col_idx_(-1), is_lob_col_(false), datum_(), col_param_(col_param),
+      expr_(expr), allocator_(allocator)
 {
   if (col_param_ != nullptr) {
     is_lob_col_ = col_param_->get_meta_type().is_lob_storage();
@@ -45,6 +47,7 @@ ObAggCell::~ObAggCell()
 void ObAggCell::reset()
 {
   col_idx_ = -1;
+  skip_index_col_idx_ = -1;
   is_lob_col_ = false;
   expr_ = nullptr;
 }
@@ -53,6 +56,33 @@ void ObAggCell::reuse()
 {
 }
 
+bool ObAggCell::can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  UNUSED(index_info);
+  return false;
+}
+
+int ObAggCell::read_skip_index(
+    const blocksstable::ObMicroIndexInfo &index_info,
+    blocksstable::ObSkipIndexColAggResult &result) const
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObAggRowReader agg_row_reader;
+  result.reset();
+  if (skip_index_col_idx_ < 0 || !index_info.has_agg_data()) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(agg_row_reader.init(index_info.agg_row_buf_, index_info.agg_buf_size_))) {
+    LOG_WARN("Failed to init agg row reader", K(ret), K(index_info));
+  } else if (skip_index_col_idx_ >= agg_row_reader.get_column_count() ||
+             agg_row_reader.get_row_count() != index_info.get_row_count()) {
+    // column not stored in sstable or without skip index
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(agg_row_reader.read(skip_index_col_idx_, result))) {
+    LOG_WARN("Failed to read agg column", K(ret), K_(skip_index_col_idx), K(agg_row_reader));
+  }
+  return ret;
+}
+
 int ObAggCell::fill_result(sql::ObEvalCtx &ctx,bool need_padding)
 {
   int ret = OB_SUCCESS;
@@ -71,6 +101,14 @@ int ObAggCell::fill_result(sql::ObEvalCtx &ctx,bool need_padding)
   return ret;
 }
 
+int ObAggCell::eval(const common::ObDatum &datum, const int64_t row_count)
+{
+  UNUSEDx(datum, row_count);
+  int ret = OB_NOT_SUPPORTED;
+  LOG_WARN("eval is not supported", K(ret), K(*this));
+  return ret;
+}
+
 int ObAggCell::fill_default_if_need(blocksstable::ObStorageDatum &datum)
 {
   int ret = OB_SUCCESS;
@@ -243,14 +281,29 @@ int ObCountAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
   } else if (!exclude_null_) {
     row_count_ += index_info.get_row_count();
   } else {
-    // TODO, extract from pre-agginfo
-    ret = OB_NOT_SUPPORTED;
-    LOG_WARN("exclude null is not supported", K(ret));
+    blocksstable::ObSkipIndexColAggResult result;
+    if (OB_FAIL(read_skip_index(index_info, result))) {
+      LOG_WARN("Failed to read skip index", K(ret), K(index_info), KPC(this));
+    } else {
+      row_count_ += index_info.get_row_count() - result.null_count_;
+    }
   }
   LOG_DEBUG("after count index info", K(ret), K(index_info.get_row_count()), K(row_count_));
   return ret;
 }
 
+bool ObCountAggCell::can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = !exclude_null_;
+  if (!bret) {
+    // nop and out row values invalidate min/max and sum, null count is exact only without them
+    blocksstable::ObSkipIndexColAggResult result;
+    bret = OB_SUCCESS == read_skip_index(index_info, result) &&
+        (result.has_min_max() || result.has_sum() || result.null_count_ >= index_info.get_row_count());
+  }
+  return bret;
+}
+
 int ObCountAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
 {
   UNUSED(need_padding);
@@ -465,6 +518,390 @@ int ObMinMaxAggCell::deep_copy_datum(const blocksstable::ObStorageDatum &src)
   return ret;
 }
 
+ObSumAggCell::ObSumAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      col_tc_(ObNullTC),
+      res_tc_(ObNullTC),
+      has_value_(false),
+      int_sum_(0),
+      uint_sum_(0),
+      double_sum_(0),
+      num_sum_(),
+      num_buf_idx_(0),
+      agg_datum_buf_(allocator),
+      cell_data_ptrs_(nullptr),
+      ref_cnts_(nullptr)
+{
+  num_sum_.set_zero();
+}
+
+void ObSumAggCell::reset()
+{
+  agg_datum_buf_.reset();
+  if (nullptr != cell_data_ptrs_) {
+    allocator_.free(cell_data_ptrs_);
+    cell_data_ptrs_ = nullptr;
+  }
+  if (nullptr != ref_cnts_) {
+    allocator_.free(ref_cnts_);
+    ref_cnts_ = nullptr;
+  }
+  col_tc_ = ObNullTC;
+  res_tc_ = ObNullTC;
+  reuse();
+  ObAggCell::reset();
+}
+
+void ObSumAggCell::reuse()
+{
+  has_value_ = false;
+  int_sum_ = 0;
+  uint_sum_ = 0;
+  double_sum_ = 0;
+  num_sum_.set_zero();
+  num_buf_idx_ = 0;
+  ObAggCell::reuse();
+}
+
+bool ObSumAggCell::is_sum_supported(const common::ObObjTypeClass col_tc, const common::ObObjTypeClass res_tc)
+{
+  bool bret = false;
+  if (ObIntTC == col_tc || ObUIntTC == col_tc || ObNumberTC == col_tc) {
+    bret = ObNumberTC == res_tc;
+  } else if (ObFloatTC == col_tc || ObDoubleTC == col_tc) {
+    bret = ObFloatTC == res_tc || ObDoubleTC == res_tc;
+  }
+  return bret;
+}
+
+int ObSumAggCell::init(const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_ISNULL(col_param_) || OB_ISNULL(expr_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null col param or expr", K(ret), KP_(col_param), KP_(expr));
+  } else if (FALSE_IT(col_tc_ = col_param_->get_meta_type().get_type_class())) {
+  } else if (FALSE_IT(res_tc_ = ob_obj_type_class(expr_->datum_meta_.type_))) {
+  } else if (OB_UNLIKELY(!is_sum_supported(col_tc_, res_tc_))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Sum type is not supported", K(ret), K_(col_tc), K_(res_tc));
+  } else if (OB_FAIL(agg_datum_buf_.init(batch_size))) {
+    LOG_WARN("Failed to init agg datum buf", K(ret));
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(char*) * batch_size))) {
+    ret = common::OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc cell data ptrs", K(ret), K(batch_size));
+  } else if (FALSE_IT(cell_data_ptrs_ = static_cast<const char**>(buf))) {
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(int64_t) * batch_size))) {
+    ret = common::OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc ref cnts", K(ret), K(batch_size));
+  } else {
+    ref_cnts_ = static_cast<int64_t*>(buf);
+  }
+  return ret;
+}
+
+int ObSumAggCell::process(blocksstable::ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum &storage_datum = row.storage_datums_[col_idx_];
+  if (OB_FAIL(fill_default_if_need(storage_datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(storage_datum), K(*this));
+  } else if (OB_FAIL(eval(storage_datum))) {
+    LOG_WARN("Failed to eval datum", K(ret), K(storage_datum), K(*this));
+  }
+  LOG_DEBUG("after process single row", K(storage_datum), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  agg_datum_buf_.reuse();
+  if (OB_ISNULL(reader) || OB_ISNULL(row_ids)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Uexpected, reader or row_ids is null", K(ret), KP(reader), KP(row_ids), K(*this));
+  } else if (blocksstable::ObIMicroBlockReader::Reader == reader->get_type()) {
+    blocksstable::ObMicroBlockReader *block_reader = static_cast<blocksstable::ObMicroBlockReader*>(reader);
+    if (OB_FAIL(block_reader->get_aggregate_result(col_idx_, col_param_, row_ids, row_count, *this))) {
+      LOG_WARN("Failed to get aggregate result", K(ret), K(row_count), KPC(this));
+    }
+  } else {
+    blocksstable::ObMicroBlockDecoder *block_decoder = static_cast<blocksstable::ObMicroBlockDecoder*>(reader);
+    if (OB_FAIL(block_decoder->get_aggregate_result(col_idx_, row_ids, cell_data_ptrs_, row_count,
+                agg_datum_buf_.get_datums(), ref_cnts_, *this))) {
+      LOG_WARN("Failed to get aggregate result", K(ret), K(row_count), KPC(this));
+    }
+  }
+  LOG_DEBUG("after process batch rows", K(ret), K(row_count), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObSkipIndexColAggResult result;
+  if (!index_info.can_blockscan(is_lob_col()) || index_info.is_left_border() || index_info.is_right_border()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, the micro index info must can blockscan and not border", K(ret));
+  } else if (OB_FAIL(read_skip_index(index_info, result))) {
+    LOG_WARN("Failed to read skip index", K(ret), K(index_info), KPC(this));
+  } else if (!result.has_sum()) {
+    if (OB_UNLIKELY(result.null_count_ < index_info.get_row_count())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected skip index without sum", K(ret), K(result), K(index_info), KPC(this));
+    }
+    // all values are null, nothing to sum
+  } else {
+    // sum of the block is saved as int/uint for integer columns and as double for float columns
+    switch (col_tc_) {
+      case ObIntTC: {
+        ret = eval_int(result.sum_.get_int(), 1);
+        break;
+      }
+      case ObUIntTC: {
+        ret = eval_uint(result.sum_.get_uint64(), 1);
+        break;
+      }
+      case ObFloatTC:
+      case ObDoubleTC: {
+        double_sum_ += result.sum_.get_double();
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected skip index sum type", K(ret), K_(col_tc), K(result));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("Failed to eval skip index sum", K(ret), K(result), KPC(this));
+    } else {
+      has_value_ = true;
+    }
+  }
+  LOG_DEBUG("after process index info", K(ret), K(index_info.get_row_count()), K(result), KPC(this));
+  return ret;
+}
+
+bool ObSumAggCell::can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  blocksstable::ObSkipIndexColAggResult result;
+  return OB_SUCCESS == read_skip_index(index_info, result) &&
+         (result.has_sum() || result.null_count_ >= index_info.get_row_count());
+}
+
+int ObSumAggCell::eval(const common::ObDatum &datum, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(0 >= row_count)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid row count", K(ret), K(row_count));
+  } else if (datum.is_nop()) {
+    blocksstable::ObStorageDatum default_datum;
+    if (OB_FAIL(fill_default_if_need(default_datum))) {
+      LOG_WARN("Failed to fill default", K(ret), K(*this));
+    } else if (default_datum.is_nop()) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected nop default datum", K(ret), K(*this));
+    } else if (OB_FAIL(eval(default_datum, row_count))) {
+      LOG_WARN("Failed to eval default datum", K(ret), K(default_datum), K(*this));
+    }
+  } else if (datum.is_null()) {
+  } else {
+    switch (col_tc_) {
+      case ObIntTC: {
+        ret = eval_int(datum.get_int(), row_count);
+        break;
+      }
+      case ObUIntTC: {
+        ret = eval_uint(datum.get_uint64(), row_count);
+        break;
+      }
+      case ObNumberTC: {
+        const number::ObNumber nmb(datum.get_number());
+        ret = eval_number(nmb, row_count);
+        break;
+      }
+      case ObFloatTC: {
+        double_sum_ += static_cast<double>(datum.get_float()) * row_count;
+        break;
+      }
+      case ObDoubleTC: {
+        double_sum_ += datum.get_double() * row_count;
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected column type class", K(ret), K_(col_tc));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("Failed to eval sum", K(ret), K(datum), K(row_count), K(*this));
+    } else {
+      has_value_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::eval_int(const int64_t val, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  int64_t product = 0;
+  int64_t sum = 0;
+  if (__builtin_mul_overflow(val, row_count, &product)) {
+    char local_buf[common::number::ObNumber::MAX_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_BYTE_LEN);
+    common::number::ObNumber nmb;
+    if (OB_FAIL(nmb.from(val, local_alloc))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K(val));
+    } else if (OB_FAIL(eval_number(nmb, row_count))) {
+      LOG_WARN("Failed to eval number", K(ret), K(nmb), K(row_count));
+    }
+  } else if (__builtin_add_overflow(int_sum_, product, &sum)) {
+    char local_buf[common::number::ObNumber::MAX_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_BYTE_LEN);
+    common::number::ObNumber nmb;
+    if (OB_FAIL(nmb.from(int_sum_, local_alloc))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K_(int_sum));
+    } else if (OB_FAIL(add_to_num_sum(nmb))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb));
+    } else {
+      int_sum_ = product;
+    }
+  } else {
+    int_sum_ = sum;
+  }
+  return ret;
+}
+
+int ObSumAggCell::eval_uint(const uint64_t val, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  uint64_t product = 0;
+  uint64_t sum = 0;
+  if (__builtin_mul_overflow(val, static_cast<uint64_t>(row_count), &product)) {
+    char local_buf[common::number::ObNumber::MAX_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_BYTE_LEN);
+    common::number::ObNumber nmb;
+    if (OB_FAIL(nmb.from(val, local_alloc))) {
+      LOG_WARN("Failed to cons number from uint", K(ret), K(val));
+    } else if (OB_FAIL(eval_number(nmb, row_count))) {
+      LOG_WARN("Failed to eval number", K(ret), K(nmb), K(row_count));
+    }
+  } else if (__builtin_add_overflow(uint_sum_, product, &sum)) {
+    char local_buf[common::number::ObNumber::MAX_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_BYTE_LEN);
+    common::number::ObNumber nmb;
+    if (OB_FAIL(nmb.from(uint_sum_, local_alloc))) {
+      LOG_WARN("Failed to cons number from uint", K(ret), K_(uint_sum));
+    } else if (OB_FAIL(add_to_num_sum(nmb))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb));
+    } else {
+      uint_sum_ = product;
+    }
+  } else {
+    uint_sum_ = sum;
+  }
+  return ret;
+}
+
+int ObSumAggCell::eval_number(const common::number::ObNumber &nmb, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (1 == row_count) {
+    if (OB_FAIL(add_to_num_sum(nmb))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb));
+    }
+  } else {
+    char local_buf[common::number::ObNumber::MAX_CALC_BYTE_LEN * 2];
+    common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_CALC_BYTE_LEN * 2);
+    common::number::ObNumber cnt_nmb;
+    common::number::ObNumber product;
+    if (OB_FAIL(cnt_nmb.from(row_count, local_alloc))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K(row_count));
+    } else if (OB_FAIL(nmb.mul_v3(cnt_nmb, product, local_alloc))) {
+      LOG_WARN("Failed to mul number", K(ret), K(nmb), K(cnt_nmb));
+    } else if (OB_FAIL(add_to_num_sum(product))) {
+      LOG_WARN("Failed to add number", K(ret), K(product));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_to_num_sum(const common::number::ObNumber &nmb)
+{
+  int ret = OB_SUCCESS;
+  // result is written into the buffer not referenced by num_sum_
+  const int64_t next_idx = 1 - num_buf_idx_;
+  common::ObDataBuffer allocator(num_sum_buf_[next_idx], common::number::ObNumber::MAX_CALC_BYTE_LEN);
+  common::number::ObNumber result;
+  if (OB_FAIL(num_sum_.add_v3(nmb, result, allocator))) {
+    LOG_WARN("Failed to add number", K(ret), K_(num_sum), K(nmb));
+  } else {
+    num_sum_ = result;
+    num_buf_idx_ = next_idx;
+  }
+  return ret;
+}
+
+int ObSumAggCell::get_result_number(common::number::ObNumber &result, common::ObIAllocator &allocator) const
+{
+  int ret = OB_SUCCESS;
+  char local_buf[common::number::ObNumber::MAX_BYTE_LEN];
+  common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_BYTE_LEN);
+  common::number::ObNumber nmb;
+  if (ObIntTC == col_tc_ && OB_FAIL(nmb.from(int_sum_, local_alloc))) {
+    LOG_WARN("Failed to cons number from int", K(ret), K_(int_sum));
+  } else if (ObUIntTC == col_tc_ && OB_FAIL(nmb.from(uint_sum_, local_alloc))) {
+    LOG_WARN("Failed to cons number from uint", K(ret), K_(uint_sum));
+  } else if (ObNumberTC == col_tc_) {
+    result = num_sum_;
+  } else if (OB_FAIL(num_sum_.add_v3(nmb, result, allocator))) {
+    LOG_WARN("Failed to add number", K(ret), K_(num_sum), K(nmb));
+  }
+  return ret;
+}
+
+int ObSumAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
+{
+  UNUSED(need_padding);
+  int ret = OB_SUCCESS;
+  ObDatum &result = expr_->locate_datum_for_write(ctx);
+  sql::ObEvalInfo &eval_info = expr_->get_eval_info(ctx);
+  if (!has_value_) {
+    result.set_null();
+  } else if (ObNumberTC == res_tc_) {
+    char local_buf[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer local_alloc(local_buf, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    common::number::ObNumber result_num;
+    if (OB_FAIL(get_result_number(result_num, local_alloc))) {
+      LOG_WARN("Failed to get result number", K(ret), K(*this));
+    } else {
+      result.set_number(result_num);
+    }
+  } else if (ObDoubleTC == res_tc_) {
+    result.set_double(double_sum_);
+  } else if (ObFloatTC == res_tc_) {
+    result.set_float(static_cast<float>(double_sum_));
+  } else {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected result type class", K(ret), K_(res_tc));
+  }
+  if (OB_SUCC(ret)) {
+    eval_info.evaluated_ = true;
+  }
+  LOG_DEBUG("fill result", K(ret), K(result), KPC(this));
+  return ret;
+}
+
 ObAggRow::ObAggRow(common::ObIAllocator &allocator) :
     agg_cells_(allocator),
     need_exclude_null_(false),
@@ -504,9 +941,10 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
 {
   int ret = OB_SUCCESS;
   const common::ObIArray<share::schema::ObColumnParam *> *out_cols_param = param.iter_param_.get_col_params();
-  if (OB_ISNULL(out_cols_param)) {
+  const ObTableReadInfo *read_info = param.iter_param_.get_read_info();
+  if (OB_ISNULL(out_cols_param) || OB_ISNULL(read_info)) {
     ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("unexpected null out cols param", K(ret), K_(param.iter_param));
+    LOG_WARN("unexpected null out cols param or read info", K(ret), K_(param.iter_param));
   } else if (OB_FAIL(agg_cells_.init(param.output_exprs_->count() + param.aggregate_exprs_->count()))) {
     LOG_WARN("Failed to init agg cells array", K(ret), K(param.output_exprs_->count()));
   } else {
@@ -547,6 +985,7 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
               OB_ISNULL(cell = new(buf) ObCountAggCell(col_idx, col_param, expr, allocator_, exclude_null))) {
             ret = OB_ALLOCATE_MEMORY_FAILED;
             LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+          } else if (FALSE_IT(set_skip_index_col_idx(*read_info, col_idx, *cell))) {
           } else if (OB_FAIL(agg_cells_.push_back(cell))) {
             LOG_WARN("Failed to push back agg cell", K(ret), K(i));
           }
@@ -574,6 +1013,19 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
           } else if (OB_FAIL(agg_cells_.push_back(cell))) {
             LOG_WARN("Failed to push back agg cell", K(ret), K(i));
           }
+        } else if (T_FUN_SUM == expr->type_) {
+          need_exclude_null_ = true;
+          const share::schema::ObColumnParam *col_param = out_cols_param->at(col_idx);
+          if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObSumAggCell))) ||
+              OB_ISNULL(cell = new(buf) ObSumAggCell(col_idx, col_param, expr, allocator_))) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+          } else if (OB_FAIL(static_cast<ObSumAggCell*>(cell)->init(batch_size))) {
+            LOG_WARN("Failed to init ObSumAggCell", K(ret), KPC(cell));
+          } else if (FALSE_IT(set_skip_index_col_idx(*read_info, col_idx, *cell))) {
+          } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+            LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+          }
         } else {
           ret = OB_NOT_SUPPORTED;
           LOG_WARN("Agg is not supported", K(ret), K(expr->type_));
@@ -584,6 +1036,22 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
   return ret;
 }
 
+bool ObAggRow::can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = true;
+  for (int64_t i = 0; bret && i < agg_cells_.count(); ++i) {
+    bret = nullptr != agg_cells_.at(i) && agg_cells_.at(i)->can_agg_index_info(index_info);
+  }
+  return bret;
+}
+
+void ObAggRow::set_skip_index_col_idx(const ObTableReadInfo &read_info, const int32_t col_idx, ObAggCell &cell)
+{
+  if (col_idx >= 0 && col_idx < read_info.get_columns_index().count()) {
+    cell.set_skip_index_col_idx(read_info.get_columns_index().at(col_idx));
+  }
+}
+
 ObAggregatedStore::ObAggregatedStore(const int64_t batch_size, sql::ObEvalCtx &eval_ctx, ObTableAccessContext &context)
     : ObBlockBatchedRowStore(batch_size, eval_ctx, context),
       is_firstrow_aggregated_(false),
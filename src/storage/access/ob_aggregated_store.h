@@ -25,9 +25,11 @@ namespace blocksstable
 {
 class ObMicroBlockDecoder;
 struct ObMicroIndexInfo;
+struct ObSkipIndexColAggResult;
 }
 namespace storage
 {
+class ObTableReadInfo;
 
 static const int64_t AGG_ROW_MODE_COUNT_THRESHOLD = 3;
 static const double AGG_ROW_MODE_RATIO_THRESHOLD = 0.5;
@@ -40,6 +42,7 @@ public:
     COUNT,
     MINMAX,
     FIRST_ROW,
+    SUM,
   };
   ObAggCell(
       const int32_t col_idx,
@@ -56,15 +59,25 @@ public:
       int64_t *row_ids,
       const int64_t row_count) = 0;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) = 0;
+  // whether the rows under @index_info can be aggregated without reading them
+  virtual bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const;
+  // aggregate one value which appears in @row_count rows, used by readers for batch processing
+  virtual int eval(const common::ObDatum &datum, const int64_t row_count = 1);
   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding);
   OB_INLINE bool is_lob_col() const { return is_lob_col_; }
   OB_INLINE int32_t get_col_idx() const { return col_idx_; }
-  TO_STRING_KV(K_(col_idx), K_(is_lob_col), K_(datum), KPC(col_param_), K_(expr));
+  OB_INLINE void set_skip_index_col_idx(const int64_t skip_index_col_idx) { skip_index_col_idx_ = skip_index_col_idx; }
+  TO_STRING_KV(K_(col_idx), K_(skip_index_col_idx), K_(is_lob_col), K_(datum), KPC(col_param_), K_(expr));
 protected:
   int fill_default_if_need(blocksstable::ObStorageDatum &datum);
   int pad_column_if_need(blocksstable::ObStorageDatum &datum);
+  // read the skip index of this column from @index_info, OB_ENTRY_NOT_EXIST if absent
+  int read_skip_index(
+      const blocksstable::ObMicroIndexInfo &index_info,
+      blocksstable::ObSkipIndexColAggResult &result) const;
 protected:
   int32_t col_idx_;
+  int64_t skip_index_col_idx_; // column index in the stored row, -1 if not stored
   bool is_lob_col_;
   blocksstable::ObStorageDatum datum_;
   const share::schema::ObColumnParam *col_param_;
@@ -90,6 +103,11 @@ public:
       int64_t *row_ids,
       const int64_t row_count) override;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override
+  {
+    UNUSED(index_info);
+    return true;
+  }
   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
   INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(aggregated));
 private:
@@ -115,6 +133,7 @@ public:
       int64_t *row_ids,
       const int64_t row_count) override;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
    virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
    INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(exclude_null), K_(row_count));
 private:
@@ -169,7 +188,52 @@ private:
   common::ObArenaAllocator datum_allocator_;
 };
 
-// TODO sum
+class ObSumAggCell : public ObAggCell
+{
+public:
+  ObSumAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator);
+  virtual ~ObSumAggCell() { reset(); };
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual ObAggCellType get_type() const override { return SUM; }
+  int init(const int64_t batch_size);
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
+  virtual int eval(const common::ObDatum &datum, const int64_t row_count = 1) override;
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  static bool is_sum_supported(const common::ObObjTypeClass col_tc, const common::ObObjTypeClass res_tc);
+  INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(col_tc), K_(res_tc), K_(has_value),
+                       K_(int_sum), K_(uint_sum), K_(double_sum), K_(num_sum), K_(agg_datum_buf));
+private:
+  int eval_int(const int64_t val, const int64_t row_count);
+  int eval_uint(const uint64_t val, const int64_t row_count);
+  int eval_number(const common::number::ObNumber &nmb, const int64_t row_count);
+  int add_to_num_sum(const common::number::ObNumber &nmb);
+  int get_result_number(common::number::ObNumber &result, common::ObIAllocator &allocator) const;
+private:
+  common::ObObjTypeClass col_tc_;
+  common::ObObjTypeClass res_tc_;
+  bool has_value_;
+  // integers are summed natively and folded into num_sum_ on overflow
+  int64_t int_sum_;
+  uint64_t uint_sum_;
+  double double_sum_;
+  common::number::ObNumber num_sum_;
+  int64_t num_buf_idx_;
+  char num_sum_buf_[2][common::number::ObNumber::MAX_CALC_BYTE_LEN];
+  ObAggDatumBuf agg_datum_buf_;
+  const char **cell_data_ptrs_;
+  int64_t *ref_cnts_;
+};
 
 class ObAggRow
 {
@@ -180,6 +244,7 @@ public:
   void reuse();
   int init(const ObTableAccessParam &param, const int64_t batch_size);
   OB_INLINE int64_t get_agg_count() const { return agg_cells_.count(); }
+  bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const;
   OB_INLINE bool need_exclude_null() const { return need_exclude_null_; };
   OB_INLINE bool has_lob_column_out() const { return has_lob_column_out_; }
   // void set_firstrow_aggregated(bool aggregated) { is_firstrow_aggregated_ = aggregated; }
@@ -187,6 +252,8 @@ public:
   OB_INLINE ObAggCell* at(int64_t idx) { return agg_cells_.at(idx); }
   OB_INLINE common::ObIArray<ObAggCell*>& get_agg_cells() { return agg_cells_; }
   TO_STRING_KV(K_(agg_cells));
+private:
+  void set_skip_index_col_idx(const ObTableReadInfo &read_info, const int32_t col_idx, ObAggCell &cell);
 private:
   common::ObFixedArray<ObAggCell *, common::ObIAllocator> agg_cells_;
   bool need_exclude_null_;
@@ -219,10 +286,11 @@ public:
   OB_INLINE bool can_batched_aggregate() const { return is_firstrow_aggregated_; }
   OB_INLINE bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
   { 
-    return filter_is_null() && !agg_row_.need_exclude_null() && can_batched_aggregate() &&
+    return filter_is_null() && can_batched_aggregate() &&
            index_info.can_blockscan(agg_row_.has_lob_column_out()) &&
            !index_info.is_left_border() &&
-           !index_info.is_right_border();
+           !index_info.is_right_border() &&
+           agg_row_.can_agg_index_info(index_info);
   }
   OB_INLINE void set_end() { iter_end_flag_ = IterEndState::ITER_END; }
   int check_agg_in_row_mode(const ObTableIterParam &iter_param);
@@ -74,6 +74,8 @@ public:
   OB_INLINE bool can_blockscan() const { return can_blockscan_; }
   OB_INLINE bool filter_applied() const { return filter_applied_; }
   OB_INLINE bool filter_is_null() const { return pd_filter_info_.is_pd_filter_ && nullptr == pd_filter_info_.filter_; }
+  OB_INLINE const sql::ObPushdownFilterExecutor *get_pd_filter() const
+  { return pd_filter_info_.is_pd_filter_ ? pd_filter_info_.filter_ : nullptr; }
   int apply_blockscan(
       blocksstable::ObIMicroBlockRowScanner &micro_scanner,
       const int64_t row_count,
@@ -16,6 +16,7 @@
 #include "share/rc/ob_tenant_base.h"
 #include "ob_index_tree_prefetcher.h"
 #include "ob_aggregated_store.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
 
 namespace oceanbase
@@ -299,6 +300,29 @@ int ObIndexTreePrefetcher::prefetch_block_data(
 {
   int ret = OB_SUCCESS;
   bool need_submit_io = false;
+  if (OB_FAIL(lookup_block_data(index_block_info, micro_handle, is_data, need_submit_io))) {
+    LOG_WARN("Fail to lookup block data", K(ret), K(index_block_info), K(is_data));
+  } else if (need_submit_io && OB_FAIL(submit_block_io(index_block_info, micro_handle, is_data))) {
+    LOG_WARN("Fail to submit block io", K(ret), K(index_block_info), K(is_data));
+  }
+  if (OB_SUCC(ret)) {
+    if (is_data) {
+      EVENT_INC(ObStatEventIds::DATA_BLOCK_READ_CNT);
+    } else {
+      EVENT_INC(ObStatEventIds::INDEX_BLOCK_READ_CNT);
+    }
+  }
+  return ret;
+}
+
+int ObIndexTreePrefetcher::lookup_block_data(
+    blocksstable::ObMicroIndexInfo &index_block_info,
+    ObMicroBlockDataHandle &micro_handle,
+    const bool is_data,
+    bool &need_submit_io)
+{
+  int ret = OB_SUCCESS;
+  need_submit_io = false;
   uint64_t tenant_id = MTL_ID();
   const MacroBlockId &macro_id = index_block_info.get_macro_id();
   const int64_t offset = index_block_info.get_block_offset();
@@ -339,54 +363,56 @@ int ObIndexTreePrefetcher::prefetch_block_data(
   if (OB_SUCC(ret)) {
     micro_handle.micro_info_.offset_ = offset;
     micro_handle.micro_info_.size_ = index_block_info.get_block_size();
-    if (need_submit_io) {
-      ObMacroBlockHandle macro_handle;
-      if (is_data) {
-        const ObTableReadInfo *data_read_info = iter_param_->get_full_read_info();
-        if (OB_ISNULL(data_read_info)) {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_WARN("Unexpected null full_col_descs", K(ret), KPC_(iter_param));
-        } else if (OB_FAIL(data_block_cache_->prefetch(
-                    tenant_id,
-                    macro_id,
-                    index_block_info,
-                    access_ctx_->query_flag_,
-                    *data_read_info,
-                    iter_param_->tablet_handle_,
-                    macro_handle))) {
-          LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle), K(micro_handle), KPC(data_read_info));
-        }
-      } else if (OB_FAIL(index_block_cache_->prefetch(
-                  tenant_id,
-                  macro_id,
-                  index_block_info,
-                  access_ctx_->query_flag_,
-                  *index_read_info_,
-                  iter_param_->tablet_handle_,
-                  macro_handle))) {
-        LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(micro_handle), KPC_(index_read_info));
-      }
-      if (OB_SUCC(ret) && ObSSTableMicroBlockState::UNKNOWN_STATE == micro_handle.block_state_) {
-        micro_handle.tenant_id_ = tenant_id;
-        micro_handle.macro_block_id_ = macro_id;
-        micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
-        micro_handle.io_handle_ = macro_handle;
+  }
+  return ret;
+}
 
-        if (is_data && OB_FAIL(micro_block_handle_mgr_.put_micro_block_handle(
-                    tenant_id,
-                    macro_id,
-                    *index_block_info.row_header_,
-                    micro_handle))) {
-          STORAGE_LOG(WARN, "failed to put handle cache", K(ret), K(tenant_id), K(macro_id), K(index_block_info));
-        }
-      }
+int ObIndexTreePrefetcher::submit_block_io(
+    blocksstable::ObMicroIndexInfo &index_block_info,
+    ObMicroBlockDataHandle &micro_handle,
+    const bool is_data)
+{
+  int ret = OB_SUCCESS;
+  uint64_t tenant_id = MTL_ID();
+  const MacroBlockId &macro_id = index_block_info.get_macro_id();
+  ObMacroBlockHandle macro_handle;
+  if (is_data) {
+    const ObTableReadInfo *data_read_info = iter_param_->get_full_read_info();
+    if (OB_ISNULL(data_read_info)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected null full_col_descs", K(ret), KPC_(iter_param));
+    } else if (OB_FAIL(data_block_cache_->prefetch(
+                tenant_id,
+                macro_id,
+                index_block_info,
+                access_ctx_->query_flag_,
+                *data_read_info,
+                iter_param_->tablet_handle_,
+                macro_handle))) {
+      LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle), K(micro_handle), KPC(data_read_info));
     }
+  } else if (OB_FAIL(index_block_cache_->prefetch(
+              tenant_id,
+              macro_id,
+              index_block_info,
+              access_ctx_->query_flag_,
+              *index_read_info_,
+              iter_param_->tablet_handle_,
+              macro_handle))) {
+    LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(micro_handle), KPC_(index_read_info));
   }
-  if (OB_SUCC(ret)) {
-    if (is_data) {
-      EVENT_INC(ObStatEventIds::DATA_BLOCK_READ_CNT);
-    } else {
-      EVENT_INC(ObStatEventIds::INDEX_BLOCK_READ_CNT);
+  if (OB_SUCC(ret) && ObSSTableMicroBlockState::UNKNOWN_STATE == micro_handle.block_state_) {
+    micro_handle.tenant_id_ = tenant_id;
+    micro_handle.macro_block_id_ = macro_id;
+    micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+    micro_handle.io_handle_ = macro_handle;
+
+    if (is_data && OB_FAIL(micro_block_handle_mgr_.put_micro_block_handle(
+                tenant_id,
+                macro_id,
+                *index_block_info.row_header_,
+                micro_handle))) {
+      STORAGE_LOG(WARN, "failed to put handle cache", K(ret), K(tenant_id), K(macro_id), K(index_block_info));
     }
   }
   return ret;
@@ -401,6 +427,8 @@ void ObIndexTreeMultiPrefetcher::reset()
   prefetched_rowkey_cnt_ = 0;
   rowkeys_ = nullptr;
   ext_read_handles_.reset();
+  pending_data_ios_.reset();
+  coalesce_infos_.reset();
   ObIndexTreePrefetcher::reset();
 }
 
@@ -410,6 +438,8 @@ void ObIndexTreeMultiPrefetcher::reuse()
   prefetch_rowkey_idx_ = 0;
   prefetched_rowkey_cnt_ = 0;
   rowkeys_ = nullptr;
+  pending_data_ios_.reuse();
+  coalesce_infos_.reuse();
   ObIndexTreePrefetcher::reuse();
 }
 
@@ -579,6 +609,13 @@ int ObIndexTreeMultiPrefetcher::multi_prefetch()
         }
       }
     }
+    if (OB_SUCC(ret)) {
+      if (OB_FAIL(submit_pending_data_io())) {
+        LOG_WARN("Fail to submit pending data io", K(ret), KPC(this));
+      }
+    } else {
+      pending_data_ios_.reuse();
+    }
   }
   return ret;
 }
@@ -617,7 +654,9 @@ int ObIndexTreeMultiPrefetcher::drill_down(
   } else {
     // hold block cache of the parent temporaliy to avoid freed
     ObMicroBlockDataHandle &next_handle = read_handle.get_read_handle();
-    if (OB_FAIL(prefetch_block_data(index_block_info, next_handle, cur_level_is_leaf))) {
+    if (OB_FAIL(cur_level_is_leaf
+                ? prefetch_data_block_deferred(index_block_info, next_handle)
+                : prefetch_block_data(index_block_info, next_handle, false))) {
       LOG_WARN("fail to prefetch_block_data", K(ret), K(read_handle), K(index_block_info), K(cur_level_is_leaf));
     } else if (FALSE_IT(read_handle.set_cur_micro_handle(next_handle))) {
     } else if (cur_level_is_leaf) {
@@ -652,6 +691,148 @@ int ObIndexTreeMultiPrefetcher::drill_down(
   return ret;
 }
 
+int ObIndexTreeMultiPrefetcher::prefetch_data_block_deferred(
+    ObMicroIndexInfo &index_block_info,
+    ObMicroBlockDataHandle &micro_handle)
+{
+  int ret = OB_SUCCESS;
+  bool need_submit_io = false;
+  if (OB_FAIL(lookup_block_data(index_block_info, micro_handle, true, need_submit_io))) {
+    LOG_WARN("Fail to lookup data block", K(ret), K(index_block_info));
+  } else if (need_submit_io) {
+    ObPendingDataIO pending_io;
+    pending_io.index_block_info_ = index_block_info;
+    pending_io.index_block_info_.row_header_ = nullptr;
+    pending_io.index_block_info_.minor_meta_info_ = nullptr;
+    pending_io.index_block_info_.endkey_ = nullptr;
+    pending_io.index_block_info_.agg_row_buf_ = nullptr;
+    pending_io.index_block_info_.agg_buf_size_ = 0;
+    pending_io.row_header_ = *index_block_info.row_header_;
+    pending_io.micro_handle_ = &micro_handle;
+    if (OB_FAIL(pending_data_ios_.push_back(pending_io))) {
+      LOG_WARN("Fail to push back pending data io", K(ret), K(pending_io));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    EVENT_INC(ObStatEventIds::DATA_BLOCK_READ_CNT);
+  }
+  return ret;
+}
+
+bool ObIndexTreeMultiPrefetcher::can_coalesce(
+    const ObMicroIndexInfo &first_info,
+    const ObMicroIndexInfo &prev_info,
+    const ObMicroIndexInfo &next_info)
+{
+  const int64_t prev_end = prev_info.get_block_offset() + prev_info.get_block_size();
+  const int64_t next_end = next_info.get_block_offset() + next_info.get_block_size();
+  const ObIndexBlockRowHeader *first_header = first_info.row_header_;
+  const ObIndexBlockRowHeader *next_header = next_info.row_header_;
+  return first_info.parent_macro_id_ == next_info.parent_macro_id_
+      && next_info.get_block_offset() >= prev_end
+      && next_info.get_block_offset() - prev_end <= MAX_COALESCE_GAP_SIZE
+      && next_end - first_info.get_block_offset() <= MAX_COALESCE_IO_SIZE
+      && first_header->get_row_store_type() == next_header->get_row_store_type()
+      && first_header->get_compressor_type() == next_header->get_compressor_type()
+      && first_header->get_encrypt_id() == next_header->get_encrypt_id()
+      && first_header->get_master_key_id() == next_header->get_master_key_id();
+}
+
+// Sort the data blocks missed in current prefetch window by position, blocks of
+// one macro block close to each other are read by one io and decoded in the io
+// callback, others fall back to single block io.
+int ObIndexTreeMultiPrefetcher::submit_pending_data_io()
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = MTL_ID();
+  const ObTableReadInfo *data_read_info = iter_param_->get_full_read_info();
+  if (pending_data_ios_.empty()) {
+  } else if (OB_ISNULL(data_read_info)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null full_col_descs", K(ret), KPC_(iter_param));
+  } else {
+    std::sort(pending_data_ios_.begin(), pending_data_ios_.end());
+    coalesce_infos_.reuse();
+    for (int64_t i = 0; OB_SUCC(ret) && i < pending_data_ios_.count(); ++i) {
+      ObPendingDataIO &pending_io = pending_data_ios_.at(i);
+      // pending_data_ios_ is not changed until all ios are submitted
+      pending_io.index_block_info_.row_header_ = &pending_io.row_header_;
+      if (0 == i || pending_data_ios_.at(i - 1) < pending_io) {
+        if (OB_FAIL(coalesce_infos_.push_back(pending_io.index_block_info_))) {
+          LOG_WARN("Fail to push back micro index info", K(ret), K(pending_io));
+        }
+      }
+      pending_io.block_idx_ = coalesce_infos_.count() - 1;
+    }
+
+    int64_t pending_idx = 0;
+    int64_t start_idx = 0;
+    while (OB_SUCC(ret) && start_idx < coalesce_infos_.count()) {
+      ObMicroIndexInfo &first_info = coalesce_infos_.at(start_idx);
+      const MacroBlockId &macro_id = first_info.get_macro_id();
+      ObMacroBlockHandle macro_handle;
+      int64_t end_idx = start_idx + 1;
+      while (end_idx < coalesce_infos_.count()
+             && can_coalesce(first_info, coalesce_infos_.at(end_idx - 1), coalesce_infos_.at(end_idx))) {
+        ++end_idx;
+      }
+      const bool is_multi_block_io = end_idx - start_idx > 1;
+      if (!is_multi_block_io) {
+        if (OB_FAIL(data_block_cache_->prefetch(
+                    tenant_id,
+                    macro_id,
+                    first_info,
+                    access_ctx_->query_flag_,
+                    *data_read_info,
+                    iter_param_->tablet_handle_,
+                    macro_handle))) {
+          LOG_WARN("Fail to prefetch micro block", K(ret), K(first_info), K(macro_handle));
+        }
+      } else {
+        ObMultiBlockIOParam io_param;
+        io_param.micro_index_infos_ = &coalesce_infos_;
+        io_param.start_index_ = start_idx;
+        io_param.block_count_ = end_idx - start_idx;
+        if (OB_FAIL(data_block_cache_->prefetch(
+                    tenant_id,
+                    macro_id,
+                    io_param,
+                    access_ctx_->query_flag_,
+                    *data_read_info,
+                    iter_param_->tablet_handle_,
+                    macro_handle))) {
+          LOG_WARN("Fail to prefetch multi micro blocks", K(ret), K(io_param), K(macro_handle));
+        }
+      }
+      for (; OB_SUCC(ret) && pending_idx < pending_data_ios_.count()
+             && pending_data_ios_.at(pending_idx).block_idx_ < end_idx; ++pending_idx) {
+        ObPendingDataIO &pending_io = pending_data_ios_.at(pending_idx);
+        ObMicroBlockDataHandle &micro_handle = *pending_io.micro_handle_;
+        const bool is_first_of_block = 0 == pending_idx
+            || pending_data_ios_.at(pending_idx - 1).block_idx_ != pending_io.block_idx_;
+        if (ObSSTableMicroBlockState::UNKNOWN_STATE == micro_handle.block_state_) {
+          micro_handle.tenant_id_ = tenant_id;
+          micro_handle.macro_block_id_ = macro_id;
+          micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+          micro_handle.io_handle_ = macro_handle;
+          micro_handle.block_index_ = is_multi_block_io
+              ? static_cast<int32_t>(pending_io.block_idx_ - start_idx) : -1;
+          if (is_first_of_block && OB_FAIL(micro_block_handle_mgr_.put_micro_block_handle(
+                      tenant_id,
+                      macro_id,
+                      pending_io.row_header_,
+                      micro_handle))) {
+            LOG_WARN("failed to put handle cache", K(ret), K(tenant_id), K(macro_id), K(pending_io));
+          }
+        }
+      }
+      start_idx = end_idx;
+    }
+  }
+  pending_data_ios_.reuse();
+  return ret;
+}
+
 ////////////////////////////////// MultiPassPrefetcher /////////////////////////////////////////////
 
 template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
@@ -675,6 +856,7 @@ void ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::
   micro_data_prefetch_idx_ = 0;
   row_lock_check_version_ = transaction::ObTransVersion::INVALID_TRANS_VERSION;
   agg_row_store_ = nullptr;
+  block_row_store_ = nullptr;
   max_micro_handle_cnt_ = 0;
   iter_type_ = 0;
   cur_level_ = 0;
@@ -701,6 +883,7 @@ void ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::
   micro_data_prefetch_idx_ = 0;
   row_lock_check_version_ = transaction::ObTransVersion::INVALID_TRANS_VERSION;
   agg_row_store_ = nullptr;
+  block_row_store_ = nullptr;
   prefetch_depth_ = 1;
   total_micro_data_cnt_ = 0;
   for (int64_t i = 0; i < tree_handles_.count(); i++) {
@@ -1040,6 +1223,8 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
               LOG_DEBUG("Success to agg index info", K(ret), KPC(agg_row_store_));
               continue;
             }
+          } else if (can_skip_by_skip_index(block_info)) {
+            continue;
           } else if (OB_FAIL(check_row_lock(block_info, is_row_lock_checked_))) {
             if (OB_UNLIKELY(OB_ITER_END != ret)) {
               LOG_WARN("Fail to check row lock", K(ret), K(block_info), KPC(this));
@@ -1415,6 +1600,37 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::c
   return ret;
 }
 
+template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
+bool ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::can_skip_by_skip_index(
+    const blocksstable::ObMicroIndexInfo &index_info)
+{
+  int ret = OB_SUCCESS;
+  bool can_skip = false;
+  const sql::ObPushdownFilterExecutor *filter = nullptr;
+  const ObTableReadInfo *read_info = nullptr;
+  if (nullptr == block_row_store_ || block_row_store_->is_disabled() || !index_info.has_agg_data()) {
+  } else if (nullptr == (filter = block_row_store_->get_pd_filter())) {
+  } else if (!index_info.can_blockscan(iter_param_->has_lob_column_out())) {
+    // filter is only applied by storage for blocks can be scanned entirely
+  } else if (OB_ISNULL(read_info = iter_param_->get_read_info())) {
+  } else {
+    ObAggRowReader agg_row_reader;
+    if (OB_FAIL(agg_row_reader.init(index_info.agg_row_buf_, index_info.agg_buf_size_))) {
+      LOG_WARN("Fail to init agg row reader", K(ret), K(index_info));
+    } else if (OB_FAIL(ObSkipIndexFilterChecker::check_always_false(
+                *filter, *read_info, agg_row_reader, can_skip))) {
+      LOG_WARN("Fail to check filter by skip index", K(ret), K(index_info), K(agg_row_reader));
+    } else if (can_skip) {
+      LOG_DEBUG("[SKIP INDEX] skip block by pushdown filter", K(index_info), K(agg_row_reader));
+    }
+    if (OB_FAIL(ret)) {
+      // skip index is only an optimization, read the block as usual
+      can_skip = false;
+    }
+  }
+  return can_skip;
+}
+
 //////////////////////////////////////// ObIndexTreeLevelHandle //////////////////////////////////////////////
 
 template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
@@ -1463,6 +1679,7 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::O
         } else {
           LOG_DEBUG("Success to agg index info", K(ret), K(index_info));
         }
+      } else if (prefetcher.can_skip_by_skip_index(index_info)) {
       } else if (OB_FAIL(prefetcher.check_row_lock(index_info, is_row_lock_checked_))) {
         if (OB_UNLIKELY(OB_ITER_END != ret)) {
           LOG_WARN("Fail to check row lock", K(ret), KPC(this));
@@ -28,6 +28,7 @@ namespace oceanbase {
 using namespace blocksstable;
 namespace storage {
 class ObAggregatedStore;
+class ObBlockRowStore;
 
 struct ObSSTableRowState {
   enum ObSSTableRowStateEnum {
@@ -164,6 +165,16 @@ protected:
       ObMicroIndexInfo &index_block_info,
       ObMicroBlockDataHandle &micro_handle,
       const bool is_data = true);
+  // lookup micro block in handle cache and block cache, need_submit_io is set on cache miss
+  int lookup_block_data(
+      ObMicroIndexInfo &index_block_info,
+      ObMicroBlockDataHandle &micro_handle,
+      const bool is_data,
+      bool &need_submit_io);
+  int submit_block_io(
+      ObMicroIndexInfo &index_block_info,
+      ObMicroBlockDataHandle &micro_handle,
+      const bool is_data);
   int lookup_in_cache(ObSSTableReadHandle &read_handle);
 private:
   int lookup_in_index_tree(ObSSTableReadHandle &read_handle);
@@ -248,6 +259,33 @@ public:
     ObMicroBlockDataHandle micro_handles_[DEFAULT_MULTIGET_MICRO_DATA_HANDLE_CNT];
   };
   typedef ObReallocatedFixedArray<ObSSTableReadHandleExt> ReadHandleExtArray;
+  // Data block missed in cache, io is submitted after the whole prefetch window is
+  // drilled down so that adjacent blocks of one macro block can share one io.
+  // The row header of index_block_info_ points into the datum row of index_scanner_,
+  // which is reused by the next drill down, so it is copied into row_header_ at
+  // lookup time and only pointed back when the io is submitted.
+  struct ObPendingDataIO
+  {
+    ObPendingDataIO() : index_block_info_(), row_header_(), micro_handle_(nullptr), block_idx_(-1) {}
+    OB_INLINE uint64_t get_block_offset() const
+    {
+      return row_header_.get_block_offset() + index_block_info_.nested_offset_;
+    }
+    bool operator<(const ObPendingDataIO &other) const
+    {
+      return index_block_info_.parent_macro_id_ == other.index_block_info_.parent_macro_id_
+          ? get_block_offset() < other.get_block_offset()
+          : index_block_info_.parent_macro_id_ < other.index_block_info_.parent_macro_id_;
+    }
+    TO_STRING_KV(K_(index_block_info), K_(row_header), KPC_(micro_handle), K_(block_idx));
+    ObMicroIndexInfo index_block_info_;
+    ObIndexBlockRowHeader row_header_;
+    ObMicroBlockDataHandle *micro_handle_;
+    // index of the distinct micro block in coalesce_infos_
+    int64_t block_idx_;
+  };
+  static const int64_t MAX_COALESCE_GAP_SIZE = 32 << 10; // 32KB
+  static const int64_t MAX_COALESCE_IO_SIZE = 1 << 20; // 1MB
   ObIndexTreeMultiPrefetcher() :
       index_tree_height_(0),
       fetch_rowkey_idx_(0),
@@ -255,7 +293,9 @@ public:
       prefetched_rowkey_cnt_(0),
       max_handle_prefetching_cnt_(0),
       rowkeys_(nullptr),
-      ext_read_handles_()
+      ext_read_handles_(),
+      pending_data_ios_(),
+      coalesce_infos_()
   {}
   virtual ~ObIndexTreeMultiPrefetcher() { reset(); }
   virtual void reset() override;
@@ -302,6 +342,16 @@ private:
       ObSSTableReadHandleExt &read_handle,
       const bool cur_level_is_leaf,
       const bool force_prefetch);
+  int prefetch_data_block_deferred(
+      ObMicroIndexInfo &index_block_info,
+      ObMicroBlockDataHandle &micro_handle);
+  int submit_pending_data_io();
+  static bool can_coalesce(
+      const ObMicroIndexInfo &first_info,
+      const ObMicroIndexInfo &prev_info,
+      const ObMicroIndexInfo &next_info);
+  common::ObSEArray<ObPendingDataIO, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT> pending_data_ios_;
+  common::ObSEArray<ObMicroIndexInfo, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT> coalesce_infos_;
 };
 
 template <int32_t DATA_PREFETCH_DEPTH = 32, int32_t INDEX_PREFETCH_DEPTH = 3>
@@ -317,6 +367,7 @@ public:
       micro_data_prefetch_idx_(0),
       row_lock_check_version_(transaction::ObTransVersion::INVALID_TRANS_VERSION),
       agg_row_store_(nullptr),
+      block_row_store_(nullptr),
       can_blockscan_(false),
       need_check_prefetch_depth_(false),
       iter_type_(0),
@@ -374,6 +425,7 @@ public:
   int check_row_lock(
       const blocksstable::ObMicroIndexInfo &index_info,
       bool &is_prefetch_end);
+  bool can_skip_by_skip_index(const blocksstable::ObMicroIndexInfo &index_info);
   INHERIT_TO_STRING_KV("ObIndexTreeMultiPassPrefetcher", ObIndexTreePrefetcher,
                        K_(is_prefetch_end), K_(cur_range_fetch_idx), K_(cur_range_prefetch_idx), K_(max_range_prefetching_cnt),
                        K_(cur_micro_data_fetch_idx), K_(micro_data_prefetch_idx), K_(max_micro_handle_cnt),
@@ -567,6 +619,8 @@ public:
   int64_t micro_data_prefetch_idx_;
   int64_t row_lock_check_version_;
   ObAggregatedStore *agg_row_store_;
+  // set when pushdown filter can be applied on the sstable, used to skip blocks by skip index
+  ObBlockRowStore *block_row_store_;
 private:
   bool can_blockscan_;
   bool need_check_prefetch_depth_;
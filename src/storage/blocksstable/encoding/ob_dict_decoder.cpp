@@ -189,6 +189,34 @@ bool init_dict_cmp_ref_funcs()
 
 bool dict_cmp_ref_funcs_inited = init_dict_cmp_ref_funcs();
 
+ObMultiDimArray_T<dict_gather_ref_func, 3> dict_gather_ref_funcs;
+
+bool init_dict_gather_ref_simd_funcs();
+
+template <int32_t REF_LEN>
+struct DictGatherRefArrayInit
+{
+  bool operator()()
+  {
+    dict_gather_ref_funcs[REF_LEN] = &(DictGatherRefFunc_T<REF_LEN>::dict_gather_ref_func);
+    return true;
+  }
+};
+
+bool init_dict_gather_ref_funcs()
+{
+  bool res = false;
+  res = ObNDArrayIniter<DictGatherRefArrayInit, 3>::apply();
+#if defined ( __x86_64__ )
+  if (is_avx512_valid()) {
+    res = init_dict_gather_ref_simd_funcs();
+  }
+#endif
+  return res;
+}
+
+bool dict_gather_ref_funcs_inited = init_dict_gather_ref_funcs();
+
 int ObDictDecoder::init(const common::ObObjType &store_obj_type, const char *meta_header)
 {
   int ret = OB_SUCCESS;
@@ -539,6 +567,95 @@ int ObDictDecoder::batch_decode_dict(
   return ret;
 }
 
+int ObDictDecoder::batch_decode_distinct(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    int64_t *ref_cnts,
+    int64_t &distinct_cnt) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    // Batch read ref to datum.pack_
+    const unsigned char *col_data = reinterpret_cast<unsigned char *>(
+        const_cast<ObDictMetaHeader *>(meta_header_)) + ctx.col_header_->length_;
+    const uint8_t row_ref_size = meta_header_->row_ref_size_;
+    int64_t row_id = 0;
+    if (ctx.is_bit_packing()) {
+      if (OB_FAIL(batch_get_bitpacked_refs(row_ids, row_cap, col_data, datums))) {
+        LOG_WARN("Failed to batch unpack bitpacked value", K(ret));
+      }
+    } else {
+      for (int64_t i = 0; i < row_cap; ++i) {
+        row_id = row_ids[i];
+        datums[i].pack_ = 0;
+        MEMCPY(&datums[i].pack_, col_data + row_id * row_ref_size, row_ref_size);
+      }
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(batch_decode_distinct_dict(
+        ctx.col_header_->get_store_obj_type(),
+        cell_datas,
+        row_cap,
+        ctx.col_header_->length_,
+        datums,
+        ref_cnts,
+        distinct_cnt))) {
+      LOG_WARN("Failed to batch decode distinct references from dict", K(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+// Internal call, not check parameters for performance
+int ObDictDecoder::batch_decode_distinct_dict(
+    const common::ObObjType &obj_type,
+    const char **cell_datas,
+    const int64_t row_cap,
+    const int64_t meta_length,
+    common::ObDatum *datums,
+    int64_t *ref_cnts,
+    int64_t &distinct_cnt) const
+{
+  int ret = OB_SUCCESS;
+  distinct_cnt = 0;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    // all references not less than dict count stand for null, count them in the last slot
+    const int64_t count = meta_header_->count_;
+    MEMSET(ref_cnts, 0, sizeof(int64_t) * (count + 1));
+    for (int64_t i = 0; i < row_cap; ++i) {
+      const uint32_t ref = datums[i].pack_;
+      ++ref_cnts[ref < count ? ref : count];
+    }
+    // compact referenced entries to the front, the slot written is never read again
+    for (int64_t ref = 0; ref <= count; ++ref) {
+      if (0 < ref_cnts[ref]) {
+        ref_cnts[distinct_cnt] = ref_cnts[ref];
+        datums[distinct_cnt].pack_ = static_cast<uint32_t>(ref);
+        ++distinct_cnt;
+      }
+    }
+    if (0 == count) {
+      // all null
+      for (int64_t i = 0; i < distinct_cnt; ++i) {
+        datums[i].set_null();
+      }
+    } else if (OB_FAIL(batch_decode_dict(obj_type, cell_datas, distinct_cnt, meta_length, datums))) {
+      LOG_WARN("Failed to batch decode distinct references from dict", K(ret), K(distinct_cnt));
+    }
+  }
+  return ret;
+}
+
 bool ObDictDecoder::fast_decode_valid(const ObColumnDecoderCtx &ctx) const
 {
   bool valid = false;
@@ -710,14 +827,17 @@ int ObDictDecoder::nu_nn_operator(
         }
       }
     } else {
-      if (OB_FAIL(cmp_ref_and_set_res(parent, col_ctx, count, col_data,
-                                      FP_INT_OP_EQ, true, result_bitmap))) {
-        LOG_WARN("Failed to compare reference and set result bitmap ",
-            K(ret), K(count), K(filter));
-      } else if (sql::WHITE_OP_NN == filter.get_op_type()) {
-        if (OB_FAIL(result_bitmap.bit_not())) {
-          LOG_WARN("Failed to bitwise not on result_bitmap", K(ret));
-        }
+      const int64_t ref_bitset_size = count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      if (sql::WHITE_OP_NU == filter.get_op_type()) {
+        ref_bitset->set(count);
+      } else {
+        ref_bitset->set_all(count);
+      }
+      if (OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(count), K(filter));
       }
     }
   }
@@ -766,20 +886,21 @@ int ObDictDecoder::eq_ne_operator(
         break;
       }
     }
-    // TODO: @saitong.zst
-    // SIMD optimize on sorted dictionary with only one element found
-    if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
-      LOG_WARN("Failed to set result bitmap", K(ret));
-    }
-    if (OB_SUCC(ret) && op_type == sql::WHITE_OP_NE) {
-      if (OB_FAIL(result_bitmap.bit_not())) {
-        LOG_WARN("Failed to bitwise not on result_bitmap", K(ret));
-      } else if (OB_FAIL(cmp_ref_and_set_res(parent, col_ctx, meta_header_->count_, col_data,
-                                             FP_INT_OP_EQ, false, result_bitmap))) {
-        LOG_WARN("Failed to compare reference and set result bitmap to false",
-                 K(ret), K(meta_header_->count_), K(op_type));
+    if (op_type == sql::WHITE_OP_NE) {
+      // flip on dictionary entries instead of rows, null slot is left unset
+      found = false;
+      for (int64_t ref = 0; ref < meta_header_->count_; ++ref) {
+        if (ref_bitset->at(ref)) {
+          ref_bitset->unset(ref);
+        } else {
+          ref_bitset->set(ref);
+          found = true;
+        }
       }
     }
+    if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+      LOG_WARN("Failed to set result bitmap", K(ret), K(op_type));
+    }
   }
   return ret;
 }
@@ -941,20 +1062,17 @@ int ObDictDecoder::bt_operator(
         loc = std::upper_bound(begin_it, end_it, objs.at(1));
         int64_t right_bound_exclusive_ref = loc - begin_it;
 
-        int64_t ref = 0;
-        for (int64_t row_id = 0;
-             OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-             ++row_id) {
-          if (nullptr != parent && parent->can_skip_filter(row_id)) {
-            continue;
-          } else if (OB_FAIL(read_ref(row_id, col_ctx.is_bit_packing(), col_data, ref))) {
-            LOG_WARN("Failed to read reference for dictionary", K(ret), K(col_data), K(row_id));
-          } else {
-            if (left_bound_inclusive_ref <= ref && right_bound_exclusive_ref > ref && ref < count) {
-              if (OB_FAIL(result_bitmap.set(row_id))) {
-                LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
-              }
-            }
+        if (left_bound_inclusive_ref < right_bound_exclusive_ref) {
+          const int64_t ref_bitset_size = count + 1;
+          char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+          sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+          ref_bitset->init(ref_bitset_size);
+          for (int64_t ref = left_bound_inclusive_ref; ref < right_bound_exclusive_ref; ++ref) {
+            ref_bitset->set(ref);
+          }
+          if (OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+            LOG_WARN("Failed to set result bitmap", K(ret), K(left_bound_inclusive_ref),
+                K(right_bound_exclusive_ref), K(filter));
           }
         }
       } else {
@@ -1159,6 +1277,10 @@ int ObDictDecoder::set_res_with_bitset(
   if (OB_ISNULL(col_data)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid Argument", K(ret));
+  } else if (fast_gather_valid(col_ctx)) {
+    if (OB_FAIL(fast_set_res_with_bitset(col_ctx, col_data, ref_bitset, result_bitmap))) {
+      LOG_WARN("Failed to fast set result bitmap", K(ret));
+    }
   } else {
     int64_t ref = 0;
     for (int64_t row_id = 0;
@@ -1169,7 +1291,7 @@ int ObDictDecoder::set_res_with_bitset(
       } else if (OB_FAIL(read_ref(row_id, col_ctx.is_bit_packing(), col_data, ref))) {
         LOG_WARN("Failed to read reference for dictionary", K(ret), K(col_data), K(row_id));
       } else {
-        if (ref_bitset->exist(ref)) {
+        if (ref_bitset->exist(MIN(ref, static_cast<int64_t>(meta_header_->count_)))) {
           if (OB_FAIL(result_bitmap.set(row_id))) {
             LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(ref));
           }
@@ -1180,6 +1302,35 @@ int ObDictDecoder::set_res_with_bitset(
   return ret;
 }
 
+int ObDictDecoder::fast_set_res_with_bitset(
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char *col_data,
+    const sql::ObBitVector *ref_bitset,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(col_data) || OB_ISNULL(ref_bitset) || OB_UNLIKELY(meta_header_->row_ref_size_ > 2)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(col_data), KP(ref_bitset), K(meta_header_->row_ref_size_));
+  } else {
+    int64_t cnt = col_ctx.micro_block_header_->row_count_;
+    int64_t size = sql::ObBitVector::memory_size(cnt);
+    char buf[size];
+    sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+    bit_vec->reset(cnt);
+
+    dict_gather_ref_func func = dict_gather_ref_funcs[meta_header_->row_ref_size_];
+    func(cnt, meta_header_->count_, col_data, *ref_bitset, *bit_vec);
+
+    if (OB_FAIL(result_bitmap.load_blocks_from_array(reinterpret_cast<uint64_t *>(buf), cnt))) {
+      LOG_WARN("Failed to load result bitmap from array", K(ret));
+    }
+    LOG_DEBUG("[PUSHDOWN] fast gather reference and set result bitmap",
+        K(ret), K(result_bitmap.popcnt()), KPC(meta_header_));
+  }
+  return ret;
+}
+
 ObDictDecoderIterator ObDictDecoder::begin(
     const ObColumnDecoderCtx *ctx,
     int64_t meta_length) const
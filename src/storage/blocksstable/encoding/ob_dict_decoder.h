@@ -51,6 +51,15 @@ typedef void (*dict_cmp_ref_func)(
                   const unsigned char *col_data,
                   sql::ObBitVector &result);
 
+// Set result bit of each row whose reference is in @ref_bitset, null references
+// (not less than @dict_cnt) are looked up at the slot of @dict_cnt
+typedef void (*dict_gather_ref_func)(
+                  const int64_t row_cnt,
+                  const int64_t dict_cnt,
+                  const unsigned char *col_data,
+                  const sql::ObBitVector &ref_bitset,
+                  sql::ObBitVector &result);
+
 class ObDictDecoder : public ObIColumnDecoder
 {
 public:
@@ -83,6 +92,21 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const override;
 
+  virtual int64_t get_distinct_count(const ObColumnDecoderCtx &ctx) const override
+  {
+    UNUSED(ctx);
+    return is_inited() ? meta_header_->count_ : -1;
+  }
+
+  virtual int batch_decode_distinct(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      int64_t *ref_cnts,
+      int64_t &distinct_cnt) const override;
+
   virtual int update_pointer(const char *old_block, const char *cur_block) override;
 
   int decode(common::ObObjMeta cell_meta, common::ObObj &cell, const int64_t ref, const int64_t meta_legnth) const;
@@ -94,6 +118,16 @@ public:
       const int64_t meta_length,
       common::ObDatum *datums) const;
 
+  // datums[i].pack_ should stand for the reference to dictionary of row i as input parameter
+  int batch_decode_distinct_dict(
+      const common::ObObjType &obj_type,
+      const char **cell_datas,
+      const int64_t row_cap,
+      const int64_t meta_length,
+      common::ObDatum *datums,
+      int64_t *ref_cnts,
+      int64_t &distinct_cnt) const;
+
   void reset() { this->~ObDictDecoder(); new (this) ObDictDecoder(); }
   OB_INLINE void reuse();
   virtual ObColumnHeader::Type get_type() const override { return type_; }
@@ -188,6 +222,14 @@ private:
       const sql::ObBitVector *ref_bitset,
       ObBitmap &result_bitmap) const;
 
+  int fast_set_res_with_bitset(
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char *col_data,
+      const sql::ObBitVector *ref_bitset,
+      ObBitmap &result_bitmap) const;
+
+  OB_INLINE bool fast_gather_valid(const ObColumnDecoderCtx &col_ctx) const;
+
   OB_INLINE int read_ref(
       const int64_t row_id,
       const bool is_bit_packing,
@@ -429,8 +471,48 @@ struct DictCmpRefFunc_T
   }
 };
 
+template <int32_t REF_LEN>
+struct DictGatherRefFunc_T
+{
+  static void dict_gather_ref_func(
+      const int64_t row_cnt,
+      const int64_t dict_cnt,
+      const unsigned char *col_data,
+      const sql::ObBitVector &ref_bitset,
+      sql::ObBitVector &result)
+  {
+    typedef typename ObEncodingByteLenMap<false, REF_LEN>::Type RefType;
+    const RefType *ref_arr = reinterpret_cast<const RefType *>(col_data);
+    uint64_t *res_arr = result.reinterpret_data<uint64_t>();
+    int64_t row_id = 0;
+    // branchless lookup, 64 rows make up one result word
+    for (int64_t i = 0; i < row_cnt / 64; ++i) {
+      uint64_t res_word = 0;
+      for (int64_t j = 0; j < 64; ++j, ++row_id) {
+        const int64_t ref = MIN(static_cast<int64_t>(ref_arr[row_id]), dict_cnt);
+        res_word |= static_cast<uint64_t>(ref_bitset.at(ref)) << j;
+      }
+      res_arr[i] = res_word;
+    }
+    for (; row_id < row_cnt; ++row_id) {
+      if (ref_bitset.at(MIN(static_cast<int64_t>(ref_arr[row_id]), dict_cnt))) {
+        result.set(row_id);
+      }
+    }
+  }
+};
+
 extern ObMultiDimArray_T<dict_cmp_ref_func, 3, 6> dict_cmp_ref_funcs;
 extern bool dict_cmp_ref_funcs_inited;
+extern ObMultiDimArray_T<dict_gather_ref_func, 3> dict_gather_ref_funcs;
+extern bool dict_gather_ref_funcs_inited;
+
+OB_INLINE bool ObDictDecoder::fast_gather_valid(const ObColumnDecoderCtx &col_ctx) const
+{
+  return !col_ctx.is_bit_packing()
+      && (1 == meta_header_->row_ref_size_ || 2 == meta_header_->row_ref_size_)
+      && dict_gather_ref_funcs_inited;
+}
 
 } // end namespace blocksstable
 } // end namespace oceanbase
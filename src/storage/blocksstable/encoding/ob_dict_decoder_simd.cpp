@@ -149,6 +149,78 @@ struct DictCmpRefAVX512Func_T<2, CMP_TYPE>
 };
 #endif
 
+template <int32_t REF_LEN>
+struct DictGatherRefAVX512Func_T : public DictGatherRefFunc_T<REF_LEN>
+{};
+
+#if defined ( __AVX512BW__ )
+// 1 Byte
+template <>
+struct DictGatherRefAVX512Func_T<1>
+{
+  static void dict_gather_ref_func(
+      const int64_t row_cnt,
+      const int64_t dict_cnt,
+      const unsigned char *col_data,
+      const sql::ObBitVector &ref_bitset,
+      sql::ObBitVector &result)
+  {
+    if (dict_cnt > UINT8_MAX) {
+      DictGatherRefFunc_T<1>::dict_gather_ref_func(row_cnt, dict_cnt, col_data, ref_bitset, result);
+    } else {
+      // Reference bitset has at most 256 bits, lookup byte (ref >> 3) from two 16 bytes tables
+      // and test bit (ref & 7) of it, 64 rows per round
+      uint8_t bitset_bytes[32];
+      MEMSET(bitset_bytes, 0, sizeof(bitset_bytes));
+      MEMCPY(bitset_bytes, ref_bitset.reinterpret_data<uint8_t>(), sql::ObBitVector::byte_count(dict_cnt + 1));
+      const __m512i low_table = _mm512_broadcast_i32x4(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(bitset_bytes)));
+      const __m512i high_table = _mm512_broadcast_i32x4(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(bitset_bytes + 16)));
+      const __m512i bit_table = _mm512_broadcast_i32x4(
+          _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+      const __m512i dict_cnt_vec = _mm512_set1_epi8(static_cast<uint8_t>(dict_cnt));
+      const __m512i byte_idx_mask = _mm512_set1_epi8(0x1F);
+      const __m512i bit_idx_mask = _mm512_set1_epi8(0x07);
+      const __m512i high_table_flag = _mm512_set1_epi8(0x10);
+      uint64_t *res_arr = result.reinterpret_data<uint64_t>();
+      for (int64_t i = 0; i < row_cnt / 64; ++i) {
+        __m512i ref_vec = _mm512_loadu_si512(reinterpret_cast<const void *>(col_data + i * 64));
+        // null references share the slot of dict_cnt
+        ref_vec = _mm512_min_epu8(ref_vec, dict_cnt_vec);
+        const __m512i byte_idx = _mm512_and_si512(_mm512_srli_epi16(ref_vec, 3), byte_idx_mask);
+        const __m512i bit_idx = _mm512_and_si512(ref_vec, bit_idx_mask);
+        const __mmask64 use_high = _mm512_test_epi8_mask(byte_idx, high_table_flag);
+        const __m512i bytes = _mm512_mask_blend_epi8(use_high,
+            _mm512_shuffle_epi8(low_table, byte_idx), _mm512_shuffle_epi8(high_table, byte_idx));
+        res_arr[i] = _mm512_test_epi8_mask(bytes, _mm512_shuffle_epi8(bit_table, bit_idx));
+      }
+      for (int64_t row_id = row_cnt / 64 * 64; row_id < row_cnt; ++row_id) {
+        if (ref_bitset.at(MIN(static_cast<int64_t>(col_data[row_id]), dict_cnt))) {
+          result.set(row_id);
+        }
+      }
+    }
+    LOG_DEBUG("[SIMD filter] fast gather dict ref for 1 byte", K(row_cnt), K(dict_cnt));
+  }
+};
+#endif
+
+template <int32_t REF_LEN>
+struct DictGatherRefAVX512ArrayInit
+{
+  bool operator()()
+  {
+    dict_gather_ref_funcs[REF_LEN]
+        = &(DictGatherRefAVX512Func_T<REF_LEN>::dict_gather_ref_func);
+    return true;
+  }
+};
+
+bool init_dict_gather_ref_simd_funcs()
+{
+  return ObNDArrayIniter<DictGatherRefAVX512ArrayInit, 3>::apply();
+}
 
 template <int32_t REF_LEN, int32_t CMP_TYPE>
 struct DictCmpRefAVX512ArrayInit
@@ -184,6 +184,30 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const;
 
+  // Number of values in dictionary for columns encoded with one, -1 for others
+  virtual int64_t get_distinct_count(const ObColumnDecoderCtx &ctx) const
+  {
+    UNUSED(ctx);
+    return -1;
+  }
+
+  // Decode every distinct value referenced by rows only once into @datums and
+  // the number of rows referencing it into @ref_cnts, null is output as a null datum.
+  // Only for columns encoded with dictionary, @ref_cnts should hold at least
+  // get_distinct_count() + 1 elements.
+  virtual int batch_decode_distinct(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      int64_t *ref_cnts,
+      int64_t &distinct_cnt) const
+  {
+    UNUSEDx(ctx, row_ids, cell_datas, row_cap, datums, ref_cnts, distinct_cnt);
+    return common::OB_NOT_SUPPORTED;
+  }
+
   virtual int get_null_count_from_fixed_column(
       const ObColumnDecoderCtx &ctx,
       const int64_t *row_ids,
@@ -14,6 +14,7 @@
 #include "ob_micro_block_decoder.h"
 #include "share/rc/ob_tenant_base.h"
 #include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_aggregated_store.h"
 
 namespace oceanbase
 {
@@ -238,6 +239,31 @@ int ObColumnDecoder::get_row_count(
   return ret;
 }
 
+int ObColumnDecoder::batch_decode_distinct(
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    int64_t *ref_cnts,
+    int64_t &distinct_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == row_ids
+                  || nullptr == cell_datas
+                  || nullptr == datums
+                  || nullptr == ref_cnts
+                  || 0 >= row_cap
+                  || get_distinct_count() >= row_cap)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument to batch decode distinct", K(ret), KP(row_ids), KP(cell_datas),
+             KP(datums), KP(ref_cnts), K(row_cap), K(get_distinct_count()));
+  } else if (OB_FAIL(decoder_->batch_decode_distinct(
+              *ctx_, row_ids, cell_datas, row_cap, datums, ref_cnts, distinct_cnt))) {
+    LOG_WARN("Failed to batch decode distinct data to datum in column decoder", K(ret), K(*ctx_));
+  }
+  return ret;
+}
+
 // performance critical, do not check parameters
 int ObColumnDecoder::quick_compare(const ObStorageDatum &left, const ObStorageDatumCmpFunc &cmp_func, const int64_t row_id,
     const ObBitStream &bs, const char *data, const int64_t len, int32_t &cmp_ret)
@@ -2109,6 +2135,50 @@ int ObMicroBlockDecoder::get_min_or_max(
   return ret;
 }
 
+int ObMicroBlockDecoder::get_aggregate_result(
+    const int32_t col_id,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    ObDatum *datum_buf,
+    int64_t *ref_cnts,
+    storage::ObAggCell &agg_cell)
+{
+  int ret = OB_SUCCESS;
+  decoder_allocator_.reuse();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(col_id >= header_->column_count_)) {
+    ret = OB_INDEX_OUT_OF_RANGE;
+    LOG_WARN("Vector store col id greate than store cnt", K(ret), K(header_->column_count_), K(col_id));
+  } else {
+    const int64_t distinct_cnt = decoders_[col_id].get_distinct_count();
+    if (nullptr != ref_cnts && 0 <= distinct_cnt && distinct_cnt * 2 < row_cap) {
+      // low cardinality, aggregate on dictionary references
+      int64_t referenced_cnt = 0;
+      if (OB_FAIL(decoders_[col_id].batch_decode_distinct(
+                  row_ids, cell_datas, row_cap, datum_buf, ref_cnts, referenced_cnt))) {
+        LOG_WARN("Failed to batch decode distinct", K(ret), K(col_id), K(row_cap));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < referenced_cnt; ++i) {
+        if (OB_FAIL(agg_cell.eval(datum_buf[i], ref_cnts[i]))) {
+          LOG_WARN("Failed to eval agg cell", K(ret), K(i), K(datum_buf[i]), K(ref_cnts[i]));
+        }
+      }
+    } else if (OB_FAIL(get_col_datums(col_id, row_ids, cell_datas, row_cap, datum_buf))) {
+      LOG_WARN("Failed to get col datums", K(ret), K(col_id), K(row_cap));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+        if (OB_FAIL(agg_cell.eval(datum_buf[i]))) {
+          LOG_WARN("Failed to eval agg cell", K(ret), K(i), K(datum_buf[i]));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObMicroBlockDecoder::get_col_datums(
     int32_t col_id,
     const int64_t *row_ids,
@@ -26,6 +26,7 @@ namespace oceanbase
 {
 namespace storage {
 struct PushdownFilterInfo;
+class ObAggCell;
 }
 namespace blocksstable
 {
@@ -67,6 +68,17 @@ public:
       const bool contains_null,
       int64_t &count);
 
+  OB_INLINE int64_t get_distinct_count() const
+  { return decoder_->get_distinct_count(*ctx_); }
+
+  int batch_decode_distinct(
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      int64_t *ref_cnts,
+      int64_t &distinct_cnt);
+
 public:
   const ObIColumnDecoder *decoder_;
   ObColumnDecoderCtx *ctx_;
@@ -266,6 +278,16 @@ public:
       const int64_t row_cap,
       ObDatum *datum_buf,
       ObMicroBlockAggInfo<ObDatum> &agg_info);
+  // For column encoded with a small dictionary, each distinct value is aggregated only once
+  // with the count of rows referencing it, @ref_cnts should hold @row_cap elements.
+  int get_aggregate_result(
+      const int32_t col_id,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      ObDatum *datum_buf,
+      int64_t *ref_cnts,
+      storage::ObAggCell &agg_cell);
   virtual int64_t get_column_count() const override
   {
     OB_ASSERT(nullptr != header_);
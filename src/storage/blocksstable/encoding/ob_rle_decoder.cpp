@@ -23,6 +23,27 @@ namespace blocksstable
 {
 using namespace common;
 const ObColumnHeader::Type ObRLEDecoder::type_;
+
+// set bits in [start, end) of word array
+static OB_INLINE void set_bit_range(uint64_t *words, const int64_t start, const int64_t end)
+{
+  if (start < end) {
+    const int64_t start_word = start / 64;
+    const int64_t end_word = (end - 1) / 64;
+    const uint64_t start_mask = UINT64_MAX << (start % 64);
+    const uint64_t end_mask = UINT64_MAX >> (63 - (end - 1) % 64);
+    if (start_word == end_word) {
+      words[start_word] |= start_mask & end_mask;
+    } else {
+      words[start_word] |= start_mask;
+      for (int64_t i = start_word + 1; i < end_word; ++i) {
+        words[i] = UINT64_MAX;
+      }
+      words[end_word] |= end_mask;
+    }
+  }
+}
+
 int ObRLEDecoder::decode(ObColumnDecoderCtx &ctx, ObObj &cell, const int64_t row_id,
     const ObBitStream &bs,
     const char *data, const int64_t len) const
@@ -101,6 +122,35 @@ int ObRLEDecoder::batch_decode(
   return ret;
 }
 
+int ObRLEDecoder::batch_decode_distinct(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    int64_t *ref_cnts,
+    int64_t &distinct_cnt) const
+{
+  int ret = OB_SUCCESS;
+  int64_t unused_null_cnt = 0;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (OB_FAIL(extract_ref_and_null_count(row_ids, row_cap, datums, unused_null_cnt))) {
+    LOG_WARN("Failed to extract refs",K(ret));
+  } else if (OB_FAIL(dict_decoder_.batch_decode_distinct_dict(
+      ctx.col_header_->get_store_obj_type(),
+      cell_datas,
+      row_cap,
+      ctx.col_header_->length_ - meta_header_->offset_,
+      datums,
+      ref_cnts,
+      distinct_cnt))) {
+    LOG_WARN("Failed to batch decode distinct RLE ref data from dict", K(ret), K(ctx));
+  }
+  return ret;
+}
+
 int ObRLEDecoder::get_null_count(
     const ObColumnDecoderCtx &ctx,
     const ObIRowIndex *row_index,
@@ -203,13 +253,17 @@ int ObRLEDecoder::nu_nn_operator(
         }
       }
     } else {
-      if (OB_FAIL(cmp_ref_and_set_res(parent, col_ctx, dict_count, FP_INT_OP_EQ, true, result_bitmap))) {
-        LOG_WARN("Failed to compare ref table and set result bitmap",
-            K(ret), K(dict_count), K(filter));
-      } else if (sql::WHITE_OP_NN == filter.get_op_type()) {
-        if (OB_FAIL(result_bitmap.bit_not())) {
-          LOG_WARN("Failed to bitwise not on result bitmnap", K(ret));
-        }
+      const int64_t ref_bitset_size = dict_count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      if (sql::WHITE_OP_NU == filter.get_op_type()) {
+        ref_bitset->set(dict_count);
+      } else {
+        ref_bitset->set_all(dict_count);
+      }
+      if (OB_FAIL(set_res_with_bitset(parent, col_ctx, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(dict_count), K(filter));
       }
     }
   }
@@ -234,27 +288,26 @@ int ObRLEDecoder::eq_ne_operator(
     const int64_t dict_meta_length = col_ctx.col_header_->length_ - meta_header_->offset_;
     const ObObj &ref_obj = filter.get_objs().at(0);
     if (dict_count > 0) {
+      // evaluate once per dictionary entry, then once per run
+      const bool is_ne = filter.get_op_type() == sql::WHITE_OP_NE;
+      bool found = false;
       ObDictDecoderIterator traverse_it = dict_decoder_.begin(&col_ctx, dict_meta_length);
       ObDictDecoderIterator end_it = dict_decoder_.end(&col_ctx, dict_meta_length);
+      const int64_t ref_bitset_size = dict_count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
       int64_t dict_ref = 0;
-      while (OB_SUCC(ret) && traverse_it != end_it) {
-        if (*traverse_it == ref_obj) {
-          if (OB_FAIL(cmp_ref_and_set_res(parent, col_ctx, dict_ref, FP_INT_OP_EQ, true, result_bitmap))) {
-            LOG_WARN("Failed to compare reference and set result bitmap",
-                K(ret), K(dict_ref), K(filter));
-          }
+      while (traverse_it != end_it) {
+        if ((*traverse_it == ref_obj) != is_ne) {
+          found = true;
+          ref_bitset->set(dict_ref);
         }
         ++traverse_it;
         ++dict_ref;
       }
-    }
-    if (OB_SUCC(ret) && filter.get_op_type() == sql::WHITE_OP_NE) {
-      if (OB_FAIL(result_bitmap.bit_not())) {
-        LOG_WARN("Failed to bitwise not on result bitmap", K(ret));
-      } else if (OB_FAIL(cmp_ref_and_set_res(parent, col_ctx, dict_count,
-                                            FP_INT_OP_EQ, false, result_bitmap))) {
-        LOG_WARN("Failed to compare reference and set result bitmap to false",
-            K(ret), K(dict_count), K(filter));
+      if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(filter));
       }
     }
   }
@@ -394,39 +447,6 @@ int ObRLEDecoder::in_operator(
   return ret;
 }
 
-int ObRLEDecoder::cmp_ref_and_set_res(
-    const sql::ObPushdownFilterExecutor *parent,
-    const ObColumnDecoderCtx &col_ctx,
-    const int64_t dict_ref,
-    const ObFPIntCmpOpType cmp_op,
-    bool flag,
-    ObBitmap &result_bitmap) const
-{
-  UNUSED(parent);
-  int ret = OB_SUCCESS;
-  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
-  const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(meta_header_->ref_byte_);
-  int64_t row_id;
-  int64_t next_row_id;
-  int64_t ref;
-  for (int64_t i = 0; OB_SUCC(ret) && i < meta_header_->count_ ; ++i) {
-    ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
-    if (fp_int_cmp<int64_t>(ref, dict_ref, cmp_op)
-        && OB_LIKELY(ref < dict_decoder_.get_dict_header()->count_ || FP_INT_OP_EQ == cmp_op)) {
-      row_id = row_ids.at_(meta_header_->payload_, i);
-      next_row_id = i != meta_header_->count_ - 1
-                          ? row_ids.at_(meta_header_->payload_, i + 1)
-                          : col_ctx.micro_block_header_->row_count_;
-      for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
-        if (OB_FAIL(result_bitmap.set(idx, flag))) {
-          LOG_WARN("Failed to set result_bitmap", K(ret), K(row_id), K(next_row_id), K(idx));
-        }
-      }
-    }
-  }
-  return ret;
-}
-
 int ObRLEDecoder::set_res_with_bitset(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -437,23 +457,30 @@ int ObRLEDecoder::set_res_with_bitset(
   int ret = OB_SUCCESS;
   const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
   const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(meta_header_->ref_byte_);
+  const int64_t dict_count = dict_decoder_.get_dict_header()->count_;
+  const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+  int64_t size = sql::ObBitVector::memory_size(row_count);
+  char buf[size];
+  sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+  bit_vec->reset(row_count);
+  uint64_t *res_arr = bit_vec->reinterpret_data<uint64_t>();
   int64_t row_id;
   int64_t next_row_id;
   int64_t ref;
-  for (int64_t i = 0; OB_SUCC(ret) && i < meta_header_->count_ ; ++i) {
+  // set whole run by words
+  for (int64_t i = 0; i < meta_header_->count_ ; ++i) {
     ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
-    if (ref_bitset->exist(ref)) {
+    if (ref_bitset->exist(MIN(ref, dict_count))) {
       row_id = row_ids.at_(meta_header_->payload_, i);
       next_row_id = i != meta_header_->count_ - 1
                           ? row_ids.at_(meta_header_->payload_, i + 1)
-                          : col_ctx.micro_block_header_->row_count_;
-      for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
-        if (OB_FAIL(result_bitmap.set(idx))) {
-          LOG_WARN("Failed to set result_bitmap", K(ret), K(row_id), K(next_row_id), K(idx));
-        }
-      }
+                          : row_count;
+      set_bit_range(res_arr, row_id, next_row_id);
     }
   }
+  if (OB_FAIL(result_bitmap.load_blocks_from_array(reinterpret_cast<uint64_t *>(buf), row_count))) {
+    LOG_WARN("Failed to load result bitmap from array", K(ret), K(row_count));
+  }
   return ret;
 }
 
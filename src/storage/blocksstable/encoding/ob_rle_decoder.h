@@ -61,6 +61,21 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const override;
 
+  virtual int64_t get_distinct_count(const ObColumnDecoderCtx &ctx) const override
+  {
+    UNUSED(ctx);
+    return is_inited() ? dict_decoder_.get_dict_header()->count_ : -1;
+  }
+
+  virtual int batch_decode_distinct(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      int64_t *ref_cnts,
+      int64_t &distinct_cnt) const override;
+
   virtual int update_pointer(const char *old_block, const char *cur_block) override;
 
   void reset() { this->~ObRLEDecoder(); new (this) ObRLEDecoder(); }
@@ -108,14 +123,6 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
-  int cmp_ref_and_set_res(
-      const sql::ObPushdownFilterExecutor *parent,
-      const ObColumnDecoderCtx &col_ctx,
-      const int64_t dict_ref,
-      const ObFPIntCmpOpType cmp_op,
-      bool flag,
-      ObBitmap &result_bitmap) const;
-
   int set_res_with_bitset(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
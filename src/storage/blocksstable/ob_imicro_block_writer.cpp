@@ -42,6 +42,8 @@ void ObMicroBlockDesc::reset()
   macro_id_.reset();
   block_offset_ = 0;
   block_checksum_ = 0;
+  agg_row_buf_ = NULL;
+  agg_row_len_ = 0;
   row_count_delta_ = 0;
   contain_uncommitted_row_ = false;
   can_mark_deletion_ = false;
@@ -42,6 +42,8 @@ struct ObMicroBlockDesc
   MacroBlockId macro_id_;
   int64_t block_offset_;
   int64_t block_checksum_;
+  const char *agg_row_buf_; // skip index of this micro block, null if not built
+  int64_t agg_row_len_;
   int32_t row_count_delta_;
   bool contain_uncommitted_row_;
   bool can_mark_deletion_;
@@ -66,6 +68,8 @@ struct ObMicroBlockDesc
       K_(macro_id),
       K_(block_offset),
       K_(block_checksum),
+      KP_(agg_row_buf),
+      K_(agg_row_len),
       K_(row_count_delta),
       K_(contain_uncommitted_row),
       K_(can_mark_deletion),
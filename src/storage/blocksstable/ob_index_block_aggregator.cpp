@@ -0,0 +1,769 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_index_block_aggregator.h"
+#include "lib/utility/serialization.h"
+#include "common/object/ob_obj_compare.h"
+#include "sql/engine/expr/ob_expr.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+#include "storage/access/ob_table_read_info.h"
+#include "ob_macro_block.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+namespace blocksstable
+{
+
+/**
+ * -------------------------------------------------------------------ObAggRowReader-------------------------------------------------------------------
+ */
+ObAggRowReader::ObAggRowReader()
+  : buf_(nullptr), buf_size_(0), col_cnt_(0), row_count_(0), col_start_pos_(0), is_inited_(false)
+{
+}
+
+void ObAggRowReader::reset()
+{
+  buf_ = nullptr;
+  buf_size_ = 0;
+  col_cnt_ = 0;
+  row_count_ = 0;
+  col_start_pos_ = 0;
+  is_inited_ = false;
+}
+
+int ObAggRowReader::init(const char *buf, const int64_t buf_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  int8_t version = 0;
+  reset();
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument to init agg row reader", K(ret), KP(buf), K(buf_size));
+  } else if (OB_FAIL(serialization::decode_i8(buf, buf_size, pos, &version))) {
+    LOG_WARN("Fail to decode agg row version", K(ret));
+  } else if (OB_UNLIKELY(ObSkipIndexAggregator::AGG_ROW_VERSION != version)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Unsupported agg row version", K(ret), K(version));
+  } else if (OB_FAIL(serialization::decode_vi64(buf, buf_size, pos, &col_cnt_))) {
+    LOG_WARN("Fail to decode agg row column count", K(ret));
+  } else if (OB_FAIL(serialization::decode_vi64(buf, buf_size, pos, &row_count_))) {
+    LOG_WARN("Fail to decode agg row row count", K(ret));
+  } else if (OB_UNLIKELY(col_cnt_ <= 0 || row_count_ < 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected agg row header", K(ret), K_(col_cnt), K_(row_count));
+  } else {
+    buf_ = buf;
+    buf_size_ = buf_size;
+    col_start_pos_ = pos;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObAggRowReader::read(const int64_t col_idx, ObSkipIndexColAggResult &result) const
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = col_start_pos_;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Agg row reader not inited", K(ret));
+  } else if (OB_UNLIKELY(col_idx < 0 || col_idx >= col_cnt_)) {
+    ret = OB_INDEX_OUT_OF_RANGE;
+    LOG_WARN("Column index out of agg row range", K(ret), K(col_idx), K_(col_cnt));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i <= col_idx; ++i) {
+      if (OB_FAIL(read_column(pos, result))) {
+        LOG_WARN("Fail to read agg column", K(ret), K(i), K(col_idx), KPC(this));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObAggRowReader::read_column(int64_t &pos, ObSkipIndexColAggResult &result) const
+{
+  int ret = OB_SUCCESS;
+  result.reset();
+  if (OB_FAIL(serialization::decode_i8(buf_, buf_size_, pos, &result.flag_))) {
+    LOG_WARN("Fail to decode agg column flag", K(ret));
+  } else if (OB_FAIL(serialization::decode_vi64(buf_, buf_size_, pos, &result.null_count_))) {
+    LOG_WARN("Fail to decode agg column null count", K(ret));
+  } else if (result.has_min_max()) {
+    if (OB_FAIL(deserialize_datum(buf_, buf_size_, pos, result.min_))) {
+      LOG_WARN("Fail to deserialize min datum", K(ret));
+    } else if (OB_FAIL(deserialize_datum(buf_, buf_size_, pos, result.max_))) {
+      LOG_WARN("Fail to deserialize max datum", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && result.has_sum()) {
+    if (OB_FAIL(deserialize_datum(buf_, buf_size_, pos, result.sum_))) {
+      LOG_WARN("Fail to deserialize sum datum", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObAggRowReader::serialize_datum(const ObDatum &datum, char *buf, const int64_t buf_len, int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(serialization::encode_vi64(buf, buf_len, pos, static_cast<int64_t>(datum.pack_)))) {
+    LOG_WARN("Fail to encode datum pack", K(ret), K(datum));
+  } else if (datum.is_null() || 0 == datum.len_) {
+  } else if (OB_UNLIKELY(pos + datum.len_ > buf_len)) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("Buffer not enough for datum", K(ret), K(pos), K(buf_len), K(datum));
+  } else {
+    MEMCPY(buf + pos, datum.ptr_, datum.len_);
+    pos += datum.len_;
+  }
+  return ret;
+}
+
+int ObAggRowReader::deserialize_datum(const char *buf, const int64_t data_len, int64_t &pos, ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  int64_t pack = 0;
+  if (OB_FAIL(serialization::decode_vi64(buf, data_len, pos, &pack))) {
+    LOG_WARN("Fail to decode datum pack", K(ret));
+  } else {
+    datum.pack_ = static_cast<uint32_t>(pack);
+    datum.ptr_ = buf + pos;
+    if (!datum.is_null()) {
+      if (OB_UNLIKELY(pos + datum.len_ > data_len)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Datum out of agg row buffer", K(ret), K(pos), K(data_len), K(pack));
+      } else {
+        pos += datum.len_;
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObAggRowReader::get_datum_serialize_size(const ObDatum &datum)
+{
+  return serialization::encoded_length_vi64(static_cast<int64_t>(datum.pack_))
+      + (datum.is_null() ? 0 : datum.len_);
+}
+
+/**
+ * -------------------------------------------------------------------ObColAggregator-------------------------------------------------------------------
+ */
+ObSkipIndexAggregator::ObColAggregator::ObColAggregator()
+  : cmp_func_(nullptr), type_class_(ObMaxTC), support_min_max_(false), support_sum_(false),
+    has_value_(false), min_max_valid_(false), sum_valid_(false), null_count_(0), min_(), max_(),
+    int_sum_(0)
+{
+  min_.set_null();
+  max_.set_null();
+}
+
+void ObSkipIndexAggregator::ObColAggregator::init(
+    const ObDatumCmpFuncType cmp_func,
+    const ObObjTypeClass type_class,
+    const bool support_min_max)
+{
+  cmp_func_ = cmp_func;
+  type_class_ = type_class;
+  support_min_max_ = support_min_max && nullptr != cmp_func;
+  support_sum_ = ObIntTC == type_class || ObUIntTC == type_class
+      || ObFloatTC == type_class || ObDoubleTC == type_class;
+  reuse();
+}
+
+void ObSkipIndexAggregator::ObColAggregator::reuse()
+{
+  has_value_ = false;
+  min_max_valid_ = support_min_max_;
+  sum_valid_ = support_sum_;
+  null_count_ = 0;
+  min_.set_null();
+  max_.set_null();
+  if (ObFloatTC == type_class_ || ObDoubleTC == type_class_) {
+    double_sum_ = 0;
+  } else {
+    int_sum_ = 0;
+  }
+}
+
+void ObSkipIndexAggregator::ObColAggregator::copy_datum(const ObDatum &src, char *buf, ObDatum &dst)
+{
+  MEMCPY(buf, src.ptr_, src.len_);
+  dst.ptr_ = buf;
+  dst.pack_ = src.pack_;
+}
+
+int ObSkipIndexAggregator::ObColAggregator::update_min_max(const ObDatum &min_datum, const ObDatum &max_datum)
+{
+  int ret = OB_SUCCESS;
+  int cmp_ret = 0;
+  if (OB_UNLIKELY(min_datum.len_ > MAX_AGG_DATUM_LEN || max_datum.len_ > MAX_AGG_DATUM_LEN)) {
+    min_max_valid_ = false;
+  } else if (min_.is_null()) {
+    copy_datum(min_datum, min_buf_, min_);
+    copy_datum(max_datum, max_buf_, max_);
+  } else if (OB_FAIL(cmp_func_(min_datum, min_, cmp_ret))) {
+    LOG_WARN("Fail to compare min datum", K(ret), K(min_datum), K_(min));
+  } else if (cmp_ret < 0 && FALSE_IT(copy_datum(min_datum, min_buf_, min_))) {
+  } else if (OB_FAIL(cmp_func_(max_datum, max_, cmp_ret))) {
+    LOG_WARN("Fail to compare max datum", K(ret), K(max_datum), K_(max));
+  } else if (cmp_ret > 0) {
+    copy_datum(max_datum, max_buf_, max_);
+  }
+  return ret;
+}
+
+void ObSkipIndexAggregator::ObColAggregator::add_sum(const ObDatum &datum)
+{
+  switch (type_class_) {
+    case ObIntTC: {
+      if (__builtin_add_overflow(int_sum_, datum.get_int(), &int_sum_)) {
+        sum_valid_ = false;
+      }
+      break;
+    }
+    case ObUIntTC: {
+      if (__builtin_add_overflow(uint_sum_, datum.get_uint64(), &uint_sum_)) {
+        sum_valid_ = false;
+      }
+      break;
+    }
+    case ObFloatTC: {
+      double_sum_ += datum.get_float();
+      break;
+    }
+    case ObDoubleTC: {
+      double_sum_ += datum.get_double();
+      break;
+    }
+    default: {
+      sum_valid_ = false;
+    }
+  }
+}
+
+void ObSkipIndexAggregator::ObColAggregator::merge_sum(const ObDatum &sum_datum)
+{
+  switch (type_class_) {
+    case ObIntTC: {
+      if (__builtin_add_overflow(int_sum_, sum_datum.get_int(), &int_sum_)) {
+        sum_valid_ = false;
+      }
+      break;
+    }
+    case ObUIntTC: {
+      if (__builtin_add_overflow(uint_sum_, sum_datum.get_uint64(), &uint_sum_)) {
+        sum_valid_ = false;
+      }
+      break;
+    }
+    case ObFloatTC:
+    case ObDoubleTC: {
+      // sum of float column is accumulated as double
+      double_sum_ += sum_datum.get_double();
+      break;
+    }
+    default: {
+      sum_valid_ = false;
+    }
+  }
+}
+
+void ObSkipIndexAggregator::ObColAggregator::build_sum_datum(char *buf, ObDatum &sum_datum) const
+{
+  sum_datum.ptr_ = buf;
+  if (ObIntTC == type_class_) {
+    sum_datum.set_int(int_sum_);
+  } else if (ObUIntTC == type_class_) {
+    sum_datum.set_uint(uint_sum_);
+  } else {
+    sum_datum.set_double(double_sum_);
+  }
+}
+
+int ObSkipIndexAggregator::ObColAggregator::eval(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+    ++null_count_;
+  } else if (OB_UNLIKELY(datum.is_ext() || datum.is_outrow())) {
+    invalidate();
+    has_value_ = true;
+  } else {
+    has_value_ = true;
+    if (min_max_valid_ && OB_FAIL(update_min_max(datum, datum))) {
+      LOG_WARN("Fail to update min max", K(ret), K(datum));
+    } else if (sum_valid_) {
+      add_sum(datum);
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::ObColAggregator::merge(
+    const ObSkipIndexColAggResult &child,
+    const int64_t child_row_count)
+{
+  int ret = OB_SUCCESS;
+  null_count_ += child.null_count_;
+  if (child_row_count > child.null_count_) {
+    has_value_ = true;
+    if (!min_max_valid_) {
+    } else if (!child.has_min_max()) {
+      min_max_valid_ = false;
+    } else if (OB_FAIL(update_min_max(child.min_, child.max_))) {
+      LOG_WARN("Fail to merge min max", K(ret), K(child));
+    }
+    if (OB_FAIL(ret) || !sum_valid_) {
+    } else if (!child.has_sum()) {
+      sum_valid_ = false;
+    } else {
+      merge_sum(child.sum_);
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::ObColAggregator::serialize(char *buf, const int64_t buf_len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  int8_t flag = 0;
+  char sum_buf[sizeof(int64_t)];
+  ObDatum sum_datum;
+  if (has_value_ && min_max_valid_ && !min_.is_null()) {
+    flag |= ObSkipIndexColAggResult::AGG_FLAG_HAS_MIN_MAX;
+  }
+  if (has_value_ && sum_valid_) {
+    flag |= ObSkipIndexColAggResult::AGG_FLAG_HAS_SUM;
+    build_sum_datum(sum_buf, sum_datum);
+  }
+  if (OB_FAIL(serialization::encode_i8(buf, buf_len, pos, flag))) {
+    LOG_WARN("Fail to encode agg column flag", K(ret));
+  } else if (OB_FAIL(serialization::encode_vi64(buf, buf_len, pos, null_count_))) {
+    LOG_WARN("Fail to encode agg column null count", K(ret));
+  } else if (0 != (flag & ObSkipIndexColAggResult::AGG_FLAG_HAS_MIN_MAX)) {
+    if (OB_FAIL(ObAggRowReader::serialize_datum(min_, buf, buf_len, pos))) {
+      LOG_WARN("Fail to serialize min datum", K(ret));
+    } else if (OB_FAIL(ObAggRowReader::serialize_datum(max_, buf, buf_len, pos))) {
+      LOG_WARN("Fail to serialize max datum", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && 0 != (flag & ObSkipIndexColAggResult::AGG_FLAG_HAS_SUM)) {
+    if (OB_FAIL(ObAggRowReader::serialize_datum(sum_datum, buf, buf_len, pos))) {
+      LOG_WARN("Fail to serialize sum datum", K(ret));
+    }
+  }
+  return ret;
+}
+
+/**
+ * -------------------------------------------------------------------ObSkipIndexAggregator-------------------------------------------------------------------
+ */
+ObSkipIndexAggregator::ObSkipIndexAggregator()
+  : allocator_(nullptr), col_aggs_(nullptr), col_cnt_(0), row_count_(0),
+    agg_buf_(nullptr), agg_buf_size_(0), is_valid_(true), is_inited_(false)
+{
+}
+
+ObSkipIndexAggregator::~ObSkipIndexAggregator()
+{
+  reset();
+}
+
+void ObSkipIndexAggregator::reset()
+{
+  if (nullptr != allocator_) {
+    if (nullptr != col_aggs_) {
+      for (int64_t i = 0; i < col_cnt_; ++i) {
+        col_aggs_[i].~ObColAggregator();
+      }
+      allocator_->free(col_aggs_);
+    }
+    if (nullptr != agg_buf_) {
+      allocator_->free(agg_buf_);
+    }
+  }
+  allocator_ = nullptr;
+  col_aggs_ = nullptr;
+  col_cnt_ = 0;
+  row_count_ = 0;
+  agg_buf_ = nullptr;
+  agg_buf_size_ = 0;
+  is_valid_ = true;
+  is_inited_ = false;
+}
+
+void ObSkipIndexAggregator::reuse()
+{
+  for (int64_t i = 0; i < col_cnt_; ++i) {
+    col_aggs_[i].reuse();
+  }
+  row_count_ = 0;
+  is_valid_ = true;
+}
+
+bool ObSkipIndexAggregator::is_skip_index_supported(const ObObjMeta &col_type)
+{
+  bool bret = false;
+  switch (col_type.get_type_class()) {
+    case ObIntTC:
+    case ObUIntTC:
+    case ObFloatTC:
+    case ObDoubleTC:
+    case ObNumberTC:
+    case ObDateTimeTC:
+    case ObDateTC:
+    case ObTimeTC:
+    case ObYearTC:
+    case ObStringTC: {
+      bret = true;
+      break;
+    }
+    default: {
+      bret = false;
+    }
+  }
+  return bret;
+}
+
+int64_t ObSkipIndexAggregator::get_max_agg_row_size(const int64_t column_count)
+{
+  const int64_t max_vi_len = serialization::encoded_length_vi64(INT64_MAX);
+  const int64_t max_datum_len = max_vi_len + MAX_AGG_DATUM_LEN;
+  const int64_t max_col_len = sizeof(int8_t) + max_vi_len + 2 * max_datum_len + max_datum_len;
+  return sizeof(int8_t) + 2 * max_vi_len + min(column_count, MAX_SKIP_INDEX_COL_CNT) * max_col_len;
+}
+
+int ObSkipIndexAggregator::init(const ObDataStoreDesc &desc, ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Skip index aggregator init twice", K(ret));
+  } else if (OB_UNLIKELY(desc.col_desc_array_.count() <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid data store desc to init skip index aggregator", K(ret), K(desc));
+  } else if (FALSE_IT(col_cnt_ = min(desc.col_desc_array_.count(), MAX_SKIP_INDEX_COL_CNT))) {
+  } else if (OB_ISNULL(buf = allocator.alloc(sizeof(ObColAggregator) * col_cnt_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Fail to alloc column aggregators", K(ret), K_(col_cnt));
+  } else if (FALSE_IT(col_aggs_ = static_cast<ObColAggregator *>(buf))) {
+  } else if (FALSE_IT(agg_buf_size_ = get_max_agg_row_size(col_cnt_))) {
+  } else if (OB_ISNULL(agg_buf_ = static_cast<char *>(allocator.alloc(agg_buf_size_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Fail to alloc agg row buffer", K(ret), K_(agg_buf_size));
+  } else {
+    allocator_ = &allocator;
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      new (col_aggs_ + i) ObColAggregator();
+    }
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      const ObObjMeta &col_type = desc.col_desc_array_.at(i).col_type_;
+      ObDatumCmpFuncType cmp_func = nullptr;
+      bool support_min_max = is_skip_index_supported(col_type);
+      if (support_min_max) {
+        sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(
+            col_type.get_type(), col_type.get_collation_type());
+        cmp_func = nullptr == basic_funcs ? nullptr : basic_funcs->null_first_cmp_;
+      }
+      col_aggs_[i].init(cmp_func, col_type.get_type_class(), support_min_max);
+    }
+    row_count_ = 0;
+    is_valid_ = true;
+    is_inited_ = true;
+  }
+  if (OB_FAIL(ret) && !is_inited_) {
+    if (nullptr != col_aggs_) {
+      allocator.free(col_aggs_);
+      col_aggs_ = nullptr;
+    }
+    if (nullptr != agg_buf_) {
+      allocator.free(agg_buf_);
+      agg_buf_ = nullptr;
+    }
+    col_cnt_ = 0;
+    agg_buf_size_ = 0;
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval(const ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Skip index aggregator not inited", K(ret));
+  } else if (!is_valid_) {
+  } else if (OB_UNLIKELY(row.get_column_count() < col_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Unexpected column count of row to aggregate", K(ret), K_(col_cnt), K(row));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      if (OB_FAIL(col_aggs_[i].eval(row.storage_datums_[i]))) {
+        LOG_WARN("Fail to aggregate column", K(ret), K(i), K(row));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ++row_count_;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval(const char *agg_row_buf, const int64_t agg_row_len)
+{
+  int ret = OB_SUCCESS;
+  ObAggRowReader reader;
+  ObSkipIndexColAggResult result;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Skip index aggregator not inited", K(ret));
+  } else if (!is_valid_) {
+  } else if (nullptr == agg_row_buf || agg_row_len <= 0) {
+    // child has no skip index, e.g. reused from a sstable built without it
+    is_valid_ = false;
+  } else if (OB_FAIL(reader.init(agg_row_buf, agg_row_len))) {
+    LOG_WARN("Fail to init agg row reader", K(ret), KP(agg_row_buf), K(agg_row_len));
+  } else if (reader.get_column_count() != col_cnt_) {
+    is_valid_ = false;
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      if (OB_FAIL(reader.read(i, result))) {
+        LOG_WARN("Fail to read agg column", K(ret), K(i), K(reader));
+      } else if (OB_FAIL(col_aggs_[i].merge(result, reader.get_row_count()))) {
+        LOG_WARN("Fail to merge agg column", K(ret), K(i), K(result));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      row_count_ += reader.get_row_count();
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::get_aggregated_row(const char *&agg_row_buf, int64_t &agg_row_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  agg_row_buf = nullptr;
+  agg_row_len = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Skip index aggregator not inited", K(ret));
+  } else if (!is_valid_ || 0 == row_count_) {
+  } else if (OB_FAIL(serialization::encode_i8(agg_buf_, agg_buf_size_, pos, AGG_ROW_VERSION))) {
+    LOG_WARN("Fail to encode agg row version", K(ret));
+  } else if (OB_FAIL(serialization::encode_vi64(agg_buf_, agg_buf_size_, pos, col_cnt_))) {
+    LOG_WARN("Fail to encode agg row column count", K(ret));
+  } else if (OB_FAIL(serialization::encode_vi64(agg_buf_, agg_buf_size_, pos, row_count_))) {
+    LOG_WARN("Fail to encode agg row row count", K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      if (OB_FAIL(col_aggs_[i].serialize(agg_buf_, agg_buf_size_, pos))) {
+        LOG_WARN("Fail to serialize agg column", K(ret), K(i), K(col_aggs_[i]));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      agg_row_buf = agg_buf_;
+      agg_row_len = pos;
+    }
+  }
+  return ret;
+}
+
+/**
+ * -------------------------------------------------------------------ObSkipIndexFilterChecker-------------------------------------------------------------------
+ */
+int ObSkipIndexFilterChecker::check_always_false(
+    const sql::ObPushdownFilterExecutor &filter,
+    const ObTableReadInfo &read_info,
+    const ObAggRowReader &agg_row_reader,
+    bool &always_false)
+{
+  int ret = OB_SUCCESS;
+  always_false = false;
+  if (OB_UNLIKELY(!agg_row_reader.is_inited())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Agg row reader not inited", K(ret));
+  } else if (filter.is_logic_and_node()) {
+    sql::ObPushdownFilterExecutor **childs = filter.get_childs();
+    for (uint32_t i = 0; OB_SUCC(ret) && !always_false && i < filter.get_child_count(); ++i) {
+      if (OB_ISNULL(childs[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected null child filter", K(ret), K(i));
+      } else if (OB_FAIL(check_always_false(*childs[i], read_info, agg_row_reader, always_false))) {
+        LOG_WARN("Fail to check child filter", K(ret), K(i));
+      }
+    }
+  } else if (filter.is_logic_or_node()) {
+    sql::ObPushdownFilterExecutor **childs = filter.get_childs();
+    always_false = filter.get_child_count() > 0;
+    for (uint32_t i = 0; OB_SUCC(ret) && always_false && i < filter.get_child_count(); ++i) {
+      if (OB_ISNULL(childs[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected null child filter", K(ret), K(i));
+      } else if (OB_FAIL(check_always_false(*childs[i], read_info, agg_row_reader, always_false))) {
+        LOG_WARN("Fail to check child filter", K(ret), K(i));
+      }
+    }
+  } else if (filter.is_filter_white_node()) {
+    if (OB_FAIL(check_white_filter(static_cast<const sql::ObWhiteFilterExecutor &>(filter),
+                                   read_info, agg_row_reader, always_false))) {
+      LOG_WARN("Fail to check white filter", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    always_false = false;
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterChecker::compare(
+    const ObObj &left,
+    const ObObj &right,
+    const ObCollationType cs_type,
+    bool &is_comparable,
+    int &cmp_ret)
+{
+  int ret = OB_SUCCESS;
+  obj_cmp_func cmp_func = nullptr;
+  is_comparable = ObObjCmpFuncs::can_cmp_without_cast(left.get_meta(), right.get_meta(), CO_CMP, cmp_func);
+  if (is_comparable && OB_FAIL(ObObjCmpFuncs::compare(left, right, cs_type, cmp_ret))) {
+    LOG_WARN("Fail to compare obj", K(ret), K(left), K(right));
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterChecker::check_white_filter(
+    const sql::ObWhiteFilterExecutor &filter,
+    const ObTableReadInfo &read_info,
+    const ObAggRowReader &agg_row_reader,
+    bool &always_false)
+{
+  int ret = OB_SUCCESS;
+  always_false = false;
+  const common::ObIArray<int32_t> &col_offsets = filter.get_col_offsets();
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const common::ObIArray<ObObj> &ref_objs = filter.get_objs();
+  int64_t col_offset = 0;
+  int64_t col_idx = 0;
+  ObSkipIndexColAggResult result;
+  if (1 != col_offsets.count() || nullptr != filter.get_col_params().at(0)) {
+    // column need padding is not comparable with its stored value
+  } else if (FALSE_IT(col_offset = col_offsets.at(0))) {
+  } else if (col_offset < 0 || col_offset >= read_info.get_columns_index().count()) {
+  } else if (FALSE_IT(col_idx = read_info.get_columns_index().at(col_offset))) {
+  } else if (col_idx < 0 || col_idx >= agg_row_reader.get_column_count()) {
+    // column not stored in sstable or without skip index
+  } else if (OB_FAIL(agg_row_reader.read(col_idx, result))) {
+    LOG_WARN("Fail to read agg column", K(ret), K(col_idx), K(agg_row_reader));
+  } else {
+    const ObObjMeta &col_type = read_info.get_columns_desc().at(col_offset).col_type_;
+    const bool all_null = result.null_count_ >= agg_row_reader.get_row_count();
+    if (sql::WHITE_OP_NU == op_type) {
+      always_false = 0 == result.null_count_;
+    } else if (sql::WHITE_OP_NN == op_type) {
+      always_false = all_null;
+    } else if (lib::is_oracle_mode() && ObStringTC == col_type.get_type_class()) {
+      // empty string is treated as null in oracle mode
+    } else if (all_null) {
+      // compare with null is null, or never in the set
+      always_false = true;
+    } else if (!result.has_min_max()) {
+    } else {
+      ObObj min_obj;
+      ObObj max_obj;
+      bool min_comparable = false;
+      bool max_comparable = false;
+      int min_cmp = 0;
+      int max_cmp = 0;
+      const ObCollationType cs_type = col_type.get_collation_type();
+      if (OB_FAIL(result.min_.to_obj(min_obj, col_type))) {
+        LOG_WARN("Fail to convert min datum to obj", K(ret), K(result), K(col_type));
+      } else if (OB_FAIL(result.max_.to_obj(max_obj, col_type))) {
+        LOG_WARN("Fail to convert max datum to obj", K(ret), K(result), K(col_type));
+      }
+      switch (op_type) {
+        case sql::WHITE_OP_EQ:
+        case sql::WHITE_OP_NE:
+        case sql::WHITE_OP_LT:
+        case sql::WHITE_OP_LE:
+        case sql::WHITE_OP_GT:
+        case sql::WHITE_OP_GE: {
+          if (OB_FAIL(ret) || 1 != ref_objs.count() || ref_objs.at(0).is_null()) {
+          } else if (OB_FAIL(compare(min_obj, ref_objs.at(0), cs_type, min_comparable, min_cmp))) {
+            LOG_WARN("Fail to compare min", K(ret));
+          } else if (OB_FAIL(compare(max_obj, ref_objs.at(0), cs_type, max_comparable, max_cmp))) {
+            LOG_WARN("Fail to compare max", K(ret));
+          } else if (min_comparable && max_comparable) {
+            if (sql::WHITE_OP_EQ == op_type) {
+              always_false = min_cmp > 0 || max_cmp < 0;
+            } else if (sql::WHITE_OP_NE == op_type) {
+              always_false = 0 == min_cmp && 0 == max_cmp;
+            } else if (sql::WHITE_OP_LT == op_type) {
+              always_false = min_cmp >= 0;
+            } else if (sql::WHITE_OP_LE == op_type) {
+              always_false = min_cmp > 0;
+            } else if (sql::WHITE_OP_GT == op_type) {
+              always_false = max_cmp <= 0;
+            } else {
+              always_false = max_cmp < 0;
+            }
+          }
+          break;
+        }
+        case sql::WHITE_OP_BT: {
+          if (OB_FAIL(ret) || 2 != ref_objs.count() || ref_objs.at(0).is_null() || ref_objs.at(1).is_null()) {
+          } else if (OB_FAIL(compare(max_obj, ref_objs.at(0), cs_type, max_comparable, max_cmp))) {
+            LOG_WARN("Fail to compare max", K(ret));
+          } else if (OB_FAIL(compare(min_obj, ref_objs.at(1), cs_type, min_comparable, min_cmp))) {
+            LOG_WARN("Fail to compare min", K(ret));
+          } else {
+            always_false = (max_comparable && max_cmp < 0) || (min_comparable && min_cmp > 0);
+          }
+          break;
+        }
+        case sql::WHITE_OP_IN: {
+          always_false = OB_SUCC(ret) && ref_objs.count() > 0;
+          for (int64_t i = 0; OB_SUCC(ret) && always_false && i < ref_objs.count(); ++i) {
+            const ObObj &ref_obj = ref_objs.at(i);
+            if (ref_obj.is_null()) {
+            } else if (OB_FAIL(compare(min_obj, ref_obj, cs_type, min_comparable, min_cmp))) {
+              LOG_WARN("Fail to compare min", K(ret));
+            } else if (OB_FAIL(compare(max_obj, ref_obj, cs_type, max_comparable, max_cmp))) {
+              LOG_WARN("Fail to compare max", K(ret));
+            } else {
+              always_false = min_comparable && max_comparable && (min_cmp > 0 || max_cmp < 0);
+            }
+          }
+          break;
+        }
+        default: {
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    always_false = false;
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
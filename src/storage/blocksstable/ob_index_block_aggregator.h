@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+
+#include "share/datum/ob_datum.h"
+#include "share/datum/ob_datum_funcs.h"
+#include "ob_datum_row.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+class ObPushdownFilterExecutor;
+class ObWhiteFilterExecutor;
+}
+namespace storage
+{
+class ObTableReadInfo;
+}
+namespace blocksstable
+{
+struct ObDataStoreDesc;
+
+// Skip index of one column pre-aggregated from all rows under an index block row.
+// min/max are absent when the column type is not supported, any value is too long
+// or all values are null, sum is only maintained for integer and float columns.
+struct ObSkipIndexColAggResult
+{
+public:
+  static const int8_t AGG_FLAG_HAS_MIN_MAX = 0x1;
+  static const int8_t AGG_FLAG_HAS_SUM = 0x2;
+  ObSkipIndexColAggResult() { reset(); }
+  ~ObSkipIndexColAggResult() = default;
+  OB_INLINE void reset()
+  {
+    flag_ = 0;
+    null_count_ = 0;
+    min_.set_null();
+    max_.set_null();
+    sum_.set_null();
+  }
+  OB_INLINE bool has_min_max() const { return 0 != (flag_ & AGG_FLAG_HAS_MIN_MAX); }
+  OB_INLINE bool has_sum() const { return 0 != (flag_ & AGG_FLAG_HAS_SUM); }
+  TO_STRING_KV(K_(flag), K_(null_count), K_(min), K_(max), K_(sum));
+
+  int8_t flag_;
+  int64_t null_count_;
+  common::ObDatum min_;
+  common::ObDatum max_;
+  common::ObDatum sum_;
+};
+
+// Aggregated row layout, all integers are variable-length encoded:
+//   version | column count | row count
+//   for each column: flag | null count | [min datum, max datum] | [sum datum]
+class ObAggRowReader
+{
+public:
+  ObAggRowReader();
+  ~ObAggRowReader() = default;
+  void reset();
+  int init(const char *buf, const int64_t buf_size);
+  int read(const int64_t col_idx, ObSkipIndexColAggResult &result) const;
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  OB_INLINE int64_t get_column_count() const { return col_cnt_; }
+  OB_INLINE int64_t get_row_count() const { return row_count_; }
+  TO_STRING_KV(K_(is_inited), KP_(buf), K_(buf_size), K_(col_cnt), K_(row_count), K_(col_start_pos));
+
+  static int serialize_datum(const common::ObDatum &datum, char *buf, const int64_t buf_len, int64_t &pos);
+  static int deserialize_datum(const char *buf, const int64_t data_len, int64_t &pos, common::ObDatum &datum);
+  static int64_t get_datum_serialize_size(const common::ObDatum &datum);
+private:
+  int read_column(int64_t &pos, ObSkipIndexColAggResult &result) const;
+private:
+  const char *buf_;
+  int64_t buf_size_;
+  int64_t col_cnt_;
+  int64_t row_count_;
+  int64_t col_start_pos_;
+  bool is_inited_;
+};
+
+// Aggregate skip index from data rows (data micro block) or from aggregated rows of
+// children (index micro block / macro block). An aggregated row is produced only if
+// every child carries one, otherwise the parent has no skip index at all.
+class ObSkipIndexAggregator
+{
+public:
+  static const int64_t AGG_ROW_VERSION = 1;
+  static const int64_t MAX_SKIP_INDEX_COL_CNT = 16;
+  static const int64_t MAX_AGG_DATUM_LEN = 16;
+public:
+  ObSkipIndexAggregator();
+  ~ObSkipIndexAggregator();
+  void reset();
+  void reuse();
+  int init(const ObDataStoreDesc &desc, common::ObIAllocator &allocator);
+  int eval(const ObDatumRow &row);
+  int eval(const char *agg_row_buf, const int64_t agg_row_len);
+  // output buffer is owned by aggregator and valid until next reuse()
+  int get_aggregated_row(const char *&agg_row_buf, int64_t &agg_row_len);
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  static int64_t get_max_agg_row_size(const int64_t column_count);
+  TO_STRING_KV(K_(is_inited), K_(col_cnt), K_(row_count), K_(is_valid), K_(agg_buf_size));
+
+private:
+  struct ObColAggregator
+  {
+  public:
+    ObColAggregator();
+    ~ObColAggregator() = default;
+    void init(const common::ObDatumCmpFuncType cmp_func,
+              const common::ObObjTypeClass type_class,
+              const bool support_min_max);
+    void reuse();
+    int eval(const common::ObDatum &datum);
+    void invalidate() { min_max_valid_ = false; sum_valid_ = false; }
+    int merge(const ObSkipIndexColAggResult &child, const int64_t child_row_count);
+    int serialize(char *buf, const int64_t buf_len, int64_t &pos) const;
+    int64_t get_serialize_size() const;
+    TO_STRING_KV(K_(type_class), K_(support_min_max), K_(support_sum), K_(has_value),
+                 K_(min_max_valid), K_(sum_valid), K_(null_count), K_(min), K_(max));
+  private:
+    int update_min_max(const common::ObDatum &min_datum, const common::ObDatum &max_datum);
+    void add_sum(const common::ObDatum &datum);
+    void merge_sum(const common::ObDatum &sum_datum);
+    void build_sum_datum(char *buf, common::ObDatum &sum_datum) const;
+    static void copy_datum(const common::ObDatum &src, char *buf, common::ObDatum &dst);
+  public:
+    common::ObDatumCmpFuncType cmp_func_;
+    common::ObObjTypeClass type_class_;
+    bool support_min_max_;
+    bool support_sum_;
+    bool has_value_;
+    bool min_max_valid_;
+    bool sum_valid_;
+    int64_t null_count_;
+    common::ObDatum min_;
+    common::ObDatum max_;
+    union {
+      int64_t int_sum_;
+      uint64_t uint_sum_;
+      double double_sum_;
+    };
+    char min_buf_[MAX_AGG_DATUM_LEN];
+    char max_buf_[MAX_AGG_DATUM_LEN];
+  };
+  static bool is_skip_index_supported(const common::ObObjMeta &col_type);
+
+private:
+  common::ObIAllocator *allocator_;
+  ObColAggregator *col_aggs_;
+  int64_t col_cnt_;
+  int64_t row_count_;
+  char *agg_buf_;
+  int64_t agg_buf_size_;
+  bool is_valid_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObSkipIndexAggregator);
+};
+
+// Check whether the pushdown filter must be false for all rows under an index block row
+// according to its skip index. Only white filters on columns need no padding are checked,
+// black filters or anything undecidable are treated as maybe true.
+class ObSkipIndexFilterChecker
+{
+public:
+  static int check_always_false(
+      const sql::ObPushdownFilterExecutor &filter,
+      const storage::ObTableReadInfo &read_info,
+      const ObAggRowReader &agg_row_reader,
+      bool &always_false);
+private:
+  static int check_white_filter(
+      const sql::ObWhiteFilterExecutor &filter,
+      const storage::ObTableReadInfo &read_info,
+      const ObAggRowReader &agg_row_reader,
+      bool &always_false);
+  static int compare(
+      const common::ObObj &left,
+      const common::ObObj &right,
+      const common::ObCollationType cs_type,
+      bool &is_comparable,
+      int &cmp_ret);
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
@@ -1114,6 +1114,7 @@ ObBaseIndexBlockBuilder::ObBaseIndexBlockBuilder()
    allocator_(nullptr),
    micro_writer_(nullptr),
    macro_writer_(nullptr),
+   skip_index_aggregator_(nullptr),
    index_block_pre_warmer_(),
    row_count_(0),
    row_count_delta_(0),
@@ -1148,6 +1149,11 @@ void ObBaseIndexBlockBuilder::reset()
     allocator_->free(micro_writer_);
     micro_writer_ = nullptr;
   }
+  if (OB_NOT_NULL(skip_index_aggregator_)) {
+    skip_index_aggregator_->~ObSkipIndexAggregator();
+    allocator_->free(skip_index_aggregator_);
+    skip_index_aggregator_ = nullptr;
+  }
   row_builder_.reset();
   if (OB_NOT_NULL(next_level_builder_)) {
     next_level_builder_->~ObBaseIndexBlockBuilder();
@@ -1187,6 +1193,8 @@ int ObBaseIndexBlockBuilder::init(ObDataStoreDesc &index_store_desc,
       STORAGE_LOG(WARN, "fail to init ObBaseIndexBlockBuilder", K(ret));
     } else if (OB_FAIL(ObMacroBlockWriter::build_micro_writer(index_store_desc_, allocator, micro_writer_))) {
       STORAGE_LOG(WARN, "fail to build micro writer", K(ret));
+    } else if (index_store_desc_->need_build_skip_index_ && OB_FAIL(init_skip_index_aggregator())) {
+      STORAGE_LOG(WARN, "fail to init skip index aggregator", K(ret));
     } else {
       if (index_store_desc_->need_pre_warm_) {
         index_block_pre_warmer_.init(idx_read_info_);
@@ -1251,6 +1259,10 @@ int ObBaseIndexBlockBuilder::append_row(const ObIndexBlockRowDesc &row_desc)
     macro_block_count_ += row_desc.macro_block_count_;
     // use the flag of the last row in last micro block
     is_last_row_last_flag_ = row_desc.is_last_row_last_flag_;
+    if (nullptr != skip_index_aggregator_
+        && OB_FAIL(skip_index_aggregator_->eval(row_desc.agg_row_buf_, row_desc.agg_row_len_))) {
+      STORAGE_LOG(WARN, "fail to aggregate skip index", K(ret), K(row_desc));
+    }
   }
   return ret;
 }
@@ -1429,6 +1441,18 @@ void ObBaseIndexBlockBuilder::update_accumulative_info(ObIndexBlockRowDesc &next
   next_row_desc.macro_block_count_ = macro_block_count_;
   next_row_desc.micro_block_count_ = micro_block_count_;
   next_row_desc.is_last_row_last_flag_ = is_last_row_last_flag_;
+  next_row_desc.agg_row_buf_ = nullptr;
+  next_row_desc.agg_row_len_ = 0;
+  if (nullptr != skip_index_aggregator_) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(skip_index_aggregator_->get_aggregated_row(
+        next_row_desc.agg_row_buf_, next_row_desc.agg_row_len_))) {
+      // skip index is optional, build index row without it
+      STORAGE_LOG_RET(WARN, tmp_ret, "fail to get aggregated skip index row", K(tmp_ret));
+      next_row_desc.agg_row_buf_ = nullptr;
+      next_row_desc.agg_row_len_ = 0;
+    }
+  }
 }
 
 int ObBaseIndexBlockBuilder::close_index_tree(ObBaseIndexBlockBuilder *&root_builder)
@@ -1471,6 +1495,8 @@ void ObBaseIndexBlockBuilder::block_to_row_desc(
   row_desc.has_string_out_row_ = micro_block_desc.has_string_out_row_;
   row_desc.has_lob_out_row_ = micro_block_desc.has_lob_out_row_;
   row_desc.is_last_row_last_flag_ = micro_block_desc.is_last_row_last_flag_;
+  row_desc.agg_row_buf_ = micro_block_desc.agg_row_buf_;
+  row_desc.agg_row_len_ = micro_block_desc.agg_row_len_;
 }
 
 int ObBaseIndexBlockBuilder::meta_to_row_desc(
@@ -1510,6 +1536,8 @@ int ObBaseIndexBlockBuilder::meta_to_row_desc(
     row_desc.macro_block_count_ = 1;
     row_desc.has_string_out_row_ = macro_meta.val_.has_string_out_row_;
     row_desc.has_lob_out_row_ = !macro_meta.val_.all_lob_in_row_;
+    row_desc.agg_row_buf_ = macro_meta.val_.agg_row_buf_;
+    row_desc.agg_row_len_ = macro_meta.val_.agg_row_len_;
   }
   return ret;
 }
@@ -1530,6 +1558,8 @@ void ObBaseIndexBlockBuilder::row_desc_to_meta(
   macro_meta.val_.has_string_out_row_ = macro_row_desc.has_string_out_row_;
   macro_meta.val_.all_lob_in_row_ = !macro_row_desc.has_lob_out_row_;
   macro_meta.val_.is_last_row_last_flag_ = macro_row_desc.is_last_row_last_flag_;
+  macro_meta.val_.agg_row_buf_ = macro_row_desc.agg_row_buf_;
+  macro_meta.val_.agg_row_len_ = macro_row_desc.agg_row_len_;
 }
 
 
@@ -1546,6 +1576,28 @@ void ObBaseIndexBlockBuilder::reset_accumulative_info()
   is_last_row_last_flag_ = false;
   macro_block_count_ = 0;
   micro_block_count_ = 0;
+  if (nullptr != skip_index_aggregator_) {
+    skip_index_aggregator_->reuse();
+  }
+}
+
+int ObBaseIndexBlockBuilder::init_skip_index_aggregator()
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_ISNULL(buf = allocator_->alloc(sizeof(ObSkipIndexAggregator)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "fail to alloc skip index aggregator", K(ret));
+  } else if (FALSE_IT(skip_index_aggregator_ = new (buf) ObSkipIndexAggregator())) {
+  } else if (OB_FAIL(skip_index_aggregator_->init(*index_store_desc_, *allocator_))) {
+    STORAGE_LOG(WARN, "fail to init skip index aggregator", K(ret), KPC_(index_store_desc));
+  }
+  if (OB_FAIL(ret) && nullptr != skip_index_aggregator_) {
+    skip_index_aggregator_->~ObSkipIndexAggregator();
+    allocator_->free(skip_index_aggregator_);
+    skip_index_aggregator_ = nullptr;
+  }
+  return ret;
 }
 
 int ObBaseIndexBlockBuilder::new_next_builder(ObBaseIndexBlockBuilder *&next_builder)
@@ -1750,6 +1802,10 @@ int ObDataIndexBlockBuilder::cal_macro_meta_block_size(
     macro_meta.val_.logic_id_.logic_version_ = data_store_desc_->get_logical_version();
     macro_meta.val_.logic_id_.tablet_id_ = data_store_desc_->tablet_id_.id();
     macro_meta.val_.macro_id_ = ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID;
+    if (data_store_desc_->need_build_skip_index_) {
+      // reserve space for skip index, only length is used for estimation
+      macro_meta.val_.agg_row_len_ = ObSkipIndexAggregator::get_max_agg_row_size(column_cnt);
+    }
     meta_row_.reuse();
     row_allocator_.reuse();
     if (OB_FAIL(ret)) {
@@ -264,6 +264,7 @@ protected:
   int64_t get_row_count() { return micro_writer_->get_row_count(); }
 private:
   void reset_accumulative_info();
+  int init_skip_index_aggregator();
   int new_next_builder(ObBaseIndexBlockBuilder *&next_builder);
   virtual int append_next_row(const ObMicroBlockDesc &micro_block_desc);
   int64_t calc_basic_micro_block_data_offset(const uint64_t column_cnt);
@@ -279,6 +280,7 @@ protected:
   common::ObIAllocator *allocator_;
   ObIMicroBlockWriter *micro_writer_;
   ObMacroBlockWriter *macro_writer_;
+  ObSkipIndexAggregator *skip_index_aggregator_;
   // accumulative info
   ObIndexBlockCachePreWarmer index_block_pre_warmer_;
   int64_t row_count_;
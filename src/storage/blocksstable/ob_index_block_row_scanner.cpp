@@ -360,6 +360,8 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
   const ObIndexBlockRowHeader *idx_row_header = nullptr;
   const ObIndexBlockRowMinorMetaInfo *idx_minor_info = nullptr;
   const char *idx_data_buf = nullptr;
+  const char *agg_row_buf = nullptr;
+  int64_t agg_buf_size = 0;
   int ret = OB_SUCCESS;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
@@ -372,9 +374,16 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Unexpected null index block row header/endkey", K(ret),
              K(index_format_), KP(idx_row_header), KP(endkey));
-  } else if (idx_row_header->is_data_index() && !idx_row_header->is_major_node()) {
-    if (OB_FAIL(idx_row_parser_.get_minor_meta(idx_minor_info))) {
-      LOG_WARN("Fail to get minor meta info", K(ret));
+  } else {
+    if (idx_row_header->is_data_index() && !idx_row_header->is_major_node()) {
+      if (OB_FAIL(idx_row_parser_.get_minor_meta(idx_minor_info))) {
+        LOG_WARN("Fail to get minor meta info", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && IndexFormat::BLOCK_TREE != index_format_ && idx_row_header->is_pre_aggregated()) {
+      if (OB_FAIL(idx_row_parser_.get_agg_row(agg_row_buf, agg_buf_size))) {
+        LOG_WARN("Fail to get aggregated row", K(ret));
+      }
     }
   }
 
@@ -383,6 +392,8 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
     idx_block_row.endkey_ = endkey;
     idx_block_row.row_header_ = idx_row_header;
     idx_block_row.minor_meta_info_ = idx_minor_info;
+    idx_block_row.agg_row_buf_ = agg_row_buf;
+    idx_block_row.agg_buf_size_ = agg_buf_size;
     idx_block_row.is_get_ = is_get_;
     idx_block_row.is_left_border_ = is_left_border_ && current_ == start_;
     idx_block_row.is_right_border_ = is_right_border_ && current_ == end_;
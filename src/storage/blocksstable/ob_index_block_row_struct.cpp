@@ -25,7 +25,7 @@ namespace blocksstable
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc()
   : data_store_desc_(nullptr), row_key_(), macro_id_(), block_offset_(0),
-    row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
+    agg_row_buf_(nullptr), agg_row_len_(0), row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_string_out_row_(false), has_lob_out_row_(false),
@@ -33,7 +33,7 @@ ObIndexBlockRowDesc::ObIndexBlockRowDesc()
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
   : data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
-    row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
+    agg_row_buf_(nullptr), agg_row_len_(0), row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_string_out_row_(false), has_lob_out_row_(false),
@@ -245,14 +245,15 @@ int ObIndexBlockRowBuilder::calc_data_size(const ObIndexBlockRowDesc &desc, int6
     LOG_WARN("Invalid index block row description", K(ret), K(desc));
   } else if (desc.is_secondary_meta_) {
     size = sizeof(ObIndexBlockRowHeader);
-  } else if (MAJOR_MERGE == desc.data_store_desc_->merge_type_) {
-    size = sizeof(ObIndexBlockRowHeader);
-    // if (desc.is_pre_aggregated_) {
-      // TODO: @saitong.zst Calculate aggregate size here
-      // size += aggregate_size;
-    // }
   } else {
-    size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
+    if (MAJOR_MERGE == desc.data_store_desc_->merge_type_) {
+      size = sizeof(ObIndexBlockRowHeader);
+    } else {
+      size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
+    }
+    if (nullptr != desc.agg_row_buf_ && desc.agg_row_len_ > 0) {
+      size += sizeof(int32_t) + desc.agg_row_len_;
+    }
   }
   return ret;
 }
@@ -268,10 +269,16 @@ int ObIndexBlockRowBuilder::calc_data_size(
     LOG_WARN("Invalid indeex block row header", K(ret), K(idx_row_header));
   } else if (!idx_row_header.is_data_index()) {
     size = sizeof(ObIndexBlockRowHeader);
-  } else if (idx_row_header.is_major_node()) {
-    size = sizeof(ObIndexBlockRowHeader);
   } else {
-    size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
+    if (idx_row_header.is_major_node()) {
+      size = sizeof(ObIndexBlockRowHeader);
+    } else {
+      size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
+    }
+    if (idx_row_header.is_pre_aggregated()) {
+      const char *agg_len_ptr = reinterpret_cast<const char *>(&idx_row_header) + size;
+      size += sizeof(int32_t) + *reinterpret_cast<const int32_t *>(agg_len_ptr);
+    }
   }
   return ret;
 }
@@ -295,7 +302,7 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
     header_->is_major_node_ = desc.data_store_desc_->merge_type_ == MAJOR_MERGE;
     header_->has_string_out_row_ = desc.has_string_out_row_;
     header_->all_lob_in_row_ = !desc.has_lob_out_row_;
-    // header_->is_pre_aggregated_ =
+    header_->is_pre_aggregated_ = is_data_mid_micro_block && nullptr != desc.agg_row_buf_ && desc.agg_row_len_ > 0;
     header_->is_deleted_ = desc.is_deleted_;
     header_->macro_id_ =(desc.is_data_block_ && is_data_mid_micro_block)
         ? ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID : desc.macro_id_;
@@ -329,20 +336,25 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
 int ObIndexBlockRowBuilder::append_aggregate_data(const ObIndexBlockRowDesc &desc)
 {
   int ret = OB_SUCCESS;
-  UNUSED(desc);
   if (OB_ISNULL(header_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Fail to append aggregation data to buffer", K(ret), KP_(header));
   } else if (!header_->is_pre_aggregated()) {
+  } else if (OB_UNLIKELY(desc.agg_row_len_ > INT32_MAX)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Aggregated row too long", K(ret), K(desc));
   } else {
-    // TODO: @saitong.zst Write aggregate data here
+    *reinterpret_cast<int32_t *>(data_buf_ + write_pos_) = static_cast<int32_t>(desc.agg_row_len_);
+    write_pos_ += sizeof(int32_t);
+    MEMCPY(data_buf_ + write_pos_, desc.agg_row_buf_, desc.agg_row_len_);
+    write_pos_ += desc.agg_row_len_;
   }
   return ret;
 }
 
 
 ObIndexBlockRowParser::ObIndexBlockRowParser()
-  : header_(nullptr), minor_meta_info_(nullptr), is_inited_(false) {}
+  : header_(nullptr), minor_meta_info_(nullptr), agg_row_buf_(nullptr), agg_row_len_(0), is_inited_(false) {}
 
 int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatumRow &row)
 {
@@ -368,6 +380,8 @@ int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatum
 int ObIndexBlockRowParser::init(const char *data_buf)
 {
   int ret = OB_SUCCESS;
+  agg_row_buf_ = nullptr;
+  agg_row_len_ = 0;
   if (OB_ISNULL(data_buf)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Unexpected null data buffer for index block row data", K(ret));
@@ -378,14 +392,19 @@ int ObIndexBlockRowParser::init(const char *data_buf)
     header_ = nullptr;
   } else if (!header_->is_data_index()) {
     // Init finished
-  } else if (!header_->is_major_node()) {
-    const int64_t minor_meta_offset = sizeof(ObIndexBlockRowHeader);
-    minor_meta_info_ = reinterpret_cast<const ObIndexBlockRowMinorMetaInfo *>(
-      data_buf + minor_meta_offset);
+  } else {
+    int64_t agg_offset = sizeof(ObIndexBlockRowHeader);
+    if (!header_->is_major_node()) {
+      minor_meta_info_ = reinterpret_cast<const ObIndexBlockRowMinorMetaInfo *>(
+        data_buf + agg_offset);
+      agg_offset += sizeof(ObIndexBlockRowMinorMetaInfo);
+    }
+    if (header_->is_pre_aggregated()) {
+      agg_row_len_ = *reinterpret_cast<const int32_t *>(data_buf + agg_offset);
+      agg_row_buf_ = data_buf + agg_offset + sizeof(int32_t);
+    }
   }
 
-  // TODO: @saitong.zst locate aggregated data logic here
-
   if (OB_SUCC(ret)) {
     is_inited_ = true;
   }
@@ -419,6 +438,22 @@ int ObIndexBlockRowParser::get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&m
   return ret;
 }
 
+int ObIndexBlockRowParser::get_agg_row(const char *&row_buf, int64_t &buf_size) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (OB_UNLIKELY(!header_->is_pre_aggregated())) {
+    ret = OB_ENTRY_NOT_EXIST;
+    LOG_WARN("This index block row is not pre-aggregated", K(ret), KPC_(header));
+  } else {
+    row_buf = agg_row_buf_;
+    buf_size = agg_row_len_;
+  }
+  return ret;
+}
+
 int ObIndexBlockRowParser::is_macro_node(bool &is_macro_node) const
 {
   int ret = OB_SUCCESS;
@@ -49,11 +49,12 @@ struct ObIndexBlockRowDesc
     return ret;
   }
 
-  // const ObSSTablePreAggreator *aggregator_;
   const ObDataStoreDesc *data_store_desc_;
   ObDatumRowkey row_key_;
   MacroBlockId macro_id_;
   int64_t block_offset_;
+  const char *agg_row_buf_; // skip index aggregated from all rows under this row
+  int64_t agg_row_len_;
   int64_t row_count_;
   int64_t row_count_delta_;
   int64_t max_merged_trans_version_;
@@ -70,7 +71,7 @@ struct ObIndexBlockRowDesc
   bool is_last_row_last_flag_;
 
   TO_STRING_KV(KP_(data_store_desc), K_(row_key), K_(macro_id),
-      K_(block_offset), K_(row_count), K_(row_count_delta),
+      K_(block_offset), KP_(agg_row_buf), K_(agg_row_len), K_(row_count), K_(row_count_delta),
       K_(max_merged_trans_version), K_(block_size),
       K_(macro_block_count), K_(micro_block_count),
       K_(is_deleted), K_(contain_uncommitted_row), K_(is_data_block),
@@ -89,7 +90,7 @@ struct ObIndexBlockRowHeader
   void reset();
   OB_INLINE bool is_valid() const
   {
-    bool aggregation_valid = (is_pre_aggregated() && is_major_node()) || !is_pre_aggregated();
+    bool aggregation_valid = !is_pre_aggregated() || is_data_index();
     bool version_valid = INDEX_BLOCK_HEADER_V1 == version_;
     bool macro_id_valid =
         (macro_id_ == DEFAULT_IDX_ROW_MACRO_ID)
@@ -201,6 +202,8 @@ public:
     : row_header_(nullptr),
       minor_meta_info_(nullptr),
       endkey_(nullptr),
+      agg_row_buf_(nullptr),
+      agg_buf_size_(0),
       query_range_(nullptr),
       flag_(0),
       range_idx_(-1),
@@ -213,6 +216,8 @@ public:
     row_header_ = nullptr;
     minor_meta_info_ = nullptr;
     endkey_ = nullptr;
+    agg_row_buf_ = nullptr;
+    agg_buf_size_ = 0;
     query_range_ = nullptr;
     flag_ = 0;
     range_idx_ = -1;
@@ -356,15 +361,20 @@ public:
   {
     return is_filter_applied_ && !is_left_border_ && !is_right_border_;
   }
+  OB_INLINE bool has_agg_data() const
+  {
+    return nullptr != agg_row_buf_ && agg_buf_size_ > 0;
+  }
 
   TO_STRING_KV(KP_(query_range), KPC_(row_header), KPC_(minor_meta_info), KPC_(endkey),
-      K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
+      KP_(agg_row_buf), K_(agg_buf_size), K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
 
 public:
   const ObIndexBlockRowHeader *row_header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
   const ObDatumRowkey *endkey_;
-  // ObPreAggDataStore *pre_agg_data_;
+  const char *agg_row_buf_;
+  int64_t agg_buf_size_;
   union {
     const ObDatumRowkey *rowkey_;
     const ObDatumRange *range_;
@@ -433,6 +443,7 @@ public:
   int init(const char *data_buf);
   int get_header(const ObIndexBlockRowHeader *&header) const;
   int get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&meta) const;
+  int get_agg_row(const char *&row_buf, int64_t &buf_size) const;
   int is_macro_node(bool &is_macro_node) const;
   int64_t get_snapshot_version() const;
   int64_t get_max_merged_trans_version() const;
@@ -442,7 +453,8 @@ public:
 private:
   const ObIndexBlockRowHeader *header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
-  // Aggregate data read struct
+  const char *agg_row_buf_;
+  int64_t agg_row_len_;
   bool is_inited_;
 };
 
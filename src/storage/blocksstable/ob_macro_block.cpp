@@ -17,6 +17,7 @@
 #include "ob_macro_block.h"
 #include "ob_micro_block_hash_index.h"
 #include "observer/ob_server_struct.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/ob_encryption_util.h"
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
@@ -233,6 +234,11 @@ int ObDataStoreDesc::init(
       STORAGE_LOG(INFO, "success to set major working cluster version", K(tmp_ret), K(merge_type), K(cluster_version), K(major_working_cluster_version_));
     }
 
+    if (OB_SUCC(ret) && is_major_merge() && major_working_cluster_version_ >= DATA_VERSION_4_2_0_0) {
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+      need_build_skip_index_ = tenant_config.is_valid() && tenant_config->_enable_skip_index;
+    }
+
     if (OB_SUCC(ret)) {
       bool need_build_hash_index = merge_schema.get_table_type() == USER_TABLE
                                        && !is_major_merge();
@@ -332,6 +338,7 @@ void ObDataStoreDesc::reset()
   is_ddl_ = false;
   need_pre_warm_ = false;
   is_force_flat_store_type_ = false;
+  need_build_skip_index_ = false;
   col_desc_array_.reset();
   datum_utils_.reset();
   allocator_.reset();
@@ -367,6 +374,7 @@ int ObDataStoreDesc::assign(const ObDataStoreDesc &desc)
   is_ddl_ = desc.is_ddl_;
   need_pre_warm_ = desc.need_pre_warm_;
   is_force_flat_store_type_ = desc.is_force_flat_store_type_;
+  need_build_skip_index_ = desc.need_build_skip_index_;
   col_desc_array_.reset();
   datum_utils_.reset();
   sstable_index_builder_ = desc.sstable_index_builder_;
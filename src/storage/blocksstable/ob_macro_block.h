@@ -80,6 +80,7 @@ struct ObDataStoreDesc
   bool is_ddl_;
   bool need_pre_warm_;
   bool is_force_flat_store_type_;
+  bool need_build_skip_index_; // aggregate per-column skip index into index rows, major only
   common::ObArenaAllocator allocator_;
   common::ObFixedArray<share::schema::ObColDesc, common::ObIAllocator> col_desc_array_;
   blocksstable::ObStorageDatumUtils datum_utils_;
@@ -132,6 +133,7 @@ struct ObDataStoreDesc
       K_(major_working_cluster_version),
       KP_(sstable_index_builder),
       K_(is_ddl),
+      K_(need_build_skip_index),
       K_(col_desc_array));
 
 private:
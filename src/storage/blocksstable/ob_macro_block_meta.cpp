@@ -50,7 +50,10 @@ ObDataBlockMetaVal::ObDataBlockMetaVal()
     macro_id_(),
     column_checksums_(sizeof(int64_t), ModulePageAllocator("MacroMetaChksum", MTL_ID())),
     has_string_out_row_(false),
-    all_lob_in_row_(false)
+    all_lob_in_row_(false),
+    agg_row_buf_(nullptr),
+    agg_row_len_(0),
+    agg_row_holder_(sizeof(int64_t), ModulePageAllocator("MacroMetaAggRow", MTL_ID()))
 {
   MEMSET(encrypt_key_, 0, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
 }
@@ -86,7 +89,10 @@ ObDataBlockMetaVal::ObDataBlockMetaVal(ObIAllocator &allocator)
     macro_id_(),
     column_checksums_(sizeof(int64_t), ModulePageAllocator(allocator, "MacroMetaChksum")),
     has_string_out_row_(false),
-    all_lob_in_row_(false)
+    all_lob_in_row_(false),
+    agg_row_buf_(nullptr),
+    agg_row_len_(0),
+    agg_row_holder_(sizeof(int64_t), ModulePageAllocator(allocator, "MacroMetaAggRow"))
 {
   MEMSET(encrypt_key_, 0, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
 }
@@ -128,11 +134,14 @@ void ObDataBlockMetaVal::reset()
   column_checksums_.reset();
   has_string_out_row_ = false;
   all_lob_in_row_ = false;
+  agg_row_buf_ = nullptr;
+  agg_row_len_ = 0;
+  agg_row_holder_.reset();
 }
 
 bool ObDataBlockMetaVal::is_valid() const
 {
-return DATA_BLOCK_META_VAL_VERSION == version_
+return (DATA_BLOCK_META_VAL_VERSION == version_ || DATA_BLOCK_META_VAL_VERSION_V2 == version_)
     && rowkey_count_ > 0
     && column_count_ > 0
     && micro_block_count_ >= 0
@@ -160,6 +169,8 @@ int ObDataBlockMetaVal::assign(const ObDataBlockMetaVal &val)
     LOG_WARN("invalid argument", K(ret), K(val));
   } else if (OB_FAIL(column_checksums_.assign(val.column_checksums_))) {
     LOG_WARN("fail to assign column checksums", K(ret), K(val.column_checksums_));
+  } else if (val.agg_row_len_ > 0 && OB_FAIL(agg_row_holder_.prepare_allocate(val.agg_row_len_))) {
+    LOG_WARN("fail to prepare agg row buffer", K(ret), K(val.agg_row_len_));
   } else {
     version_ = val.version_;
     length_ = val.length_;
@@ -192,6 +203,11 @@ int ObDataBlockMetaVal::assign(const ObDataBlockMetaVal &val)
     macro_id_ = val.macro_id_;
     has_string_out_row_ = val.has_string_out_row_;
     all_lob_in_row_ = val.all_lob_in_row_;
+    if (val.agg_row_len_ > 0) {
+      MEMCPY(&agg_row_holder_.at(0), val.agg_row_buf_, val.agg_row_len_);
+      agg_row_buf_ = &agg_row_holder_.at(0);
+      agg_row_len_ = val.agg_row_len_;
+    }
   }
   return ret;
 }
@@ -229,6 +245,8 @@ DEFINE_SERIALIZE(ObDataBlockMetaVal)
     LOG_WARN("data block meta value is invalid", K(ret), KPC(this));
   } else {
     int64_t start_pos = pos;
+    const_cast<ObDataBlockMetaVal *>(this)->version_ = agg_row_len_ > 0
+        ? DATA_BLOCK_META_VAL_VERSION_V2 : DATA_BLOCK_META_VAL_VERSION;
     const_cast<ObDataBlockMetaVal *>(this)->length_ = get_serialize_size();
     if (OB_FAIL(serialization::encode_i32(buf, buf_len, pos, version_))) {
       LOG_WARN("fail to encode version", K(ret), K(buf_len), K(pos));
@@ -270,6 +288,16 @@ DEFINE_SERIALIZE(ObDataBlockMetaVal)
                   has_string_out_row_,
                   all_lob_in_row_,
                   is_last_row_last_flag_);
+      if (OB_FAIL(ret) || DATA_BLOCK_META_VAL_VERSION_V2 != version_) {
+      } else if (OB_FAIL(serialization::encode_vi64(buf, buf_len, pos, agg_row_len_))) {
+        LOG_WARN("fail to encode agg row length", K(ret), K(buf_len), K(pos));
+      } else if (OB_UNLIKELY(pos + agg_row_len_ > buf_len)) {
+        ret = OB_BUF_NOT_ENOUGH;
+        LOG_WARN("buffer not enough for agg row", K(ret), K(buf_len), K(pos), K_(agg_row_len));
+      } else {
+        MEMCPY(buf + pos, agg_row_buf_, agg_row_len_);
+        pos += agg_row_len_;
+      }
       if (OB_FAIL(ret)) {
       } else if (OB_UNLIKELY(length_ != pos - start_pos)) {
         ret = OB_ERR_UNEXPECTED;
@@ -290,7 +318,8 @@ DEFINE_DESERIALIZE(ObDataBlockMetaVal)
     int64_t start_pos = pos;
     if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &version_))) {
       LOG_WARN("fail to decode version", K(ret), K(data_len), K(pos));
-    } else if (OB_UNLIKELY(version_ != DATA_BLOCK_META_VAL_VERSION)) {
+    } else if (OB_UNLIKELY(version_ != DATA_BLOCK_META_VAL_VERSION
+                           && version_ != DATA_BLOCK_META_VAL_VERSION_V2)) {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("object version mismatch", K(ret), K(version_));
     } else if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &length_))) {
@@ -331,6 +360,18 @@ DEFINE_DESERIALIZE(ObDataBlockMetaVal)
                   has_string_out_row_,
                   all_lob_in_row_,
                   is_last_row_last_flag_);
+      agg_row_buf_ = nullptr;
+      agg_row_len_ = 0;
+      if (OB_FAIL(ret) || DATA_BLOCK_META_VAL_VERSION_V2 != version_) {
+      } else if (OB_FAIL(serialization::decode_vi64(buf, data_len, pos, &agg_row_len_))) {
+        LOG_WARN("fail to decode agg row length", K(ret), K(data_len), K(pos));
+      } else if (OB_UNLIKELY(agg_row_len_ <= 0 || pos + agg_row_len_ > data_len)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected agg row length", K(ret), K(data_len), K(pos), K_(agg_row_len));
+      } else {
+        agg_row_buf_ = buf + pos;
+        pos += agg_row_len_;
+      }
       if (OB_FAIL(ret)) {
       } else if (OB_UNLIKELY(length_ != pos - start_pos)) {
         ret = OB_ERR_UNEXPECTED;
@@ -346,6 +387,7 @@ int64_t ObDataBlockMetaVal::get_max_serialize_size() const
   len -= sizeof(column_checksums_);
   len += sizeof(int64_t); // serialize column count
   len += sizeof(int64_t) * column_count_; // serialize each checksum
+  len += sizeof(int64_t) + agg_row_len_; // serialize agg row
   return len;
 }
 DEFINE_GET_SERIALIZE_SIZE(ObDataBlockMetaVal)
@@ -384,6 +426,10 @@ DEFINE_GET_SERIALIZE_SIZE(ObDataBlockMetaVal)
               has_string_out_row_,
               all_lob_in_row_,
               is_last_row_last_flag_);
+  if (agg_row_len_ > 0) {
+    len += serialization::encoded_length_vi64(agg_row_len_);
+    len += agg_row_len_;
+  }
   return len;
 }
 
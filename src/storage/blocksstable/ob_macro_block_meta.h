@@ -36,6 +36,7 @@ class ObDataBlockMetaVal final
 {
 private:
   static const int32_t DATA_BLOCK_META_VAL_VERSION = 1;
+  static const int32_t DATA_BLOCK_META_VAL_VERSION_V2 = 2; // with skip index aggregated row
 public:
   ObDataBlockMetaVal();
   explicit ObDataBlockMetaVal(ObIAllocator &allocator);
@@ -55,7 +56,8 @@ public:
         K_(is_deleted), K_(contain_uncommitted_row), K_(compressor_type),
         K_(master_key_id), K_(encrypt_id), K_(encrypt_key), K_(row_store_type),
         K_(schema_version), K_(snapshot_version), K_(is_last_row_last_flag),
-        K_(logic_id), K_(macro_id), K_(column_checksums), K_(has_string_out_row), K_(all_lob_in_row));
+        K_(logic_id), K_(macro_id), K_(column_checksums), K_(has_string_out_row), K_(all_lob_in_row),
+        KP_(agg_row_buf), K_(agg_row_len));
 public:
   int32_t version_;
   int32_t length_;
@@ -89,6 +91,11 @@ public:
   common::ObSEArray<int64_t, 4> column_checksums_;
   bool has_string_out_row_;
   bool all_lob_in_row_;
+  // skip index of the whole macro block, points into the deserialized buffer or
+  // into agg_row_holder_ after assign
+  const char *agg_row_buf_;
+  int64_t agg_row_len_;
+  common::ObSEArray<char, 64> agg_row_holder_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObDataBlockMetaVal);
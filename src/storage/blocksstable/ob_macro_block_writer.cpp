@@ -365,6 +365,7 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    last_key_with_L_flag_(false),
    is_macro_or_micro_block_reused_(false),
    curr_micro_column_checksum_(NULL),
+   micro_skip_index_aggregator_(),
    allocator_("MaBlkWriter", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
    rowkey_allocator_("MaBlkWriter", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
    macro_reader_(),
@@ -416,6 +417,7 @@ void ObMacroBlockWriter::reset()
     builder_ = nullptr;
   }
   micro_block_adaptive_splitter_.reset();
+  micro_skip_index_aggregator_.reset();
   allocator_.reset();
   rowkey_allocator_.reset();
   data_block_pre_warmer_.reset();
@@ -483,6 +485,11 @@ int ObMacroBlockWriter::open(
            sizeof(int64_t) * data_store_desc_->row_column_count_);
       }
     }
+    if (OB_SUCC(ret) && data_store_desc_->need_build_skip_index_) {
+      if (OB_FAIL(micro_skip_index_aggregator_.init(data_store_desc, allocator_))) {
+        STORAGE_LOG(WARN, "fail to init skip index aggregator", K(ret));
+      }
+    }
     if (OB_FAIL(ret)) {
     } else if (OB_NOT_NULL(sstable_index_builder)) {
       if (OB_FAIL(sstable_index_builder->new_index_builder(builder_, data_store_desc, allocator_))) {
@@ -866,6 +873,9 @@ int ObMacroBlockWriter::append_row_and_hash_index(const ObDatumRow &row)
     if (ret != OB_BUF_NOT_ENOUGH) {
       STORAGE_LOG(WARN, "Failed to append row in micro writer", K(ret), K(row));
     }
+  } else if (micro_skip_index_aggregator_.is_inited()
+      && OB_FAIL(micro_skip_index_aggregator_.eval(row))) {
+    STORAGE_LOG(WARN, "Failed to aggregate skip index", K(ret), K(row));
   } else if (hash_index_builder_.is_valid()) {
     if (OB_UNLIKELY(FLAT_ROW_STORE != data_store_desc_->row_store_type_)) {
       ret = OB_ERR_UNEXPECTED;
@@ -920,6 +930,10 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (OB_FAIL(build_hash_index_block(micro_block_desc))) {
     STORAGE_LOG(WARN, "Failed to build hash index block", K(ret));
+  } else if (micro_skip_index_aggregator_.is_inited()
+      && OB_FAIL(micro_skip_index_aggregator_.get_aggregated_row(
+          micro_block_desc.agg_row_buf_, micro_block_desc.agg_row_len_))) {
+    STORAGE_LOG(WARN, "Failed to get aggregated skip index row", K(ret));
   } else {
     micro_block_desc.last_rowkey_ = last_key_;
     block_size = micro_block_desc.buf_size_;
@@ -956,6 +970,9 @@ int ObMacroBlockWriter::build_micro_block()
 
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
+    if (micro_skip_index_aggregator_.is_inited()) {
+      micro_skip_index_aggregator_.reuse();
+    }
     if (data_store_desc_->need_build_hash_index_for_micro_block_) {
       hash_index_builder_.reuse();
     }
@@ -1043,6 +1060,8 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.has_string_out_row_ = micro_block.micro_index_info_->has_string_out_row();
     micro_block_desc.has_lob_out_row_ = micro_block.micro_index_info_->has_lob_out_row();
     micro_block_desc.original_size_ = header.original_length_;
+    micro_block_desc.agg_row_buf_ = micro_block.micro_index_info_->agg_row_buf_;
+    micro_block_desc.agg_row_len_ = micro_block.micro_index_info_->agg_buf_size_;
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
@@ -18,6 +18,7 @@
 #include "lib/compress/ob_compressor.h"
 #include "lib/container/ob_array_wrap.h"
 #include "ob_block_manager.h"
+#include "ob_index_block_aggregator.h"
 #include "ob_index_block_row_struct.h"
 #include "ob_macro_block_checker.h"
 #include "ob_macro_block_reader.h"
@@ -216,6 +217,7 @@ private:
   bool last_key_with_L_flag_;
   bool is_macro_or_micro_block_reused_;
   int64_t *curr_micro_column_checksum_;
+  ObSkipIndexAggregator micro_skip_index_aggregator_; // skip index of current data micro block
   common::ObArenaAllocator allocator_;
   common::ObArenaAllocator rowkey_allocator_;
   blocksstable::ObMacroBlockReader macro_reader_;
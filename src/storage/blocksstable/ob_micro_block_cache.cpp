@@ -298,13 +298,14 @@ int ObMultiBlockIOParam::get_block_des_info(
 
 void ObMultiBlockIOCtx::reset()
 {
-  micro_index_infos_ = nullptr;
+  micro_block_infos_ = nullptr;
+  hit_cache_bitmap_ = nullptr;
   block_count_ = 0;
 }
 
 bool ObMultiBlockIOCtx::is_valid() const
 {
-  return OB_NOT_NULL(micro_index_infos_) && block_count_ > 0;
+  return OB_NOT_NULL(micro_block_infos_) && block_count_ > 0;
 }
 
 /*---------------------------------------ObIMicroBlockIOCallback-------------------------------------*/
@@ -604,7 +605,8 @@ const char *ObSingleMicroBlockIOCallback::get_data()
 ObMultiDataBlockIOCallback::ObMultiDataBlockIOCallback()
   : ObIMicroBlockIOCallback(),
     io_ctx_(),
-    io_result_()
+    io_result_(),
+    tablet_handle_()
 {
   STATIC_ASSERT(sizeof(*this) <= CALLBACK_BUF_SIZE, "IOCallback buf size not enough");
 }
@@ -612,6 +614,7 @@ ObMultiDataBlockIOCallback::ObMultiDataBlockIOCallback()
 ObMultiDataBlockIOCallback::~ObMultiDataBlockIOCallback()
 {
   free_result();
+  free_io_ctx();
 }
 
 int64_t ObMultiDataBlockIOCallback::size() const
@@ -636,8 +639,8 @@ int ObMultiDataBlockIOCallback::inner_process(const bool is_success)
 
     const int64_t block_count = io_ctx_.block_count_;
     for (int64_t i = 0; OB_SUCC(ret) && i < block_count; ++i) {
-      const int64_t data_size = io_ctx_.micro_index_infos_[i].get_block_size();
-      const int64_t data_offset = io_ctx_.micro_index_infos_[i].get_block_offset() - offset_;
+      const int64_t data_size = io_ctx_.micro_block_infos_[i].size_;
+      const int64_t data_offset = io_ctx_.micro_block_infos_[i].offset_ - offset_;
       if (OB_FAIL(process_block(
           reader,
           data_buffer_ + data_offset,
@@ -680,8 +683,8 @@ int ObMultiDataBlockIOCallback::inner_deep_copy(char *buf,
     } else if (OB_FAIL(pcallback->deep_copy_ctx(io_ctx_))) {
       LOG_WARN("deep_copy_ctx failed", K(ret));
     } else {
-      pcallback->io_ctx_ = io_ctx_;
       pcallback->io_result_ = io_result_;
+      pcallback->tablet_handle_ = tablet_handle_;
       callback = pcallback;
     }
   }
@@ -699,12 +702,31 @@ int ObMultiDataBlockIOCallback::set_io_ctx(
     const ObMultiBlockIOParam &io_param)
 {
   int ret = OB_SUCCESS;
+  void *ptr = nullptr;
+  const int64_t alloc_size = sizeof(ObMicroBlockInfo) * io_param.block_count_;
   if (OB_UNLIKELY(!io_param.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid io_param", K(ret), K(io_param));
+  } else if (OB_ISNULL(allocator_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("allocator_ is null", K(ret), KP(allocator_));
+  } else if (OB_ISNULL(ptr = allocator_->alloc(alloc_size))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc memory failed", K(ret), K(alloc_size));
   } else {
-    io_ctx_.micro_index_infos_ = &io_param.micro_index_infos_->at(io_param.start_index_);
+    io_ctx_.micro_block_infos_ = new (ptr) ObMicroBlockInfo[io_param.block_count_];
     io_ctx_.block_count_ = io_param.block_count_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < io_param.block_count_; ++i) {
+      const ObMicroIndexInfo &micro_info = io_param.micro_index_infos_->at(io_param.start_index_ + i);
+      if (OB_FAIL(io_ctx_.micro_block_infos_[i].set(
+          static_cast<int32_t>(micro_info.get_block_offset()),
+          static_cast<int32_t>(micro_info.get_block_size())))) {
+        LOG_WARN("Fail to set micro block info", K(ret), K(i), K(micro_info));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      free_io_ctx();
+    }
   }
   return ret;
 }
@@ -721,13 +743,13 @@ int ObMultiDataBlockIOCallback::deep_copy_ctx(
     LOG_WARN("allocator_ is null", K(ret), KP(allocator_));
   } else {
     void *ptr = nullptr;
-    int64_t alloc_size = sizeof(ObMicroIndexInfo) * io_ctx.block_count_;
+    int64_t alloc_size = sizeof(ObMicroBlockInfo) * io_ctx.block_count_;
     if (OB_ISNULL(ptr = allocator_->alloc(alloc_size))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("alloc memory failed", K(ret), K(alloc_size));
     } else {
-      io_ctx_.micro_index_infos_ = reinterpret_cast<ObMicroIndexInfo *>(ptr);
-      MEMCPY(io_ctx_.micro_index_infos_, io_ctx.micro_index_infos_, alloc_size);
+      io_ctx_.micro_block_infos_ = reinterpret_cast<ObMicroBlockInfo *>(ptr);
+      MEMCPY(io_ctx_.micro_block_infos_, io_ctx.micro_block_infos_, alloc_size);
     }
 
     if (OB_SUCC(ret)) {
@@ -737,6 +759,14 @@ int ObMultiDataBlockIOCallback::deep_copy_ctx(
   return ret;
 }
 
+void ObMultiDataBlockIOCallback::free_io_ctx()
+{
+  if (OB_NOT_NULL(allocator_) && OB_NOT_NULL(io_ctx_.micro_block_infos_)) {
+    allocator_->free(io_ctx_.micro_block_infos_);
+  }
+  io_ctx_.reset();
+}
+
 int ObMultiDataBlockIOCallback::alloc_result()
 {
   int ret = OB_SUCCESS;
@@ -1055,6 +1085,7 @@ int ObDataMicroBlockCache::prefetch(
     const ObMultiBlockIOParam &io_param,
     const ObQueryFlag &flag,
     const ObTableReadInfo &full_read_info,
+    const ObTabletHandle &tablet_handle,
     ObMacroBlockHandle &macro_handle)
 {
   int ret = OB_SUCCESS;
@@ -1062,9 +1093,14 @@ int ObDataMicroBlockCache::prefetch(
   if (OB_UNLIKELY(!io_param.is_valid() || 0 == tenant_id || OB_INVALID_TENANT_ID == tenant_id)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid input parameters", K(ret), K(tenant_id));
+  } else if (OB_FAIL(get_allocator(callback.allocator_))) {
+    LOG_WARN("Fail to get allocator", K(ret));
   } else if (OB_FAIL(callback.set_io_ctx(io_param))) {
     LOG_WARN("Set io context failed", K(ret), K(io_param));
   } else if (FALSE_IT(callback.read_info_ = &full_read_info)) {
+  } else if (FALSE_IT(callback.tablet_handle_ = tablet_handle)) {
+  } else if (FALSE_IT(callback.need_write_extra_buf_ = ObStoreFormat::is_row_store_type_with_encoding(
+      io_param.micro_index_infos_->at(io_param.start_index_).get_row_store_type()))) {
   } else if (OB_FAIL(ObIMicroBlockCache::prefetch(
       tenant_id, macro_id, io_param, flag, macro_handle, callback))) {
     LOG_WARN("Fail to prefetch multi data blocks", K(ret));
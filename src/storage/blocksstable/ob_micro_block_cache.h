@@ -125,17 +125,19 @@ struct ObMultiBlockIOParam
   int64_t block_count_;
 };
 
+// Offset and size of every micro block are copied out of the index rows, since
+// the index block may have been released before the async io is done.
 struct ObMultiBlockIOCtx
 {
   ObMultiBlockIOCtx()
-    : micro_index_infos_(nullptr), hit_cache_bitmap_(nullptr), block_count_(0) {}
+    : micro_block_infos_(nullptr), hit_cache_bitmap_(nullptr), block_count_(0) {}
   virtual ~ObMultiBlockIOCtx() {}
   void reset();
   bool is_valid() const;
-  ObMicroIndexInfo *micro_index_infos_;
+  ObMicroBlockInfo *micro_block_infos_;
   bool *hit_cache_bitmap_;
   int64_t block_count_;
-  TO_STRING_KV(KP_(micro_index_infos), KP_(hit_cache_bitmap), K_(block_count));
+  TO_STRING_KV(KP_(micro_block_infos), KP_(hit_cache_bitmap), K_(block_count));
 };
 
 class ObIPutSizeStat
@@ -222,17 +224,19 @@ public:
       char *buf, const int64_t buf_len,
       ObIOCallback *&callback) const override;
   virtual const char *get_data() override;
-  INHERIT_TO_STRING_KV("ObIMicroBlockIOCallback", ObIMicroBlockIOCallback, K_(io_ctx));
+  INHERIT_TO_STRING_KV("ObIMicroBlockIOCallback", ObIMicroBlockIOCallback, K_(io_ctx),
+                       K_(tablet_handle));
 private:
   friend class ObDataMicroBlockCache;
   int set_io_ctx(const ObMultiBlockIOParam &io_param);
-  void reset_io_ctx() { io_ctx_.reset(); }
   int deep_copy_ctx(const ObMultiBlockIOCtx &io_ctx);
+  void free_io_ctx();
   int alloc_result();
   void free_result();
   // Notice: lifetime shoule be longer than AIO or deep copy here
   ObMultiBlockIOCtx io_ctx_;
   ObMultiBlockIOResult io_result_;
+  ObTabletHandle tablet_handle_;
 };
 
 class ObIMicroBlockCache : public ObIPutSizeStat
@@ -312,6 +316,7 @@ public:
       const ObMultiBlockIOParam &io_param,
       const ObQueryFlag &flag,
       const ObTableReadInfo &full_read_info,
+      const ObTabletHandle &tablet_handle,
       ObMacroBlockHandle &macro_handle);
   int load_block(
       const ObMicroBlockId &micro_block_id,
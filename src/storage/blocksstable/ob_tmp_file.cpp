@@ -14,6 +14,7 @@
 #include "ob_tmp_file_cache.h"
 #include "observer/ob_server_struct.h"
 #include "share/ob_task_define.h"
+#include "lib/stat/ob_diagnose_info.h"
 
 namespace oceanbase
 {
@@ -121,6 +122,8 @@ int ObTmpFileIOHandle::wait(const int64_t timeout_ms)
 {
   int ret = OB_SUCCESS;
   ObTmpFileHandle file_handle;
+  const int64_t begin_ts = common::ObTimeUtility::fast_current_time();
+  const bool need_read_stat = is_read_ && !has_wait_;
   if (OB_UNLIKELY(has_wait_ && is_read_)) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(ERROR, "read wait() isn't reentrant interface, shouldn't call again", K(ret));
@@ -156,6 +159,13 @@ int ObTmpFileIOHandle::wait(const int64_t timeout_ms)
   }
 
   if (OB_SUCC(ret) || OB_ITER_END == ret) {
+    if (need_read_stat) {
+      // reads are issued asynchronously, the time waiting for them is what the reader sees
+      EVENT_INC(ObStatEventIds::TMP_FILE_READ_COUNT);
+      EVENT_ADD(ObStatEventIds::TMP_FILE_READ_BYTES, size_);
+      EVENT_ADD(ObStatEventIds::TMP_FILE_READ_WAIT_TIME,
+                common::ObTimeUtility::fast_current_time() - begin_ts);
+    }
     has_wait_ = true;
     expect_read_size_ = 0;
     last_read_offset_ = -1;
@@ -912,6 +922,7 @@ int ObTmpFile::aio_write(const ObTmpFileIOInfo &io_info, ObTmpFileIOHandle &hand
 {
   // only support append at present.
   int ret = OB_SUCCESS;
+  const int64_t begin_ts = common::ObTimeUtility::fast_current_time();
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     STORAGE_LOG(WARN, "ObTmpFile has not been inited", K(ret));
@@ -940,17 +951,18 @@ int ObTmpFile::aio_write(const ObTmpFileIOInfo &io_info, ObTmpFileIOHandle &hand
         //    a.  0KB < size <= 32KB, alloc_size = 32KB;
         //    b. 32KB < size <= 64KB, alloc_size = 64KB;
         //    c. 64KB < size        , alloc_size = size;
-        // 2. big file
-        //    a. 32KB < size <= 64KB, alloc_size = 64KB;
-        //    b. 64KB < size        , alloc_size = size;
+        // 2. big file, prealloc_size grows from 64KB up to 512KB with the file size
+        //    a. 32KB < size <= prealloc_size, alloc_size = prealloc_size;
+        //    b. prealloc_size < size        , alloc_size = size;
         //
         // NOTE: if the size is more than block size, it will be split into
         // multiple allocation.
-        if (size <= big_file_prealloc_size()) {
+        const int64_t prealloc_size = big_file_prealloc_size(NULL == tmp ? 0 : tmp->get_global_end());
+        if (size <= prealloc_size) {
           if (!is_big_ && size <= small_file_prealloc_size()) {
             alloc_size = common::upper_align(size, small_file_prealloc_size());
           } else {
-            alloc_size = common::upper_align(size, big_file_prealloc_size());
+            alloc_size = common::upper_align(size, prealloc_size);
           }
         } else if (size > ObTmpMacroBlock::get_block_size()) {
           alloc_size = ObTmpMacroBlock::get_block_size();
@@ -1002,6 +1014,13 @@ int ObTmpFile::aio_write(const ObTmpFileIOInfo &io_info, ObTmpFileIOHandle &hand
           SMALL_FILE_MAX_THRESHOLD * ObTmpMacroBlock::get_default_page_size();
     }
   }
+  if (OB_SUCC(ret)) {
+    // the write is done once the data is copied into the write cache of tenant
+    EVENT_INC(ObStatEventIds::TMP_FILE_WRITE_COUNT);
+    EVENT_ADD(ObStatEventIds::TMP_FILE_WRITE_BYTES, io_info.size_);
+    EVENT_ADD(ObStatEventIds::TMP_FILE_WRITE_TIME,
+              common::ObTimeUtility::fast_current_time() - begin_ts);
+  }
   return ret;
 }
 
@@ -1126,9 +1145,20 @@ int64_t ObTmpFile::small_file_prealloc_size()
   return SMALL_FILE_MAX_THRESHOLD * ObTmpMacroBlock::get_default_page_size();
 }
 
-int64_t ObTmpFile::big_file_prealloc_size()
+int64_t ObTmpFile::big_file_prealloc_size(const int64_t file_size)
 {
-  return BIG_FILE_PREALLOC_EXTENT_SIZE * ObTmpMacroBlock::get_default_page_size();
+  // Spilling operators append small pieces to big files, grow the pre-allocated extent
+  // geometrically so that most appends go to an open extent, which saves the extent
+  // allocation under the tenant store lock and makes the file less fragmented for reading.
+  // The pre-allocated but unused pages are at most 1/BIG_FILE_PREALLOC_GROWTH_RATIO of
+  // the file, and they are given back when the extent is closed.
+  const int64_t page_size = ObTmpMacroBlock::get_default_page_size();
+  int64_t page_nums = BIG_FILE_PREALLOC_EXTENT_SIZE;
+  while (page_nums < MAX_BIG_FILE_PREALLOC_EXTENT_SIZE
+         && page_nums * BIG_FILE_PREALLOC_GROWTH_RATIO * page_size < file_size) {
+    page_nums *= 2;
+  }
+  return page_nums * page_size;
 }
 
 
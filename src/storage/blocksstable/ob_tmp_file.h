@@ -266,7 +266,7 @@ private:
       int64_t &offset,
       ObTmpFileIOHandle &handle);
   int64_t small_file_prealloc_size();
-  int64_t big_file_prealloc_size();
+  int64_t big_file_prealloc_size(const int64_t file_size);
   int64_t find_first_extent(const int64_t offset);
   void update_extent_idx_cache(const int64_t last_extent_id,
                                const int64_t last_extent_min_offset,
@@ -276,9 +276,13 @@ private:
 private:
   // NOTE:
   // 1.The pre-allocated macro should satisfy the following inequality:
-  //      SMALL_FILE_MAX_THRESHOLD < BIG_FILE_PREALLOC_EXTENT_SIZE < block size
+  //      SMALL_FILE_MAX_THRESHOLD < BIG_FILE_PREALLOC_EXTENT_SIZE
+  //        <= MAX_BIG_FILE_PREALLOC_EXTENT_SIZE < max continuous pages of block
+  // 2.The pre-allocated pages of big file grow with the file size, see big_file_prealloc_size.
   static const int64_t SMALL_FILE_MAX_THRESHOLD = 4;
   static const int64_t BIG_FILE_PREALLOC_EXTENT_SIZE = 8;
+  static const int64_t MAX_BIG_FILE_PREALLOC_EXTENT_SIZE = 64;
+  static const int64_t BIG_FILE_PREALLOC_GROWTH_RATIO = 8;
   static const int64_t READ_SIZE_PER_BATCH = 8 * 1024 * 1024; // 8MB
 
   bool is_inited_;
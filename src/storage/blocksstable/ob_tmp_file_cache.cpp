@@ -12,6 +12,7 @@
 
 #include "observer/omt/ob_tenant_config_mgr.h"
 #include "lib/stat/ob_diagnose_info.h"
+#include "lib/stat/ob_session_stat.h"
 #include "common/ob_smart_var.h"
 #include "storage/ob_file_system_router.h"
 #include "share/ob_task_define.h"
@@ -1219,6 +1220,11 @@ int ObTmpTenantMemBlockManager::write_io(
     } else if (OB_FAIL(OB_SERVER_BLOCK_MGR.update_write_time(handle.get_macro_id(),
         true/*update_to_max_time*/))) { //just to skip bad block inspect
       STORAGE_LOG(WARN, "fail to update macro id write time", K(ret), "macro id", handle.get_macro_id());
+    } else {
+      // may be washed by a thread of other tenant
+      common::ObTenantStatEstGuard stat_guard(tenant_id_);
+      EVENT_INC(ObStatEventIds::TMP_FILE_FLUSH_COUNT);
+      EVENT_ADD(ObStatEventIds::TMP_FILE_FLUSH_BYTES, io_info.size_);
     }
   }
   return ret;
@@ -47,6 +47,17 @@ struct CompHelper
   {
     return search_key.compare(idx_key, cmp);
   }
+  // compare by the normalized key prefixes inlined in node first, the keys are
+  // dereferenced only if the prefixes are not comparable or equal.
+  OB_INLINE int compare(const BtreeKey search_key, const uint64_t search_prefix,
+                        const BtreeKey idx_key, const uint64_t idx_prefix, int &cmp) const
+  {
+    int ret = OB_SUCCESS;
+    if (!BtreeKey::compare_prefix(search_prefix, idx_prefix, cmp)) {
+      ret = search_key.compare(idx_key, cmp);
+    }
+    return ret;
+  }
 };
 
 class RWLock
@@ -244,8 +255,18 @@ public:
   }
   int get_next_active_child(int pos, int64_t version, int64_t* cnt, MultibitSet *index = nullptr);
   int get_prev_active_child(int pos, int64_t version, int64_t* cnt, MultibitSet *index = nullptr);
+  OB_INLINE uint64_t get_prefix(int pos, MultibitSet *index = nullptr) const
+  {
+    return prefix_[get_real_pos(pos, index)];
+  }
   OB_INLINE void set_key_value(int pos, BtreeKey key, BtreeVal val)
   {
+    set_key_value(pos, key, key.get_prefix(), val);
+  }
+  OB_INLINE void set_key_value(int pos, BtreeKey key, uint64_t prefix, BtreeVal val)
+  {
+    // prefix and key must be visible before val, which is published by index or parent
+    prefix_[pos] = prefix;
     kvs_[pos].key_ = key;
     ATOMIC_STORE(&kvs_[pos].val_, val);
   }
@@ -274,6 +295,7 @@ protected:
     int start = 0;
     int end = 0;
     int ret = OB_SUCCESS;
+    const uint64_t key_prefix = key.get_prefix();
     // Only leaf node try append directly, other scence do nothign with index.
     if (is_leaf()) {
       index->load(index_);
@@ -285,7 +307,8 @@ protected:
     while (OB_SUCC(ret) && start < end && !is_equal) {
       int mid = start + (end - start) / 2;
       int cmp_ret = 0;
-      if (OB_FAIL(nh.compare(key, get_key(mid, index), cmp_ret))) {
+      const int real_pos = get_real_pos(mid, index);
+      if (OB_FAIL(nh.compare(key, key_prefix, kvs_[real_pos].key_, prefix_[real_pos], cmp_ret))) {
         OB_LOG(ERROR, "failed to compare", K(key), K(get_key(mid, index)));
       } else if (0 == cmp_ret) {
         is_equal = true;
@@ -321,6 +344,9 @@ private:
   uint16_t magic_num_; // 2byte
   RWLock lock_; // 4byte
   MultibitSet index_; // 8byte this is the real position of kv.
+  // normalized prefix of kvs_[i].key_, binary search only touches this array
+  // unless prefixes tie, instead of dereferencing every key.
+  uint64_t prefix_[NODE_KEY_COUNT]; // 8 * 15 = 120byte
   BtreeKV kvs_[NODE_KEY_COUNT]; // 16 * 15 = 240byte
 };
 
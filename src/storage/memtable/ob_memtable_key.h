@@ -298,6 +298,52 @@ public:
   int64_t to_string(char *buf, const int64_t buf_len) const { return rowkey_->to_string(buf, buf_len); }
   const ObObj *get_ptr() const { return rowkey_->get_obj_ptr(); }
   const char *repr() const { return rowkey_->repr(); }
+  // Normalized prefix of the first rowkey column inlined in btree nodes. The top
+  // PREFIX_KIND_BITS tell the kind of prefix, NO_PREFIX means not available. The
+  // rest bits are the leading bits of the order preserving encoding (same as
+  // ObOrderPerservingEncoder) of the column, so that prefixes of the same kind
+  // compare as the full rowkeys do, unless they are equal.
+  OB_INLINE uint64_t get_prefix() const
+  {
+    uint64_t prefix = NO_PREFIX;
+    const ObObj *obj = nullptr;
+    if (OB_ISNULL(rowkey_) || rowkey_->get_obj_cnt() <= 0 || OB_ISNULL(obj = rowkey_->get_obj_ptr())) {
+      // do nothing
+    } else if (ObIntTC == obj->get_type_class()) {
+      prefix = make_prefix(INT_PREFIX, static_cast<uint64_t>(obj->get_int()) ^ (1ULL << 63));
+    } else if (ObUIntTC == obj->get_type_class()) {
+      prefix = make_prefix(UINT_PREFIX, obj->get_uint64());
+    } else if ((ObVarcharType == obj->get_type() || ObCharType == obj->get_type())
+               && (CS_TYPE_BINARY == obj->get_collation_type() || CS_TYPE_UTF8MB4_BIN == obj->get_collation_type())
+               && obj->get_val_len() >= static_cast<int32_t>(sizeof(uint64_t))) {
+      // shorter strings are not comparable by prefix because of end space padding
+      uint64_t bytes = 0;
+      MEMCPY(&bytes, obj->get_string_ptr(), sizeof(bytes));
+      prefix = make_prefix(STRING_PREFIX, __builtin_bswap64(bytes));
+    }
+    return prefix;
+  }
+  // return false if the order can't be decided by prefixes
+  OB_INLINE static bool compare_prefix(const uint64_t lhs, const uint64_t rhs, int &cmp)
+  {
+    const uint64_t kind = lhs >> PREFIX_VALUE_BITS;
+    const bool is_decided = NO_PREFIX != kind && kind == (rhs >> PREFIX_VALUE_BITS) && lhs != rhs;
+    if (is_decided) {
+      cmp = lhs < rhs ? -1 : 1;
+    }
+    return is_decided;
+  }
+private:
+  static const int64_t PREFIX_KIND_BITS = 2;
+  static const int64_t PREFIX_VALUE_BITS = 64 - PREFIX_KIND_BITS;
+  static const uint64_t NO_PREFIX = 0;
+  static const uint64_t INT_PREFIX = 1;
+  static const uint64_t UINT_PREFIX = 2;
+  static const uint64_t STRING_PREFIX = 3;
+  OB_INLINE static uint64_t make_prefix(const uint64_t kind, const uint64_t encoded)
+  {
+    return (kind << PREFIX_VALUE_BITS) | (encoded >> PREFIX_KIND_BITS);
+  }
 public:
   const common::ObStoreRowkey *rowkey_;
 };
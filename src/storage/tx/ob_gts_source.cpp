@@ -357,6 +357,17 @@ int64_t ObGtsSource::get_task_count() const
   return task_count;
 }
 
+bool ObGtsSource::need_wakeup_wait_gts_elapse_tasks()
+{
+  int64_t task_count = 0;
+  for (int64_t i = WAIT_GTS_QUEUE_START_INDEX; i < TOTAL_GTS_QUEUE_COUNT; i++) {
+    task_count += queue_[i].get_task_count();
+  }
+  // check the interval only if there are waiters, so that the first refresh
+  // after a task is pushed can wake it up
+  return task_count > 0 && wakeup_wait_gts_elapse_interval_.reach();
+}
+
 int ObGtsSource::gts_callback_interrupted(const int errcode)
 {
   int ret = OB_SUCCESS;
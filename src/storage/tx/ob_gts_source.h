@@ -69,7 +69,8 @@ private:
 class ObGtsSource
 {
 public:
-  ObGtsSource() : log_interval_(3 * 1000 * 1000), refresh_location_interval_(100 * 1000) { reset(); }
+  ObGtsSource() : log_interval_(3 * 1000 * 1000), refresh_location_interval_(100 * 1000),
+                  wakeup_wait_gts_elapse_interval_(WAKEUP_WAIT_GTS_ELAPSE_INTERVAL_US) { reset(); }
   ~ObGtsSource() { destroy(); }
   int init(const uint64_t tenant_id, const common::ObAddr &server, ObIGtsRequestRpc *gts_request_rpc,
            ObILocationAdapter *location_adapter);
@@ -82,6 +83,9 @@ public:
   int get_srr(MonotonicTs &srr);
   int get_latest_srr(MonotonicTs &latest_srr);
   int64_t get_task_count() const;
+  // whether the tasks waiting for gts elapse need to be woken up after gts cache is
+  // refreshed by other servers, at most once per WAKEUP_WAIT_GTS_ELAPSE_INTERVAL_US
+  bool need_wakeup_wait_gts_elapse_tasks();
   int gts_callback_interrupted(const int errcode);
 public:
   int update_gts(const int64_t gts, bool &update);
@@ -109,6 +113,7 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  static const int64_t WAKEUP_WAIT_GTS_ELAPSE_INTERVAL_US = 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -122,6 +127,7 @@ private:
   common::ObTimeInterval log_interval_;
   common::ObAddr gts_cache_leader_;
   common::ObTimeInterval refresh_location_interval_;
+  common::ObTimeInterval wakeup_wait_gts_elapse_interval_;
 };
 
 } // transaction
@@ -35,8 +35,9 @@ using namespace obrpc;
 namespace transaction
 {
 int64_t ObTransCtxFactory::active_coord_ctx_count_ CACHE_ALIGNED = 0;
-int64_t ObTransCtxFactory::active_part_ctx_count_ CACHE_ALIGNED = 0;
-int64_t ObTransCtxFactory::total_release_part_ctx_count_ CACHE_ALIGNED = 0;
+ObTransCtxFactory::PartCtxCountSlot
+  ObTransCtxFactory::part_ctx_count_slots_[ObTransCtxFactory::PART_CTX_COUNT_SLOT_NUM];
+bool ObTransCtxFactory::part_ctx_count_reach_limit_ CACHE_ALIGNED = false;
 const char *ObTransCtxFactory::mod_type_ = "OB_TRANS_CTX";
 
 int64_t ObLSTxCtxMgrFactory::alloc_count_ = 0;
@@ -113,18 +114,19 @@ ObTransCtx *ObTransCtxFactory::alloc(const int64_t ctx_type)
 
   if (OB_LIKELY(!ObTransErrsim::is_memory_errsim())) {
     if (ObTransCtxType::PARTICIPANT == ctx_type) {
+      // summing up the sharded counter is expensive, so the limit is checked periodically
+      if (REACH_TIME_INTERVAL(PART_CTX_LIMIT_CHECK_INTERVAL)) {
+        ATOMIC_STORE(&part_ctx_count_reach_limit_, get_active_part_ctx_count_() > MAX_PART_CTX_COUNT);
+      }
       // During restart, the number of transaction contexts is relatively large
       // and cannot be limited, otherwise there will be circular dependencies
-      if (ATOMIC_LOAD(&active_part_ctx_count_) > MAX_PART_CTX_COUNT && GCTX.status_ == observer::SS_SERVING) {
-        TRANS_LOG_RET(ERROR, tmp_ret, "participant context memory alloc failed", K_(active_part_ctx_count));
+      if (ATOMIC_LOAD(&part_ctx_count_reach_limit_) && GCTX.status_ == observer::SS_SERVING) {
+        TRANS_LOG_RET(ERROR, tmp_ret, "participant context memory alloc failed",
+                      "active_part_ctx_count", get_active_part_ctx_count_());
         tmp_ret = OB_TRANS_CTX_COUNT_REACH_LIMIT;
       } else if (NULL != (ctx = mtl_sop_borrow(ObPartTransCtx))) {
-        (void)ATOMIC_FAA(&active_part_ctx_count_, 1);
-        TRANS_LOG(DEBUG,
-                  "[Tx Ctx] alloc part_ctx success",
-                  KP(ctx),
-                  K(active_part_ctx_count_),
-                  K(total_release_part_ctx_count_));
+        (void)ATOMIC_FAA(&get_part_ctx_count_slot_().active_count_, 1);
+        TRANS_LOG(DEBUG, "[Tx Ctx] alloc part_ctx success", KP(ctx));
       } else {
         // do nothing
       }
@@ -136,9 +138,9 @@ ObTransCtx *ObTransCtxFactory::alloc(const int64_t ctx_type)
   if (REACH_TIME_INTERVAL(TRANS_MEM_STAT_INTERVAL)) {
     TRANS_LOG(INFO, "ObTransCtx statistics",
       K_(active_coord_ctx_count),
-      K_(active_part_ctx_count),
-      K_(total_release_part_ctx_count));
-      (void)ATOMIC_STORE(&total_release_part_ctx_count_, 0);
+      "active_part_ctx_count", get_active_part_ctx_count_(),
+      "total_release_part_ctx_count", get_release_part_ctx_count_());
+      reset_release_part_ctx_count_();
   }
 
   (void) tmp_ret; // make compiler happy
@@ -153,17 +155,39 @@ void ObTransCtxFactory::release(ObTransCtx *ctx)
     ObPartTransCtx *part_ctx = static_cast<ObPartTransCtx *>(ctx);
     part_ctx->destroy();
     mtl_sop_return(ObPartTransCtx, part_ctx);
-    (void)ATOMIC_FAA(&active_part_ctx_count_, -1);
-    (void)ATOMIC_FAA(&total_release_part_ctx_count_, 1);
-    TRANS_LOG(DEBUG,
-              "[Tx Ctx] release part_ctx success",
-              KP(ctx),
-              K(active_part_ctx_count_),
-              K(total_release_part_ctx_count_));
+    PartCtxCountSlot &slot = get_part_ctx_count_slot_();
+    (void)ATOMIC_FAA(&slot.active_count_, -1);
+    (void)ATOMIC_FAA(&slot.release_count_, 1);
+    TRANS_LOG(DEBUG, "[Tx Ctx] release part_ctx success", KP(ctx));
     ctx = NULL;
   }
 }
 
+int64_t ObTransCtxFactory::get_active_part_ctx_count_()
+{
+  int64_t count = 0;
+  for (int64_t i = 0; i < PART_CTX_COUNT_SLOT_NUM; i++) {
+    count += ATOMIC_LOAD(&part_ctx_count_slots_[i].active_count_);
+  }
+  return count;
+}
+
+int64_t ObTransCtxFactory::get_release_part_ctx_count_()
+{
+  int64_t count = 0;
+  for (int64_t i = 0; i < PART_CTX_COUNT_SLOT_NUM; i++) {
+    count += ATOMIC_LOAD(&part_ctx_count_slots_[i].release_count_);
+  }
+  return count;
+}
+
+void ObTransCtxFactory::reset_release_part_ctx_count_()
+{
+  for (int64_t i = 0; i < PART_CTX_COUNT_SLOT_NUM; i++) {
+    ATOMIC_STORE(&part_ctx_count_slots_[i].release_count_, 0);
+  }
+}
+
 //ObLSTxCtxMgrFactory
 ObLSTxCtxMgr *ObLSTxCtxMgrFactory::alloc(const uint64_t tenant_id)
 {
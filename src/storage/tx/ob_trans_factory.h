@@ -15,6 +15,7 @@
 
 #include <stdint.h>
 #include "lib/objectpool/ob_concurrency_objpool.h"
+#include "lib/thread_local/ob_tsi_utils.h"
 #include "storage/tx/ob_trans_define.h"
 // #include "ob_trans_log.h"
 
@@ -53,16 +54,34 @@ class ObTransCtxFactory
 public:
   static ObTransCtx *alloc(const int64_t ctx_type);
   static void release(ObTransCtx *ctx);
-  static int64_t get_alloc_count() { return ATOMIC_LOAD(&active_part_ctx_count_); }
+  static int64_t get_alloc_count() { return get_active_part_ctx_count_(); }
   static int64_t get_release_count() { return 0; }
   static const char *get_mod_type() { return mod_type_; }
-  static int64_t get_active_part_ctx_cunt() { return ATOMIC_LOAD(&active_part_ctx_count_); }
+  static int64_t get_active_part_ctx_cunt() { return get_active_part_ctx_count_(); }
 private:
+  // the part ctx counters are updated by every transaction of all tenants, so they are
+  // sharded by cpu and every cpu owns a whole cache line. They are only used for the
+  // coarse MAX_PART_CTX_COUNT limit and statistics, never for emptiness checks.
+  struct PartCtxCountSlot
+  {
+    int64_t active_count_;
+    int64_t release_count_;
+  } CACHE_ALIGNED;
+  static PartCtxCountSlot &get_part_ctx_count_slot_()
+  {
+    return part_ctx_count_slots_[common::icpu_id() % PART_CTX_COUNT_SLOT_NUM];
+  }
+  static int64_t get_active_part_ctx_count_();
+  static int64_t get_release_part_ctx_count_();
+  static void reset_release_part_ctx_count_();
+private:
+  static const int64_t PART_CTX_LIMIT_CHECK_INTERVAL = 10 * 1000; // 10ms
+  static const int64_t PART_CTX_COUNT_SLOT_NUM = 128;
   static const char *mod_type_;
   static int64_t active_sche_ctx_count_;
   static int64_t active_coord_ctx_count_;
-  static int64_t active_part_ctx_count_;
-  static int64_t total_release_part_ctx_count_;
+  static PartCtxCountSlot part_ctx_count_slots_[PART_CTX_COUNT_SLOT_NUM];
+  static bool part_ctx_count_reach_limit_;
 };
 
 template <typename T, int64_t STATISTIC_INTERVAL = TRANS_MEM_STAT_INTERVAL>
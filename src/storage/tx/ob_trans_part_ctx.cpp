@@ -2300,6 +2300,30 @@ int ObPartTransCtx::wait_gts_elapse_commit_version_(bool &need_wait)
   return ret;
 }
 
+// The commit response of local tx waits for both the commit log synced and the gts elapsing
+// the commit version, and the latter used to start only after the former is done. Refresh gts
+// as soon as the commit log is submitted, so that the two waits are pipelined and the gts has
+// usually elapsed the commit version when the commit log is synced.
+void ObPartTransCtx::prefetch_gts_for_commit_version_()
+{
+  int tmp_ret = OB_SUCCESS;
+  SCN gts;
+  MonotonicTs receive_gts_ts;
+  const SCN commit_version = ctx_tx_data_.get_commit_version();
+  ObITsMgr *ts_mgr = trans_service_->get_ts_mgr();
+
+  if (OB_ISNULL(ts_mgr) || !commit_version.is_valid()) {
+    // do nothing
+  } else if (OB_SUCCESS == ts_mgr->get_gts(tenant_id_, NULL, gts) && gts > commit_version) {
+    // the cached gts has elapsed the commit version
+  } else if (OB_TMP_FAIL(ts_mgr->get_gts(tenant_id_, MonotonicTs::current_time(), NULL, gts, receive_gts_ts))) {
+    // OB_EAGAIN means the gts request has been sent, and no task is registered here
+    if (OB_EAGAIN != tmp_ret) {
+      TRANS_LOG_RET(WARN, tmp_ret, "prefetch gts for commit version failed", K(commit_version), KPC(this));
+    }
+  }
+}
+
 int ObPartTransCtx::generate_prepare_version_()
 {
   int ret = OB_SUCCESS;
@@ -3650,6 +3674,9 @@ int ObPartTransCtx::after_submit_log_(ObTxLogBlock &log_block,
       }
        elr_handler_.check_and_early_lock_release(this);
     }
+    if (is_local_tx_()) {
+      prefetch_gts_for_commit_version_();
+    }
   }
   if (OB_SUCC(ret) && is_contain(cb_arg_array, ObTxLogType::TX_ABORT_LOG)) {
     sub_state_.set_state_log_submitting();
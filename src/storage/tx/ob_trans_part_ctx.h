@@ -531,6 +531,7 @@ private:
 protected:
   virtual int get_gts_(share::SCN &gts);
   virtual int wait_gts_elapse_commit_version_(bool &need_wait);
+  virtual void prefetch_gts_for_commit_version_();
   virtual int get_local_max_read_version_(share::SCN &local_max_read_version);
   virtual int update_local_max_commit_version_(const share::SCN &commit_version);
   virtual int check_and_response_scheduler_(ObTxState next_phase, int result);
@@ -105,6 +105,7 @@ int ObTx##name##P::process()                                            \
       ret = OB_INVALID_ARGUMENT;                                        \
       TRANS_LOG(ERROR, "msg is invalid", K(ret), K_(arg));              \
     } else {                                                            \
+      (*txs).refresh_gts_by_msg(arg_);                                  \
       ret = (*txs).handle_func(arg_, result_);                          \
     }                                                                   \
     const int64_t cur_ts = ObTimeUtility::current_time();               \
@@ -371,6 +372,7 @@ int ObTransRpc::post_msg(const ObAddr &server, ObTxMsg &msg)
       OB_UNLIKELY(!server.is_valid()) || OB_UNLIKELY(!msg.is_valid())) {
     TRANS_LOG(WARN, "invalid argument", K(tenant_id), K(server), K(msg));
     ret = OB_INVALID_ARGUMENT;
+  } else if (FALSE_IT(fill_gts_(msg))) {
   } else if (ObTxMsgTypeChecker::is_2pc_msg_type(msg.get_msg_type())) {
     if (OB_FAIL(batch_rpc_->post(msg.tenant_id_,
                                  server,
@@ -427,6 +429,7 @@ int ObTransRpc::post_msg(const ObLSID &p, ObTxMsg &msg)
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_FAIL(trans_service_->get_location_adapter()->nonblock_get_leader(cluster_id, tenant_id, p, server))) {
     TRANS_LOG(WARN, "get leader failed", KR(ret), K(msg), K(cluster_id), K(p));
+  } else if (FALSE_IT(fill_gts_(msg))) {
   } else if (ObTxMsgTypeChecker::is_2pc_msg_type(msg.get_msg_type())) {
     // 2pc msg optimization
     const int64_t dst_cluster_id = obrpc::ObRpcNetHandler::CLUSTER_ID;
@@ -455,6 +458,17 @@ int ObTransRpc::post_msg(const ObLSID &p, ObTxMsg &msg)
   return ret;
 }
 
+// piggyback the gts cached locally, so that the receiver can refresh its gts cache
+// without sending gts rpc to the timestamp service
+void ObTransRpc::fill_gts_(ObTxMsg &msg)
+{
+  SCN gts;
+  ObITsMgr *ts_mgr = trans_service_->get_ts_mgr();
+  if (OB_NOT_NULL(ts_mgr) && OB_SUCCESS == ts_mgr->get_gts(msg.tenant_id_, NULL, gts)) {
+    msg.gts_ = gts.get_val_for_gts();
+  }
+}
+
 int ObTransRpc::post_msg(const ObAddr &server, const ObTxFreeRouteMsg &msg)
 {
   int ret = OB_SUCCESS;
@@ -418,6 +418,7 @@ private:
   int post_sub_request_msg_(const ObAddr &server, ObTxMsg &msg);
   int post_sub_response_msg_(const ObAddr &server, ObTxMsg &msg);
   int post_standby_msg_(const ObAddr &server, ObTxMsg &msg);
+  void fill_gts_(ObTxMsg &msg);
   void statistics_();
 private:
   static const int64_t STAT_INTERVAL = 1 * 1000 * 1000;
@@ -1879,6 +1879,20 @@ int ObTransService::check_ls_status_(const share::ObLSID &ls_id, bool &leader)
 }
 
 // need_check_leader : just for unittest case
+void ObTransService::refresh_gts_by_msg(const ObTxMsg &msg)
+{
+  int ret = OB_SUCCESS;
+  bool update = false;
+  const int64_t gts = msg.get_gts();
+  if (gts <= 0 || msg.get_cluster_id() != GCONF.cluster_id) {
+    // msg from old version or other cluster
+  } else if (OB_FAIL(ts_mgr_->update_gts(msg.get_tenant_id(), gts, update))) {
+    TRANS_LOG(WARN, "refresh gts by msg failed", K(ret), K(gts), K(msg));
+  } else {
+    TRANS_LOG(DEBUG, "refresh gts by msg", K(update), K(gts), K(msg));
+  }
+}
+
 int ObTransService::handle_tx_batch_req(int msg_type,
                                         const char *buf,
                                         int32_t size,
@@ -1898,6 +1912,7 @@ int ObTransService::handle_tx_batch_req(int msg_type,
     } else if (!msg.is_valid()) {                                       \
       ret = OB_INVALID_ARGUMENT;                                        \
       TRANS_LOG(ERROR, "msg is invalid", K(ret), K(msg_type), K(msg));  \
+    } else if (FALSE_IT(refresh_gts_by_msg(msg))) {                     \
     } else if (OB_FAIL(get_tx_ctx_(msg.get_receiver(), msg.get_trans_id(), ctx))) { \
       TRANS_LOG(WARN, "get tx context fail", K(ret),  K(msg));          \
       if (OB_TRANS_CTX_NOT_EXIST == ret ||                              \
@@ -565,6 +565,12 @@ int ObTsMgr::update_gts(const uint64_t tenant_id, const int64_t gts, bool &updat
         TRANS_LOG(WARN, "ts source is NULL", K(ret));
       } else if (OB_FAIL(ts_source->update_gts(gts, update))) {
         TRANS_LOG(WARN, "update gts cache failed", K(ret), K(tenant_id), K(gts));
+      } else if (update && ts_source->need_wakeup_wait_gts_elapse_tasks()) {
+        // the tasks waiting for gts elapse may be satisfied by the new gts, wake them up
+        // without waiting for the next gts rpc, the wakeup is coalesced by ts source
+        if (OB_FAIL(push_wait_gts_elapse_tasks_(tenant_id))) {
+          TRANS_LOG(WARN, "push wait gts elapse tasks failed", K(ret), K(tenant_id), K(gts));
+        }
       }
     }
   }
@@ -572,6 +578,31 @@ int ObTsMgr::update_gts(const uint64_t tenant_id, const int64_t gts, bool &updat
   return ret;
 }
 
+int ObTsMgr::push_wait_gts_elapse_tasks_(const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  ObTsResponseTask *task = NULL;
+  for (int64_t i = ObGtsSource::WAIT_GTS_QUEUE_START_INDEX; OB_SUCC(ret) && i < ObGtsSource::TOTAL_GTS_QUEUE_COUNT; ++i) {
+    if (NULL == (task = ObTsResponseTaskFactory::alloc())) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      TRANS_LOG(ERROR, "alloc memory failed", KR(ret), KP(task));
+    } else {
+      if (OB_FAIL(task->init(tenant_id, i, this, TS_SOURCE_GTS))) {
+        TRANS_LOG(WARN, "gts task init error", KR(ret), KP(task), K(i), K(tenant_id));
+      } else if (OB_FAIL(ts_worker_.push_task(tenant_id, task))) {
+        TRANS_LOG(WARN, "push gts task failed", KR(ret), KP(task), K(tenant_id));
+      } else {
+        TRANS_LOG(DEBUG, "push gts task success", KP(task), K(tenant_id));
+      }
+      if (OB_SUCCESS != ret) {
+        ObTsResponseTaskFactory::free(task);
+        task = NULL;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTsMgr::get_gts(const uint64_t tenant_id, ObTsCbTask *task, SCN &scn)
 {
   int ret = OB_SUCCESS;
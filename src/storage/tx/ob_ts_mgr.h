@@ -284,6 +284,7 @@ public:
   int update_gts(const uint64_t tenant_id, const MonotonicTs srr, const int64_t gts, const int ts_type, bool &update);
   int delete_tenant(const uint64_t tenant_id);
 public:
+  // update gts cache with the gts piggybacked by other servers, which must come from gts service
   int update_gts(const uint64_t tenant_id, const int64_t gts, bool &update);
   //根据stc获取合适的gts值，如果条件不满足需要注册gts task，等异步回调
   int get_gts(const uint64_t tenant_id,
@@ -315,6 +316,7 @@ private:
   int get_ts_source_info_(const uint64_t tenant_id, ObTsSourceInfoGuard &guard,
       const bool need_create_tenant, const bool need_update_access_ts);
   void revert_ts_source_info_(ObTsSourceInfoGuard &guard);
+  int push_wait_gts_elapse_tasks_(const uint64_t tenant_id);
   int add_tenant_(const uint64_t tenant_id);
   int delete_tenant_(const uint64_t tenant_id);
   int remove_dropped_tenant_(const uint64_t tenant_id);
@@ -27,7 +27,8 @@ OB_SERIALIZE_MEMBER(ObTxMsg,
                     request_id_,
                     timestamp_,
                     epoch_,
-                    cluster_id_);
+                    cluster_id_,
+                    gts_);
 OB_SERIALIZE_MEMBER_INHERIT(ObTxSubPrepareMsg, ObTxMsg, expire_ts_, xid_, parts_, app_trace_info_);
 OB_SERIALIZE_MEMBER_INHERIT(ObTxSubPrepareRespMsg, ObTxMsg, ret_);
 OB_SERIALIZE_MEMBER_INHERIT(ObTxSubCommitMsg, ObTxMsg, xid_);
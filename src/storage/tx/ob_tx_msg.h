@@ -78,7 +78,8 @@ namespace transaction
                     sender_(share::ObLSID::INVALID_LS_ID),
                     request_id_(-1),
                     timestamp_(ObTimeUtility::current_time()),
-                    cluster_id_(OB_INVALID_CLUSTER_ID)
+                    cluster_id_(OB_INVALID_CLUSTER_ID),
+                    gts_(0)
       {}
       ~ObTxMsg() {}
       int16_t type_;
@@ -94,6 +95,8 @@ namespace transaction
       int64_t request_id_;
       int64_t timestamp_;
       int64_t cluster_id_;
+      /* gts cached by sender, used to refresh the gts cache of receiver without gts rpc */
+      int64_t gts_;
       VIRTUAL_TO_STRING_KV(K_(type),
                            K_(cluster_version),
                            K_(tenant_id),
@@ -104,7 +107,8 @@ namespace transaction
                            K_(epoch),
                            K_(request_id),
                            K_(timestamp),
-                           K_(cluster_id));
+                           K_(cluster_id),
+                           K_(gts));
       OB_UNIS_VERSION_V(1);
     public:
       virtual bool is_valid() const;
@@ -119,6 +123,7 @@ namespace transaction
       uint64_t get_tenant_id() const { return tenant_id_; }
       int64_t get_cluster_id() const { return cluster_id_; }
       int64_t get_cluster_version() const { return cluster_version_; }
+      int64_t get_gts() const { return gts_; }
       virtual int fill_buffer(char* buf, int64_t size, int64_t &filled_size) const override
       {
         filled_size = 0;
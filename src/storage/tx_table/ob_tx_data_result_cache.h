@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_OB_TX_DATA_RESULT_CACHE
+#define OCEANBASE_STORAGE_OB_TX_DATA_RESULT_CACHE
+
+#include "lib/allocator/ob_malloc.h"
+#include "lib/lock/ob_spin_rwlock.h"
+#include "share/rc/ob_tenant_base.h"
+#include "storage/tx/ob_tx_data_define.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+// The results of tx data lookups of one log stream, which is shared by all readers of the log
+// stream. Delayed cleanout makes readers meet the same recently finished transactions again and
+// again, this cache saves the lookups of tx data memtables, kv cache and tx data sstables.
+//
+// 1. The slot of a tx is decided by the low bits of tx_id, so the transactions in a range of tx_id
+//    (e.g. the transactions of a write burst) never evict each other.
+// 2. Only decided results are cached, i.e. the committed or aborted tx data without undo actions,
+//    and the negative result of transactions which are not exist in both tx ctx table and tx data
+//    table. They never change once decided. A negative result only saves the lookups of readers
+//    which can decide the state by ObITxDataCheckFunctor::recheck().
+// 3. Every result is tagged with the epoch of tx table, so the results before offline or online
+//    are never hit.
+// 4. The slots are allocated on the first set, so the log streams which never meet finished
+//    transactions (e.g. the idle or the read only ones) do not pay for them.
+class ObTxDataResultCache
+{
+public:
+  static const int64_t SLOT_CNT = 1 << 11; /* 2048 */
+  static const int64_t SLOT_MASK = SLOT_CNT - 1;
+
+private:
+  struct CacheItem {
+    ObTxCommitData tx_data_;
+    int64_t epoch_;
+    bool is_valid_;
+    // the tx is not exist in both tx ctx table and tx data table
+    bool is_not_exist_;
+    common::SpinRWLock lock_;
+
+    CacheItem() : tx_data_(), epoch_(0), is_valid_(false), is_not_exist_(false) {}
+
+    void reset()
+    {
+      tx_data_.reset();
+      epoch_ = 0;
+      is_valid_ = false;
+      is_not_exist_ = false;
+    }
+
+    TO_STRING_KV(K_(tx_data), K_(epoch), K_(is_valid), K_(is_not_exist));
+  };
+
+public:
+  ObTxDataResultCache() : cache_items_(nullptr) {}
+  ~ObTxDataResultCache() { destroy(); }
+
+  // @return OB_SUCCESS, the tx data is cached
+  //         OB_TRANS_CTX_NOT_EXIST, the tx is cached as not exist
+  //         OB_ENTRY_NOT_EXIST, the tx is not cached
+  int get(const transaction::ObTransID tx_id, const int64_t epoch, ObTxCommitData &tx_commit_data)
+  {
+    int ret = OB_ENTRY_NOT_EXIST;
+    CacheItem *items = ATOMIC_LOAD(&cache_items_);
+    if (OB_NOT_NULL(items)) {
+      CacheItem &item = items[tx_id.get_id() & SLOT_MASK];
+      common::SpinRLockGuard guard(item.lock_);
+      if (item.is_valid_ && epoch == item.epoch_ && tx_id == item.tx_data_.tx_id_) {
+        if (item.is_not_exist_) {
+          ret = OB_TRANS_CTX_NOT_EXIST;
+        } else {
+          tx_commit_data = item.tx_data_;
+          ret = OB_SUCCESS;
+        }
+      }
+    }
+    return ret;
+  }
+
+  void set(const ObTxCommitData &tx_commit_data, const int64_t epoch)
+  {
+    CacheItem *items = nullptr;
+    if (ObTxCommitData::COMMIT != tx_commit_data.state_ && ObTxCommitData::ABORT != tx_commit_data.state_) {
+      // only the decided results are cached
+    } else if (OB_NOT_NULL(items = get_or_alloc_items_())) {
+      CacheItem &item = items[tx_commit_data.tx_id_.get_id() & SLOT_MASK];
+      common::SpinWLockGuard guard(item.lock_);
+      item.tx_data_ = tx_commit_data;
+      item.epoch_ = epoch;
+      item.is_not_exist_ = false;
+      item.is_valid_ = true;
+    }
+  }
+
+  void set_not_exist(const transaction::ObTransID tx_id, const int64_t epoch)
+  {
+    CacheItem *items = get_or_alloc_items_();
+    if (OB_NOT_NULL(items)) {
+      CacheItem &item = items[tx_id.get_id() & SLOT_MASK];
+      common::SpinWLockGuard guard(item.lock_);
+      item.tx_data_.reset();
+      item.tx_data_.tx_id_ = tx_id;
+      item.epoch_ = epoch;
+      item.is_not_exist_ = true;
+      item.is_valid_ = true;
+    }
+  }
+
+  // invalidate all results and keep the slots, readers may be running concurrently
+  void reset()
+  {
+    CacheItem *items = ATOMIC_LOAD(&cache_items_);
+    if (OB_NOT_NULL(items)) {
+      for (int64_t i = 0; i < SLOT_CNT; i++) {
+        common::SpinWLockGuard guard(items[i].lock_);
+        items[i].reset();
+      }
+    }
+  }
+
+  // free the slots, the caller must make sure there is no reader
+  void destroy()
+  {
+    CacheItem *items = ATOMIC_TAS(&cache_items_, static_cast<CacheItem *>(nullptr));
+    if (OB_NOT_NULL(items)) {
+      free_items_(items);
+    }
+  }
+
+  bool is_allocated() const { return OB_NOT_NULL(ATOMIC_LOAD(&cache_items_)); }
+
+  TO_STRING_KV("slot_cnt", SLOT_CNT, "is_allocated", is_allocated());
+
+private:
+  CacheItem *get_or_alloc_items_()
+  {
+    CacheItem *items = ATOMIC_LOAD(&cache_items_);
+    void *buf = nullptr;
+    if (OB_NOT_NULL(items)) {
+    } else if (OB_ISNULL(buf = common::ob_malloc(sizeof(CacheItem) * SLOT_CNT,
+                                                 common::ObMemAttr(MTL_ID(), "TxDataResCache")))) {
+      // the result cache is best effort, the lookup goes on without it
+      STORAGE_LOG_RET(WARN, common::OB_ALLOCATE_MEMORY_FAILED, "alloc tx data result cache failed");
+    } else {
+      CacheItem *new_items = static_cast<CacheItem *>(buf);
+      for (int64_t i = 0; i < SLOT_CNT; i++) {
+        new (new_items + i) CacheItem();
+      }
+      if (OB_NOT_NULL(items = ATOMIC_VCAS(&cache_items_, static_cast<CacheItem *>(nullptr), new_items))) {
+        // allocated by another thread concurrently
+        free_items_(new_items);
+      } else {
+        items = new_items;
+      }
+    }
+    return items;
+  }
+
+  static void free_items_(CacheItem *items)
+  {
+    for (int64_t i = 0; i < SLOT_CNT; i++) {
+      items[i].~CacheItem();
+    }
+    common::ob_free(items);
+  }
+
+private:
+  CacheItem *cache_items_;
+};
+
+}  // namespace storage
+}  // namespace oceanbase
+
+#endif  // OCEANBASE_STORAGE_OB_TX_DATA_RESULT_CACHE
@@ -148,6 +148,7 @@ int ObTxTable::offline()
     LOG_WARN("offline tx data table failed", K(ret));
   } else {
     ATOMIC_STORE(&state_, TxTableState::OFFLINE);
+    result_cache_.reset();
     LOG_INFO("tx table offline succeed", K(ls_id_), KPC(this));
   }
 
@@ -667,6 +668,7 @@ void ObTxTable::destroy()
 {
   tx_data_table_.destroy();
   tx_ctx_table_.reset();
+  result_cache_.destroy();
   ls_id_.reset();
   ls_ = nullptr;
   epoch_ = 0;
@@ -722,6 +724,7 @@ int ObTxTable::check_with_tx_data(ObReadTxDataArg &read_tx_data_arg, ObITxDataCh
   // step 1 : read tx data in mini cache
   int tmp_ret = OB_SUCCESS;
   bool find_tx_data_in_cache = false;
+  bool read_tx_data_in_tables = false;
   if (OB_TMP_FAIL(check_tx_data_in_mini_cache_(read_tx_data_arg, fn))) {
     if (OB_TRANS_CTX_NOT_EXIST != tmp_ret) {
       STORAGE_LOG(WARN, "check tx data in mini cache failed", KR(tmp_ret), K(read_tx_data_arg));
@@ -731,9 +734,30 @@ int ObTxTable::check_with_tx_data(ObReadTxDataArg &read_tx_data_arg, ObITxDataCh
     find_tx_data_in_cache = true;
   }
 
-  // step 2 : read tx data in kv cache
+  // step 2 : read tx data in result cache of this ls
   if (find_tx_data_in_cache) {
     // already find tx data and do function with mini cache
+  } else if (OB_TMP_FAIL(check_tx_data_in_result_cache_(read_tx_data_arg, fn))) {
+    if (OB_ENTRY_NOT_EXIST == tmp_ret) {
+      // not cached
+    } else if (OB_TRANS_CTX_NOT_EXIST == tmp_ret) {
+      // the tx is known to be not exist, but the reader may still be able to decide its state by
+      // recheck, just like ObTxCtxTable::check_with_tx_data does. Treat it as a miss if the
+      // recheck fails, and let the tables decide.
+      if (fn.recheck()) {
+        find_tx_data_in_cache = true;
+      }
+    } else {
+      STORAGE_LOG(WARN, "check tx data in result cache failed", KR(tmp_ret), K(read_tx_data_arg));
+    }
+  } else {
+    STORAGE_LOG(DEBUG, "check tx data in result cache success", K(read_tx_data_arg), K(fn));
+    find_tx_data_in_cache = true;
+  }
+
+  // step 3 : read tx data in kv cache
+  if (find_tx_data_in_cache) {
+    // already find tx data and do function with mini cache or result cache
   } else if (OB_TMP_FAIL(check_tx_data_in_kv_cache_(read_tx_data_arg, fn))) {
     if (OB_TRANS_CTX_NOT_EXIST != tmp_ret) {
       STORAGE_LOG(WARN, "check tx data in kv cache failed", KR(tmp_ret), K(read_tx_data_arg));
@@ -743,19 +767,26 @@ int ObTxTable::check_with_tx_data(ObReadTxDataArg &read_tx_data_arg, ObITxDataCh
     find_tx_data_in_cache = true;
   }
 
-  // step 3 : read tx data in tx_ctx table and tx_data table
+  // step 4 : read tx data in tx_ctx table and tx_data table
   if (find_tx_data_in_cache) {
     // already find tx data and do function with cache
+  } else if (FALSE_IT(read_tx_data_in_tables = true)) {
   } else if (OB_FAIL(check_tx_data_in_tables_(read_tx_data_arg, fn))) {
     if (OB_TRANS_CTX_NOT_EXIST != ret) {
       STORAGE_LOG(WARN, "check tx data in tables failed", KR(ret), K(ls_id_), K(read_tx_data_arg));
     }
   }
 
-  // step 4 : make sure tx table can be read
+  // step 5 : make sure tx table can be read
   if (OB_SUCC(ret) || OB_TRANS_CTX_NOT_EXIST == ret) {
     check_state_and_epoch_(read_tx_data_arg.tx_id_, read_tx_data_arg.read_epoch_, true /*need_log_error*/, ret);
   }
+
+  // the tx is not exist in both tx ctx table and tx data table, which never changes unless the tx
+  // table is offline, remember it to save the lookups of following readers
+  if (read_tx_data_in_tables && OB_TRANS_CTX_NOT_EXIST == ret) {
+    result_cache_.set_not_exist(read_tx_data_arg.tx_id_, read_tx_data_arg.read_epoch_);
+  }
   return ret;
 }
 
@@ -778,6 +809,22 @@ int ObTxTable::check_tx_data_in_mini_cache_(ObReadTxDataArg &read_tx_data_arg, O
   return ret;
 }
 
+int ObTxTable::check_tx_data_in_result_cache_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn)
+{
+  int ret = OB_SUCCESS;
+  ObTxData tx_data;
+  if (OB_FAIL(result_cache_.get(read_tx_data_arg.tx_id_, read_tx_data_arg.read_epoch_, tx_data))) {
+    // OB_ENTRY_NOT_EXIST if not cached, or OB_TRANS_CTX_NOT_EXIST if the tx is not exist
+  } else {
+    if (OB_FAIL(fn(tx_data))) {
+      STORAGE_LOG(WARN, "check tx data in result cache failed", KR(ret), K(read_tx_data_arg), K(tx_data));
+    }
+    // only tx data without undo actions is cached, put it into mini cache either
+    read_tx_data_arg.tx_data_mini_cache_.set(tx_data);
+  }
+  return ret;
+}
+
 int ObTxTable::check_tx_data_in_kv_cache_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn)
 {
   int ret = OB_SUCCESS;
@@ -807,8 +854,9 @@ int ObTxTable::check_tx_data_in_kv_cache_(ObReadTxDataArg &read_tx_data_arg, ObI
         ret = OB_ERR_UNEXPECTED;
         STORAGE_LOG(ERROR, "read an unexpected state tx data from kv cache");
       } else if (OB_ISNULL(tx_data->undo_status_list_.head_)) {
-        // put into mini cache only if this tx data do not have undo actions
+        // put into mini cache and result cache only if this tx data do not have undo actions
         read_tx_data_arg.tx_data_mini_cache_.set(*tx_data);
+        result_cache_.set(*tx_data, read_tx_data_arg.read_epoch_);
       }
     }
   }
@@ -845,6 +893,7 @@ int ObTxTable::check_tx_data_in_tables_(ObReadTxDataArg &read_tx_data_arg, ObITx
       } else {
         if (OB_ISNULL(tx_data->undo_status_list_.head_)) {
           read_tx_data_arg.tx_data_mini_cache_.set(*tx_data);
+          result_cache_.set(*tx_data, read_tx_data_arg.read_epoch_);
         }
 
         int tmp_ret = OB_SUCCESS;
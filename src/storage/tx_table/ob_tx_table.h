@@ -19,6 +19,7 @@
 #include "storage/tx_table/ob_tx_data_table.h"
 #include "storage/tx/ob_tx_data_functor.h"
 #include "storage/tx_table/ob_tx_ctx_table.h"
+#include "storage/tx_table/ob_tx_data_result_cache.h"
 
 namespace oceanbase
 {
@@ -310,6 +311,7 @@ private:
    */
   int check_with_tx_data(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn);
   int check_tx_data_in_mini_cache_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn);
+  int check_tx_data_in_result_cache_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn);
   int check_tx_data_in_kv_cache_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn);
   int check_tx_data_in_tables_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn);
   int put_tx_data_into_kv_cache_(const ObTxData &tx_data);
@@ -330,6 +332,8 @@ private:
   // The Tx Data will be inserted into tx_data_table_ after transaction commit or abort
   ObTxDataTable default_tx_data_table_;
   ObTxDataTable &tx_data_table_;
+  // The decided tx data results shared by all readers of this ls
+  ObTxDataResultCache result_cache_;
   int64_t mini_cache_hit_cnt_;
   int64_t kv_cache_hit_cnt_;
   int64_t read_tx_data_table_cnt_;
@@ -0,0 +1,298 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "lib/compress/ob_compressor_pool.h"
+#include "lib/file/file_directory_utils.h"
+#define private public
+#include "logservice/libobcdc/src/ob_log_file_store_service.h"
+#undef private
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+static const char *TEST_DIR = "./test_file_store_service";
+
+class TestLogFileStoreService : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    bool is_exist = false;
+    EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::is_exists(TEST_DIR, is_exist));
+    if (is_exist) {
+      EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::delete_directory_rec(TEST_DIR));
+    }
+    EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::create_full_path(TEST_DIR));
+  }
+  virtual void TearDown()
+  {
+    EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::delete_directory_rec(TEST_DIR));
+  }
+  static ObCompressor *get_compressor(const char *compress_func)
+  {
+    ObCompressor *compressor = NULL;
+    EXPECT_EQ(OB_SUCCESS, ObCompressorPool::get_instance().get_compressor(compress_func, compressor));
+    return compressor;
+  }
+  // the value of a key is always the same, so that it can be verified by any reader
+  static std::string gen_value(const std::string &key, const int64_t len)
+  {
+    std::string value;
+    value.reserve(len);
+    while (static_cast<int64_t>(value.size()) < len) {
+      value.append(key);
+      value.push_back('#');
+    }
+    value.resize(len);
+    return value;
+  }
+  static std::string gen_key(const int64_t idx)
+  {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "key_%08ld", idx);
+    return std::string(buf);
+  }
+};
+
+void check_put_get(ObCompressor *compressor)
+{
+  const std::string file_path = std::string(TEST_DIR) + "/put_get.spill";
+  ObLogSpillFile spill_file;
+  std::string value;
+  EXPECT_EQ(OB_SUCCESS, spill_file.init(file_path, compressor));
+
+  // compressible and incompressible values of different sizes
+  const int64_t value_lens[] = {1, 7, 4095, 4096, 4097, 1 << 20};
+  for (int64_t i = 0; i < sizeof(value_lens) / sizeof(value_lens[0]); i++) {
+    const std::string key = TestLogFileStoreService::gen_key(i);
+    const std::string put_value = TestLogFileStoreService::gen_value(key, value_lens[i]);
+    EXPECT_EQ(OB_SUCCESS, spill_file.put(key, ObSlice(put_value.data(), put_value.size())));
+  }
+  std::string random_value(8192, '\0');
+  for (int64_t i = 0; i < static_cast<int64_t>(random_value.size()); i++) {
+    random_value[i] = static_cast<char>(rand());
+  }
+  EXPECT_EQ(OB_SUCCESS, spill_file.put("random", ObSlice(random_value.data(), random_value.size())));
+
+  for (int64_t i = 0; i < sizeof(value_lens) / sizeof(value_lens[0]); i++) {
+    const std::string key = TestLogFileStoreService::gen_key(i);
+    EXPECT_EQ(OB_SUCCESS, spill_file.get(key, value));
+    EXPECT_TRUE(TestLogFileStoreService::gen_value(key, value_lens[i]) == value);
+  }
+  EXPECT_EQ(OB_SUCCESS, spill_file.get("random", value));
+  EXPECT_TRUE(random_value == value);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, spill_file.get("not_exist", value));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, spill_file.put("empty", ObSlice()));
+
+  if (NULL != compressor) {
+    // compressible values take less space than the values themselves
+    int64_t total_len = random_value.size();
+    for (int64_t i = 0; i < sizeof(value_lens) / sizeof(value_lens[0]); i++) {
+      total_len += value_lens[i];
+    }
+    EXPECT_GT(total_len, spill_file.get_file_size());
+  }
+  EXPECT_EQ(OB_SUCCESS, spill_file.remove());
+}
+
+TEST_F(TestLogFileStoreService, put_get)
+{
+  check_put_get(NULL);
+  check_put_get(get_compressor("lz4_1.0"));
+  check_put_get(get_compressor("zstd_1.3.8"));
+}
+
+TEST_F(TestLogFileStoreService, overwrite_del_truncate)
+{
+  const std::string file_path = std::string(TEST_DIR) + "/overwrite.spill";
+  ObLogSpillFile spill_file;
+  std::string value;
+  EXPECT_EQ(OB_SUCCESS, spill_file.init(file_path, get_compressor("lz4_1.0")));
+
+  const std::string old_value(10000, 'a');
+  const std::string new_value = gen_value("new", 20000);
+  EXPECT_EQ(OB_SUCCESS, spill_file.put("k1", ObSlice(old_value.data(), old_value.size())));
+  EXPECT_EQ(OB_SUCCESS, spill_file.put("k2", ObSlice(old_value.data(), old_value.size())));
+  EXPECT_EQ(OB_SUCCESS, spill_file.put("k1", ObSlice(new_value.data(), new_value.size())));
+  EXPECT_EQ(2, spill_file.get_value_count());
+  EXPECT_EQ(OB_SUCCESS, spill_file.get("k1", value));
+  EXPECT_TRUE(new_value == value);
+  EXPECT_EQ(OB_SUCCESS, spill_file.get("k2", value));
+  EXPECT_TRUE(old_value == value);
+
+  // delete a key not exist is OK
+  EXPECT_EQ(OB_SUCCESS, spill_file.del("not_exist"));
+  EXPECT_EQ(OB_SUCCESS, spill_file.del("k1"));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, spill_file.get("k1", value));
+  // the space of k1 is released, but k2 is still readable
+  EXPECT_EQ(OB_SUCCESS, spill_file.get("k2", value));
+  EXPECT_TRUE(old_value == value);
+  EXPECT_LT(0, spill_file.get_file_size());
+
+  // the file is truncated once all values are deleted, and values are appended from the start
+  EXPECT_EQ(OB_SUCCESS, spill_file.del("k2"));
+  EXPECT_EQ(0, spill_file.get_value_count());
+  EXPECT_EQ(0, spill_file.get_file_size());
+  int64_t disk_file_size = -1;
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::get_file_size(file_path.c_str(), disk_file_size));
+  EXPECT_EQ(0, disk_file_size);
+  EXPECT_EQ(OB_SUCCESS, spill_file.put("k3", ObSlice(new_value.data(), new_value.size())));
+  EXPECT_EQ(OB_SUCCESS, spill_file.get("k3", value));
+  EXPECT_TRUE(new_value == value);
+  EXPECT_EQ(0, spill_file.index_["k3"].offset_);
+  EXPECT_EQ(OB_SUCCESS, spill_file.remove());
+}
+
+TEST_F(TestLogFileStoreService, del_range)
+{
+  const std::string file_path = std::string(TEST_DIR) + "/del_range.spill";
+  ObLogSpillFile spill_file;
+  std::string value;
+  EXPECT_EQ(OB_SUCCESS, spill_file.init(file_path, get_compressor("lz4_1.0")));
+
+  const int64_t key_cnt = 100;
+  for (int64_t i = 0; i < key_cnt; i++) {
+    const std::string key = gen_key(i);
+    const std::string put_value = gen_value(key, 100 + i * 10);
+    EXPECT_EQ(OB_SUCCESS, spill_file.put(key, ObSlice(put_value.data(), put_value.size())));
+  }
+  // [begin_key, end_key) is deleted
+  EXPECT_EQ(OB_SUCCESS, spill_file.del_range(gen_key(10), gen_key(20)));
+  EXPECT_EQ(key_cnt - 10, spill_file.get_value_count());
+  for (int64_t i = 0; i < key_cnt; i++) {
+    const std::string key = gen_key(i);
+    if (i >= 10 && i < 20) {
+      EXPECT_EQ(OB_ENTRY_NOT_EXIST, spill_file.get(key, value));
+    } else {
+      EXPECT_EQ(OB_SUCCESS, spill_file.get(key, value));
+      EXPECT_TRUE(gen_value(key, 100 + i * 10) == value);
+    }
+  }
+  // empty range
+  EXPECT_EQ(OB_SUCCESS, spill_file.del_range(gen_key(50), gen_key(50)));
+  EXPECT_EQ(key_cnt - 10, spill_file.get_value_count());
+  EXPECT_EQ(OB_SUCCESS, spill_file.del_range("", "z"));
+  EXPECT_EQ(0, spill_file.get_value_count());
+  EXPECT_EQ(0, spill_file.get_file_size());
+  EXPECT_EQ(OB_SUCCESS, spill_file.remove());
+}
+
+// readers must never see a value whose space is released by a concurrent del or overwrite
+TEST_F(TestLogFileStoreService, concurrent_get_del)
+{
+  const std::string file_path = std::string(TEST_DIR) + "/concurrent.spill";
+  ObLogSpillFile spill_file;
+  EXPECT_EQ(OB_SUCCESS, spill_file.init(file_path, get_compressor("lz4_1.0")));
+  const int64_t key_cnt = 16;
+  const int64_t value_len = 64 * 1024;
+  const int64_t round_cnt = 2000;
+  const int64_t reader_cnt = 4;
+  bool stop = false;
+  int64_t read_succ_cnt = 0;
+  int64_t read_fail_cnt = 0;
+
+  std::vector<std::thread> readers;
+  for (int64_t t = 0; t < reader_cnt; t++) {
+    readers.push_back(std::thread([&]() {
+      std::string value;
+      int64_t idx = 0;
+      while (!ATOMIC_LOAD(&stop)) {
+        const std::string key = gen_key(idx++ % key_cnt);
+        const int ret = spill_file.get(key, value);
+        if (OB_SUCCESS == ret) {
+          if (gen_value(key, value_len) == value) {
+            ATOMIC_INC(&read_succ_cnt);
+          } else {
+            ATOMIC_INC(&read_fail_cnt);
+          }
+        } else if (OB_ENTRY_NOT_EXIST != ret) {
+          ATOMIC_INC(&read_fail_cnt);
+        }
+      }
+    }));
+  }
+  // the writer keeps overwriting and deleting the keys which are being read
+  for (int64_t i = 0; i < round_cnt; i++) {
+    const std::string key = gen_key(i % key_cnt);
+    const std::string put_value = gen_value(key, value_len);
+    EXPECT_EQ(OB_SUCCESS, spill_file.put(key, ObSlice(put_value.data(), put_value.size())));
+    if (0 == i % 3) {
+      EXPECT_EQ(OB_SUCCESS, spill_file.del(key));
+    } else if (0 == i % 7) {
+      EXPECT_EQ(OB_SUCCESS, spill_file.del_range(gen_key(0), gen_key(key_cnt / 2)));
+    }
+  }
+  ATOMIC_STORE(&stop, true);
+  for (int64_t t = 0; t < reader_cnt; t++) {
+    readers.at(t).join();
+  }
+  EXPECT_EQ(0, read_fail_cnt);
+  EXPECT_LT(0, read_succ_cnt);
+  EXPECT_TRUE(spill_file.reading_values_.empty());
+  EXPECT_EQ(0, spill_file.io_cnt_);
+
+  // all space is released after the readers finished
+  EXPECT_EQ(OB_SUCCESS, spill_file.del_range("", "z"));
+  EXPECT_EQ(0, spill_file.get_file_size());
+  EXPECT_EQ(OB_SUCCESS, spill_file.remove());
+}
+
+TEST_F(TestLogFileStoreService, column_family)
+{
+  const std::string path = std::string(TEST_DIR) + "/storage";
+  ObLogFileStoreService store_service;
+  void *cf_handle = NULL;
+  std::string value;
+  const std::string put_value = gen_value("cf", 1000);
+
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::create_full_path(path.c_str()));
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::create_full_path((path + "/stale_dir").c_str()));
+  // the files left by last run are removed by init
+  EXPECT_EQ(OB_SUCCESS, store_service.init(path));
+  bool is_exist = true;
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::is_exists((path + "/stale_dir").c_str(), is_exist));
+  EXPECT_FALSE(is_exist);
+
+  EXPECT_EQ(OB_SUCCESS, store_service.create_column_family("1001", cf_handle));
+  EXPECT_EQ(OB_SUCCESS, store_service.put(cf_handle, "k", ObSlice(put_value.data(), put_value.size())));
+  EXPECT_EQ(OB_SUCCESS, store_service.put("k", ObSlice("default", 7)));
+  EXPECT_EQ(OB_SUCCESS, store_service.get(cf_handle, "k", value));
+  EXPECT_TRUE(put_value == value);
+  EXPECT_EQ(OB_SUCCESS, store_service.get("k", value));
+  EXPECT_TRUE(std::string("default") == value);
+  EXPECT_EQ(OB_SUCCESS, store_service.del(cf_handle, "k"));
+  EXPECT_EQ(OB_ERR_UNEXPECTED, store_service.get(cf_handle, "k", value));
+  EXPECT_EQ(OB_SUCCESS, store_service.drop_column_family(cf_handle));
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::is_exists((path + "/1001.spill").c_str(), is_exist));
+  EXPECT_FALSE(is_exist);
+  EXPECT_EQ(OB_SUCCESS, store_service.destory_column_family(cf_handle));
+  store_service.destroy();
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_ob_log_file_store_service.log", true);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * This file defines test_ob_log_formatter.cpp
+ */
+
+#define USING_LOG_PREFIX OBLOG_FORMATTER
+
+#include <gtest/gtest.h>
+#include <set>
+#include "share/ob_define.h"
+#define private public
+#include "logservice/libobcdc/src/ob_log_formatter.h"
+#include "logservice/libobcdc/src/ob_log_part_trans_task.h"
+#include "logservice/libobcdc/src/ob_log_binlog_record.h"
+#undef private
+#include "logservice/libobcdc/src/ob_log_config.h"
+#include "logservice/libobcdc/src/ob_log_instance.h"
+#include "logservice/libobcdc/src/ob_log_resource_collector.h"
+#include "logservice/libobcdc/src/ob_log_binlog_record_pool.h"
+#include "logservice/libobcdc/src/ob_log_utils.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+using namespace transaction;
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+class MockResourceCollector : public ObLogResourceCollector
+{
+public:
+  MockResourceCollector() : revert_log_entry_task_cnt_(0) {}
+  virtual int revert_log_entry_task(ObLogEntryTask *log_entry_task)
+  {
+    UNUSED(log_entry_task);
+    ATOMIC_INC(&revert_log_entry_task_cnt_);
+    return OB_SUCCESS;
+  }
+  int64_t revert_log_entry_task_cnt_;
+};
+
+class MockBRPool : public ObLogBRPool
+{
+public:
+  MockBRPool() : free_cnt_(0) {}
+  // the binlog records are owned by the test
+  virtual void free(ObLogBR *br)
+  {
+    UNUSED(br);
+    ATOMIC_INC(&free_cnt_);
+  }
+  int64_t free_cnt_;
+};
+
+// Formats nothing, only records the thread of each stmt and finishes the stmt
+// like ObLogFormatter::handle does.
+class MockFormatter : public ObLogFormatter
+{
+public:
+  static const int64_t MAX_STMT_NUM = 64;
+  MockFormatter() : handled_cnt_(0)
+  {
+    for (int64_t i = 0; i < MAX_STMT_NUM; i++) {
+      thread_index_[i] = -1;
+    }
+  }
+  virtual int handle(void *data, const int64_t thread_index, volatile bool &stop_flag)
+  {
+    int ret = OB_SUCCESS;
+    DmlStmtTask *stmt_task = static_cast<DmlStmtTask *>(data);
+    const uint64_t row_index = stmt_task->get_row_index();
+    thread_index_[row_index] = thread_index;
+    // the former stmts are formatted slower, so the stmts are finished out of order
+    ob_usleep((MAX_STMT_NUM - row_index) * 100);
+    if (OB_FAIL(finish_format_(stmt_task->get_host(), stmt_task->get_redo_log_entry_task(), stop_flag))) {
+      LOG_ERROR("finish_format_ fail", KR(ret));
+    }
+    ATOMIC_INC(&handled_cnt_);
+    return ret;
+  }
+  int64_t thread_index_[MAX_STMT_NUM];
+  int64_t handled_cnt_;
+};
+}
+
+namespace unittest
+{
+static const int64_t THREAD_NUM = 4;
+static const int64_t QUEUE_SIZE = 1024;
+static const int64_t SHARD_STMT_COUNT_THRESHOLD = 4;
+
+class TestObLogFormatter : public ::testing::Test
+{
+public:
+  TestObLogFormatter() : allocator_("TestFormatter") {}
+  virtual void SetUp()
+  {
+    ObLogInstance *instance = ObLogInstance::get_instance();
+    instance->drc_message_factory_binlog_record_type_.assign("LogRecordImpl");
+    instance->resource_collector_ = &resource_collector_;
+    instance->br_pool_ = &br_pool_;
+    EXPECT_TRUE(TCONF.formatter_shard_stmt_count_threshold.set_value(
+        std::to_string(SHARD_STMT_COUNT_THRESHOLD).c_str()));
+    EXPECT_EQ(OB_SUCCESS, formatter_.FormatterThread::init(THREAD_NUM, QUEUE_SIZE));
+    formatter_.inited_ = true;
+    EXPECT_EQ(OB_SUCCESS, formatter_.start());
+  }
+  virtual void TearDown()
+  {
+    formatter_.stop();
+    formatter_.destroy();
+    ObLogInstance *instance = ObLogInstance::get_instance();
+    instance->resource_collector_ = NULL;
+    instance->br_pool_ = NULL;
+    ObLogInstance::destroy_instance();
+  }
+
+  // build a log entry with stmt_num stmts, whose binlog records are valid or not
+  void build_log_entry(const int64_t stmt_num, const bool is_br_valid)
+  {
+    const logservice::TenantLSID tls_id(1002, share::ObLSID(1001));
+    EXPECT_EQ(OB_SUCCESS, log_entry_task_.init(tls_id, "participant", ObTransID(1), &redo_node_));
+    for (int64_t i = 0; i < stmt_num; i++) {
+      MutatorRow *row = new MutatorRow(allocator_);
+      DmlStmtTask *stmt_task = new DmlStmtTask(part_trans_task_, log_entry_task_, *row);
+      ObLogBR *br = new ObLogBR();
+      br->construct_data_(true);
+      br->set_is_valid(is_br_valid);
+      stmt_task->set_binlog_record(br);
+      EXPECT_EQ(OB_SUCCESS, log_entry_task_.add_stmt(i, stmt_task));
+      rows_.push_back(row);
+      stmts_.push_back(stmt_task);
+      brs_.push_back(br);
+    }
+  }
+  void destroy_log_entry()
+  {
+    for (int64_t i = 0; i < stmts_.size(); i++) {
+      delete brs_[i];
+      delete stmts_[i];
+      delete rows_[i];
+    }
+    brs_.clear();
+    stmts_.clear();
+    rows_.clear();
+    log_entry_task_.reset();
+    redo_node_.reset();
+  }
+  void push_and_wait(const int64_t stmt_num)
+  {
+    volatile bool stop_flag = false;
+    const int64_t start_ts = get_timestamp();
+    EXPECT_EQ(OB_SUCCESS, formatter_.push(log_entry_task_.get_stmt_list().head_, stop_flag));
+    while (ATOMIC_LOAD(&formatter_.handled_cnt_) < stmt_num
+        && get_timestamp() - start_ts < 10 * _SEC_) {
+      ob_usleep(1000);
+    }
+    EXPECT_EQ(stmt_num, ATOMIC_LOAD(&formatter_.handled_cnt_));
+    EXPECT_TRUE(redo_node_.is_formatted());
+  }
+  int64_t get_thread_cnt(const int64_t stmt_num)
+  {
+    std::set<int64_t> thread_set;
+    for (int64_t i = 0; i < stmt_num; i++) {
+      EXPECT_NE(-1, formatter_.thread_index_[i]);
+      thread_set.insert(formatter_.thread_index_[i]);
+    }
+    return thread_set.size();
+  }
+
+public:
+  ObArenaAllocator allocator_;
+  MockResourceCollector resource_collector_;
+  MockBRPool br_pool_;
+  MockFormatter formatter_;
+  PartTransTask part_trans_task_;
+  DmlRedoLogNode redo_node_;
+  ObLogEntryTask log_entry_task_;
+  std::vector<MutatorRow *> rows_;
+  std::vector<DmlStmtTask *> stmts_;
+  std::vector<ObLogBR *> brs_;
+};
+
+// the stmts of a large log entry are formatted by all threads, and the rows are linked in
+// the order of stmt list by the thread which formats the last stmt
+TEST_F(TestObLogFormatter, shard_large_log_entry)
+{
+  const int64_t stmt_num = 16;
+  build_log_entry(stmt_num, true);
+  push_and_wait(stmt_num);
+
+  EXPECT_EQ(THREAD_NUM, get_thread_cnt(stmt_num));
+  EXPECT_EQ(stmt_num, log_entry_task_.formatted_stmt_num_);
+  EXPECT_EQ(stmt_num, redo_node_.get_valid_row_num());
+  EXPECT_EQ(stmt_num, log_entry_task_.get_row_ref_cnt());
+  ObLink *row = redo_node_.get_row_head();
+  for (int64_t i = 0; i < stmt_num; i++) {
+    EXPECT_EQ(static_cast<ObLink *>(stmts_[i]), row);
+    row = (NULL == row) ? NULL : row->next_;
+  }
+  EXPECT_TRUE(NULL == row);
+  EXPECT_EQ(static_cast<ObLink *>(stmts_[stmt_num - 1]), redo_node_.get_row_tail());
+  // the rows are released by their consumers
+  EXPECT_EQ(0, resource_collector_.revert_log_entry_task_cnt_);
+  EXPECT_EQ(0, formatter_.log_entry_task_count_);
+
+  destroy_log_entry();
+}
+
+// the stmts of a small log entry are formatted by one thread
+TEST_F(TestObLogFormatter, not_shard_small_log_entry)
+{
+  const int64_t stmt_num = SHARD_STMT_COUNT_THRESHOLD;
+  build_log_entry(stmt_num, true);
+  push_and_wait(stmt_num);
+
+  EXPECT_EQ(1, get_thread_cnt(stmt_num));
+  EXPECT_EQ(stmt_num, redo_node_.get_valid_row_num());
+  ObLink *row = redo_node_.get_row_head();
+  for (int64_t i = 0; i < stmt_num; i++) {
+    EXPECT_EQ(static_cast<ObLink *>(stmts_[i]), row);
+    row = (NULL == row) ? NULL : row->next_;
+  }
+  EXPECT_EQ(0, resource_collector_.revert_log_entry_task_cnt_);
+  EXPECT_EQ(0, formatter_.log_entry_task_count_);
+
+  destroy_log_entry();
+}
+
+// the log entry without any valid row is released exactly once, though its stmts are
+// finished by all threads
+TEST_F(TestObLogFormatter, release_sharded_log_entry_once)
+{
+  const int64_t stmt_num = 32;
+  build_log_entry(stmt_num, false);
+  push_and_wait(stmt_num);
+
+  EXPECT_EQ(THREAD_NUM, get_thread_cnt(stmt_num));
+  EXPECT_EQ(0, redo_node_.get_valid_row_num());
+  EXPECT_TRUE(NULL == redo_node_.get_row_head());
+  EXPECT_EQ(stmt_num, br_pool_.free_cnt_);
+  EXPECT_EQ(1, resource_collector_.revert_log_entry_task_cnt_);
+  EXPECT_EQ(0, formatter_.log_entry_task_count_);
+
+  destroy_log_entry();
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_ob_log_formatter.log");
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_log_formatter.log", true, false);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "logservice/palf/log_cache.h"
+#include "logservice/palf/log_define.h"
+#include "share/ob_simple_mem_limit_getter.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+
+namespace unittest
+{
+static ObSimpleMemLimitGetter getter;
+
+class TestLogColdCache : public ::testing::Test
+{
+public:
+  static const uint64_t TENANT_ID = 1001;
+  static const int64_t PALF_ID = 1001;
+  // the last line of each block is 4KB
+  static const int64_t BLOCK_SIZE = 10 * LogColdCache::LINE_SIZE + 4096;
+  TestLogColdCache() : buf_(NULL), out_buf_(NULL) {}
+  virtual void SetUp();
+  virtual void TearDown();
+  void init_cold_cache(LogColdCache &cache);
+protected:
+  char *buf_;
+  char *out_buf_;
+};
+
+void TestLogColdCache::SetUp()
+{
+  int ret = OB_SUCCESS;
+  ASSERT_EQ(OB_SUCCESS, getter.add_tenant(TENANT_ID, 64 * 1024 * 1024, 128 * 1024 * 1024));
+  ret = ObKVGlobalCache::get_instance().init(&getter, 1024, 1024 * 1024 * 1024, lib::ACHUNK_SIZE);
+  if (OB_INIT_TWICE == ret) {
+    ret = OB_SUCCESS;
+  }
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(OB_SUCCESS, OB_LOG_KV_CACHE.init("log_kv_cache", 1));
+  buf_ = static_cast<char *>(ob_malloc(2 * BLOCK_SIZE, "TestLogCache"));
+  out_buf_ = static_cast<char *>(ob_malloc(2 * BLOCK_SIZE, "TestLogCache"));
+  ASSERT_TRUE(NULL != buf_ && NULL != out_buf_);
+  for (int64_t i = 0; i < 2 * BLOCK_SIZE; ++i) {
+    buf_[i] = static_cast<char>(i % 251);
+  }
+}
+
+void TestLogColdCache::TearDown()
+{
+  ob_free(buf_);
+  ob_free(out_buf_);
+  OB_LOG_KV_CACHE.destroy();
+  ObKVGlobalCache::get_instance().destroy();
+  getter.reset();
+}
+
+// tenant of unittest thread is invalid, init the cache by hand
+void TestLogColdCache::init_cold_cache(LogColdCache &cache)
+{
+  cache.palf_id_ = PALF_ID;
+  cache.tenant_id_ = TENANT_ID;
+  cache.logical_block_size_ = BLOCK_SIZE;
+  cache.invalidate();
+  cache.is_inited_ = true;
+}
+
+TEST_F(TestLogColdCache, test_read_and_fill)
+{
+  LogColdCache cache;
+  init_cold_cache(cache);
+  const int64_t LINE = LogColdCache::LINE_SIZE;
+  int64_t out_read_size = 0;
+  const int64_t version = cache.get_version();
+
+  // miss before fill
+  ASSERT_EQ(OB_SUCCESS, cache.read(version, LSN(100), LINE, out_buf_, out_read_size));
+  ASSERT_EQ(0, out_read_size);
+
+  // fill 3 lines and a half, the half line is not cached
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache.fill(version, LSN(100), buf_ + 100, LINE));
+  ASSERT_EQ(OB_SUCCESS, cache.fill(version, LSN(0), buf_, 3 * LINE + LINE / 2));
+  ASSERT_EQ(OB_SUCCESS, cache.read(version, LSN(100), 2 * LINE, out_buf_, out_read_size));
+  ASSERT_EQ(2 * LINE, out_read_size);
+  ASSERT_EQ(0, MEMCMP(out_buf_, buf_ + 100, out_read_size));
+  // the cached prefix is returned
+  ASSERT_EQ(OB_SUCCESS, cache.read(version, LSN(LINE + 10), 3 * LINE, out_buf_, out_read_size));
+  ASSERT_EQ(2 * LINE - 10, out_read_size);
+  ASSERT_EQ(0, MEMCMP(out_buf_, buf_ + LINE + 10, out_read_size));
+
+  // the last line of block is shorter, and lines never cross blocks
+  const LSN last_line_lsn(10 * LINE);
+  ASSERT_EQ(OB_SUCCESS, cache.fill(version, last_line_lsn, buf_ + last_line_lsn.val_, 4096 + LINE));
+  ASSERT_EQ(OB_SUCCESS, cache.read(version, last_line_lsn, 4096 + LINE, out_buf_, out_read_size));
+  ASSERT_EQ(4096 + LINE, out_read_size);
+  ASSERT_EQ(0, MEMCMP(out_buf_, buf_ + last_line_lsn.val_, out_read_size));
+
+  // stale lines are never hit after invalidate
+  cache.invalidate();
+  ASSERT_NE(version, cache.get_version());
+  ASSERT_EQ(OB_SUCCESS, cache.read(cache.get_version(), LSN(0), LINE, out_buf_, out_read_size));
+  ASSERT_EQ(0, out_read_size);
+}
+
+TEST_F(TestLogColdCache, test_fill_range)
+{
+  LogColdCache cache;
+  init_cold_cache(cache);
+  const int64_t LINE = LogColdCache::LINE_SIZE;
+  const LSN block_end_lsn(BLOCK_SIZE);
+  LSN fill_begin_lsn;
+  LSN fill_end_lsn;
+
+  // random read is extended to complete lines only
+  cache.get_fill_range(LSN(LINE + 10), LSN(2 * LINE + 10), block_end_lsn, fill_begin_lsn, fill_end_lsn);
+  ASSERT_EQ(LSN(LINE), fill_begin_lsn);
+  ASSERT_EQ(LSN(3 * LINE), fill_end_lsn);
+  // never exceed the readable end
+  cache.get_fill_range(LSN(LINE + 10), LSN(2 * LINE + 10), LSN(2 * LINE + 20), fill_begin_lsn, fill_end_lsn);
+  ASSERT_EQ(LSN(2 * LINE + 20), fill_end_lsn);
+
+  // sequential read is extended by readahead lines
+  int64_t out_read_size = 0;
+  ASSERT_EQ(OB_SUCCESS, cache.fill(cache.get_version(), LSN(0), buf_, LINE));
+  ASSERT_EQ(OB_SUCCESS, cache.read(cache.get_version(), LSN(10), LINE - 10, out_buf_, out_read_size));
+  ASSERT_EQ(LINE - 10, out_read_size);
+  cache.get_fill_range(LSN(LINE), LSN(LINE + 10), block_end_lsn, fill_begin_lsn, fill_end_lsn);
+  ASSERT_EQ(LSN(LINE), fill_begin_lsn);
+  ASSERT_EQ(block_end_lsn, fill_end_lsn);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf ./test_log_cache.log*");
+  OB_LOGGER.set_file_name("test_log_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
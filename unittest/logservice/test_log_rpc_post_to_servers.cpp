@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "logservice/palf/log_rpc.h"
+#include "rpc/frame/ob_req_deliver.h"
+#include "rpc/obrpc/ob_poc_rpc_server.h"
+#include "share/ob_cluster_version.h"
+#include "observer/ob_server_struct.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+using namespace obrpc;
+namespace unittest
+{
+
+struct ReceivedPacket
+{
+  ObRpcPacketCode pcode_;
+  int64_t timestamp_;
+  std::string payload_;
+};
+
+// record the packets received by pkt-nio and reply empty responses
+class PushLogDeliver : public rpc::frame::ObReqDeliver
+{
+public:
+  virtual int init() { return OB_SUCCESS; }
+  virtual int deliver(rpc::ObRequest &req)
+  {
+    const ObRpcPacket &pkt = reinterpret_cast<const ObRpcPacket&>(req.get_packet());
+    ReceivedPacket received;
+    received.pcode_ = pkt.get_pcode();
+    received.timestamp_ = pkt.get_timestamp();
+    received.payload_.assign(pkt.get_cdata(), pkt.get_clen());
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      packets_.push_back(received);
+    }
+    ObPocServerHandleContext *ctx = static_cast<ObPocServerHandleContext *>(req.get_server_handle_context());
+    ctx->resp(NULL);
+    ctx->destroy();
+    return OB_SUCCESS;
+  }
+  virtual void stop() {}
+  int64_t count()
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    return packets_.size();
+  }
+  std::mutex lock_;
+  std::vector<ReceivedPacket> packets_;
+};
+
+class TestLogRpcPostToServers : public ::testing::Test
+{
+public:
+  static void SetUpTestCase()
+  {
+    // post_to_servers of pkt-nio is used only if pkt-nio is enabled and started
+    GCONF._enable_pkt_nio = true;
+    ObClusterVersion::get_instance().update_cluster_version(CLUSTER_VERSION_4_1_0_0);
+    int ret = OB_SUCCESS;
+    srand(static_cast<unsigned int>(ObTimeUtility::current_time()));
+    for (int64_t i = 0; i < 10; i++) {
+      port_ = 20000 + rand() % 10000;
+      if (OB_SUCC(global_poc_server.start(port_, 1, &deliver_))) {
+        break;
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ASSERT_TRUE(global_poc_server.client_use_pkt_nio());
+  }
+  virtual void SetUp()
+  {
+    deliver_.packets_.clear();
+    self_.set_ip_addr("127.0.0.1", port_);
+    ASSERT_EQ(OB_SUCCESS, log_rpc_.init(self_, 1, OB_SYS_TENANT_ID, &transport_));
+  }
+  virtual void TearDown()
+  {
+    log_rpc_.destroy();
+  }
+  bool wait_packets(const int64_t count)
+  {
+    const int64_t timeout_us = 10 * 1000 * 1000;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    while (deliver_.count() < count && ObTimeUtility::current_time() - start_ts < timeout_us) {
+      usleep(1000);
+    }
+    return deliver_.count() == count;
+  }
+protected:
+  static int32_t port_;
+  static PushLogDeliver deliver_;
+  ObAddr self_;
+  rpc::frame::ObReqTransport transport_{NULL, NULL};
+  LogRpc log_rpc_;
+};
+
+int32_t TestLogRpcPostToServers::port_ = 0;
+PushLogDeliver TestLogRpcPostToServers::deliver_;
+
+TEST_F(TestLogRpcPostToServers, test_invalid_argument)
+{
+  char buf[64] = "push log";
+  LogWriteBuf write_buf;
+  ASSERT_EQ(OB_SUCCESS, write_buf.push_back(buf, sizeof(buf)));
+  LogPushReq req(PUSH_LOG, 1, 1, LSN(0), LSN(100), write_buf);
+  ObSEArray<ObAddr, 3> servers;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, log_rpc_.post_request_to_servers(servers, 1, req));
+  ASSERT_EQ(OB_SUCCESS, servers.push_back(self_));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, log_rpc_.post_request_to_servers(servers, -1, req));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, log_rpc_.post_request_to_servers(servers, 1, LogPushReq()));
+  LogRpc not_inited_rpc;
+  ASSERT_EQ(OB_NOT_INIT, not_inited_rpc.post_request_to_servers(servers, 1, req));
+  ASSERT_EQ(0, deliver_.count());
+}
+
+TEST_F(TestLogRpcPostToServers, test_post_push_log_to_servers)
+{
+  const int64_t server_count = 3;
+  const int64_t palf_id = 1001;
+  char buf[1024];
+  const int64_t buf_len = sizeof(buf);
+  for (int64_t i = 0; i < buf_len; i++) {
+    buf[i] = static_cast<char>(i);
+  }
+  // the group buffer of leader may be split into two segments
+  LogWriteBuf write_buf;
+  ASSERT_EQ(OB_SUCCESS, write_buf.push_back(buf, 100));
+  ASSERT_EQ(OB_SUCCESS, write_buf.push_back(buf + 100, buf_len - 100));
+  LogPushReq req(PUSH_LOG, 2, 1, LSN(4096), LSN(4096 + buf_len), write_buf);
+  ObSEArray<ObAddr, 3> servers;
+  for (int64_t i = 0; i < server_count; i++) {
+    ASSERT_EQ(OB_SUCCESS, servers.push_back(self_));
+  }
+  ASSERT_EQ(OB_SUCCESS, log_rpc_.post_request_to_servers(servers, palf_id, req));
+  ASSERT_TRUE(wait_packets(server_count));
+
+  for (int64_t i = 0; i < server_count; i++) {
+    const ReceivedPacket &received = deliver_.packets_[i];
+    ASSERT_EQ(OB_LOG_PUSH_REQ, received.pcode_);
+    // every server receives the same encoded packet
+    ASSERT_EQ(deliver_.packets_[0].payload_, received.payload_);
+#ifndef PERF_MODE
+    ASSERT_EQ(deliver_.packets_[0].timestamp_, received.timestamp_);
+#endif
+    LogRpcPacketImpl<LogPushReq> packet;
+    int64_t pos = 0;
+    ASSERT_EQ(OB_SUCCESS, packet.deserialize(received.payload_.data(), received.payload_.size(), pos));
+    ASSERT_EQ(self_, packet.src_);
+    ASSERT_EQ(palf_id, packet.palf_id_);
+    ASSERT_EQ(req.msg_proposal_id_, packet.req_.msg_proposal_id_);
+    ASSERT_EQ(req.prev_log_proposal_id_, packet.req_.prev_log_proposal_id_);
+    ASSERT_EQ(req.prev_lsn_, packet.req_.prev_lsn_);
+    ASSERT_EQ(req.curr_lsn_, packet.req_.curr_lsn_);
+    // the two segments are received as one continuous buffer
+    const char *data = NULL;
+    int64_t data_len = 0;
+    ASSERT_EQ(1, packet.req_.write_buf_.get_buf_count());
+    ASSERT_EQ(OB_SUCCESS, packet.req_.write_buf_.get_write_buf(0, data, data_len));
+    ASSERT_EQ(buf_len, data_len);
+    ASSERT_EQ(0, MEMCMP(buf, data, data_len));
+  }
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_rpc_post_to_servers.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_rpc_post_to_servers");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#define private public
+#include "logservice/replayservice/ob_replay_status.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace logservice;
+using namespace palf;
+namespace unittest
+{
+
+class TestReplayHintRoute : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    status_.ls_id_ = share::ObLSID(1001);
+    status_.reset_hint_slots_();
+  }
+  virtual void TearDown()
+  {
+    drain_all();
+    status_.is_inited_ = false;
+  }
+  // route a task of replay_hint like push_log_replay_task, seq is the order of the log in the hint
+  int64_t push_task(const int64_t replay_hint)
+  {
+    ObLogReplayTask *task = new ObLogReplayTask();
+    const int64_t seq = next_push_seq_[replay_hint]++;
+    task->replay_hint_ = replay_hint;
+    task->lsn_ = LSN(seq);
+    const int64_t queue_idx = status_.route_replay_hint_(replay_hint);
+    status_.task_queues_[queue_idx].push(task);
+    return queue_idx;
+  }
+  // replay the head of task queue like a replay worker, return false if the queue is empty
+  bool replay_one(const int64_t queue_idx)
+  {
+    bool replayed = false;
+    ObLink *link = status_.task_queues_[queue_idx].pop();
+    if (NULL != link) {
+      ObLogReplayTask *task = static_cast<ObLogReplayTask *>(link);
+      const int64_t replay_hint = task->replay_hint_;
+      // logs of one hint are replayed in the order they are pushed, wherever the hint is routed
+      EXPECT_EQ(next_replay_seq_[replay_hint]++, static_cast<int64_t>(task->lsn_.val_));
+      // a hint can not move away while it has a task in flight
+      EXPECT_EQ(queue_idx, status_.get_hint_queue_idx_(replay_hint));
+      status_.dec_queue_pending_task(*task);
+      delete task;
+      replayed = true;
+    }
+    return replayed;
+  }
+  void drain_all()
+  {
+    for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+      while (replay_one(i)) {}
+    }
+  }
+  int64_t hint_slot_pending(const int64_t replay_hint)
+  {
+    return status_.hint_slots_[replay_hint & (ObReplayStatus::REPLAY_HINT_SLOT_CNT - 1)].pending_cnt_;
+  }
+protected:
+  ObReplayStatus status_;
+  std::map<int64_t, int64_t> next_push_seq_;
+  std::map<int64_t, int64_t> next_replay_seq_;
+};
+
+TEST_F(TestReplayHintRoute, test_hint_not_move_with_pending_task)
+{
+  const int64_t hot_hint = 1;
+  // hint 33 is hashed to slot 33, which is bound to the same task queue as hint 1
+  const int64_t cold_hint = 33;
+  const int64_t queue_idx = status_.calc_replay_queue_idx(hot_hint);
+  ASSERT_EQ(queue_idx, status_.get_hint_queue_idx_(cold_hint));
+  for (int64_t i = 0; i < 200; ++i) {
+    ASSERT_EQ(queue_idx, push_task(hot_hint));
+  }
+  ASSERT_EQ(200, hint_slot_pending(hot_hint));
+  ASSERT_EQ(200, status_.task_queues_[queue_idx].get_pending_cnt());
+  ASSERT_EQ(0, status_.rebalance_count_);
+  // an idle hint on the backed up queue moves to the least loaded queue
+  ASSERT_EQ(0, push_task(cold_hint));
+  ASSERT_EQ(0, status_.get_hint_queue_idx_(cold_hint));
+  ASSERT_EQ(1, status_.rebalance_count_);
+  // the hot hint stays while it has pending tasks
+  ASSERT_EQ(queue_idx, push_task(hot_hint));
+  ASSERT_EQ(1, status_.rebalance_count_);
+  drain_all();
+  ASSERT_EQ(0, hint_slot_pending(hot_hint));
+  ASSERT_EQ(0, hint_slot_pending(cold_hint));
+  ASSERT_EQ(0, status_.task_queues_[queue_idx].get_pending_cnt());
+  ASSERT_EQ(0, status_.task_queues_[0].get_pending_cnt());
+  // no queue is backed up, nothing moves
+  ASSERT_EQ(queue_idx, push_task(hot_hint));
+  ASSERT_EQ(1, status_.rebalance_count_);
+}
+
+TEST_F(TestReplayHintRoute, test_hint_move_after_replayed)
+{
+  const int64_t hint = 1;
+  const int64_t other_hint = 33;
+  const int64_t queue_idx = status_.calc_replay_queue_idx(hint);
+  // both hints are routed before the queue is backed up, then other_hint keeps it busy
+  for (int64_t i = 0; i < 50; ++i) {
+    ASSERT_EQ(queue_idx, push_task(hint));
+    ASSERT_EQ(queue_idx, push_task(other_hint));
+  }
+  for (int64_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(queue_idx, push_task(other_hint));
+  }
+  ASSERT_EQ(0, status_.rebalance_count_);
+  // replay all tasks of hint, the queue still has 100 tasks of other_hint
+  for (int64_t i = 0; i < 100; ++i) {
+    ASSERT_TRUE(replay_one(queue_idx));
+  }
+  ASSERT_EQ(50, next_replay_seq_[hint]);
+  ASSERT_EQ(0, hint_slot_pending(hint));
+  // hint is idle now and moves away, its later logs are replayed by another queue
+  const int64_t new_queue_idx = push_task(hint);
+  ASSERT_NE(queue_idx, new_queue_idx);
+  ASSERT_EQ(new_queue_idx, status_.get_hint_queue_idx_(hint));
+  ASSERT_EQ(1, status_.rebalance_count_);
+  for (int64_t i = 0; i < 10; ++i) {
+    ASSERT_EQ(new_queue_idx, push_task(hint));
+  }
+  ASSERT_EQ(11, status_.task_queues_[new_queue_idx].get_pending_cnt());
+  while (replay_one(new_queue_idx)) {}
+  ASSERT_EQ(61, next_replay_seq_[hint]);
+  ASSERT_EQ(0, status_.task_queues_[new_queue_idx].get_pending_cnt());
+  ASSERT_EQ(100, status_.task_queues_[queue_idx].get_pending_cnt());
+}
+
+TEST_F(TestReplayHintRoute, test_replay_order_with_rebalance)
+{
+  // hot hints are all bound to queue 3 at first
+  const int64_t hot_hints[] = {3, 35, 67, 99, 131, 163, 195, 227};
+  const int64_t hot_hint_cnt = sizeof(hot_hints) / sizeof(hot_hints[0]);
+  srand(20231018);
+  for (int64_t step = 0; step < 100000; ++step) {
+    if (rand() % 10 < 6) {
+      const int64_t replay_hint = (rand() % 10 < 8) ? hot_hints[rand() % hot_hint_cnt] : rand() % 1024;
+      push_task(replay_hint);
+    } else {
+      // replay workers consume queues in arbitrary order
+      (void)replay_one(rand() % REPLAY_TASK_QUEUE_SIZE);
+    }
+  }
+  drain_all();
+  ASSERT_LT(0, status_.rebalance_count_);
+  for (std::map<int64_t, int64_t>::iterator iter = next_push_seq_.begin(); iter != next_push_seq_.end(); ++iter) {
+    ASSERT_EQ(iter->second, next_replay_seq_[iter->first]);
+    ASSERT_EQ(0, hint_slot_pending(iter->first));
+  }
+  for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+    ASSERT_EQ(0, status_.task_queues_[i].get_pending_cnt());
+  }
+}
+
+TEST_F(TestReplayHintRoute, test_task_queue_stat)
+{
+  ObSEArray<ObReplayQueueStat, REPLAY_TASK_QUEUE_SIZE> queue_stats;
+  int64_t rebalance_count = -1;
+  ASSERT_EQ(OB_NOT_INIT, status_.get_task_queue_stat(queue_stats, rebalance_count));
+  status_.is_inited_ = true;
+  ObReplayServiceReplayTask &task_queue = status_.task_queues_[2];
+  task_queue.add_replayed_stat(100, 10);
+  task_queue.add_replayed_stat(300, 30);
+  push_task(2);
+  ASSERT_EQ(OB_SUCCESS, status_.get_task_queue_stat(queue_stats, rebalance_count));
+  ASSERT_EQ(REPLAY_TASK_QUEUE_SIZE, queue_stats.count());
+  ASSERT_EQ(0, rebalance_count);
+  ASSERT_EQ(2, queue_stats.at(2).queue_idx_);
+  ASSERT_EQ(1, queue_stats.at(2).pending_cnt_);
+  ASSERT_EQ(2, queue_stats.at(2).replayed_cnt_);
+  ASSERT_EQ(400, queue_stats.at(2).replayed_size_);
+  ASSERT_EQ(0, queue_stats.at(1).replayed_cnt_);
+  // reading the stat does not reset it
+  ASSERT_EQ(OB_SUCCESS, status_.get_task_queue_stat(queue_stats, rebalance_count));
+  ASSERT_EQ(2, queue_stats.at(2).replayed_cnt_);
+  // the printed stat is the delta since last print
+  int64_t replayed_cnt = 0;
+  int64_t replayed_size = 0;
+  int64_t replay_cost = 0;
+  task_queue.fetch_replayed_stat(replayed_cnt, replayed_size, replay_cost);
+  ASSERT_EQ(2, replayed_cnt);
+  ASSERT_EQ(400, replayed_size);
+  ASSERT_EQ(40, replay_cost);
+  task_queue.add_replayed_stat(50, 5);
+  task_queue.fetch_replayed_stat(replayed_cnt, replayed_size, replay_cost);
+  ASSERT_EQ(1, replayed_cnt);
+  ASSERT_EQ(50, replayed_size);
+  ASSERT_EQ(5, replay_cost);
+  ASSERT_EQ(OB_SUCCESS, status_.get_task_queue_stat(queue_stats, rebalance_count));
+  ASSERT_EQ(3, queue_stats.at(2).replayed_cnt_);
+  ASSERT_EQ(450, queue_stats.at(2).replayed_size_);
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_replay_hint_route.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  CLOG_LOG(INFO, "begin unittest::test_replay_hint_route");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
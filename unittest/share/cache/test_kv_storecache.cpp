@@ -720,6 +720,94 @@ TEST_F(TestKVCache, test_hold_size)
   ASSERT_TRUE(cache.store_size(tenant_id_) >= hold_size);
 }
 
+TEST(ObKVCacheFreqSketch, normal)
+{
+  ObKVCacheFreqSketch sketch;
+  // not inited sketch knows nothing
+  sketch.record(1);
+  ASSERT_EQ(0, sketch.estimate(1));
+  ASSERT_EQ(OB_SUCCESS, sketch.init());
+  ASSERT_EQ(OB_INIT_TWICE, sketch.init());
+
+  for (int64_t i = 0; i < 3; ++i) {
+    sketch.record(100);
+  }
+  sketch.record(200);
+  ASSERT_GE(sketch.estimate(100), 3);
+  ASSERT_GE(sketch.estimate(200), 1);
+  ASSERT_LT(sketch.estimate(200), sketch.estimate(100));
+
+  // counters saturate instead of wrapping around
+  for (int64_t i = 0; i < 1000; ++i) {
+    sketch.record(300);
+  }
+  ASSERT_EQ(UINT8_MAX, sketch.estimate(300));
+
+  // old history fades out after enough samples
+  for (int64_t i = 0; i < ObKVCacheFreqSketch::RESET_SAMPLE_CNT; ++i) {
+    sketch.record(1000000 + i);
+  }
+  ASSERT_LT(sketch.estimate(300), UINT8_MAX);
+  sketch.destroy();
+  ASSERT_EQ(0, sketch.estimate(300));
+}
+
+TEST_F(TestKVCache, test_admission)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  ObKVCache<TestKey, TestValue> cache;
+  ASSERT_EQ(OB_SUCCESS, cache.init("test"));
+  ASSERT_EQ(OB_SUCCESS, cache.set_admission(true));
+
+  TestKey key;
+  TestValue value;
+  const TestValue *pvalue = NULL;
+  ObKVCacheHandle handle;
+  key.tenant_id_ = tenant_id_;
+  value.v_ = 4321;
+
+  // one-touch item is rejected by put
+  key.v_ = 1;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(key, pvalue, handle));
+  ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  ASSERT_EQ(0, cache.count(tenant_id_));
+
+  // requested again, admitted now
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(key, pvalue, handle));
+  ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+  ASSERT_EQ(value.v_, pvalue->v_);
+
+  // put_and_fetch always stores the item
+  key.v_ = 2;
+  ASSERT_EQ(OB_SUCCESS, cache.put_and_fetch(key, value, pvalue, handle));
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+
+  ObKVCacheInstKey inst_key(cache.get_cache_id(), tenant_id_);
+  ObKVCacheInstHandle inst_handle;
+  ASSERT_EQ(OB_SUCCESS, ObKVGlobalCache::get_instance().insts_.get_cache_inst(inst_key, inst_handle));
+  ASSERT_TRUE(NULL != inst_handle.get_inst());
+  const ObKVCacheStatus &status = inst_handle.get_inst()->status_;
+  ASSERT_EQ(1, status.admission_reject_cnt_);
+  ASSERT_EQ(2, status.lru_hit_cnt_.value() + status.lfu_hit_cnt_.value());
+  ASSERT_EQ(status.total_hit_cnt_.value(), status.lru_hit_cnt_.value() + status.lfu_hit_cnt_.value());
+
+  // probation memblocks of a cache with admission get no base score
+  ASSERT_DOUBLE_EQ(0, status.get_base_mb_score(LRU));
+  ASSERT_DOUBLE_EQ(status.base_mb_score_, status.get_base_mb_score(LFU));
+
+  // everything is admitted after admission is turned off
+  ASSERT_EQ(OB_SUCCESS, cache.set_admission(false));
+  key.v_ = 3;
+  ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+  ASSERT_EQ(1, status.admission_reject_cnt_);
+}
+
 // TEST_F(TestKVCache, sync_wash_mbs)
 // {
 //   CHUNK_MGR.set_limit(512 * 1024 * 1024);
@@ -632,6 +632,54 @@ TEST_F(TestChunkDatumStore, basic2)
   rs.reset();
 }
 
+TEST_F(TestChunkDatumStore, compressed_dump)
+{
+  int ret = OB_SUCCESS;
+  ObChunkDatumStore rs;
+  ObChunkDatumStore plain_rs;
+  ObChunkDatumStore::Iterator it;
+  ret = rs.init(1L << 20, tenant_id_, ctx_id_, label_);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(OB_SUCCESS, rs.alloc_dir_id());
+  ASSERT_EQ(OB_SUCCESS, rs.set_dump_compressor(LZ4_COMPRESSOR));
+  ASSERT_TRUE(rs.is_dump_compressed());
+  ret = plain_rs.init(1L << 20, tenant_id_, ctx_id_, label_);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(OB_SUCCESS, plain_rs.alloc_dir_id());
+
+  CALL(append_rows, rs, 50000);
+  rs.finish_add_row();
+  CALL(append_rows, plain_rs, 50000);
+  plain_rs.finish_add_row();
+  LOG_INFO("compressed and plain dump", K(rs.get_file_size()), K(plain_rs.get_file_size()));
+  ASSERT_GT(rs.get_file_size(), 0);
+  ASSERT_LT(rs.get_file_size(), plain_rs.get_file_size());
+  ASSERT_EQ(OB_ERR_UNEXPECTED, rs.set_dump_compressor(NONE_COMPRESSOR));
+
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true);
+  ret = it.get_next_row(ver_cells_, eval_ctx_);
+  ASSERT_EQ(OB_ITER_END, ret);
+  it.reset();
+  // iterate again
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true);
+  it.reset();
+  rs.reset();
+  plain_rs.reset();
+
+  // big rows are larger than the dump page
+  enable_big_row_ = true;
+  ret = rs.init(1L << 20, tenant_id_, ctx_id_, label_);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(OB_SUCCESS, rs.alloc_dir_id());
+  ASSERT_EQ(OB_SUCCESS, rs.set_dump_compressor(LZ4_COMPRESSOR));
+  CALL(append_rows, rs, 20000);
+  rs.finish_add_row();
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true);
+  enable_big_row_ = false;
+  it.reset();
+  rs.reset();
+}
+
 TEST_F(TestChunkDatumStore, test_copy_row)
 {
   int ret = OB_SUCCESS;
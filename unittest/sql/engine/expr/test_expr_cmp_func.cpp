@@ -0,0 +1,368 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_expr_cmp_func.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_bit_vector.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+using namespace common;
+using namespace sql;
+
+namespace unittest
+{
+
+// Batch compare of fixed length payload reads the raw payload from the reserved frame buffer
+// when both operands are in frame and not null, the result must be the same as the datum
+// comparator. The payload width is 1 byte for year, 4 bytes for date and 8 bytes for the others.
+class TestExprCmpFunc : public ::testing::Test
+{
+public:
+  // rows in full 16 rows chunks are compared by raw payload, the tail rows by datum
+  static const int64_t BATCH_SIZE = 100;
+  static const int64_t RAW_CMP_ROW_CNT = 96;
+  static const int64_t FRAME_SIZE = 1L << 20;
+  TestExprCmpFunc()
+    : allocator_(ObModIds::TEST),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      skip_(nullptr),
+      frame_pos_(0)
+  {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  ObExpr *alloc_expr(const ObObjType type, const bool is_batch_result);
+  ObExpr *alloc_cmp_expr(ObExpr &left, ObExpr &right);
+  void set_payload(const ObObjType type, const int64_t val, ObDatum &datum);
+  void fill_arg(ObExpr &expr, const int64_t *values, const int64_t value_cnt, const bool has_null);
+  void set_in_frame(ObExpr &expr, const bool has_null, const bool in_frame);
+  void eval_batch(const ObObjType type, const ObCmpOp cmp_op, ObExpr &cmp_expr);
+  void check_result(const ObObjType type, const ObCmpOp cmp_op, ObExpr &cmp_expr);
+  void check_type(const ObObjType type, const int64_t *values, const int64_t value_cnt);
+protected:
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObBitVector *skip_;
+  int64_t frame_pos_;
+};
+
+static const ObCmpOp CMP_OPS[] = { CO_EQ, CO_NE, CO_LT, CO_LE, CO_GT, CO_GE };
+
+void TestExprCmpFunc::SetUp()
+{
+  eval_ctx_.max_batch_size_ = BATCH_SIZE;
+  eval_ctx_.frames_ = static_cast<char **>(allocator_.alloc(sizeof(char *)));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_);
+  eval_ctx_.frames_[0] = static_cast<char *>(allocator_.alloc(FRAME_SIZE));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_[0]);
+  MEMSET(eval_ctx_.frames_[0], 0, FRAME_SIZE);
+  skip_ = to_bit_vector(allocator_.alloc(ObBitVector::memory_size(BATCH_SIZE)));
+  ASSERT_TRUE(nullptr != skip_);
+  skip_->reset(BATCH_SIZE);
+  srand(20231018);
+}
+
+ObExpr *TestExprCmpFunc::alloc_expr(const ObObjType type, const bool is_batch_result)
+{
+  ObExpr *expr = OB_NEWx(ObExpr, &allocator_);
+  if (nullptr != expr) {
+    const int64_t datum_cnt = is_batch_result ? BATCH_SIZE : 1;
+    expr->datum_meta_.type_ = type;
+    expr->obj_datum_map_ = ObDatum::get_obj_datum_map_type(type);
+    expr->res_buf_len_ = ObDatum::get_reserved_size(expr->obj_datum_map_);
+    expr->batch_result_ = is_batch_result;
+    expr->batch_idx_mask_ = is_batch_result ? UINT64_MAX : 0;
+    expr->frame_idx_ = 0;
+    expr->datum_off_ = frame_pos_;
+    frame_pos_ += sizeof(ObDatum) * datum_cnt;
+    expr->eval_info_off_ = frame_pos_;
+    frame_pos_ += sizeof(ObEvalInfo);
+    expr->eval_flags_off_ = frame_pos_;
+    frame_pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr->pvt_skip_off_ = frame_pos_;
+    frame_pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr->res_buf_off_ = frame_pos_;
+    // payload of batch result is stored contiguously with the width of res_buf_len_
+    frame_pos_ += upper_align(expr->res_buf_len_ * datum_cnt, 8);
+    EXPECT_LT(frame_pos_, FRAME_SIZE);
+    ObDatum *datums = expr->locate_batch_datums(eval_ctx_);
+    for (int64_t i = 0; i < datum_cnt; ++i) {
+      datums[i].ptr_ = expr->get_rev_buf(eval_ctx_) + i * expr->res_buf_len_;
+    }
+  }
+  return expr;
+}
+
+ObExpr *TestExprCmpFunc::alloc_cmp_expr(ObExpr &left, ObExpr &right)
+{
+  ObExpr *cmp_expr = alloc_expr(ObIntType, true);
+  ObExpr **args = static_cast<ObExpr **>(allocator_.alloc(sizeof(ObExpr *) * 2));
+  if (nullptr != cmp_expr && nullptr != args) {
+    args[0] = &left;
+    args[1] = &right;
+    cmp_expr->args_ = args;
+    cmp_expr->arg_cnt_ = 2;
+  }
+  return cmp_expr;
+}
+
+void TestExprCmpFunc::set_payload(const ObObjType type, const int64_t val, ObDatum &datum)
+{
+  switch (ob_obj_type_class(type)) {
+    case ObIntTC: {
+      datum.set_int(val);
+      break;
+    }
+    case ObUIntTC: {
+      datum.set_uint(static_cast<uint64_t>(val));
+      break;
+    }
+    case ObDateTC: {
+      datum.set_date(static_cast<int32_t>(val));
+      break;
+    }
+    case ObTimeTC: {
+      datum.set_time(val);
+      break;
+    }
+    case ObYearTC: {
+      datum.set_year(static_cast<int8_t>(static_cast<uint8_t>(val)));
+      break;
+    }
+    case ObDateTimeTC: {
+      datum.set_datetime(val);
+      break;
+    }
+    default: {
+      FAIL() << "unexpected type: " << type;
+    }
+  }
+}
+
+void TestExprCmpFunc::fill_arg(
+    ObExpr &expr,
+    const int64_t *values,
+    const int64_t value_cnt,
+    const bool has_null)
+{
+  const int64_t datum_cnt = expr.is_batch_result() ? BATCH_SIZE : 1;
+  ObDatum *datums = expr.locate_batch_datums(eval_ctx_);
+  for (int64_t i = 0; i < datum_cnt; ++i) {
+    datums[i].ptr_ = expr.get_rev_buf(eval_ctx_) + i * expr.res_buf_len_;
+    if (has_null && 0 == rand() % 7) {
+      datums[i].set_null();
+    } else {
+      set_payload(expr.datum_meta_.type_, values[rand() % value_cnt], datums[i]);
+    }
+  }
+}
+
+void TestExprCmpFunc::set_in_frame(ObExpr &expr, const bool has_null, const bool in_frame)
+{
+  ObEvalInfo &eval_info = expr.get_eval_info(eval_ctx_);
+  eval_info.evaluated_ = true;
+  eval_info.projected_ = true;
+  eval_info.notnull_ = !has_null;
+  eval_info.point_to_frame_ = in_frame;
+}
+
+void TestExprCmpFunc::eval_batch(const ObObjType type, const ObCmpOp cmp_op, ObExpr &cmp_expr)
+{
+  ObExpr::EvalBatchFunc func = ObExprCmpFuncsHelper::get_eval_batch_expr_cmp_func(
+      type, type, 0, 0, cmp_op, false, CS_TYPE_BINARY, false);
+  ASSERT_TRUE(nullptr != func);
+  ObDatum *datums = cmp_expr.locate_batch_datums(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    datums[i].ptr_ = cmp_expr.get_rev_buf(eval_ctx_) + i * cmp_expr.res_buf_len_;
+    datums[i].set_null();
+  }
+  cmp_expr.get_evaluated_flags(eval_ctx_).reset(BATCH_SIZE);
+  cmp_expr.get_eval_info(eval_ctx_).notnull_ = true;
+  ASSERT_EQ(OB_SUCCESS, func(cmp_expr, eval_ctx_, *skip_, BATCH_SIZE));
+}
+
+void TestExprCmpFunc::check_result(const ObObjType type, const ObCmpOp cmp_op, ObExpr &cmp_expr)
+{
+  DatumCmpFunc datum_cmp = ObExprCmpFuncsHelper::get_datum_expr_cmp_func(
+      type, type, 0, 0, false, CS_TYPE_BINARY, false);
+  ASSERT_TRUE(nullptr != datum_cmp);
+  const ObExpr &left = *cmp_expr.args_[0];
+  const ObExpr &right = *cmp_expr.args_[1];
+  const ObDatum *res_datums = cmp_expr.locate_batch_datums(eval_ctx_);
+  const ObBitVector &eval_flags = cmp_expr.get_evaluated_flags(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    const ObDatum &l = left.is_batch_result() ? left.locate_batch_datums(eval_ctx_)[i]
+                                              : left.locate_expr_datum(eval_ctx_);
+    const ObDatum &r = right.is_batch_result() ? right.locate_batch_datums(eval_ctx_)[i]
+                                               : right.locate_expr_datum(eval_ctx_);
+    if (l.is_null()) {
+      // skipped by null short circuit of the left operand
+      ASSERT_TRUE(!eval_flags.at(i) || res_datums[i].is_null()) << "row: " << i;
+    } else {
+      ASSERT_TRUE(eval_flags.at(i)) << "row: " << i;
+      if (r.is_null()) {
+        ASSERT_TRUE(res_datums[i].is_null()) << "row: " << i;
+      } else {
+        int cmp_ret = 0;
+        ASSERT_EQ(OB_SUCCESS, datum_cmp(l, r, cmp_ret));
+        bool expect = false;
+        switch (cmp_op) {
+          case CO_EQ: expect = 0 == cmp_ret; break;
+          case CO_NE: expect = 0 != cmp_ret; break;
+          case CO_LT: expect = cmp_ret < 0; break;
+          case CO_LE: expect = cmp_ret <= 0; break;
+          case CO_GT: expect = cmp_ret > 0; break;
+          case CO_GE: expect = cmp_ret >= 0; break;
+          default: FAIL() << "unexpected cmp op: " << cmp_op;
+        }
+        ASSERT_FALSE(res_datums[i].is_null()) << "row: " << i;
+        ASSERT_EQ(expect ? 1 : 0, res_datums[i].get_int())
+            << "type: " << type << " cmp_op: " << cmp_op << " row: " << i;
+      }
+    }
+  }
+}
+
+void TestExprCmpFunc::check_type(const ObObjType type, const int64_t *values, const int64_t value_cnt)
+{
+  ObExpr *left = alloc_expr(type, true);
+  ObExpr *right = alloc_expr(type, true);
+  ObExpr *scalar = alloc_expr(type, false);
+  ASSERT_TRUE(nullptr != left && nullptr != right && nullptr != scalar);
+  ObExpr *batch_cmp = alloc_cmp_expr(*left, *right);
+  ObExpr *scalar_cmp = alloc_cmp_expr(*left, *scalar);
+  ASSERT_TRUE(nullptr != batch_cmp && nullptr != scalar_cmp);
+  for (int64_t round = 0; round < 20; ++round) {
+    const bool has_null = 1 == round % 2;
+    fill_arg(*left, values, value_cnt, has_null);
+    fill_arg(*right, values, value_cnt, has_null);
+    fill_arg(*scalar, values, value_cnt, false);
+    for (int64_t op_idx = 0; op_idx < ARRAYSIZEOF(CMP_OPS); ++op_idx) {
+      // raw payload compare when both in frame and not null, datum compare otherwise
+      for (int64_t in_frame = 0; in_frame < 2; ++in_frame) {
+        set_in_frame(*left, has_null, in_frame);
+        set_in_frame(*right, has_null, in_frame);
+        set_in_frame(*scalar, false, in_frame);
+        eval_batch(type, CMP_OPS[op_idx], *batch_cmp);
+        check_result(type, CMP_OPS[op_idx], *batch_cmp);
+        eval_batch(type, CMP_OPS[op_idx], *scalar_cmp);
+        check_result(type, CMP_OPS[op_idx], *scalar_cmp);
+      }
+    }
+  }
+}
+
+TEST_F(TestExprCmpFunc, test_int)
+{
+  const int64_t values[] = { INT64_MIN, INT64_MIN + 1, -4294967296, INT32_MIN, -65536, -256, -129,
+      -128, -1, 0, 1, 127, 128, 255, 256, INT32_MAX, 4294967296, INT64_MAX - 1, INT64_MAX };
+  check_type(ObIntType, values, ARRAYSIZEOF(values));
+  const int64_t tiny_values[] = { -128, -127, -1, 0, 1, 126, 127 };
+  check_type(ObTinyIntType, tiny_values, ARRAYSIZEOF(tiny_values));
+}
+
+TEST_F(TestExprCmpFunc, test_uint)
+{
+  // values above INT64_MAX must be ordered as unsigned
+  const int64_t values[] = { 0, 1, 127, 128, 255, 256, INT32_MAX, 4294967296, INT64_MAX,
+      INT64_MIN, INT64_MIN + 1, -2, -1 };
+  check_type(ObUInt64Type, values, ARRAYSIZEOF(values));
+}
+
+TEST_F(TestExprCmpFunc, test_date)
+{
+  // 4 bytes payload, days before 1970-01-01 are negative
+  const int64_t values[] = { INT32_MIN, -719528, -365, -1, 0, 1, 255, 256, 65536, 18262,
+      2932896, INT32_MAX };
+  check_type(ObDateType, values, ARRAYSIZEOF(values));
+}
+
+TEST_F(TestExprCmpFunc, test_time)
+{
+  const int64_t values[] = { -3020399000000, -86400000000, -1000000, -1, 0, 1, 1000000,
+      86400000000, 3020399000000 };
+  check_type(ObTimeType, values, ARRAYSIZEOF(values));
+}
+
+TEST_F(TestExprCmpFunc, test_year)
+{
+  // 1 byte payload, years after 2027 have the high bit set and must be ordered as unsigned
+  const int64_t values[] = { 0, 1, 69, 70, 126, 127, 128, 129, 155, 254, 255 };
+  check_type(ObYearType, values, ARRAYSIZEOF(values));
+}
+
+TEST_F(TestExprCmpFunc, test_datetime)
+{
+  // microseconds before 1970-01-01 are negative
+  const int64_t values[] = { -62167219200000000, -2208988800000000, -86400000000, -1, 0, 1,
+      86400000000, 1697587200000000, 253402300799999999 };
+  check_type(ObDateTimeType, values, ARRAYSIZEOF(values));
+  check_type(ObTimestampType, values, ARRAYSIZEOF(values));
+}
+
+TEST_F(TestExprCmpFunc, test_raw_payload_in_frame)
+{
+  // the raw path compares the payload in frame, not the payload datums point to
+  const int64_t values[] = { -2, -1, 0, 1, 2 };
+  ObExpr *left = alloc_expr(ObIntType, true);
+  ObExpr *right = alloc_expr(ObIntType, true);
+  ASSERT_TRUE(nullptr != left && nullptr != right);
+  ObExpr *cmp_expr = alloc_cmp_expr(*left, *right);
+  ASSERT_TRUE(nullptr != cmp_expr);
+  fill_arg(*left, values, ARRAYSIZEOF(values), false);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    reinterpret_cast<int64_t *>(right->get_rev_buf(eval_ctx_))[i] =
+        reinterpret_cast<int64_t *>(left->get_rev_buf(eval_ctx_))[i];
+  }
+  // datums of right operand point to a copy with different values
+  int64_t *shadow = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * BATCH_SIZE));
+  ASSERT_TRUE(nullptr != shadow);
+  ObDatum *right_datums = right->locate_batch_datums(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    right_datums[i].ptr_ = reinterpret_cast<char *>(shadow + i);
+    right_datums[i].set_int(INT64_MAX);
+  }
+  set_in_frame(*left, false, true);
+  set_in_frame(*right, false, true);
+  eval_batch(ObIntType, CO_EQ, *cmp_expr);
+  const ObDatum *res_datums = cmp_expr->locate_batch_datums(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    ASSERT_EQ(i < RAW_CMP_ROW_CNT ? 1 : 0, res_datums[i].get_int()) << "row: " << i;
+  }
+  // datum compare once the operand is not in frame
+  set_in_frame(*right, false, false);
+  eval_batch(ObIntType, CO_EQ, *cmp_expr);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    ASSERT_EQ(0, res_datums[i].get_int()) << "row: " << i;
+  }
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_expr_cmp_func.log*");
+  OB_LOGGER.set_file_name("test_expr_cmp_func.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
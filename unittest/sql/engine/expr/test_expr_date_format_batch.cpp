@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include <string>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_expr_date_format.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_bit_vector.h"
+#include "sql/session/ob_sql_session_info.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace sql;
+
+namespace unittest
+{
+
+// The batch kernel of DATE_FORMAT caches the timezone offset and the date parts among the rows
+// of one batch, the result of every row must be the same as the row kernel.
+class TestExprDateFormatBatch : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 256;
+  static const int64_t FRAME_SIZE = 1L << 20;
+  TestExprDateFormatBatch()
+    : allocator_(ObModIds::TEST),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      skip_(nullptr),
+      frame_pos_(0)
+  {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  ObExpr *alloc_expr(const ObObjType type, const int64_t res_buf_len);
+  ObExpr *alloc_date_format_expr(ObExpr &date, ObExpr &format);
+  void init_session_time_zone();
+  void fill_args(ObExpr &date, ObExpr &format, const int64_t *values, const int64_t value_cnt);
+  void check_batch_result(ObExpr &expr);
+protected:
+  ObArenaAllocator allocator_;
+  ObSQLSessionInfo session_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObBitVector *skip_;
+  int64_t frame_pos_;
+};
+
+// transitions of America/New_York from 2022 to 2024, the offset before the first transition is EST
+static const int64_t NEW_YORK_TRAN_TIMES[] = {
+  1647154800, // 2022-03-13 07:00:00 UTC, EDT
+  1667714400, // 2022-11-06 06:00:00 UTC, EST
+  1678604400, // 2023-03-12 07:00:00 UTC, EDT
+  1699164000, // 2023-11-05 06:00:00 UTC, EST
+  1710054000  // 2024-03-10 07:00:00 UTC, EDT
+};
+
+static const char *FORMATS[] = {
+  "%Y-%m-%d %H:%i:%s.%f",
+  "%W %M %D %j %U %u %V %X",
+  "%a %b %e %c %k %l %p %r %T",
+  "%y%%%x%v%w"
+};
+
+void TestExprDateFormatBatch::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, ObPreProcessSysVars::init_sys_var());
+  ASSERT_EQ(OB_SUCCESS, session_.test_init(0, 0, 0, NULL));
+  ASSERT_EQ(OB_SUCCESS, session_.load_default_sys_variable(false, true));
+  ASSERT_EQ(OB_SUCCESS, session_.init_tenant("test", OB_SYS_TENANT_ID));
+  exec_ctx_.set_my_session(&session_);
+  init_session_time_zone();
+  eval_ctx_.max_batch_size_ = BATCH_SIZE;
+  eval_ctx_.frames_ = static_cast<char **>(allocator_.alloc(sizeof(char *)));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_);
+  eval_ctx_.frames_[0] = static_cast<char *>(allocator_.alloc(FRAME_SIZE));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_[0]);
+  MEMSET(eval_ctx_.frames_[0], 0, FRAME_SIZE);
+  skip_ = to_bit_vector(allocator_.alloc(ObBitVector::memory_size(BATCH_SIZE)));
+  ASSERT_TRUE(nullptr != skip_);
+  skip_->reset(BATCH_SIZE);
+  srand(20231018);
+}
+
+void TestExprDateFormatBatch::init_session_time_zone()
+{
+  const char *tz_name = "America/New_York";
+  const int32_t EST_OFFSET = -5 * 3600;
+  const int32_t EDT_OFFSET = -4 * 3600;
+  ObTimeZoneInfoPos &tz_info = session_.tz_info_wrap_.get_tz_info_pos();
+  tz_info.reset();
+  tz_info.set_tz_id(1);
+  ASSERT_EQ(OB_SUCCESS, tz_info.set_tz_name(tz_name, strlen(tz_name)));
+  ObTZTransitionTypeInfo default_type;
+  default_type.info_.offset_sec_ = EST_OFFSET;
+  default_type.info_.tran_type_id_ = 0;
+  default_type.set_tz_abbr(ObString::make_string("EST"));
+  ASSERT_EQ(OB_SUCCESS, tz_info.set_default_tran_type(default_type));
+  for (int64_t i = 0; i < ARRAYSIZEOF(NEW_YORK_TRAN_TIMES); ++i) {
+    const bool is_dst = (0 == i % 2);
+    ObTZTransitionTypeInfo tran_type;
+    tran_type.lower_time_ = NEW_YORK_TRAN_TIMES[i];
+    tran_type.info_.offset_sec_ = is_dst ? EDT_OFFSET : EST_OFFSET;
+    tran_type.info_.tran_type_id_ = is_dst ? 1 : 0;
+    tran_type.info_.is_dst_ = is_dst;
+    tran_type.set_tz_abbr(ObString::make_string(is_dst ? "EDT" : "EST"));
+    ASSERT_EQ(OB_SUCCESS, tz_info.add_tran_type_info(tran_type));
+  }
+  session_.tz_info_wrap_.set_tz_info_position();
+  ASSERT_EQ(&tz_info, session_.get_timezone_info());
+}
+
+ObExpr *TestExprDateFormatBatch::alloc_expr(const ObObjType type, const int64_t res_buf_len)
+{
+  ObExpr *expr = OB_NEWx(ObExpr, &allocator_);
+  if (nullptr != expr) {
+    expr->datum_meta_.type_ = type;
+    expr->obj_meta_.set_type(type);
+    expr->obj_datum_map_ = ObDatum::get_obj_datum_map_type(type);
+    expr->res_buf_len_ = res_buf_len;
+    expr->batch_result_ = true;
+    expr->batch_idx_mask_ = UINT64_MAX;
+    expr->frame_idx_ = 0;
+    expr->datum_off_ = frame_pos_;
+    frame_pos_ += sizeof(ObDatum) * BATCH_SIZE;
+    expr->eval_info_off_ = frame_pos_;
+    frame_pos_ += sizeof(ObEvalInfo);
+    expr->eval_flags_off_ = frame_pos_;
+    frame_pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr->pvt_skip_off_ = frame_pos_;
+    frame_pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr->res_buf_off_ = frame_pos_;
+    frame_pos_ += upper_align(expr->res_buf_len_ * BATCH_SIZE, 8);
+    EXPECT_LT(frame_pos_, FRAME_SIZE);
+    ObDatum *datums = expr->locate_batch_datums(eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+      datums[i].ptr_ = expr->get_rev_buf(eval_ctx_) + i * expr->res_buf_len_;
+    }
+  }
+  return expr;
+}
+
+ObExpr *TestExprDateFormatBatch::alloc_date_format_expr(ObExpr &date, ObExpr &format)
+{
+  // the result buffer of every row is large enough for DATE_FORMAT
+  ObExpr *expr = alloc_expr(ObVarcharType, OB_MAX_DATE_FORMAT_BUF_LEN);
+  ObExpr **args = static_cast<ObExpr **>(allocator_.alloc(sizeof(ObExpr *) * 2));
+  if (nullptr != expr && nullptr != args) {
+    args[0] = &date;
+    args[1] = &format;
+    expr->args_ = args;
+    expr->arg_cnt_ = 2;
+    expr->eval_func_ = ObExprDateFormat::calc_date_format;
+    expr->eval_batch_func_ = ObExprDateFormat::calc_date_format_batch;
+  }
+  return expr;
+}
+
+void TestExprDateFormatBatch::fill_args(
+    ObExpr &date,
+    ObExpr &format,
+    const int64_t *values,
+    const int64_t value_cnt)
+{
+  ObDatum *date_datums = date.locate_batch_datums(eval_ctx_);
+  ObDatum *format_datums = format.locate_batch_datums(eval_ctx_);
+  // rows of one batch are close to each other, with a few jumps and nulls between them
+  int64_t value_idx = rand() % value_cnt;
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    date_datums[i].ptr_ = date.get_rev_buf(eval_ctx_) + i * date.res_buf_len_;
+    if (0 == rand() % 8) {
+      value_idx = rand() % value_cnt;
+    }
+    if (0 == rand() % 13) {
+      date_datums[i].set_null();
+    } else {
+      date_datums[i].set_datetime(values[value_idx] + (rand() % 3 - 1) * (rand() % 4000000));
+    }
+    if (0 == rand() % 17) {
+      format_datums[i].set_null();
+    } else {
+      const char *fmt = FORMATS[rand() % ARRAYSIZEOF(FORMATS)];
+      format_datums[i].set_string(fmt, static_cast<int32_t>(strlen(fmt)));
+    }
+  }
+  ObEvalInfo &date_info = date.get_eval_info(eval_ctx_);
+  date_info.evaluated_ = true;
+  date_info.projected_ = true;
+  ObEvalInfo &format_info = format.get_eval_info(eval_ctx_);
+  format_info.evaluated_ = true;
+  format_info.projected_ = true;
+  skip_->reset(BATCH_SIZE);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    if (0 == rand() % 11) {
+      skip_->set(i);
+    }
+  }
+}
+
+void TestExprDateFormatBatch::check_batch_result(ObExpr &expr)
+{
+  std::string expected[BATCH_SIZE];
+  bool expected_null[BATCH_SIZE];
+  {
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+    batch_info_guard.set_batch_size(BATCH_SIZE);
+    for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+      if (!skip_->at(i)) {
+        batch_info_guard.set_batch_idx(i);
+        ObDatum &datum = expr.locate_batch_datums(eval_ctx_)[i];
+        ASSERT_EQ(OB_SUCCESS, ObExprDateFormat::calc_date_format(expr, eval_ctx_, datum));
+        expected_null[i] = datum.is_null();
+        if (!datum.is_null()) {
+          expected[i].assign(datum.ptr_, datum.len_);
+        }
+      }
+    }
+  }
+  ObDatum *datums = expr.locate_batch_datums(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    datums[i].set_null();
+  }
+  expr.get_evaluated_flags(eval_ctx_).reset(BATCH_SIZE);
+  ASSERT_EQ(OB_SUCCESS, ObExprDateFormat::calc_date_format_batch(expr, eval_ctx_, *skip_,
+                                                                 BATCH_SIZE));
+  const ObBitVector &eval_flags = expr.get_evaluated_flags(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    if (skip_->at(i)) {
+      ASSERT_FALSE(eval_flags.at(i)) << "row: " << i;
+    } else {
+      ASSERT_TRUE(eval_flags.at(i)) << "row: " << i;
+      ASSERT_EQ(expected_null[i], datums[i].is_null()) << "row: " << i;
+      if (!expected_null[i]) {
+        ASSERT_EQ(expected[i], std::string(datums[i].ptr_, datums[i].len_))
+            << "type: " << expr.args_[0]->datum_meta_.type_ << " row: " << i;
+      }
+    }
+  }
+}
+
+TEST_F(TestExprDateFormatBatch, test_datetime_and_timestamp)
+{
+  // values on both sides of the transitions and exactly at them, and values far from them
+  ObSEArray<int64_t, 64> values;
+  for (int64_t i = 0; i < ARRAYSIZEOF(NEW_YORK_TRAN_TIMES); ++i) {
+    const int64_t tran_usec = NEW_YORK_TRAN_TIMES[i] * USECS_PER_SEC;
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec - 1));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec + 1));
+    ASSERT_EQ(OB_SUCCESS, values.push_back(tran_usec + 5 * 3600 * USECS_PER_SEC));
+  }
+  const int64_t other_values[] = { -2208988800000000, -86400000000, 0, 86400000000,
+      1697587200000000, 253402214400000000 };
+  for (int64_t i = 0; i < ARRAYSIZEOF(other_values); ++i) {
+    ASSERT_EQ(OB_SUCCESS, values.push_back(other_values[i]));
+  }
+  const ObObjType types[] = { ObDateTimeType, ObTimestampType };
+  for (int64_t type_idx = 0; type_idx < ARRAYSIZEOF(types); ++type_idx) {
+    ObExpr *date = alloc_expr(types[type_idx], sizeof(int64_t));
+    ObExpr *format = alloc_expr(ObVarcharType, 0);
+    ASSERT_TRUE(nullptr != date && nullptr != format);
+    ObExpr *expr = alloc_date_format_expr(*date, *format);
+    ASSERT_TRUE(nullptr != expr);
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_args(*date, *format, &values.at(0), values.count());
+      check_batch_result(*expr);
+    }
+  }
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_expr_date_format_batch.log*");
+  OB_LOGGER.set_file_name("test_expr_date_format_batch.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
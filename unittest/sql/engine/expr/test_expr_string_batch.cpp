@@ -0,0 +1,518 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include <string>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_expr_concat.h"
+#include "sql/engine/expr/ob_expr_lower.h"
+#include "sql/engine/expr/ob_expr_replace.h"
+#include "sql/engine/expr/ob_expr_instr.h"
+#include "sql/engine/expr/ob_expr_trim.h"
+#include "sql/engine/expr/ob_expr_length.h"
+#include "sql/engine/expr/ob_expr_char_length.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_bit_vector.h"
+#include "sql/session/ob_sql_session_info.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+// defined in ob_expr_left.cpp and ob_expr_right.cpp
+int calc_left_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+int calc_left_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                         const ObBitVector &skip, const int64_t batch_size);
+int calc_right_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+int calc_right_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                          const ObBitVector &skip, const int64_t batch_size);
+}
+
+using namespace common;
+using namespace share;
+using namespace sql;
+
+namespace unittest
+{
+
+// The batch kernels of the string functions take ASCII fast paths and locate the result memory
+// by batch idx, the result of every row must be the same as the row kernel.
+class TestExprStringBatch : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 256;
+  static const int64_t FRAME_SIZE = 4L << 20;
+  // large enough for the results of the strings below, no dynamic result memory is needed
+  static const int64_t RES_BUF_LEN = 256;
+  TestExprStringBatch()
+    : allocator_(ObModIds::TEST),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      skip_(nullptr),
+      frame_pos_(0)
+  {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  ObExpr *alloc_expr(const ObObjType type, const ObCollationType cs_type,
+                     const int64_t res_buf_len);
+  ObExpr *alloc_func_expr(const ObExprOperatorType type,
+                          const ObObjType res_type,
+                          const ObCollationType cs_type,
+                          ObExpr::EvalFunc eval_func,
+                          ObExpr::EvalBatchFunc eval_batch_func,
+                          ObExpr *arg0,
+                          ObExpr *arg1 = nullptr,
+                          ObExpr *arg2 = nullptr);
+  void fill_str_arg(ObExpr &arg, const char *const *strs, const int64_t str_cnt);
+  void fill_int_arg(ObExpr &arg, const int64_t min, const int64_t max);
+  void set_str_row(ObExpr &arg, const int64_t idx, const char *str);
+  void set_int_row(ObExpr &arg, const int64_t idx, const int64_t value);
+  void fill_skip();
+  void check_batch_result(ObExpr &expr);
+protected:
+  ObArenaAllocator allocator_;
+  ObSQLSessionInfo session_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObBitVector *skip_;
+  int64_t frame_pos_;
+};
+
+// ASCII and multibyte strings, empty and blank strings, leading and trailing spaces
+static const char *STRS[] = {
+  "",
+  "   ",
+  "a",
+  "abc",
+  "  Hello World  ",
+  "OceanBase",
+  "AbCdEfGhIjKlMnOp",
+  "aaaa",
+  "数据库",
+  "  中文 空格  ",
+  "混合Mixed文字",
+  "Ünïcödé",
+  "αβγ ΑΒΓ",
+  "🙂 emoji 🙂"
+};
+
+static const char *NEEDLES[] = { "", "a", "o", "Wor", "aa", "数据", "文", "Mixed", "🙂", "zzz" };
+
+static const char *FROMS[] = { "", "a", "o", " ", "aa", "数", "Γ", "🙂" };
+
+static const char *TOS[] = { "", "X", "--", "哈哈" };
+
+static const ObCollationType CS_TYPES[] = { CS_TYPE_UTF8MB4_GENERAL_CI, CS_TYPE_UTF8MB4_BIN };
+
+void TestExprStringBatch::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, ObPreProcessSysVars::init_sys_var());
+  ASSERT_EQ(OB_SUCCESS, session_.test_init(0, 0, 0, NULL));
+  ASSERT_EQ(OB_SUCCESS, session_.load_default_sys_variable(false, true));
+  ASSERT_EQ(OB_SUCCESS, session_.init_tenant("test", OB_SYS_TENANT_ID));
+  exec_ctx_.set_my_session(&session_);
+  eval_ctx_.max_batch_size_ = BATCH_SIZE;
+  eval_ctx_.frames_ = static_cast<char **>(allocator_.alloc(sizeof(char *)));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_);
+  eval_ctx_.frames_[0] = static_cast<char *>(allocator_.alloc(FRAME_SIZE));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_[0]);
+  MEMSET(eval_ctx_.frames_[0], 0, FRAME_SIZE);
+  skip_ = to_bit_vector(allocator_.alloc(ObBitVector::memory_size(BATCH_SIZE)));
+  ASSERT_TRUE(nullptr != skip_);
+  skip_->reset(BATCH_SIZE);
+  srand(20231018);
+}
+
+ObExpr *TestExprStringBatch::alloc_expr(const ObObjType type,
+                                        const ObCollationType cs_type,
+                                        const int64_t res_buf_len)
+{
+  ObExpr *expr = OB_NEWx(ObExpr, &allocator_);
+  if (nullptr != expr) {
+    expr->datum_meta_.type_ = type;
+    expr->datum_meta_.cs_type_ = cs_type;
+    expr->obj_meta_.set_type(type);
+    expr->obj_meta_.set_collation_type(cs_type);
+    expr->obj_datum_map_ = ObDatum::get_obj_datum_map_type(type);
+    expr->res_buf_len_ = res_buf_len;
+    expr->batch_result_ = true;
+    expr->batch_idx_mask_ = UINT64_MAX;
+    expr->frame_idx_ = 0;
+    expr->datum_off_ = frame_pos_;
+    frame_pos_ += sizeof(ObDatum) * BATCH_SIZE;
+    expr->eval_info_off_ = frame_pos_;
+    frame_pos_ += sizeof(ObEvalInfo);
+    expr->eval_flags_off_ = frame_pos_;
+    frame_pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr->pvt_skip_off_ = frame_pos_;
+    frame_pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr->res_buf_off_ = frame_pos_;
+    frame_pos_ += upper_align(expr->res_buf_len_ * BATCH_SIZE, 8);
+    EXPECT_LT(frame_pos_, FRAME_SIZE);
+    ObDatum *datums = expr->locate_batch_datums(eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+      datums[i].ptr_ = expr->get_rev_buf(eval_ctx_) + i * expr->res_buf_len_;
+    }
+  }
+  return expr;
+}
+
+ObExpr *TestExprStringBatch::alloc_func_expr(const ObExprOperatorType type,
+                                             const ObObjType res_type,
+                                             const ObCollationType cs_type,
+                                             ObExpr::EvalFunc eval_func,
+                                             ObExpr::EvalBatchFunc eval_batch_func,
+                                             ObExpr *arg0,
+                                             ObExpr *arg1,
+                                             ObExpr *arg2)
+{
+  ObExpr *expr = alloc_expr(res_type, cs_type, ob_is_string_tc(res_type) ? RES_BUF_LEN : 8);
+  ObExpr **args = static_cast<ObExpr **>(allocator_.alloc(sizeof(ObExpr *) * 3));
+  if (nullptr != expr && nullptr != args) {
+    args[0] = arg0;
+    args[1] = arg1;
+    args[2] = arg2;
+    expr->type_ = type;
+    expr->args_ = args;
+    expr->arg_cnt_ = nullptr == arg1 ? 1 : (nullptr == arg2 ? 2 : 3);
+    expr->eval_func_ = eval_func;
+    expr->eval_batch_func_ = eval_batch_func;
+  }
+  return expr;
+}
+
+void TestExprStringBatch::fill_str_arg(ObExpr &arg, const char *const *strs, const int64_t str_cnt)
+{
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    set_str_row(arg, i, 0 == rand() % 13 ? nullptr : strs[rand() % str_cnt]);
+  }
+  ObEvalInfo &info = arg.get_eval_info(eval_ctx_);
+  info.evaluated_ = true;
+  info.projected_ = true;
+}
+
+void TestExprStringBatch::fill_int_arg(ObExpr &arg, const int64_t min, const int64_t max)
+{
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    ObDatum &datum = arg.locate_batch_datums(eval_ctx_)[i];
+    datum.ptr_ = arg.get_rev_buf(eval_ctx_) + i * arg.res_buf_len_;
+    if (0 == rand() % 17) {
+      datum.set_null();
+    } else {
+      datum.set_int(min + rand() % (max - min + 1));
+    }
+  }
+  ObEvalInfo &info = arg.get_eval_info(eval_ctx_);
+  info.evaluated_ = true;
+  info.projected_ = true;
+}
+
+// set NULL if %str is nullptr
+void TestExprStringBatch::set_str_row(ObExpr &arg, const int64_t idx, const char *str)
+{
+  ObDatum &datum = arg.locate_batch_datums(eval_ctx_)[idx];
+  if (nullptr == str) {
+    datum.set_null();
+  } else {
+    datum.set_string(str, static_cast<int32_t>(strlen(str)));
+  }
+}
+
+void TestExprStringBatch::set_int_row(ObExpr &arg, const int64_t idx, const int64_t value)
+{
+  ObDatum &datum = arg.locate_batch_datums(eval_ctx_)[idx];
+  datum.ptr_ = arg.get_rev_buf(eval_ctx_) + idx * arg.res_buf_len_;
+  datum.set_int(value);
+}
+
+void TestExprStringBatch::fill_skip()
+{
+  skip_->reset(BATCH_SIZE);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    if (0 == rand() % 11) {
+      skip_->set(i);
+    }
+  }
+}
+
+void TestExprStringBatch::check_batch_result(ObExpr &expr)
+{
+  std::string expected[BATCH_SIZE];
+  bool expected_null[BATCH_SIZE];
+  ObDatum *datums = expr.locate_batch_datums(eval_ctx_);
+  {
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+    batch_info_guard.set_batch_size(BATCH_SIZE);
+    for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+      if (!skip_->at(i)) {
+        batch_info_guard.set_batch_idx(i);
+        ObDatum &datum = datums[i];
+        datum.ptr_ = expr.get_rev_buf(eval_ctx_) + i * expr.res_buf_len_;
+        ASSERT_EQ(OB_SUCCESS, expr.eval_func_(expr, eval_ctx_, datum)) << "row: " << i;
+        expected_null[i] = datum.is_null();
+        if (!datum.is_null()) {
+          expected[i].assign(datum.ptr_, datum.len_);
+        }
+      }
+    }
+  }
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    datums[i].ptr_ = expr.get_rev_buf(eval_ctx_) + i * expr.res_buf_len_;
+    datums[i].set_null();
+  }
+  expr.get_evaluated_flags(eval_ctx_).reset(BATCH_SIZE);
+  ASSERT_EQ(OB_SUCCESS, expr.eval_batch_func_(expr, eval_ctx_, *skip_, BATCH_SIZE));
+  const ObBitVector &eval_flags = expr.get_evaluated_flags(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    if (skip_->at(i)) {
+      ASSERT_FALSE(eval_flags.at(i)) << "row: " << i;
+    } else {
+      ASSERT_TRUE(eval_flags.at(i)) << "row: " << i;
+      ASSERT_EQ(expected_null[i], datums[i].is_null())
+          << "expr: " << expr.type_ << " row: " << i;
+      if (!expected_null[i]) {
+        ASSERT_EQ(expected[i], std::string(datums[i].ptr_, datums[i].len_))
+            << "expr: " << expr.type_ << " cs_type: " << expr.datum_meta_.cs_type_
+            << " row: " << i;
+      }
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_length_and_char_length)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *str = alloc_expr(ObVarcharType, cs_type, 0);
+    ASSERT_TRUE(nullptr != str);
+    ObExpr *length = alloc_func_expr(T_FUN_SYS_LENGTH, ObIntType, CS_TYPE_BINARY,
+        ObExprLength::calc_mysql_mode, ObExprLength::calc_mysql_mode_batch, str);
+    ObExpr *char_length = alloc_func_expr(T_FUN_SYS_CHAR_LENGTH, ObIntType, CS_TYPE_BINARY,
+        ObExprCharLength::eval_char_length, ObExprCharLength::eval_char_length_batch, str);
+    ASSERT_TRUE(nullptr != length && nullptr != char_length);
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_str_arg(*str, STRS, ARRAYSIZEOF(STRS));
+      fill_skip();
+      check_batch_result(*length);
+      check_batch_result(*char_length);
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_lower_and_upper)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *str = alloc_expr(ObVarcharType, cs_type, 0);
+    ASSERT_TRUE(nullptr != str);
+    ObExpr *lower = alloc_func_expr(T_FUN_SYS_LOWER, ObVarcharType, cs_type,
+        ObExprLower::calc_lower, ObExprLower::calc_lower_batch, str);
+    ObExpr *upper = alloc_func_expr(T_FUN_SYS_UPPER, ObVarcharType, cs_type,
+        ObExprUpper::calc_upper, ObExprUpper::calc_upper_batch, str);
+    ASSERT_TRUE(nullptr != lower && nullptr != upper);
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_str_arg(*str, STRS, ARRAYSIZEOF(STRS));
+      fill_skip();
+      check_batch_result(*lower);
+      check_batch_result(*upper);
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_concat)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *str1 = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *str2 = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *str3 = alloc_expr(ObVarcharType, cs_type, 0);
+    ASSERT_TRUE(nullptr != str1 && nullptr != str2 && nullptr != str3);
+    ObExpr *concat2 = alloc_func_expr(T_FUN_SYS_CONCAT, ObVarcharType, cs_type,
+        ObExprConcat::eval_concat, ObExprConcat::eval_concat_batch, str1, str2);
+    ObExpr *concat3 = alloc_func_expr(T_FUN_SYS_CONCAT, ObVarcharType, cs_type,
+        ObExprConcat::eval_concat, ObExprConcat::eval_concat_batch, str1, str2, str3);
+    ASSERT_TRUE(nullptr != concat2 && nullptr != concat3);
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_str_arg(*str1, STRS, ARRAYSIZEOF(STRS));
+      fill_str_arg(*str2, STRS, ARRAYSIZEOF(STRS));
+      fill_str_arg(*str3, STRS, ARRAYSIZEOF(STRS));
+      fill_skip();
+      check_batch_result(*concat2);
+      check_batch_result(*concat3);
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_left_and_right)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *str = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *len = alloc_expr(ObIntType, CS_TYPE_BINARY, sizeof(int64_t));
+    ASSERT_TRUE(nullptr != str && nullptr != len);
+    ObExpr *left = alloc_func_expr(T_FUN_SYS_LEFT, ObVarcharType, cs_type,
+        calc_left_expr, calc_left_expr_batch, str, len);
+    ObExpr *right = alloc_func_expr(T_FUN_SYS_RIGHT, ObVarcharType, cs_type,
+        calc_right_expr, calc_right_expr_batch, str, len);
+    ASSERT_TRUE(nullptr != left && nullptr != right);
+    for (int64_t round = 0; round < 20; ++round) {
+      // lengths out of the string on both sides
+      fill_str_arg(*str, STRS, ARRAYSIZEOF(STRS));
+      fill_int_arg(*len, -2, 20);
+      fill_skip();
+      check_batch_result(*left);
+      check_batch_result(*right);
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_replace)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *text = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *from = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *to = alloc_expr(ObVarcharType, cs_type, 0);
+    ASSERT_TRUE(nullptr != text && nullptr != from && nullptr != to);
+    ObExpr *replace2 = alloc_func_expr(T_FUN_SYS_REPLACE, ObVarcharType, cs_type,
+        ObExprReplace::eval_replace, ObExprReplace::eval_replace_batch, text, from);
+    ObExpr *replace3 = alloc_func_expr(T_FUN_SYS_REPLACE, ObVarcharType, cs_type,
+        ObExprReplace::eval_replace, ObExprReplace::eval_replace_batch, text, from, to);
+    ASSERT_TRUE(nullptr != replace2 && nullptr != replace3);
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_str_arg(*text, STRS, ARRAYSIZEOF(STRS));
+      fill_str_arg(*from, FROMS, ARRAYSIZEOF(FROMS));
+      fill_str_arg(*to, TOS, ARRAYSIZEOF(TOS));
+      fill_skip();
+      check_batch_result(*replace2);
+      check_batch_result(*replace3);
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_instr)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *haystack = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *needle = alloc_expr(ObVarcharType, cs_type, 0);
+    ASSERT_TRUE(nullptr != haystack && nullptr != needle);
+    ObExpr *instr = alloc_func_expr(T_FUN_SYS_INSTR, ObIntType, CS_TYPE_BINARY,
+        ObExprInstr::calc_mysql_instr_expr, ObExprInstr::calc_mysql_instr_expr_batch,
+        haystack, needle);
+    ASSERT_TRUE(nullptr != instr);
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_str_arg(*haystack, STRS, ARRAYSIZEOF(STRS));
+      fill_str_arg(*needle, NEEDLES, ARRAYSIZEOF(NEEDLES));
+      fill_skip();
+      check_batch_result(*instr);
+    }
+  }
+}
+
+TEST_F(TestExprStringBatch, test_trim)
+{
+  for (int64_t cs_idx = 0; cs_idx < ARRAYSIZEOF(CS_TYPES); ++cs_idx) {
+    const ObCollationType cs_type = CS_TYPES[cs_idx];
+    ObExpr *str = alloc_expr(ObVarcharType, cs_type, 0);
+    ObExpr *trim_type = alloc_expr(ObIntType, CS_TYPE_BINARY, sizeof(int64_t));
+    ASSERT_TRUE(nullptr != str && nullptr != trim_type);
+    // trim(str), ltrim(str), rtrim(str) and trim(both|leading|trailing from str)
+    ObExpr *exprs[] = {
+      alloc_func_expr(T_FUN_SYS_TRIM, ObVarcharType, cs_type,
+          ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch, str),
+      alloc_func_expr(T_FUN_SYS_LTRIM, ObVarcharType, cs_type,
+          ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch, str),
+      alloc_func_expr(T_FUN_SYS_RTRIM, ObVarcharType, cs_type,
+          ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch, str),
+      alloc_func_expr(T_FUN_SYS_TRIM, ObVarcharType, cs_type,
+          ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch, trim_type, str)
+    };
+    for (int64_t round = 0; round < 20; ++round) {
+      fill_str_arg(*str, STRS, ARRAYSIZEOF(STRS));
+      fill_int_arg(*trim_type, ObExprTrim::TYPE_LRTRIM, ObExprTrim::TYPE_RTRIM);
+      fill_skip();
+      for (int64_t i = 0; i < ARRAYSIZEOF(exprs); ++i) {
+        ASSERT_TRUE(nullptr != exprs[i]);
+        check_batch_result(*exprs[i]);
+      }
+    }
+  }
+}
+
+// empty string is NULL in oracle mode, both kernels must return NULL for the empty results
+TEST_F(TestExprStringBatch, test_oracle_empty_string)
+{
+  lib::CompatModeGuard compat_guard(lib::Worker::CompatMode::ORACLE);
+  const ObCollationType cs_type = CS_TYPE_UTF8MB4_BIN;
+  ObExpr *str = alloc_expr(ObVarcharType, cs_type, 0);
+  ObExpr *len = alloc_expr(ObIntType, CS_TYPE_BINARY, sizeof(int64_t));
+  ObExpr *from = alloc_expr(ObVarcharType, cs_type, 0);
+  ASSERT_TRUE(nullptr != str && nullptr != len && nullptr != from);
+  ObExpr *exprs[] = {
+    alloc_func_expr(T_FUN_SYS_LEFT, ObVarcharType, cs_type,
+        calc_left_expr, calc_left_expr_batch, str, len),
+    alloc_func_expr(T_FUN_SYS_RIGHT, ObVarcharType, cs_type,
+        calc_right_expr, calc_right_expr_batch, str, len),
+    alloc_func_expr(T_FUN_SYS_LOWER, ObVarcharType, cs_type,
+        ObExprLower::calc_lower, ObExprLower::calc_lower_batch, str),
+    alloc_func_expr(T_FUN_SYS_UPPER, ObVarcharType, cs_type,
+        ObExprUpper::calc_upper, ObExprUpper::calc_upper_batch, str),
+    alloc_func_expr(T_FUN_SYS_TRIM, ObVarcharType, cs_type,
+        ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch, str),
+    alloc_func_expr(T_FUN_SYS_REPLACE, ObVarcharType, cs_type,
+        ObExprReplace::eval_replace, ObExprReplace::eval_replace_batch, str, from)
+  };
+  for (int64_t round = 0; round < 20; ++round) {
+    fill_str_arg(*str, STRS, ARRAYSIZEOF(STRS));
+    fill_int_arg(*len, -2, 20);
+    fill_str_arg(*from, FROMS, ARRAYSIZEOF(FROMS));
+    fill_skip();
+    // rows whose result is empty: left/right of length 0, trim of blanks, replace of all chars
+    set_str_row(*str, 0, "   ");
+    set_int_row(*len, 0, 0);
+    set_str_row(*from, 0, " ");
+    skip_->unset(0);
+    for (int64_t i = 0; i < ARRAYSIZEOF(exprs); ++i) {
+      ASSERT_TRUE(nullptr != exprs[i]);
+      check_batch_result(*exprs[i]);
+      if (T_FUN_SYS_LOWER != exprs[i]->type_ && T_FUN_SYS_UPPER != exprs[i]->type_) {
+        ASSERT_TRUE(exprs[i]->locate_batch_datums(eval_ctx_)[0].is_null())
+            << "expr: " << exprs[i]->type_;
+      }
+    }
+    // lower/upper of empty string
+    set_str_row(*str, 0, "");
+    for (int64_t i = 0; i < ARRAYSIZEOF(exprs); ++i) {
+      check_batch_result(*exprs[i]);
+      ASSERT_TRUE(exprs[i]->locate_batch_datums(eval_ctx_)[0].is_null())
+          << "expr: " << exprs[i]->type_;
+    }
+  }
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_expr_string_batch.log*");
+  OB_LOGGER.set_file_name("test_expr_string_batch.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#define private public
+#define protected public
+#include "sql/engine/sort/ob_parallel_sort.h"
+#include "sql/engine/sort/ob_sort_op_impl.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/random/ob_random.h"
+#include "lib/utility/ob_tracepoint.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+typedef ObChunkDatumStore::StoredRow StoredRow;
+
+#define CALL(func, ...) func(__VA_ARGS__); ASSERT_FALSE(HasFatalFailure());
+
+// row: (key, id), sorted by key only, id tells the rows with the same key apart
+static const int64_t COL_CNT = 2;
+static const int64_t KEY_IDX = 0;
+static const int64_t ID_IDX = 1;
+static int64_t g_fail_key = INT64_MIN;
+
+static int cmp_int(const ObDatum &l, const ObDatum &r, int &cmp)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(g_fail_key == l.get_int() || g_fail_key == r.get_int())) {
+    ret = OB_ERR_UNEXPECTED;
+  } else {
+    cmp = l.get_int() < r.get_int() ? -1 : (l.get_int() > r.get_int() ? 1 : 0);
+  }
+  return ret;
+}
+
+static int cmp_str(const ObDatum &l, const ObDatum &r, int &cmp)
+{
+  cmp = MEMCMP(l.ptr_, r.ptr_, min(l.len_, r.len_));
+  cmp = 0 != cmp ? (cmp < 0 ? -1 : 1) : (l.len_ < r.len_ ? -1 : (l.len_ > r.len_ ? 1 : 0));
+  return OB_SUCCESS;
+}
+
+class TestParallelSort : public ::testing::Test
+{
+public:
+  TestParallelSort() : allocator_(ObModIds::TEST), exec_ctx_(allocator_) {}
+  virtual void SetUp() override
+  {
+    ASSERT_EQ(OB_SUCCESS, session_.test_init(0, 0, 0, NULL));
+    exec_ctx_.set_my_session(&session_);
+    ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_physical_plan_ctx());
+    g_fail_key = INT64_MIN;
+  }
+  virtual void TearDown() override
+  {
+    g_fail_key = INT64_MIN;
+    collations_.reset();
+    cmp_funcs_.reset();
+    allocator_.reset();
+  }
+
+  void init_sort_info(const bool is_ascending)
+  {
+    ObSortCmpFunc cmp_func;
+    cmp_func.cmp_func_ = cmp_int;
+    collations_.reset();
+    cmp_funcs_.reset();
+    ASSERT_EQ(OB_SUCCESS, collations_.push_back(
+        ObSortFieldCollation(KEY_IDX, CS_TYPE_BINARY, is_ascending, NULL_FIRST)));
+    ASSERT_EQ(OB_SUCCESS, cmp_funcs_.push_back(cmp_func));
+  }
+
+  static StoredRow *build_row(const int64_t key, const int64_t id, ObIAllocator &allocator)
+  {
+    const int64_t row_size = sizeof(StoredRow) + (sizeof(ObDatum) + sizeof(int64_t)) * COL_CNT;
+    char *buf = static_cast<char *>(allocator.alloc(row_size));
+    StoredRow *row = NULL;
+    if (OB_NOT_NULL(buf)) {
+      row = new (buf) StoredRow();
+      row->cnt_ = COL_CNT;
+      row->row_size_ = row_size;
+      int64_t *values = reinterpret_cast<int64_t *>(buf + sizeof(StoredRow) + sizeof(ObDatum) * COL_CNT);
+      values[KEY_IDX] = key;
+      values[ID_IDX] = id;
+      for (int64_t i = 0; i < COL_CNT; ++i) {
+        ObDatum &cell = row->cells()[i];
+        cell.ptr_ = reinterpret_cast<const char *>(values + i);
+        cell.pack_ = sizeof(int64_t);
+      }
+    }
+    return row;
+  }
+
+  // %rows gets %begin + row_cnt + 3 rows, [begin, begin + row_cnt) of which are to be sorted
+  void build_rows(const int64_t begin, const int64_t row_cnt, const int64_t key_range,
+                  ObIArray<StoredRow *> &rows)
+  {
+    const int64_t total_cnt = begin + row_cnt + 3;
+    for (int64_t i = 0; i < total_cnt; ++i) {
+      StoredRow *row = build_row(ObRandom::rand(0, key_range - 1), i, allocator_);
+      ASSERT_TRUE(NULL != row);
+      ASSERT_EQ(OB_SUCCESS, rows.push_back(row));
+    }
+  }
+
+  void check_sort(const int64_t begin, const int64_t row_cnt, const int64_t degree,
+                  const int64_t key_range, const bool is_ascending)
+  {
+    ObArray<StoredRow *> rows;
+    ObArray<StoredRow *> expect_rows;
+    ObArray<StoredRow *> tmp_buf;
+    CALL(init_sort_info, is_ascending);
+    CALL(build_rows, begin, row_cnt, key_range, rows);
+    ASSERT_EQ(OB_SUCCESS, expect_rows.assign(rows));
+    ASSERT_EQ(OB_SUCCESS, tmp_buf.prepare_allocate(row_cnt));
+    ObSortOpImpl::Compare comp;
+    ASSERT_EQ(OB_SUCCESS, comp.init(&collations_, &cmp_funcs_, &exec_ctx_, false));
+    std::sort(&expect_rows.at(begin), &expect_rows.at(begin) + row_cnt,
+              ObSortOpImpl::CopyableComparer(comp));
+
+    ASSERT_EQ(OB_SUCCESS, ObParallelSorter::sort(&rows.at(0), begin, begin + row_cnt, degree,
+        collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+
+    // rows out of [begin, begin + row_cnt) are untouched
+    for (int64_t i = 0; i < rows.count(); ++i) {
+      if (i < begin || i >= begin + row_cnt) {
+        ASSERT_EQ(expect_rows.at(i), rows.at(i)) << "i: " << i;
+      }
+    }
+    // the keys are the same as std::sort, and every row shows up exactly once,
+    // the order of rows with the same key is not defined by either sort
+    ObArray<int64_t> ids;
+    for (int64_t i = begin; i < begin + row_cnt; ++i) {
+      ASSERT_EQ(expect_rows.at(i)->cells()[KEY_IDX].get_int(), rows.at(i)->cells()[KEY_IDX].get_int())
+          << "i: " << i << " degree: " << degree << " row_cnt: " << row_cnt;
+      ASSERT_EQ(OB_SUCCESS, ids.push_back(rows.at(i)->cells()[ID_IDX].get_int()));
+    }
+    std::sort(&ids.at(0), &ids.at(0) + ids.count());
+    for (int64_t i = 0; i < ids.count(); ++i) {
+      ASSERT_EQ(begin + i, ids.at(i));
+    }
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObSQLSessionInfo session_;
+  ObExecContext exec_ctx_;
+  ObArray<ObSortFieldCollation> collations_;
+  ObArray<ObSortCmpFunc> cmp_funcs_;
+};
+
+TEST_F(TestParallelSort, test_degree)
+{
+  // even and odd run counts, and a degree larger than MAX_RUN_CNT
+  const int64_t degrees[] = {2, 3, 4, 5, 7, 8, 13, 16, 64, 100};
+  for (int64_t i = 0; i < ARRAYSIZEOF(degrees); ++i) {
+    CALL(check_sort, 0, 10007, degrees[i], INT32_MAX, true);
+    CALL(check_sort, 0, 10007, degrees[i], INT32_MAX, false);
+  }
+}
+
+TEST_F(TestParallelSort, test_row_cnt)
+{
+  // runs of uneven sizes, and a run of one row
+  CALL(check_sort, 0, 2, 2, INT32_MAX, true);
+  CALL(check_sort, 0, 7, 7, INT32_MAX, true);
+  CALL(check_sort, 0, 8, 7, INT32_MAX, true);
+  CALL(check_sort, 0, 65, 64, INT32_MAX, true);
+  CALL(check_sort, 0, 1023, 3, INT32_MAX, true);
+}
+
+TEST_F(TestParallelSort, test_begin_offset)
+{
+  // only [begin, end) is sorted, tmp_buf is indexed from begin
+  CALL(check_sort, 17, 5000, 4, INT32_MAX, true);
+  CALL(check_sort, 1001, 3333, 5, INT32_MAX, false);
+}
+
+TEST_F(TestParallelSort, test_duplicate_keys)
+{
+  CALL(check_sort, 0, 10000, 4, 1, true);
+  CALL(check_sort, 0, 10000, 5, 2, true);
+  CALL(check_sort, 0, 10000, 8, 10, false);
+  CALL(check_sort, 3, 9999, 7, 100, true);
+}
+
+TEST_F(TestParallelSort, test_invalid_argument)
+{
+  ObArray<StoredRow *> rows;
+  ObArray<StoredRow *> tmp_buf;
+  CALL(init_sort_info, true);
+  CALL(build_rows, 0, 10, INT32_MAX, rows);
+  ASSERT_EQ(OB_SUCCESS, tmp_buf.prepare_allocate(rows.count()));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelSorter::sort(NULL, 0, 10, 2,
+      collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelSorter::sort(&rows.at(0), 0, 10, 2,
+      collations_, cmp_funcs_, exec_ctx_, false, NULL));
+  // degree 1 is not a parallel sort
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelSorter::sort(&rows.at(0), 0, 10, 1,
+      collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+  // less rows than degree
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelSorter::sort(&rows.at(0), 0, 3, 4,
+      collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+}
+
+TEST_F(TestParallelSort, test_alloc_phase_failed)
+{
+  ObArray<StoredRow *> rows;
+  ObArray<StoredRow *> tmp_buf;
+  CALL(init_sort_info, true);
+  CALL(build_rows, 0, 1000, INT32_MAX, rows);
+  ASSERT_EQ(OB_SUCCESS, tmp_buf.prepare_allocate(rows.count()));
+  TP_SET_EVENT(EventTable::EN_PARALLEL_SORT_ALLOC_PHASE, OB_ALLOCATE_MEMORY_FAILED, 0, 1);
+  ASSERT_EQ(OB_ALLOCATE_MEMORY_FAILED, ObParallelSorter::sort(&rows.at(0), 0, 1000, 4,
+      collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+  TP_SET_EVENT(EventTable::EN_PARALLEL_SORT_ALLOC_PHASE, OB_SUCCESS, 0, 0);
+  // the pool is still usable after the failure
+  CALL(check_sort, 0, 1000, 4, INT32_MAX, true);
+}
+
+TEST_F(TestParallelSort, test_compare_failed)
+{
+  ObArray<StoredRow *> rows;
+  ObArray<StoredRow *> tmp_buf;
+  CALL(init_sort_info, true);
+  CALL(build_rows, 0, 10000, 100, rows);
+  ASSERT_EQ(OB_SUCCESS, tmp_buf.prepare_allocate(rows.count()));
+  // the error of one task is returned after all tasks of the phase finished
+  g_fail_key = rows.at(9999)->cells()[KEY_IDX].get_int();
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObParallelSorter::sort(&rows.at(0), 0, 10000, 8,
+      collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+  g_fail_key = INT64_MIN;
+  CALL(check_sort, 0, 10000, 8, INT32_MAX, true);
+}
+
+TEST_F(TestParallelSort, test_concurrent_sort)
+{
+  // more sorts than helpers, the busy pool leaves tasks to the sort threads
+  const int64_t THREAD_CNT = 8;
+  std::vector<std::thread> threads;
+  CALL(init_sort_info, true);
+  for (int64_t i = 0; i < THREAD_CNT; ++i) {
+    threads.push_back(std::thread([&, i]() {
+      ObArenaAllocator allocator(ObModIds::TEST);
+      ObArray<StoredRow *> rows;
+      ObArray<StoredRow *> tmp_buf;
+      const int64_t row_cnt = 20000 + i;
+      for (int64_t j = 0; j < row_cnt; ++j) {
+        ASSERT_EQ(OB_SUCCESS, rows.push_back(build_row(ObRandom::rand(0, 1000), j, allocator)));
+      }
+      ASSERT_EQ(OB_SUCCESS, tmp_buf.prepare_allocate(row_cnt));
+      ASSERT_EQ(OB_SUCCESS, ObParallelSorter::sort(&rows.at(0), 0, row_cnt, 2 + i,
+          collations_, cmp_funcs_, exec_ctx_, false, &tmp_buf.at(0)));
+      for (int64_t j = 1; j < row_cnt; ++j) {
+        ASSERT_LE(rows.at(j - 1)->cells()[KEY_IDX].get_int(), rows.at(j)->cells()[KEY_IDX].get_int());
+      }
+    }));
+  }
+  for (int64_t i = 0; i < THREAD_CNT; ++i) {
+    threads[i].join();
+  }
+}
+
+TEST_F(TestParallelSort, test_encode_sortkey_with_null)
+{
+  // row: (encoded key, key), the encoded key is null if the key can not be
+  // encoded, e.g. invalid unicode, then the rows have to be compared by key
+  const int64_t ROW_CNT = 10000;
+  const int64_t INVALID_IDX = 4321;
+  const int64_t KEY_LEN = 8;
+  const char *INVALID_KEY = "\xff\xfe\xfd";
+  ObMonitorNode monitor_node;
+  ObSortOpImpl sort_impl(monitor_node);
+  ObArray<StoredRow *> rows;
+  ObArray<StoredRow *> tmp_buf;
+  ObSortCmpFunc cmp_func;
+  cmp_func.cmp_func_ = cmp_str;
+  ASSERT_EQ(OB_SUCCESS, collations_.push_back(ObSortFieldCollation(1, CS_TYPE_UTF8MB4_BIN, true, NULL_FIRST)));
+  ASSERT_EQ(OB_SUCCESS, cmp_funcs_.push_back(cmp_func));
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    const int64_t row_size = sizeof(StoredRow) + sizeof(ObDatum) * COL_CNT + KEY_LEN + 1;
+    char *buf = static_cast<char *>(allocator_.alloc(row_size));
+    ASSERT_TRUE(NULL != buf);
+    StoredRow *row = new (buf) StoredRow();
+    row->cnt_ = COL_CNT;
+    row->row_size_ = row_size;
+    char *key = buf + sizeof(StoredRow) + sizeof(ObDatum) * COL_CNT;
+    ObDatum &encoded_cell = row->cells()[0];
+    ObDatum &key_cell = row->cells()[1];
+    if (INVALID_IDX == i) {
+      STRCPY(key, INVALID_KEY);
+      key_cell.ptr_ = key;
+      key_cell.pack_ = static_cast<uint32_t>(STRLEN(INVALID_KEY));
+      encoded_cell.set_null();
+    } else {
+      snprintf(key, KEY_LEN + 1, "%08ld", ObRandom::rand(0, 99999999));
+      key_cell.ptr_ = key;
+      key_cell.pack_ = KEY_LEN;
+      encoded_cell.ptr_ = key;
+      encoded_cell.pack_ = KEY_LEN;
+    }
+    ASSERT_EQ(OB_SUCCESS, rows.push_back(row));
+  }
+  ASSERT_EQ(OB_SUCCESS, tmp_buf.prepare_allocate(ROW_CNT));
+  ASSERT_EQ(OB_SUCCESS, sort_impl.comp_.init(&collations_, &cmp_funcs_, &exec_ctx_, true));
+  sort_impl.rows_ = &rows;
+  sort_impl.enable_encode_sortkey_ = true;
+  sort_impl.check_encode_sortkey(0, INVALID_IDX);
+  ASSERT_TRUE(sort_impl.enable_encode_sortkey_);
+  ASSERT_TRUE(sort_impl.comp_.enable_encode_sortkey_);
+  sort_impl.check_encode_sortkey(0, ROW_CNT);
+  ASSERT_FALSE(sort_impl.enable_encode_sortkey_);
+  ASSERT_FALSE(sort_impl.comp_.enable_encode_sortkey_);
+
+  ASSERT_EQ(OB_SUCCESS, ObParallelSorter::sort(&rows.at(0), 0, ROW_CNT, 4,
+      collations_, cmp_funcs_, exec_ctx_, sort_impl.enable_encode_sortkey_, &tmp_buf.at(0)));
+  for (int64_t i = 1; i < ROW_CNT; ++i) {
+    int cmp = 0;
+    ASSERT_EQ(OB_SUCCESS, cmp_str(rows.at(i - 1)->cells()[1], rows.at(i)->cells()[1], cmp));
+    ASSERT_LE(cmp, 0) << "i: " << i;
+  }
+  // the invalid key is larger than all digits
+  ASSERT_TRUE(rows.at(ROW_CNT - 1)->cells()[0].is_null());
+  sort_impl.rows_ = NULL;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_parallel_sort.log*");
+  OB_LOGGER.set_file_name("test_parallel_sort.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
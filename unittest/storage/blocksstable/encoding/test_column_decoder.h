@@ -23,6 +23,7 @@
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_row_writer.h"
 #include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_aggregated_store.h"
 #include "storage/ob_i_store.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/basic/ob_pushdown_filter.h"
@@ -88,6 +89,8 @@ public:
 
   void batch_decode_to_datum_test(bool is_condensed = false);
 
+  void sum_aggregate_test();
+
   void batch_get_row_perf_test();
 
   void set_encoding_type(ObColumnHeader::Type type);
@@ -937,6 +940,113 @@ void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
   }
 }
 
+void TestColumnDecoder::sum_aggregate_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed0 = 10000;
+  int64_t seed1 = 10001;
+  // few distinct values so that dictionary encoded columns are aggregated on references
+  for (int64_t i = 0; i < ROW_CNT - 35; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 35; i < ROW_CNT - 32; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 32; i < ROW_CNT - 30; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 30; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  int64_t row_len = 0;
+  const char *row_data = nullptr;
+  const char *cell_datas[ROW_CNT];
+  int64_t row_ids[ROW_CNT];
+  int64_t ref_cnts[ROW_CNT];
+  ObDatum datums[ROW_CNT];
+  void *datum_buf_1 = allocator_.alloc(sizeof(int8_t) * 128 * ROW_CNT);
+  void *datum_buf_2 = allocator_.alloc(sizeof(int8_t) * 128);
+  int64_t distinct_col_cnt = 0;
+  int64_t plain_col_cnt = 0;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    }
+    const ObObjMeta &col_type = col_descs_.at(i).col_type_;
+    const ObObjTypeClass col_tc = col_type.get_type_class();
+    const bool is_double_sum = ObFloatTC == col_tc || ObDoubleTC == col_tc;
+    sql::ObExpr expr;
+    expr.datum_meta_.type_ = is_double_sum ? ObDoubleType : ObNumberType;
+    if (!ObSumAggCell::is_sum_supported(col_tc, ob_obj_type_class(expr.datum_meta_.type_))) {
+      continue;
+    }
+    ObColumnParam col_param(allocator_);
+    col_param.set_meta_type(col_type);
+    ObSumAggCell batch_cell(i, &col_param, &expr, allocator_);
+    ObSumAggCell row_cell(i, &col_param, &expr, allocator_);
+    ASSERT_EQ(OB_SUCCESS, batch_cell.init(ROW_CNT));
+    ASSERT_EQ(OB_SUCCESS, row_cell.init(ROW_CNT));
+    for (int64_t j = 0; j < ROW_CNT; ++j) {
+      datums[j].ptr_ = reinterpret_cast<char *>(datum_buf_1) + j * 128;
+      row_ids[j] = j;
+    }
+
+    const ObColumnHeader::Type decoder_type = decoder.decoders_[i].decoder_->get_type();
+    const int64_t distinct_cnt = decoder.decoders_[i].get_distinct_count();
+    if (ObColumnHeader::Type::DICT == decoder_type || ObColumnHeader::Type::RLE == decoder_type) {
+      ASSERT_LE(0, distinct_cnt);
+      ASSERT_GT(ROW_CNT, distinct_cnt * 2);
+      ++distinct_col_cnt;
+    } else {
+      ASSERT_GT(0, distinct_cnt);
+      ++plain_col_cnt;
+    }
+    ASSERT_EQ(OB_SUCCESS, decoder.get_aggregate_result(
+        i, row_ids, cell_datas, ROW_CNT, datums, ref_cnts, batch_cell));
+
+    // aggregate the same column row by row as reference
+    for (int64_t j = 0; j < ROW_CNT; ++j) {
+      ObObj obj;
+      ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(j, row_data, row_len));
+      ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+      ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, j, bs, row_data, row_len));
+      ObDatum datum;
+      datum.ptr_ = reinterpret_cast<char *>(datum_buf_2);
+      ASSERT_EQ(OB_SUCCESS, datum.from_obj(obj));
+      ASSERT_EQ(OB_SUCCESS, row_cell.eval(datum));
+    }
+    STORAGE_LOG(INFO, "sum aggregate", K(i), K(col_type), K(decoder_type), K(distinct_cnt),
+        K(batch_cell), K(row_cell));
+    ASSERT_TRUE(row_cell.has_value_);
+    ASSERT_EQ(row_cell.has_value_, batch_cell.has_value_);
+    if (is_double_sum) {
+      ASSERT_NEAR(row_cell.double_sum_, batch_cell.double_sum_, fabs(row_cell.double_sum_) * 1e-12 + 1e-9);
+    } else {
+      number::ObNumber row_sum;
+      number::ObNumber batch_sum;
+      ASSERT_EQ(OB_SUCCESS, row_cell.get_result_number(row_sum, allocator_));
+      ASSERT_EQ(OB_SUCCESS, batch_cell.get_result_number(batch_sum, allocator_));
+      ASSERT_EQ(0, row_sum.compare(batch_sum)) << "col: " << i;
+    }
+  }
+  ASSERT_LT(0, ObColumnHeader::Type::RAW == column_encoding_type_ ? plain_col_cnt : distinct_col_cnt);
+}
+
 // void TestColumnDecoder::batch_get_row_perf_test()
 // {
 //   ObDatumRow row;
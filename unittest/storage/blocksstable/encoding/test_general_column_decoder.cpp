@@ -46,6 +46,13 @@ public:
   virtual ~TestRLEDecoder() {}
 };
 
+class TestRawColumnDecoder : public TestColumnDecoder
+{
+public:
+  TestRawColumnDecoder() : TestColumnDecoder(ObColumnHeader::Type::RAW) {}
+  virtual ~TestRawColumnDecoder() {}
+};
+
 class TestIntBaseDiffDecoder : public TestColumnDecoder
 {
 public:
@@ -131,6 +138,21 @@ TEST_F(TestStringPrefixDecoder, batch_decode_to_datum_test)
   batch_decode_to_datum_test();
 }
 
+TEST_F(TestDictDecoder, sum_aggregate_test)
+{
+  sum_aggregate_test();
+}
+
+TEST_F(TestRLEDecoder, sum_aggregate_test)
+{
+  sum_aggregate_test();
+}
+
+TEST_F(TestRawColumnDecoder, sum_aggregate_test)
+{
+  sum_aggregate_test();
+}
+
 // TEST_F(TestDictDecoder, batch_decode_perf_test)
 // {
 //   batch_get_row_perf_test();
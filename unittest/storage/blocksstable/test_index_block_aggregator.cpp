@@ -0,0 +1,501 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_macro_block.h"
+#include "storage/access/ob_table_read_info.h"
+#include "storage/access/ob_aggregated_store.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestIndexBlockAggregator : public ::testing::Test
+{
+public:
+  static const int64_t COLUMN_CNT = 3;
+  TestIndexBlockAggregator()
+    : allocator_(ObModIds::TEST),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      expr_spec_(allocator_),
+      op_(eval_ctx_, expr_spec_)
+  {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  void fill_row(const int64_t int_val, const char *str_val, ObDatumRow &row);
+  void build_agg_row(
+      const int64_t *int_vals,
+      const char **str_vals,
+      const int64_t row_cnt,
+      ObSkipIndexAggregator &aggregator,
+      ObAggRowReader &reader);
+  sql::ObWhiteFilterExecutor *build_white_filter(
+      const sql::ObWhiteFilterOperatorType op_type,
+      const int32_t col_offset,
+      const ObObj *objs,
+      const int64_t obj_cnt,
+      const bool need_padding = false);
+  sql::ObPushdownFilterExecutor *build_logic_filter(
+      const bool is_and,
+      sql::ObPushdownFilterExecutor *left,
+      sql::ObPushdownFilterExecutor *right);
+  bool is_always_false(const sql::ObPushdownFilterExecutor &filter, const ObAggRowReader &reader);
+protected:
+  ObArenaAllocator allocator_;
+  ObDataStoreDesc desc_;
+  storage::ObTableReadInfo read_info_;
+  sql::ObExecContext exec_ctx_;
+  sql::ObEvalCtx eval_ctx_;
+  sql::ObPushdownExprSpec expr_spec_;
+  sql::ObPushdownOperator op_;
+};
+
+void TestIndexBlockAggregator::SetUp()
+{
+  ObColDesc col_desc;
+  ASSERT_EQ(OB_SUCCESS, desc_.col_desc_array_.init(COLUMN_CNT));
+  col_desc.col_type_.set_int();
+  ASSERT_EQ(OB_SUCCESS, desc_.col_desc_array_.push_back(col_desc));
+  col_desc.col_type_.set_varchar();
+  col_desc.col_type_.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  ASSERT_EQ(OB_SUCCESS, desc_.col_desc_array_.push_back(col_desc));
+  col_desc.col_type_.set_double();
+  ASSERT_EQ(OB_SUCCESS, desc_.col_desc_array_.push_back(col_desc));
+  read_info_.reset();
+  ASSERT_EQ(OB_SUCCESS, read_info_.init(allocator_, COLUMN_CNT, 1, false, desc_.col_desc_array_));
+}
+
+void TestIndexBlockAggregator::fill_row(const int64_t int_val, const char *str_val, ObDatumRow &row)
+{
+  row.storage_datums_[0].set_int(int_val);
+  if (nullptr == str_val) {
+    row.storage_datums_[1].set_null();
+  } else {
+    row.storage_datums_[1].set_string(str_val, static_cast<int32_t>(strlen(str_val)));
+  }
+  row.storage_datums_[2].set_double(static_cast<double>(int_val) / 2);
+}
+
+void TestIndexBlockAggregator::build_agg_row(
+    const int64_t *int_vals,
+    const char **str_vals,
+    const int64_t row_cnt,
+    ObSkipIndexAggregator &aggregator,
+    ObAggRowReader &reader)
+{
+  ObDatumRow row;
+  const char *agg_buf = nullptr;
+  int64_t agg_len = 0;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_, allocator_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    fill_row(int_vals[i], str_vals[i], row);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  }
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_row(agg_buf, agg_len));
+  ASSERT_TRUE(nullptr != agg_buf);
+  ASSERT_EQ(OB_SUCCESS, reader.init(agg_buf, agg_len));
+}
+
+sql::ObWhiteFilterExecutor *TestIndexBlockAggregator::build_white_filter(
+    const sql::ObWhiteFilterOperatorType op_type,
+    const int32_t col_offset,
+    const ObObj *objs,
+    const int64_t obj_cnt,
+    const bool need_padding)
+{
+  sql::ObPushdownWhiteFilterNode *node = OB_NEWx(sql::ObPushdownWhiteFilterNode, &allocator_, allocator_);
+  sql::ObWhiteFilterExecutor *filter = nullptr;
+  if (nullptr != node) {
+    node->op_type_ = op_type;
+    filter = OB_NEWx(sql::ObWhiteFilterExecutor, &allocator_, allocator_, *node, op_);
+  }
+  if (nullptr != filter) {
+    const ObColumnParam *col_param = need_padding ? OB_NEWx(ObColumnParam, &allocator_, allocator_) : nullptr;
+    EXPECT_EQ(OB_SUCCESS, filter->col_offsets_.init(1));
+    EXPECT_EQ(OB_SUCCESS, filter->col_params_.init(1));
+    EXPECT_EQ(OB_SUCCESS, filter->col_offsets_.push_back(col_offset));
+    EXPECT_EQ(OB_SUCCESS, filter->col_params_.push_back(col_param));
+    filter->n_cols_ = 1;
+    EXPECT_EQ(OB_SUCCESS, filter->params_.init(MAX(1, obj_cnt)));
+    for (int64_t i = 0; i < obj_cnt; ++i) {
+      EXPECT_EQ(OB_SUCCESS, filter->params_.push_back(objs[i]));
+    }
+  }
+  return filter;
+}
+
+sql::ObPushdownFilterExecutor *TestIndexBlockAggregator::build_logic_filter(
+    const bool is_and,
+    sql::ObPushdownFilterExecutor *left,
+    sql::ObPushdownFilterExecutor *right)
+{
+  sql::ObPushdownFilterExecutor *filter = nullptr;
+  sql::ObPushdownFilterExecutor **childs = static_cast<sql::ObPushdownFilterExecutor **>(
+      allocator_.alloc(sizeof(sql::ObPushdownFilterExecutor *) * 2));
+  if (nullptr == childs) {
+  } else if (is_and) {
+    sql::ObPushdownAndFilterNode *node = OB_NEWx(sql::ObPushdownAndFilterNode, &allocator_, allocator_);
+    filter = OB_NEWx(sql::ObAndFilterExecutor, &allocator_, allocator_, *node, op_);
+  } else {
+    sql::ObPushdownOrFilterNode *node = OB_NEWx(sql::ObPushdownOrFilterNode, &allocator_, allocator_);
+    filter = OB_NEWx(sql::ObOrFilterExecutor, &allocator_, allocator_, *node, op_);
+  }
+  if (nullptr != filter) {
+    childs[0] = left;
+    childs[1] = right;
+    filter->set_childs(2, childs);
+  }
+  return filter;
+}
+
+bool TestIndexBlockAggregator::is_always_false(
+    const sql::ObPushdownFilterExecutor &filter,
+    const ObAggRowReader &reader)
+{
+  bool always_false = false;
+  EXPECT_EQ(OB_SUCCESS, ObSkipIndexFilterChecker::check_always_false(filter, read_info_, reader, always_false));
+  return always_false;
+}
+
+TEST_F(TestIndexBlockAggregator, test_aggregate_rows)
+{
+  ObSkipIndexAggregator aggregator;
+  ObDatumRow row;
+  const char *agg_buf = nullptr;
+  int64_t agg_len = 0;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_row(agg_buf, agg_len));
+  ASSERT_TRUE(nullptr == agg_buf);
+
+  fill_row(5, "bbb", row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  fill_row(-3, nullptr, row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  fill_row(10, "aaa", row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_row(agg_buf, agg_len));
+  ASSERT_TRUE(nullptr != agg_buf);
+  ASSERT_LE(agg_len, ObSkipIndexAggregator::get_max_agg_row_size(COLUMN_CNT));
+
+  ObAggRowReader reader;
+  ObSkipIndexColAggResult result;
+  ASSERT_EQ(OB_SUCCESS, reader.init(agg_buf, agg_len));
+  ASSERT_EQ(COLUMN_CNT, reader.get_column_count());
+  ASSERT_EQ(3, reader.get_row_count());
+
+  ASSERT_EQ(OB_SUCCESS, reader.read(0, result));
+  ASSERT_TRUE(result.has_min_max());
+  ASSERT_TRUE(result.has_sum());
+  ASSERT_EQ(0, result.null_count_);
+  ASSERT_EQ(-3, result.min_.get_int());
+  ASSERT_EQ(10, result.max_.get_int());
+  ASSERT_EQ(12, result.sum_.get_int());
+
+  ASSERT_EQ(OB_SUCCESS, reader.read(1, result));
+  ASSERT_TRUE(result.has_min_max());
+  ASSERT_FALSE(result.has_sum());
+  ASSERT_EQ(1, result.null_count_);
+  ASSERT_EQ(0, result.min_.get_string().compare("aaa"));
+  ASSERT_EQ(0, result.max_.get_string().compare("bbb"));
+
+  ASSERT_EQ(OB_SUCCESS, reader.read(2, result));
+  ASSERT_TRUE(result.has_sum());
+  ASSERT_DOUBLE_EQ(6.0, result.sum_.get_double());
+  ASSERT_EQ(OB_INDEX_OUT_OF_RANGE, reader.read(COLUMN_CNT, result));
+}
+
+TEST_F(TestIndexBlockAggregator, test_aggregate_children)
+{
+  ObSkipIndexAggregator micro_aggregator;
+  ObSkipIndexAggregator index_aggregator;
+  ObDatumRow row;
+  const char *agg_buf = nullptr;
+  int64_t agg_len = 0;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, micro_aggregator.init(desc_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.init(desc_, allocator_));
+
+  for (int64_t i = 0; i < 4; ++i) {
+    micro_aggregator.reuse();
+    fill_row(i * 10, "ccc", row);
+    ASSERT_EQ(OB_SUCCESS, micro_aggregator.eval(row));
+    fill_row(i * 10 + 1, 1 == i ? "a_string_longer_than_limit" : "ddd", row);
+    ASSERT_EQ(OB_SUCCESS, micro_aggregator.eval(row));
+    ASSERT_EQ(OB_SUCCESS, micro_aggregator.get_aggregated_row(agg_buf, agg_len));
+    ASSERT_EQ(OB_SUCCESS, index_aggregator.eval(agg_buf, agg_len));
+  }
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.get_aggregated_row(agg_buf, agg_len));
+
+  ObAggRowReader reader;
+  ObSkipIndexColAggResult result;
+  ASSERT_EQ(OB_SUCCESS, reader.init(agg_buf, agg_len));
+  ASSERT_EQ(8, reader.get_row_count());
+  ASSERT_EQ(OB_SUCCESS, reader.read(0, result));
+  ASSERT_EQ(0, result.min_.get_int());
+  ASSERT_EQ(31, result.max_.get_int());
+  ASSERT_EQ(124, result.sum_.get_int());
+  // min/max of the long string is dropped and invalidates the whole column
+  ASSERT_EQ(OB_SUCCESS, reader.read(1, result));
+  ASSERT_FALSE(result.has_min_max());
+
+  // any child without aggregated row invalidates the parent
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.eval(nullptr, 0));
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.get_aggregated_row(agg_buf, agg_len));
+  ASSERT_TRUE(nullptr == agg_buf);
+  index_aggregator.reuse();
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.eval(nullptr, 0));
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.get_aggregated_row(agg_buf, agg_len));
+  ASSERT_TRUE(nullptr == agg_buf);
+}
+
+TEST_F(TestIndexBlockAggregator, test_white_filter_min_max)
+{
+  // int column: min -3, max 10, no null
+  const int64_t int_vals[] = {5, -3, 10, -3};
+  const char *str_vals[] = {"bbb", nullptr, "aaa", nullptr};
+  ObSkipIndexAggregator aggregator;
+  ObAggRowReader reader;
+  build_agg_row(int_vals, str_vals, 4, aggregator, reader);
+  ASSERT_EQ(4, reader.get_row_count());
+
+  ObObj objs[3];
+#define CHECK_INT_FILTER(op, v, expected)                                                     \
+  objs[0].set_int(v);                                                                         \
+  ASSERT_EQ(expected, is_always_false(*build_white_filter(sql::op, 0, objs, 1), reader)) << #op << " " << v;
+  CHECK_INT_FILTER(WHITE_OP_EQ, -4, true);
+  CHECK_INT_FILTER(WHITE_OP_EQ, -3, false);
+  CHECK_INT_FILTER(WHITE_OP_EQ, 10, false);
+  CHECK_INT_FILTER(WHITE_OP_EQ, 11, true);
+  CHECK_INT_FILTER(WHITE_OP_NE, -3, false);
+  CHECK_INT_FILTER(WHITE_OP_NE, 5, false);
+  CHECK_INT_FILTER(WHITE_OP_LT, -3, true);
+  CHECK_INT_FILTER(WHITE_OP_LT, -2, false);
+  CHECK_INT_FILTER(WHITE_OP_LE, -4, true);
+  CHECK_INT_FILTER(WHITE_OP_LE, -3, false);
+  CHECK_INT_FILTER(WHITE_OP_GT, 10, true);
+  CHECK_INT_FILTER(WHITE_OP_GT, 9, false);
+  CHECK_INT_FILTER(WHITE_OP_GE, 11, true);
+  CHECK_INT_FILTER(WHITE_OP_GE, 10, false);
+#undef CHECK_INT_FILTER
+
+  // between is inclusive on both sides
+  objs[0].set_int(11);
+  objs[1].set_int(20);
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_BT, 0, objs, 2), reader));
+  objs[0].set_int(10);
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_BT, 0, objs, 2), reader));
+  objs[0].set_int(-10);
+  objs[1].set_int(-4);
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_BT, 0, objs, 2), reader));
+  objs[1].set_int(-3);
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_BT, 0, objs, 2), reader));
+
+  // null in the in list never matches
+  objs[0].set_int(11);
+  objs[1].set_null();
+  objs[2].set_int(-4);
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_IN, 0, objs, 3), reader));
+  objs[2].set_int(10);
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_IN, 0, objs, 3), reader));
+
+  // compare with null is undecidable here and kept as maybe true
+  objs[0].set_null();
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_EQ, 0, objs, 1), reader));
+
+  // string column: min "aaa", max "bbb"
+  objs[0].set_varchar("aab");
+  objs[0].set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_EQ, 1, objs, 1), reader));
+  objs[0].set_varchar("aa");
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_EQ, 1, objs, 1), reader));
+  objs[0].set_varchar("bbbb");
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_GE, 1, objs, 1), reader));
+  objs[0].set_varchar("bbb");
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_GE, 1, objs, 1), reader));
+  // column need padding is never checked
+  objs[0].set_varchar("aa");
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_EQ, 1, objs, 1, true), reader));
+
+  // int column with a single distinct value
+  const int64_t const_vals[] = {7, 7};
+  const char *const_strs[] = {"x", "x"};
+  ObSkipIndexAggregator const_aggregator;
+  ObAggRowReader const_reader;
+  build_agg_row(const_vals, const_strs, 2, const_aggregator, const_reader);
+  objs[0].set_int(7);
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_NE, 0, objs, 1), const_reader));
+  objs[0].set_int(8);
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NE, 0, objs, 1), const_reader));
+}
+
+TEST_F(TestIndexBlockAggregator, test_white_filter_null_count)
+{
+  const int64_t int_vals[] = {1, 2, 3};
+  const char *str_vals[] = {"aaa", nullptr, nullptr};
+  const char *null_strs[] = {nullptr, nullptr, nullptr};
+  ObSkipIndexAggregator aggregator;
+  ObSkipIndexAggregator null_aggregator;
+  ObAggRowReader reader;
+  ObAggRowReader null_reader;
+  build_agg_row(int_vals, str_vals, 3, aggregator, reader);
+  build_agg_row(int_vals, null_strs, 3, null_aggregator, null_reader);
+  ObObj obj;
+  obj.set_varchar("aaa");
+  obj.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+
+  // no null in the int column
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_NU, 0, nullptr, 0), reader));
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NN, 0, nullptr, 0), reader));
+  // some nulls
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NU, 1, nullptr, 0), reader));
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NN, 1, nullptr, 0), reader));
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_EQ, 1, &obj, 1), reader));
+  // null count equals row count
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NU, 1, nullptr, 0), null_reader));
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_NN, 1, nullptr, 0), null_reader));
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_EQ, 1, &obj, 1), null_reader));
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_NE, 1, &obj, 1), null_reader));
+  ASSERT_TRUE(is_always_false(*build_white_filter(sql::WHITE_OP_IN, 1, &obj, 1), null_reader));
+
+  // column out of read info or without skip index
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NU, COLUMN_CNT, nullptr, 0), reader));
+  ASSERT_FALSE(is_always_false(*build_white_filter(sql::WHITE_OP_NU, -1, nullptr, 0), reader));
+}
+
+TEST_F(TestIndexBlockAggregator, test_logic_filter)
+{
+  const int64_t int_vals[] = {0, 5, 10};
+  const char *str_vals[] = {"a", "b", "c"};
+  ObSkipIndexAggregator aggregator;
+  ObAggRowReader reader;
+  build_agg_row(int_vals, str_vals, 3, aggregator, reader);
+  ObObj obj;
+  bool always_false = true;
+
+  obj.set_int(11);
+  sql::ObPushdownFilterExecutor *eq_11 = build_white_filter(sql::WHITE_OP_EQ, 0, &obj, 1);
+  obj.set_int(0);
+  sql::ObPushdownFilterExecutor *lt_0 = build_white_filter(sql::WHITE_OP_LT, 0, &obj, 1);
+  sql::ObPushdownFilterExecutor *gt_0 = build_white_filter(sql::WHITE_OP_GT, 0, &obj, 1);
+
+  // and is false if any child is false, or if all children are false
+  ASSERT_TRUE(is_always_false(*build_logic_filter(true, eq_11, gt_0), reader));
+  ASSERT_FALSE(is_always_false(*build_logic_filter(false, eq_11, gt_0), reader));
+  ASSERT_TRUE(is_always_false(*build_logic_filter(false, eq_11, lt_0), reader));
+  ASSERT_FALSE(is_always_false(*build_logic_filter(true, gt_0,
+      build_logic_filter(false, eq_11, gt_0)), reader));
+  ASSERT_TRUE(is_always_false(*build_logic_filter(true, gt_0,
+      build_logic_filter(false, eq_11, lt_0)), reader));
+
+  // uninited agg row reader
+  ObAggRowReader empty_reader;
+  ASSERT_EQ(OB_INVALID_ARGUMENT,
+      ObSkipIndexFilterChecker::check_always_false(*eq_11, read_info_, empty_reader, always_false));
+  ASSERT_FALSE(always_false);
+}
+
+TEST_F(TestIndexBlockAggregator, test_agg_cell_by_skip_index)
+{
+  ObSkipIndexAggregator aggregator;
+  ObAggRowReader reader;
+  const int64_t int_vals[] = {5, -3, 10, 100};
+  const char *str_vals[] = {"bbb", nullptr, "aaa", nullptr};
+  const int64_t row_cnt = 4;
+  build_agg_row(int_vals, str_vals, row_cnt, aggregator, reader);
+
+  ObIndexBlockRowHeader row_header;
+  row_header.row_count_ = row_cnt;
+  row_header.all_lob_in_row_ = 1;
+  ObMicroIndexInfo index_info;
+  index_info.row_header_ = &row_header;
+  index_info.agg_row_buf_ = reader.buf_;
+  index_info.agg_buf_size_ = reader.buf_size_;
+  index_info.set_blockscan();
+
+  // sum of int column is accumulated from the skip index of every block
+  ObColumnParam int_param(allocator_);
+  int_param.set_meta_type(desc_.col_desc_array_.at(0).col_type_);
+  sql::ObExpr int_expr;
+  int_expr.datum_meta_.type_ = ObNumberType;
+  storage::ObSumAggCell int_sum(0, &int_param, &int_expr, allocator_);
+  ASSERT_EQ(OB_SUCCESS, int_sum.init(16));
+  ASSERT_FALSE(int_sum.can_agg_index_info(index_info));
+  int_sum.set_skip_index_col_idx(0);
+  ASSERT_TRUE(int_sum.can_agg_index_info(index_info));
+  ASSERT_EQ(OB_SUCCESS, int_sum.process(index_info));
+  ASSERT_EQ(OB_SUCCESS, int_sum.process(index_info));
+  ASSERT_TRUE(int_sum.has_value_);
+  number::ObNumber sum_nmb;
+  number::ObNumber expect_nmb;
+  ASSERT_EQ(OB_SUCCESS, int_sum.get_result_number(sum_nmb, allocator_));
+  ASSERT_EQ(OB_SUCCESS, expect_nmb.from(static_cast<int64_t>(224), allocator_));
+  ASSERT_EQ(0, sum_nmb.compare(expect_nmb));
+
+  // sum of double column
+  ObColumnParam double_param(allocator_);
+  double_param.set_meta_type(desc_.col_desc_array_.at(2).col_type_);
+  sql::ObExpr double_expr;
+  double_expr.datum_meta_.type_ = ObDoubleType;
+  storage::ObSumAggCell double_sum(2, &double_param, &double_expr, allocator_);
+  ASSERT_EQ(OB_SUCCESS, double_sum.init(16));
+  double_sum.set_skip_index_col_idx(2);
+  ASSERT_TRUE(double_sum.can_agg_index_info(index_info));
+  ASSERT_EQ(OB_SUCCESS, double_sum.process(index_info));
+  ASSERT_DOUBLE_EQ(56.0, double_sum.double_sum_);
+
+  // count of nullable column excludes nulls counted by the skip index
+  ObColumnParam str_param(allocator_);
+  str_param.set_meta_type(desc_.col_desc_array_.at(1).col_type_);
+  sql::ObExpr count_expr;
+  storage::ObCountAggCell count(1, &str_param, &count_expr, allocator_, true);
+  ASSERT_FALSE(count.can_agg_index_info(index_info));
+  count.set_skip_index_col_idx(1);
+  ASSERT_TRUE(count.can_agg_index_info(index_info));
+  ASSERT_EQ(OB_SUCCESS, count.process(index_info));
+  ASSERT_EQ(2, count.row_count_);
+
+  // column not stored in the sstable
+  int_sum.set_skip_index_col_idx(COLUMN_CNT);
+  ASSERT_FALSE(int_sum.can_agg_index_info(index_info));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, int_sum.process(index_info));
+
+  // skip index not built for the block
+  int_sum.set_skip_index_col_idx(0);
+  index_info.agg_row_buf_ = nullptr;
+  index_info.agg_buf_size_ = 0;
+  ASSERT_FALSE(int_sum.can_agg_index_info(index_info));
+  ASSERT_FALSE(count.can_agg_index_info(index_info));
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_index_block_aggregator.log");
+  OB_LOGGER.set_file_name("test_index_block_aggregator.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -19,6 +19,7 @@
 #include "ob_row_generate.h"
 #include "ob_data_file_prepare.h"
 #include "share/ob_simple_mem_limit_getter.h"
+#include "lib/stat/ob_diagnose_info.h"
 
 namespace oceanbase
 {
@@ -1715,6 +1716,125 @@ TEST_F(TestTmpFile, test_page_buddy)
   ASSERT_EQ(false, page_buddy_4.is_empty());
 }
 
+TEST_F(TestTmpFile, test_big_file_prealloc_grow)
+{
+  int ret = OB_SUCCESS;
+  int64_t dir = -1;
+  int64_t fd = -1;
+  const int64_t timeout_ms = 5000;
+  const int64_t write_size = 8 * 1024;
+  const int64_t write_cnt = 256;
+  ObTmpFileIOInfo io_info;
+  ObTmpFileIOHandle handle;
+  ret = ObTmpFileManager::get_instance().alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().open(fd, dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  char *write_buf = new char [write_size * write_cnt];
+  for (int64_t i = 0; i < write_size * write_cnt; ++i) {
+    write_buf[i] = static_cast<char>(i % 251);
+  }
+  char *read_buf = new char [write_size * write_cnt];
+  io_info.fd_ = fd;
+  io_info.tenant_id_ = 1;
+  io_info.io_desc_.set_wait_event(2);
+  io_info.size_ = write_size;
+  for (int64_t i = 0; i < write_cnt; ++i) {
+    io_info.buf_ = write_buf + i * write_size;
+    ret = ObTmpFileManager::get_instance().write(io_info, timeout_ms);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+
+  // one 32KB extent while the file is small, then 64KB extents until 512KB, 128KB extents
+  // until 1MB and 256KB extents after, fixed 64KB extents need 32 ones.
+  ObTmpFileHandle file_handle;
+  ret = ObTmpFileManager::get_instance().get_tmp_file_handle(fd, file_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_GE(20, file_handle.get_resource_ptr()->file_meta_.get_extents().count());
+
+  io_info.buf_ = read_buf;
+  io_info.size_ = write_size * write_cnt;
+  ret = ObTmpFileManager::get_instance().pread(io_info, 0, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(write_size * write_cnt, handle.get_data_size());
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf, write_size * write_cnt));
+
+  delete[] write_buf;
+  delete[] read_buf;
+  file_handle.reset();
+  ObTmpFileManager::get_instance().remove(fd);
+}
+
+static int64_t get_tenant_event(const int64_t stat_no)
+{
+  int64_t value = 0;
+  ObDiagnoseTenantInfo *di = ObDiagnoseTenantInfo::get_local_diagnose_info();
+  if (NULL != di) {
+    ObStatEventAddStat *stat = di->get_add_stat_stats().get(stat_no);
+    if (NULL != stat) {
+      value = stat->stat_value_;
+    }
+  }
+  return value;
+}
+
+TEST_F(TestTmpFile, test_tenant_spill_stat)
+{
+  int ret = OB_SUCCESS;
+  int64_t dir = -1;
+  int64_t fd = -1;
+  const int64_t timeout_ms = 5000;
+  const int64_t write_size = 16 * 1024;
+  const int64_t write_cnt = 16;
+  ObTmpFileIOInfo io_info;
+  ObTmpFileIOHandle handle;
+  ret = ObTmpFileManager::get_instance().alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().open(fd, dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  const int64_t begin_write_cnt = get_tenant_event(ObStatEventIds::TMP_FILE_WRITE_COUNT);
+  const int64_t begin_write_size = get_tenant_event(ObStatEventIds::TMP_FILE_WRITE_BYTES);
+  const int64_t begin_read_cnt = get_tenant_event(ObStatEventIds::TMP_FILE_READ_COUNT);
+  const int64_t begin_read_size = get_tenant_event(ObStatEventIds::TMP_FILE_READ_BYTES);
+  const int64_t begin_flush_cnt = get_tenant_event(ObStatEventIds::TMP_FILE_FLUSH_COUNT);
+  const int64_t begin_flush_size = get_tenant_event(ObStatEventIds::TMP_FILE_FLUSH_BYTES);
+
+  char *write_buf = new char [write_size];
+  for (int64_t i = 0; i < write_size; ++i) {
+    write_buf[i] = static_cast<char>(i % 256);
+  }
+  char *read_buf = new char [write_size * write_cnt];
+  io_info.fd_ = fd;
+  io_info.tenant_id_ = 1;
+  io_info.io_desc_.set_wait_event(2);
+  io_info.buf_ = write_buf;
+  io_info.size_ = write_size;
+  for (int64_t i = 0; i < write_cnt; ++i) {
+    ret = ObTmpFileManager::get_instance().write(io_info, timeout_ms);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+  // the written block is flushed to disk as a whole
+  ret = ObTmpFileManager::get_instance().sync(fd, timeout_ms);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  io_info.buf_ = read_buf;
+  io_info.size_ = write_size * write_cnt;
+  ret = ObTmpFileManager::get_instance().pread(io_info, 0, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(write_size * write_cnt, handle.get_data_size());
+
+  ASSERT_EQ(write_cnt, get_tenant_event(ObStatEventIds::TMP_FILE_WRITE_COUNT) - begin_write_cnt);
+  ASSERT_EQ(write_size * write_cnt, get_tenant_event(ObStatEventIds::TMP_FILE_WRITE_BYTES) - begin_write_size);
+  ASSERT_EQ(1, get_tenant_event(ObStatEventIds::TMP_FILE_READ_COUNT) - begin_read_cnt);
+  ASSERT_EQ(write_size * write_cnt, get_tenant_event(ObStatEventIds::TMP_FILE_READ_BYTES) - begin_read_size);
+  ASSERT_LE(1, get_tenant_event(ObStatEventIds::TMP_FILE_FLUSH_COUNT) - begin_flush_cnt);
+  ASSERT_LE(write_size * write_cnt, get_tenant_event(ObStatEventIds::TMP_FILE_FLUSH_BYTES) - begin_flush_size);
+
+  delete[] write_buf;
+  delete[] read_buf;
+  handle.reset();
+  ObTmpFileManager::get_instance().remove(fd);
+}
+
 TEST_F(TestTmpFile, test_tmp_file_sync)
 {
   int ret = OB_SUCCESS;
@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#define protected public
+#include "storage/memtable/mvcc/ob_keybtree.h"
+
+#include "common/object/ob_object.h"
+#include "common/rowkey/ob_store_rowkey.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+#include "storage/memtable/ob_memtable_key.h"
+#include "storage/memtable/mvcc/ob_mvcc_row.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::keybtree;
+using namespace oceanbase::memtable;
+
+typedef ObKeyBtree<ObStoreRowkeyWrapper, ObMvccRow *> Btree;
+typedef BtreeNode<ObStoreRowkeyWrapper, ObMvccRow *> Node;
+typedef BtreeNodeAllocator<ObStoreRowkeyWrapper, ObMvccRow *> NodeAllocator;
+typedef CompHelper<ObStoreRowkeyWrapper, ObMvccRow *> Comp;
+
+class FakeAllocator : public ObIAllocator
+{
+public:
+  void *alloc(int64_t size) override { return ob_malloc(size, ObModIds::TEST); }
+  void *alloc(const int64_t size, const ObMemAttr &attr) override
+  {
+    UNUSED(attr);
+    return alloc(size);
+  }
+  void free(void *ptr) override { ob_free(ptr); }
+};
+
+// Read modes compared by the benchmark:
+//   LATCHED: classic latch coupling, every reader takes a shared latch on each node
+//            from root to leaf, which writes the latch word of the (hot) upper nodes.
+//   OPTIMISTIC: ObKeyBtree::get, readers never write any node and only announce
+//            themselves in their own QClock slot.
+enum ReadMode
+{
+  LATCHED = 0,
+  OPTIMISTIC = 1
+};
+
+class TestKeyBtreeReadPerf : public ::testing::Test
+{
+public:
+  static const int64_t KEY_COUNT = 1 << 18;
+  static const int64_t GET_COUNT_PER_THREAD = 1 << 16;
+  static const int64_t MAX_THREAD_COUNT = 128;
+  TestKeyBtreeReadPerf()
+    : node_allocator_(allocator_), btree_(node_allocator_), objs_(nullptr), rowkeys_(nullptr), keys_(nullptr) {}
+  virtual void SetUp();
+  virtual void TearDown();
+  int latched_get(const ObStoreRowkeyWrapper &key, ObMvccRow *&val);
+  int64_t run(const ReadMode mode, const int64_t thread_count);
+protected:
+  FakeAllocator allocator_;
+  NodeAllocator node_allocator_;
+  Btree btree_;
+  ObObj *objs_;
+  ObStoreRowkey *rowkeys_;
+  ObStoreRowkeyWrapper *keys_;
+};
+
+void TestKeyBtreeReadPerf::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, btree_.init());
+  objs_ = static_cast<ObObj *>(ob_malloc(sizeof(ObObj) * KEY_COUNT, ObModIds::TEST));
+  rowkeys_ = static_cast<ObStoreRowkey *>(ob_malloc(sizeof(ObStoreRowkey) * KEY_COUNT, ObModIds::TEST));
+  keys_ = static_cast<ObStoreRowkeyWrapper *>(ob_malloc(sizeof(ObStoreRowkeyWrapper) * KEY_COUNT, ObModIds::TEST));
+  ASSERT_TRUE(nullptr != objs_ && nullptr != rowkeys_ && nullptr != keys_);
+  for (int64_t i = 0; i < KEY_COUNT; ++i) {
+    new (objs_ + i) ObObj(i);
+    new (rowkeys_ + i) ObStoreRowkey(objs_ + i, 1);
+    new (keys_ + i) ObStoreRowkeyWrapper(rowkeys_ + i);
+  }
+  // insert in random order to get a tree with realistic fill factor
+  for (int64_t i = 0; i < KEY_COUNT; ++i) {
+    const int64_t j = ObRandom::rand(i, KEY_COUNT - 1);
+    std::swap(keys_[i], keys_[j]);
+  }
+  for (int64_t i = 0; i < KEY_COUNT; ++i) {
+    int64_t v = 0;
+    ASSERT_EQ(OB_SUCCESS, keys_[i].get_rowkey()->get_obj_ptr()[0].get_int(v));
+    ObMvccRow *val = reinterpret_cast<ObMvccRow *>(v << 3);
+    ASSERT_EQ(OB_SUCCESS, btree_.insert(keys_[i], val));
+  }
+}
+
+void TestKeyBtreeReadPerf::TearDown()
+{
+  btree_.destroy();
+  ob_free(keys_);
+  ob_free(rowkeys_);
+  ob_free(objs_);
+}
+
+int TestKeyBtreeReadPerf::latched_get(const ObStoreRowkeyWrapper &key, ObMvccRow *&val)
+{
+  int ret = OB_SUCCESS;
+  Comp comp;
+  MultibitSet index;
+  Node *node = ATOMIC_LOAD(&btree_.root_);
+  Node *latched = nullptr;
+  bool is_found = false;
+  int pos = -1;
+  while (OB_SUCC(ret) && nullptr != node) {
+    while (OB_SUCCESS != node->try_rdlock()) {
+      PAUSE();
+    }
+    if (nullptr != latched) {
+      latched->rdunlock();
+    }
+    latched = node;
+    if (is_found) {
+      pos = 0;
+      if (node->is_leaf()) {
+        index.load(node->get_index());
+      }
+    } else if (OB_FAIL(node->find_pos(comp, key, is_found, pos, &index))) {
+      break;
+    }
+    if (pos < 0) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else if (!node->is_leaf()) {
+      node = reinterpret_cast<Node *>(node->get_val(pos));
+    } else if (is_found) {
+      val = node->get_val(pos, &index);
+      node = nullptr;
+    } else {
+      ret = OB_ENTRY_NOT_EXIST;
+    }
+  }
+  if (nullptr != latched) {
+    latched->rdunlock();
+  }
+  return ret;
+}
+
+// return gets per second of all threads, 0 if any get returns a wrong value
+int64_t TestKeyBtreeReadPerf::run(const ReadMode mode, const int64_t thread_count)
+{
+  std::thread threads[MAX_THREAD_COUNT];
+  bool start = false;
+  int64_t ready_count = 0;
+  int64_t fail_count = 0;
+  for (int64_t i = 0; i < thread_count; ++i) {
+    threads[i] = std::thread([&, i]() {
+      int ret = OB_SUCCESS;
+      int64_t idx = (i * GET_COUNT_PER_THREAD * 7) % KEY_COUNT;
+      ATOMIC_INC(&ready_count);
+      while (!ATOMIC_LOAD(&start)) {
+        PAUSE();
+      }
+      for (int64_t j = 0; j < GET_COUNT_PER_THREAD; ++j) {
+        ObMvccRow *val = nullptr;
+        int64_t v = 0;
+        idx = (idx + 7919) % KEY_COUNT;
+        const ObStoreRowkeyWrapper &key = keys_[idx];
+        if (LATCHED == mode) {
+          ret = latched_get(key, val);
+        } else {
+          ret = btree_.get(key, val);
+        }
+        if (OB_FAIL(ret) || OB_FAIL(key.get_rowkey()->get_obj_ptr()[0].get_int(v))
+            || reinterpret_cast<int64_t>(val) != (v << 3)) {
+          ATOMIC_INC(&fail_count);
+        }
+      }
+    });
+  }
+  while (ATOMIC_LOAD(&ready_count) < thread_count) {
+    PAUSE();
+  }
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ATOMIC_STORE(&start, true);
+  for (int64_t i = 0; i < thread_count; ++i) {
+    threads[i].join();
+  }
+  const int64_t cost_us = std::max(ObTimeUtility::current_time() - start_ts, 1L);
+  EXPECT_EQ(0, fail_count);
+  return 0 == fail_count ? thread_count * GET_COUNT_PER_THREAD * 1000000L / cost_us : 0;
+}
+
+TEST_F(TestKeyBtreeReadPerf, concurrent_get)
+{
+  // every reader finds the value of its keys in both modes, see fail_count in run()
+  ASSERT_LT(0, run(LATCHED, 4));
+  ASSERT_LT(0, run(OPTIMISTIC, 4));
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestKeyBtreeReadPerf, DISABLED_latched_vs_optimistic)
+{
+  for (int64_t thread_count = 1; thread_count <= MAX_THREAD_COUNT; thread_count *= 2) {
+    const int64_t latched_qps = run(LATCHED, thread_count);
+    const int64_t optimistic_qps = run(OPTIMISTIC, thread_count);
+    ASSERT_LT(0, latched_qps);
+    ASSERT_LT(0, optimistic_qps);
+    const double speedup = static_cast<double>(optimistic_qps) / static_cast<double>(latched_qps);
+    STORAGE_LOG(INFO, "keybtree read perf", K(thread_count), K(latched_qps), K(optimistic_qps), K(speedup));
+  }
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_keybtree_read_perf.log");
+  oceanbase::common::ObLogger::get_logger().set_file_name("test_keybtree_read_perf.log", true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -68,6 +68,45 @@ TEST(TestObQueryEngine, get_and_set_table_index_node)
   EXPECT_EQ(counter, THREAD_COUNT);
 }
 
+TEST(TestObQueryEngine, key_prefix)
+{
+  // prefixes inlined in btree nodes must never contradict the full rowkey comparison
+  const char *strs[] = {"a", "a ", "abcdefg", "abcdefgh", "abcdefgh ", "abcdefgh\x01", "abcdefgi",
+                        "abcdefghijklmn", "bbbbbbbbbbbb", "zzzzzzzzz"};
+  const int64_t ints[] = {INT64_MIN, INT64_MIN + 1, -1024, -1, 0, 1, 1024, INT64_MAX - 1, INT64_MAX};
+  const int64_t STR_CNT = sizeof(strs) / sizeof(strs[0]);
+  const int64_t KEY_CNT = STR_CNT + sizeof(ints) / sizeof(ints[0]);
+  ObObj objs[KEY_CNT];
+  ObStoreRowkey rowkeys[KEY_CNT + 2];
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    if (i < STR_CNT) {
+      objs[i].set_varchar(ObString::make_string(strs[i]));
+      objs[i].set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    } else {
+      objs[i].set_int(ints[i - STR_CNT]);
+    }
+    rowkeys[i].get_rowkey().assign(&objs[i], 1);
+  }
+  rowkeys[KEY_CNT] = ObStoreRowkey::MIN_STORE_ROWKEY;
+  rowkeys[KEY_CNT + 1] = ObStoreRowkey::MAX_STORE_ROWKEY;
+  int64_t decided_cnt = 0;
+  for (int64_t i = 0; i < KEY_CNT + 2; ++i) {
+    for (int64_t j = 0; j < KEY_CNT + 2; ++j) {
+      const memtable::ObStoreRowkeyWrapper lhs(&rowkeys[i]);
+      const memtable::ObStoreRowkeyWrapper rhs(&rowkeys[j]);
+      int prefix_cmp = 0;
+      int full_cmp = 0;
+      if (memtable::ObStoreRowkeyWrapper::compare_prefix(lhs.get_prefix(), rhs.get_prefix(), prefix_cmp)) {
+        ++decided_cnt;
+        EXPECT_EQ(OB_SUCCESS, lhs.compare(rhs, full_cmp));
+        EXPECT_EQ(full_cmp < 0, prefix_cmp < 0);
+        EXPECT_NE(0, full_cmp);
+      }
+    }
+  }
+  EXPECT_LT(0, decided_cnt);
+}
+
 TEST(TestObQueryEngine, smoke_test)
 {
   static const int64_t R_COUNT = 6;
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/tx/ob_gts_source.h"
+#include "storage/tx/ob_ts_mgr.h"
+#undef private
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace transaction;
+namespace unittest
+{
+
+class MockObTsCbTask : public ObTsCbTask
+{
+public:
+  int gts_callback_interrupted(const int errcode) { UNUSED(errcode); return OB_SUCCESS; }
+  int get_gts_callback(const MonotonicTs srr, const SCN &gts, const MonotonicTs receive_gts_ts)
+  {
+    UNUSED(srr);
+    UNUSED(gts);
+    UNUSED(receive_gts_ts);
+    return OB_SUCCESS;
+  }
+  int gts_elapse_callback(const MonotonicTs srr, const SCN &gts)
+  {
+    UNUSED(srr);
+    UNUSED(gts);
+    return OB_SUCCESS;
+  }
+  MonotonicTs get_stc() const { return MonotonicTs(1); }
+  uint64_t hash() const { return 1; }
+  uint64_t get_tenant_id() const { return OB_SYS_TENANT_ID; }
+};
+
+class TestObGtsSource : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    // init the task queues without gts rpc and location adapter
+    for (int64_t i = 0; i < ObGtsSource::TOTAL_GTS_QUEUE_COUNT; i++) {
+      ASSERT_EQ(OB_SUCCESS, source_.queue_[i].init(i < ObGtsSource::WAIT_GTS_QUEUE_START_INDEX ? GET_GTS : WAIT_GTS_ELAPSING));
+    }
+    source_.tenant_id_ = OB_SYS_TENANT_ID;
+    source_.is_inited_ = true;
+  }
+  void wait_wakeup_interval()
+  {
+    usleep(2 * ObGtsSource::WAKEUP_WAIT_GTS_ELAPSE_INTERVAL_US);
+  }
+protected:
+  ObGtsSource source_;
+};
+
+TEST_F(TestObGtsSource, wakeup_only_with_waiters)
+{
+  MockObTsCbTask get_gts_task;
+  ASSERT_FALSE(source_.need_wakeup_wait_gts_elapse_tasks());
+  // the tasks waiting for gts rpc are not woken up by the gts of other servers
+  ASSERT_EQ(OB_SUCCESS, source_.queue_[0].push(&get_gts_task));
+  ASSERT_EQ(1, source_.get_task_count());
+  wait_wakeup_interval();
+  ASSERT_FALSE(source_.need_wakeup_wait_gts_elapse_tasks());
+
+  MockObTsCbTask wait_task;
+  ASSERT_EQ(OB_SUCCESS, source_.queue_[ObGtsSource::WAIT_GTS_QUEUE_START_INDEX].push(&wait_task));
+  // the interval is not consumed without waiters, so the first refresh wakes the waiter up
+  ASSERT_TRUE(source_.need_wakeup_wait_gts_elapse_tasks());
+  ObLink *link = NULL;
+  ASSERT_EQ(OB_SUCCESS, source_.queue_[ObGtsSource::WAIT_GTS_QUEUE_START_INDEX].queue_.pop(link));
+  ASSERT_EQ(&wait_task, link);
+  wait_wakeup_interval();
+  ASSERT_FALSE(source_.need_wakeup_wait_gts_elapse_tasks());
+}
+
+TEST_F(TestObGtsSource, wakeup_at_most_once_per_interval)
+{
+  MockObTsCbTask wait_task;
+  ASSERT_EQ(OB_SUCCESS, source_.queue_[ObGtsSource::WAIT_GTS_QUEUE_START_INDEX].push(&wait_task));
+  ASSERT_TRUE(source_.need_wakeup_wait_gts_elapse_tasks());
+  // a burst of messages within the interval only wakes the waiters up once
+  int64_t wakeup_count = 0;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < 100; i++) {
+    if (source_.need_wakeup_wait_gts_elapse_tasks()) {
+      wakeup_count++;
+    }
+  }
+  if (ObTimeUtility::current_time() - start_ts < ObGtsSource::WAKEUP_WAIT_GTS_ELAPSE_INTERVAL_US) {
+    ASSERT_EQ(0, wakeup_count);
+  }
+  wait_wakeup_interval();
+  ASSERT_TRUE(source_.need_wakeup_wait_gts_elapse_tasks());
+}
+
+TEST_F(TestObGtsSource, update_gts_by_other_servers)
+{
+  bool update = false;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, source_.update_gts(0, update));
+  ASSERT_EQ(OB_SUCCESS, source_.update_gts(100, update));
+  ASSERT_TRUE(update);
+  int64_t gts = 0;
+  ASSERT_EQ(OB_SUCCESS, source_.gts_local_cache_.get_gts(gts));
+  ASSERT_EQ(100, gts);
+  // an older gts piggybacked by other servers never moves the cache back
+  ASSERT_EQ(OB_SUCCESS, source_.update_gts(50, update));
+  ASSERT_FALSE(update);
+  ASSERT_EQ(OB_SUCCESS, source_.gts_local_cache_.get_gts(gts));
+  ASSERT_EQ(100, gts);
+  ASSERT_EQ(OB_SUCCESS, source_.update_gts(200, update));
+  ASSERT_TRUE(update);
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_source.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
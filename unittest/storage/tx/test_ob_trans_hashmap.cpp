@@ -12,6 +12,8 @@
 
 #include "storage/tx/ob_trans_hashmap.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
 #include "storage/tx/ob_trans_define.h"
@@ -209,6 +211,56 @@ TEST_F(TestObTrans, hashmap_init_invalid)
   EXPECT_EQ(0, map.count());
 }
 
+TEST_F(TestObTrans, hashmap_concurrent_insert_del_count)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  TestHashMap map;
+  EXPECT_EQ(OB_SUCCESS, map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans")));
+  const int64_t THREAD_CNT = 8;
+  const int64_t ROUND_CNT = 2000;
+  bool stop = false;
+  bool count_negative = false;
+  int64_t max_count = 0;
+
+  // every worker inserts a value and deletes it at once, while another thread keeps
+  // checking that the count never goes below 0 or beyond the number of living values
+  std::thread checker([&]() {
+    while (!ATOMIC_LOAD(&stop)) {
+      const int64_t count = map.count();
+      if (count < 0) {
+        ATOMIC_STORE(&count_negative, true);
+      } else if (count > max_count) {
+        max_count = count;
+      }
+    }
+  });
+  std::vector<std::thread> workers;
+  for (int64_t t = 0; t < THREAD_CNT; t++) {
+    workers.push_back(std::thread([&map, t]() {
+      for (int64_t i = 0; i < ROUND_CNT; i++) {
+        ObTransID trans_id(t * ROUND_CNT + i + 1);
+        ObTransTestValue *val = NULL;
+        ObTransTestValue *old = NULL;
+        EXPECT_EQ(OB_SUCCESS, map.alloc_value(val));
+        EXPECT_EQ(OB_SUCCESS, val->init(trans_id));
+        EXPECT_EQ(OB_SUCCESS, map.insert_and_get(trans_id, val, &old));
+        EXPECT_LT(0, map.count());
+        EXPECT_EQ(OB_SUCCESS, map.del(trans_id, val));
+        map.revert(val);
+      }
+    }));
+  }
+  for (int64_t t = 0; t < THREAD_CNT; t++) {
+    workers.at(t).join();
+  }
+  ATOMIC_STORE(&stop, true);
+  checker.join();
+  EXPECT_FALSE(count_negative);
+  EXPECT_GE(THREAD_CNT, max_count);
+  EXPECT_EQ(0, map.count());
+}
+
 }//end of unittest
 }//end of oceanbase
 
@@ -11,11 +11,16 @@
  */
 
 #define protected public
+#define private public
 #include "storage/tx/ob_tx_msg.h"
+#include "storage/tx/ob_trans_rpc.h"
+#include "storage/tx/ob_trans_service.h"
+#undef private
 #include <gtest/gtest.h>
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
 #include "common/ob_clock_generator.h"
+#include "share/config/ob_server_config.h"
 
 namespace oceanbase
 {
@@ -44,6 +49,56 @@ const char *TestObTxMsg::LOCAL_IP = "127.0.0.1";
 const share::ObLSID TestObTxMsg::VALID_LS_ID = share::ObLSID(1);
 const share::ObLSID TestObTxMsg::INVALID_LS_ID = share::ObLSID(-1);
 
+// gts cache of one server
+class MockObTsMgr : public ObITsMgr
+{
+public:
+  MockObTsMgr() : gts_(0), update_count_(0) {}
+  int update_gts(const uint64_t tenant_id, const int64_t gts, bool &update)
+  {
+    UNUSED(tenant_id);
+    update = gts > gts_;
+    if (update) {
+      gts_ = gts;
+    }
+    update_count_++;
+    return OB_SUCCESS;
+  }
+  int get_gts(const uint64_t tenant_id,
+              const MonotonicTs stc,
+              ObTsCbTask *task,
+              share::SCN &scn,
+              MonotonicTs &receive_gts_ts)
+  {
+    UNUSED(stc);
+    UNUSED(receive_gts_ts);
+    return get_gts(tenant_id, task, scn);
+  }
+  int get_gts(const uint64_t tenant_id, ObTsCbTask *task, share::SCN &scn)
+  {
+    UNUSED(tenant_id);
+    UNUSED(task);
+    int ret = OB_SUCCESS;
+    if (0 >= gts_) {
+      ret = OB_EAGAIN;
+    } else {
+      ret = scn.convert_for_gts(gts_);
+    }
+    return ret;
+  }
+  int get_ts_sync(const uint64_t tenant_id, const int64_t timeout_ts,
+                  share::SCN &scn, bool &is_external_consistent) { return OB_NOT_SUPPORTED; }
+  int wait_gts_elapse(const uint64_t tenant_id, const share::SCN &scn, ObTsCbTask *task,
+                      bool &need_wait) { return OB_NOT_SUPPORTED; }
+  int wait_gts_elapse(const uint64_t tenant_id, const share::SCN &scn) { return OB_NOT_SUPPORTED; }
+  bool is_external_consistent(const uint64_t tenant_id) { return true; }
+  int64_t gts_;
+  int64_t update_count_;
+};
+
+transaction::ObTransService sender_txs;
+transaction::ObTransService receiver_txs;
+
 class MockObTxDesc
 {
 public:
@@ -336,6 +391,7 @@ TEST_F(TestObTxMsg, trans_commit_resp_msg)
   MockObTxDesc tx;
   ObTxCommitRespMsg msg;
   tx.build_tx_commit_resp_msg(msg);
+  msg.gts_ = 100;
   ASSERT_TRUE(msg.is_valid());
 
   // test the serialization of ObTransMsg
@@ -361,6 +417,61 @@ TEST_F(TestObTxMsg, trans_commit_resp_msg)
   EXPECT_EQ(msg.cluster_id_, msg1.cluster_id_);
   EXPECT_EQ(msg.ret_, msg1.ret_);
   EXPECT_EQ(msg.commit_version_, msg1.commit_version_);
+  EXPECT_EQ(msg.get_gts(), msg1.get_gts());
+}
+
+TEST_F(TestObTxMsg, piggyback_gts)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  MockObTsMgr sender_ts_mgr;
+  MockObTsMgr receiver_ts_mgr;
+  sender_txs.ts_mgr_ = &sender_ts_mgr;
+  receiver_txs.ts_mgr_ = &receiver_ts_mgr;
+  ObTransRpc trans_rpc;
+  trans_rpc.trans_service_ = &sender_txs;
+  GCONF.cluster_id = 1;
+
+  MockObTxDesc tx;
+  ObTxCommitRespMsg msg;
+  tx.build_tx_commit_resp_msg(msg);
+  // nothing is piggybacked if the sender has no gts cached
+  trans_rpc.fill_gts_(msg);
+  EXPECT_EQ(0, msg.get_gts());
+  sender_ts_mgr.gts_ = 1000;
+  trans_rpc.fill_gts_(msg);
+  EXPECT_EQ(1000, msg.get_gts());
+
+  int64_t pos = 0;
+  const int64_t BUFFER_SIZE = 10240;
+  char buffer[BUFFER_SIZE];
+  ASSERT_EQ(OB_SUCCESS, msg.serialize(buffer, BUFFER_SIZE, pos));
+  ObTxCommitRespMsg msg1;
+  int64_t start_index = 0;
+  ASSERT_EQ(OB_SUCCESS, msg1.deserialize(buffer, pos, start_index));
+
+  // the receiver refreshes its gts cache by the msg
+  receiver_txs.refresh_gts_by_msg(msg1);
+  EXPECT_EQ(1000, receiver_ts_mgr.gts_);
+  EXPECT_EQ(1, receiver_ts_mgr.update_count_);
+  // the gts of other cluster is ignored
+  msg1.cluster_id_ = 2;
+  msg1.gts_ = 2000;
+  receiver_txs.refresh_gts_by_msg(msg1);
+  EXPECT_EQ(1000, receiver_ts_mgr.gts_);
+  EXPECT_EQ(1, receiver_ts_mgr.update_count_);
+  // msg from old version carries no gts
+  msg1.cluster_id_ = 1;
+  msg1.gts_ = 0;
+  receiver_txs.refresh_gts_by_msg(msg1);
+  EXPECT_EQ(1, receiver_ts_mgr.update_count_);
+  // an older gts never moves the cache back
+  msg1.gts_ = 500;
+  receiver_txs.refresh_gts_by_msg(msg1);
+  EXPECT_EQ(2, receiver_ts_mgr.update_count_);
+  EXPECT_EQ(1000, receiver_ts_mgr.gts_);
+  sender_txs.ts_mgr_ = NULL;
+  receiver_txs.ts_mgr_ = NULL;
 }
 
 TEST_F(TestObTxMsg, trans_abort_msg)
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+
+#include "storage/tx_table/ob_tx_data_result_cache.h"
+#include "storage/tx_table/ob_tx_table.h"
+#include "storage/tx_table/ob_tx_data_cache.h"
+#include "storage/tx/ob_trans_ctx_mgr.h"
+#include "storage/ls/ob_ls.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace transaction;
+using namespace share;
+
+namespace storage
+{
+
+class MockCheckFunctor : public ObITxDataCheckFunctor
+{
+public:
+  MockCheckFunctor(const bool recheck_ret)
+    : recheck_ret_(recheck_ret), call_cnt_(0), recheck_cnt_(0) {}
+  virtual int operator()(const ObTxData &tx_data, ObTxCCCtx *tx_cc_ctx = nullptr) override
+  {
+    UNUSED(tx_data);
+    UNUSED(tx_cc_ctx);
+    call_cnt_++;
+    return OB_SUCCESS;
+  }
+  virtual bool recheck() override
+  {
+    recheck_cnt_++;
+    return recheck_ret_;
+  }
+  bool recheck_ret_;
+  int64_t call_cnt_;
+  int64_t recheck_cnt_;
+};
+
+class TestTxDataResultCache : public ::testing::Test
+{
+public:
+  static const int64_t EPOCH = 1;
+  // lookups of the tx ctx table and tx data table, the tx is not exist in both of them
+  static int64_t ctx_table_read_cnt_;
+  static int64_t data_table_read_cnt_;
+  void make_tx_data(const int64_t tx_id, const int32_t state, ObTxCommitData &tx_data)
+  {
+    tx_data.reset();
+    tx_data.tx_id_ = ObTransID(tx_id);
+    tx_data.state_ = state;
+    tx_data.commit_version_.convert_for_tx(tx_id * 10);
+    tx_data.start_scn_.convert_for_tx(tx_id);
+    tx_data.end_scn_.convert_for_tx(tx_id * 10);
+  }
+};
+
+int64_t TestTxDataResultCache::ctx_table_read_cnt_ = 0;
+int64_t TestTxDataResultCache::data_table_read_cnt_ = 0;
+
+int ObTxDataTable::check_with_tx_data(const ObTransID tx_id,
+                                      ObITxDataCheckFunctor &fn,
+                                      ObTxDataGuard &tx_data_guard)
+{
+  UNUSED(tx_id);
+  UNUSED(fn);
+  UNUSED(tx_data_guard);
+  TestTxDataResultCache::data_table_read_cnt_++;
+  return OB_ITER_END;
+}
+
+int ObTxDataKVCache::get_row(const ObTxDataCacheKey &key, ObTxDataValueHandle &val_handle)
+{
+  UNUSED(key);
+  UNUSED(val_handle);
+  return OB_ENTRY_NOT_EXIST;
+}
+
+} // namespace storage
+
+namespace transaction
+{
+int ObLSTxCtxMgr::check_with_tx_data(const ObTransID& tx_id, ObITxDataCheckFunctor &fn)
+{
+  UNUSED(tx_id);
+  UNUSED(fn);
+  storage::TestTxDataResultCache::ctx_table_read_cnt_++;
+  return OB_TRANS_CTX_NOT_EXIST;
+}
+} // namespace transaction
+
+namespace storage
+{
+
+TEST_F(TestTxDataResultCache, test_get_and_set)
+{
+  ObTxDataResultCache *cache = new ObTxDataResultCache();
+  ObTxCommitData tx_data;
+  ObTxCommitData out_tx_data;
+
+  // miss before set, and the slots are not allocated yet
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(100), EPOCH, out_tx_data));
+  ASSERT_FALSE(cache->is_allocated());
+
+  // running tx data is never cached
+  make_tx_data(100, ObTxCommitData::RUNNING, tx_data);
+  cache->set(tx_data, EPOCH);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(100), EPOCH, out_tx_data));
+  ASSERT_FALSE(cache->is_allocated());
+
+  make_tx_data(100, ObTxCommitData::COMMIT, tx_data);
+  cache->set(tx_data, EPOCH);
+  ASSERT_TRUE(cache->is_allocated());
+  ASSERT_EQ(OB_SUCCESS, cache->get(ObTransID(100), EPOCH, out_tx_data));
+  ASSERT_EQ(tx_data.tx_id_, out_tx_data.tx_id_);
+  ASSERT_EQ(tx_data.state_, out_tx_data.state_);
+  ASSERT_EQ(tx_data.commit_version_, out_tx_data.commit_version_);
+  // results of another epoch are never hit
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(100), EPOCH + 1, out_tx_data));
+
+  // a range of tx ids never evict each other
+  for (int64_t tx_id = 101; tx_id < 100 + ObTxDataResultCache::SLOT_CNT; tx_id++) {
+    make_tx_data(tx_id, ObTxCommitData::ABORT, tx_data);
+    cache->set(tx_data, EPOCH);
+  }
+  ASSERT_EQ(OB_SUCCESS, cache->get(ObTransID(100), EPOCH, out_tx_data));
+  ASSERT_EQ(ObTxCommitData::COMMIT, out_tx_data.state_);
+  ASSERT_EQ(OB_SUCCESS, cache->get(ObTransID(101), EPOCH, out_tx_data));
+  ASSERT_EQ(ObTxCommitData::ABORT, out_tx_data.state_);
+
+  // tx id of the same slot replaces the old one
+  make_tx_data(100 + ObTxDataResultCache::SLOT_CNT, ObTxCommitData::COMMIT, tx_data);
+  cache->set(tx_data, EPOCH);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(100), EPOCH, out_tx_data));
+  ASSERT_EQ(OB_SUCCESS, cache->get(ObTransID(100 + ObTxDataResultCache::SLOT_CNT), EPOCH, out_tx_data));
+
+  // reset keeps the slots for the concurrent readers
+  cache->reset();
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(101), EPOCH, out_tx_data));
+  ASSERT_TRUE(cache->is_allocated());
+
+  cache->destroy();
+  ASSERT_FALSE(cache->is_allocated());
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(101), EPOCH, out_tx_data));
+  delete cache;
+}
+
+TEST_F(TestTxDataResultCache, test_not_exist)
+{
+  ObTxDataResultCache *cache = new ObTxDataResultCache();
+  ObTxCommitData tx_data;
+  ObTxCommitData out_tx_data;
+
+  cache->set_not_exist(ObTransID(200), EPOCH);
+  ASSERT_EQ(OB_TRANS_CTX_NOT_EXIST, cache->get(ObTransID(200), EPOCH, out_tx_data));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache->get(ObTransID(200), EPOCH + 1, out_tx_data));
+
+  // the negative result is replaced by a decided tx data
+  make_tx_data(200, ObTxCommitData::ABORT, tx_data);
+  cache->set(tx_data, EPOCH);
+  ASSERT_EQ(OB_SUCCESS, cache->get(ObTransID(200), EPOCH, out_tx_data));
+  ASSERT_EQ(ObTxCommitData::ABORT, out_tx_data.state_);
+  delete cache;
+}
+
+TEST_F(TestTxDataResultCache, test_check_with_tx_data_not_exist)
+{
+  ObLS ls;
+  ObTxTable tx_table;
+  static ObLSTxCtxMgr ls_tx_ctx_mgr;
+  ObTxDataMiniCache mini_cache;
+  ObTxCommitData out_tx_data;
+  const ObTransID tx_id(300);
+  tx_table.is_inited_ = true;
+  tx_table.epoch_ = EPOCH;
+  tx_table.state_ = ObTxTable::ONLINE;
+  tx_table.ls_ = &ls;
+  tx_table.tx_ctx_table_.ls_tx_ctx_mgr_ = &ls_tx_ctx_mgr;
+  ctx_table_read_cnt_ = 0;
+  data_table_read_cnt_ = 0;
+
+  // 1. the tx is not exist in both tables, and it is cached as not exist
+  {
+    ObReadTxDataArg arg(tx_id, EPOCH, mini_cache);
+    MockCheckFunctor fn(false);
+    ASSERT_EQ(OB_TRANS_CTX_NOT_EXIST, tx_table.check_with_tx_data(arg, fn));
+    ASSERT_EQ(1, fn.recheck_cnt_);
+    ASSERT_EQ(1, ctx_table_read_cnt_);
+    ASSERT_EQ(1, data_table_read_cnt_);
+    ASSERT_EQ(OB_TRANS_CTX_NOT_EXIST, tx_table.result_cache_.get(tx_id, EPOCH, out_tx_data));
+  }
+
+  // 2. the reader which decides the state by recheck succeeds like reading the tx ctx table,
+  // without any lookup of the tables
+  {
+    ObReadTxDataArg arg(tx_id, EPOCH, mini_cache);
+    MockCheckFunctor fn(true);
+    ASSERT_EQ(OB_SUCCESS, tx_table.check_with_tx_data(arg, fn));
+    ASSERT_EQ(1, fn.recheck_cnt_);
+    ASSERT_EQ(0, fn.call_cnt_);
+    ASSERT_EQ(1, ctx_table_read_cnt_);
+    ASSERT_EQ(1, data_table_read_cnt_);
+  }
+
+  // 3. the negative result is a miss for the reader whose recheck fails, the tables decide
+  {
+    ObReadTxDataArg arg(tx_id, EPOCH, mini_cache);
+    MockCheckFunctor fn(false);
+    ASSERT_EQ(OB_TRANS_CTX_NOT_EXIST, tx_table.check_with_tx_data(arg, fn));
+    // by the result cache and the tx ctx table
+    ASSERT_EQ(2, fn.recheck_cnt_);
+    ASSERT_EQ(2, ctx_table_read_cnt_);
+    ASSERT_EQ(2, data_table_read_cnt_);
+  }
+
+  // 4. the negative result of another epoch is never hit
+  {
+    tx_table.epoch_ = EPOCH + 1;
+    ObReadTxDataArg arg(tx_id, EPOCH + 1, mini_cache);
+    MockCheckFunctor fn(true);
+    ASSERT_EQ(OB_SUCCESS, tx_table.check_with_tx_data(arg, fn));
+    ASSERT_EQ(1, fn.recheck_cnt_);
+    ASSERT_EQ(3, ctx_table_read_cnt_);
+    ASSERT_EQ(2, data_table_read_cnt_);
+  }
+
+  tx_table.tx_ctx_table_.ls_tx_ctx_mgr_ = nullptr;
+  tx_table.ls_ = nullptr;
+  tx_table.is_inited_ = false;
+}
+
+} // namespace storage
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_tx_data_result_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_data_result_cache.log");
+  OB_LOGGER.set_log_level("INFO");
+  STORAGE_LOG(INFO, "begin unittest: test tx data result cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}